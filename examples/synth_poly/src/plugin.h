@@ -55,7 +55,9 @@ typedef struct {
 	bw_env_gen_state	vca_env_gen_state;
 
 	unsigned char		note;
+	unsigned char		note_prev;
 	char			gate;
+	char			fresh;
 	float			mod_k;
 	float			vcf_env_k;
 	
@@ -122,6 +124,10 @@ typedef struct plugin {
 
 	float			buf[BUFFER_SIZE];
 
+	// only active voices, see plugin_process()
+	voice *			voices_active[N_VOICES];
+	size_t			n_voices_active;
+	char			gates[N_VOICES];
 	float *			b0[N_VOICES];
 	float *			b1[N_VOICES];
 	float *			b2[N_VOICES];
@@ -171,19 +177,6 @@ static void plugin_init(plugin *instance, plugin_callbacks *cbs) {
 	bw_phase_gen_set_frequency(&instance->a440_phase_gen_coeffs, 440.f);
 	
 	instance->rand_state = 0xbaddecaf600dfeed;
-
-	for (int i = 0; i < N_VOICES; i++) {
-		instance->b0[i] = instance->voices[i].buf[0];
-		instance->b1[i] = instance->voices[i].buf[1];
-		instance->b2[i] = instance->voices[i].buf[2];
-		instance->b3[i] = instance->voices[i].buf[3];
-		instance->b4[i] = instance->voices[i].buf[4];
-		instance->osc_filt_states[i] = &instance->voices[i].osc_filt_state;
-		instance->pink_filt_states[i] = &instance->voices[i].pink_filt_state;
-		instance->vcf_env_gen_states[i] = &instance->voices[i].vcf_env_gen_state;
-		instance->vca_env_gen_states[i] = &instance->voices[i].vca_env_gen_state;
-	}
-
 }
 
 static void plugin_fini(plugin *instance) {
@@ -277,7 +270,9 @@ static void plugin_reset(plugin *instance) {
 		bw_env_gen_reset_state(&instance->vca_env_gen_coeffs, &instance->voices[i].vca_env_gen_state, 0.f);
 		
 		instance->voices[i].note = 60;
+		instance->voices[i].note_prev = 60;
 		instance->voices[i].gate = 0;
+		instance->voices[i].fresh = 0;
 	}
 	instance->pitch_bend = 0.f;
 	instance->mod_wheel = 0.f;
@@ -450,9 +445,23 @@ static float plugin_get_parameter(plugin *instance, size_t index) {
 	return bw_clipf(bw_ppm_get_y_z1(&instance->ppm_state), -60.f, 0.f);
 }
 
+static char is_free(const void *BW_RESTRICT handle) {
+	voice *v = (voice *)handle;
+	bw_env_gen_phase phase = bw_env_gen_get_phase(&v->vca_env_gen_state);
+	return !v->gate && phase == bw_env_gen_phase_off;
+}
+
+// Free voices are not processed (see update_voices_active()), hence their
+// smoothers and filter states are stale when they are allocated again. These
+// are reset in plugin_process() once target values are known.
 static void note_on(void *BW_RESTRICT handle, unsigned char note, float velocity) {
 	(void)velocity;
 	voice *v = (voice *)handle;
+	if (is_free(v)) {
+		bw_osc_filt_reset_state(&v->osc_filt_state, 0.f);
+		v->note_prev = v->note;
+		v->fresh = 1;
+	}
 	v->note = note;
 	v->gate = 1;
 }
@@ -468,10 +477,38 @@ static unsigned char get_note(const void *BW_RESTRICT handle) {
 	return v->note;
 }
 
-static char is_free(const void *BW_RESTRICT handle) {
-	voice *v = (voice *)handle;
-	bw_env_gen_phase phase = bw_env_gen_get_phase(&v->vca_env_gen_state);
-	return !v->gate && phase == bw_env_gen_phase_off;
+// Only voices that are not free are processed, and all *_process_multi()
+// calls get compacted arrays containing just those, so that idle voices
+// cost nothing. Voice order is preserved, hence nothing changes for
+// voices that are active across consecutive calls.
+static void update_voices_active(plugin *instance) {
+	size_t n = 0;
+	for (int i = 0; i < N_VOICES; i++) {
+		voice *v = instance->voices + i;
+		if (is_free(v))
+			continue;
+		instance->voices_active[n] = v;
+		instance->gates[n] = v->gate;
+		instance->b0[n] = v->buf[0];
+		instance->b1[n] = v->buf[1];
+		instance->b2[n] = v->buf[2];
+		instance->b3[n] = v->buf[3];
+		instance->b4[n] = v->buf[4];
+		instance->osc_filt_states[n] = &v->osc_filt_state;
+		instance->pink_filt_states[n] = &v->pink_filt_state;
+		instance->vcf_env_gen_states[n] = &v->vcf_env_gen_state;
+		instance->vca_env_gen_states[n] = &v->vca_env_gen_state;
+		n++;
+	}
+	instance->n_voices_active = n;
+}
+
+static void set_vco_frequencies(plugin *instance, voice *v, int note, float df1, float df2, float df3) {
+	int n = note - 69;
+	int n3 = instance->vco3_kbd_ctrl ? n : -69;
+	bw_phase_gen_set_frequency(&v->vco1_phase_gen_coeffs, instance->master_tune * bw_pow2f(df1 + 8.333333333333333e-2f * n));
+	bw_phase_gen_set_frequency(&v->vco2_phase_gen_coeffs, instance->master_tune * bw_pow2f(df2 + 8.333333333333333e-2f * n));
+	bw_phase_gen_set_frequency(&v->vco3_phase_gen_coeffs, instance->master_tune * bw_pow2f(df3 + 8.333333333333333e-2f * n3));
 }
 
 static void plugin_process(plugin *instance, const float **inputs, float **outputs, size_t n_samples) {
@@ -485,18 +522,31 @@ static void plugin_process(plugin *instance, const float **inputs, float **outpu
 		voices[i] = (void *)(instance->voices + i);
 	bw_voice_alloc(&alloc_opts, &instance->note_queue, voices, N_VOICES);
 	bw_note_queue_clear(&instance->note_queue);
+
+	update_voices_active(instance);
+	voice **va = instance->voices_active;
+	const size_t n_va = instance->n_voices_active;
 	
 	// asynchronous control-rate operations
 	
 	const float df1 = instance->vco1_coarse + instance->pitch_bend + (8.333333333333333e-2f * 0.01f) * instance->vco1_fine;
 	const float df2 = instance->vco2_coarse + instance->pitch_bend + (8.333333333333333e-2f * 0.01f) * instance->vco2_fine;
 	const float df3 = instance->vco3_coarse + instance->pitch_bend + (8.333333333333333e-2f * 0.01f) * instance->vco3_fine;
-	for (int i = 0; i < N_VOICES; i++) {
-		int n = instance->voices[i].note - 69;
-		int n3 = instance->vco3_kbd_ctrl ? n : -69;
-		bw_phase_gen_set_frequency(&instance->voices[i].vco1_phase_gen_coeffs, instance->master_tune * bw_pow2f(df1 + 8.333333333333333e-2f * n));
-		bw_phase_gen_set_frequency(&instance->voices[i].vco2_phase_gen_coeffs, instance->master_tune * bw_pow2f(df2 + 8.333333333333333e-2f * n));
-		bw_phase_gen_set_frequency(&instance->voices[i].vco3_phase_gen_coeffs, instance->master_tune * bw_pow2f(df3 + 8.333333333333333e-2f * n3));
+	for (size_t i = 0; i < n_va; i++) {
+		voice *v = va[i];
+		if (v->fresh) {
+			// portamento starts from the previous note of the voice, as if
+			// the voice had kept running while free
+			set_vco_frequencies(instance, v, v->note_prev, df1, df2, df3);
+			bw_phase_gen_reset_coeffs(&v->vco1_phase_gen_coeffs);
+			bw_phase_gen_reset_coeffs(&v->vco2_phase_gen_coeffs);
+			bw_phase_gen_reset_coeffs(&v->vco3_phase_gen_coeffs);
+			float p, pi;
+			bw_phase_gen_reset_state(&v->vco1_phase_gen_coeffs, &v->vco1_phase_gen_state, 0.f, &p, &pi);
+			bw_phase_gen_reset_state(&v->vco2_phase_gen_coeffs, &v->vco2_phase_gen_state, 0.f, &p, &pi);
+			bw_phase_gen_reset_state(&v->vco3_phase_gen_coeffs, &v->vco3_phase_gen_state, 0.f, &p, &pi);
+		}
+		set_vco_frequencies(instance, v, v->note, df1, df2, df3);
 	}
 
 	if (instance->vco3_waveform_cur != instance->vco3_waveform) {
@@ -543,15 +593,11 @@ static void plugin_process(plugin *instance, const float **inputs, float **outpu
 		8.333333333333333e-2f // full
 	};
 	float cutoff_kbd_k[N_VOICES];
-	for (int i = 0; i < N_VOICES; i++)
-		cutoff_kbd_k[i] = bw_pow2f(cutoff_kbd_kv[instance->vcf_kbd_ctrl - 1] * (instance->voices[i].note - 60));
+	for (size_t i = 0; i < n_va; i++)
+		cutoff_kbd_k[i] = bw_pow2f(cutoff_kbd_kv[instance->vcf_kbd_ctrl - 1] * (va[i]->note - 60));
 
 	const float noise_k = instance->noise_kv[instance->noise_color - 1];
 
-	char gates[N_VOICES];
-	for (int i = 0; i < N_VOICES; i++)
-		gates[i] = instance->voices[i].gate;
-
 	// synchronous control-rate and audio-rate operations
 
 	for (size_t i = 0; i < n_samples; ) {
@@ -564,113 +610,119 @@ static void plugin_process(plugin *instance, const float **inputs, float **outpu
 
 		// vco 3
 
-		for (int j = 0; j < N_VOICES; j++)
-			bw_phase_gen_process(&instance->voices[j].vco3_phase_gen_coeffs, &instance->voices[j].vco3_phase_gen_state, NULL, instance->b0[j], instance->b1[j], n);
+		for (size_t j = 0; j < n_va; j++)
+			bw_phase_gen_process(&va[j]->vco3_phase_gen_coeffs, &va[j]->vco3_phase_gen_state, NULL, instance->b0[j], instance->b1[j], n);
 		switch (instance->vco3_waveform_cur) {
 		case 1:
-			bw_osc_saw_process_multi(&instance->vco_saw_coeffs, (const float **)instance->b0, (const float **)instance->b1, instance->b0, N_VOICES, n);
+			bw_osc_saw_process_multi(&instance->vco_saw_coeffs, (const float **)instance->b0, (const float **)instance->b1, instance->b0, n_va, n);
 			break;
 		case 2:
-			bw_osc_pulse_process_multi(&instance->vco3_pulse_coeffs, (const float **)instance->b0, (const float **)instance->b1, instance->b0, N_VOICES, n);
+			bw_osc_pulse_process_multi(&instance->vco3_pulse_coeffs, (const float **)instance->b0, (const float **)instance->b1, instance->b0, n_va, n);
 			break;
 		default:
-			bw_osc_tri_process_multi(&instance->vco3_tri_coeffs, (const float **)instance->b0, (const float **)instance->b1, instance->b0, N_VOICES, n);
+			bw_osc_tri_process_multi(&instance->vco3_tri_coeffs, (const float **)instance->b0, (const float **)instance->b1, instance->b0, n_va, n);
 			break;
 		}
 
 		// noise generator
 		
-		bw_noise_gen_process_multi(&instance->noise_gen_coeffs, instance->b1, N_VOICES, n);
+		bw_noise_gen_process_multi(&instance->noise_gen_coeffs, instance->b1, n_va, n);
 		if (instance->noise_color == 2)
-			bw_pink_filt_process_multi(&instance->pink_filt_coeffs, instance->pink_filt_states, (const float **)instance->b1, instance->b1, N_VOICES, n);
+			bw_pink_filt_process_multi(&instance->pink_filt_coeffs, instance->pink_filt_states, (const float **)instance->b1, instance->b1, n_va, n);
 			// no need to ever reset pink filt, as inputs are noise and filters are static
-		bw_buf_scale_multi((const float * const *)instance->b1, 5.f, instance->b1, N_VOICES, n);
+		bw_buf_scale_multi((const float * const *)instance->b1, 5.f, instance->b1, n_va, n);
 
 		// modulation signals
 
-		for (int j = 0; j < N_VOICES; j++) {
+		for (size_t j = 0; j < n_va; j++) {
 			for (size_t k = 0; k < n; k++)
 				instance->b2[j][k] = instance->mod_wheel * (instance->b0[j][k] + instance->modulation_mix * (instance->b1[j][k] - instance->b0[j][k]));
 		}
-		if (sync)
-			for (int j = 0; j < N_VOICES; j++)
-				instance->voices[j].mod_k = instance->b2[j][0];
+		for (size_t j = 0; j < n_va; j++)
+			if (sync || va[j]->fresh)
+				va[j]->mod_k = instance->b2[j][0];
 
 		// vco 1
 
-		for (int j = 0; j < N_VOICES; j++) {
+		for (size_t j = 0; j < n_va; j++) {
 			bw_buf_scale(instance->b2[j], instance->vco1_modulation, instance->b3[j], n);
-			bw_phase_gen_process(&instance->voices[j].vco1_phase_gen_coeffs, &instance->voices[j].vco1_phase_gen_state, instance->b3[j], instance->b3[j], instance->b4[j], n);
+			bw_phase_gen_process(&va[j]->vco1_phase_gen_coeffs, &va[j]->vco1_phase_gen_state, instance->b3[j], instance->b3[j], instance->b4[j], n);
 		}
 		switch (instance->vco1_waveform_cur) {
 		case 1:
-			bw_osc_saw_process_multi(&instance->vco_saw_coeffs, (const float **)instance->b3, (const float **)instance->b4, instance->b3, N_VOICES, n);
+			bw_osc_saw_process_multi(&instance->vco_saw_coeffs, (const float **)instance->b3, (const float **)instance->b4, instance->b3, n_va, n);
 			break;
 		case 2:
-			bw_osc_pulse_process_multi(&instance->vco1_pulse_coeffs, (const float **)instance->b3, (const float **)instance->b4, instance->b3, N_VOICES, n);
+			bw_osc_pulse_process_multi(&instance->vco1_pulse_coeffs, (const float **)instance->b3, (const float **)instance->b4, instance->b3, n_va, n);
 			break;
 		default:
-			bw_osc_tri_process_multi(&instance->vco1_tri_coeffs, (const float **)instance->b3, (const float **)instance->b4, instance->b3, N_VOICES, n);
+			bw_osc_tri_process_multi(&instance->vco1_tri_coeffs, (const float **)instance->b3, (const float **)instance->b4, instance->b3, n_va, n);
 			break;
 		}
 
 		// vco 2
 
-		for (int j = 0; j < N_VOICES; j++) {
+		for (size_t j = 0; j < n_va; j++) {
 			bw_buf_scale(instance->b2[j], instance->vco2_modulation, instance->b2[j], n);
-			bw_phase_gen_process(&instance->voices[j].vco2_phase_gen_coeffs, &instance->voices[j].vco2_phase_gen_state, instance->b2[j], instance->b2[j], instance->b4[j], n);
+			bw_phase_gen_process(&va[j]->vco2_phase_gen_coeffs, &va[j]->vco2_phase_gen_state, instance->b2[j], instance->b2[j], instance->b4[j], n);
 		}
 		switch (instance->vco2_waveform_cur) {
 		case 1:
-			bw_osc_saw_process_multi(&instance->vco_saw_coeffs, (const float **)instance->b2, (const float **)instance->b4, instance->b2, N_VOICES, n);
+			bw_osc_saw_process_multi(&instance->vco_saw_coeffs, (const float **)instance->b2, (const float **)instance->b4, instance->b2, n_va, n);
 			break;
 		case 2:
-			bw_osc_pulse_process_multi(&instance->vco2_pulse_coeffs, (const float **)instance->b2, (const float **)instance->b4, instance->b2, N_VOICES, n);
+			bw_osc_pulse_process_multi(&instance->vco2_pulse_coeffs, (const float **)instance->b2, (const float **)instance->b4, instance->b2, n_va, n);
 			break;
 		default:
-			bw_osc_tri_process_multi(&instance->vco2_tri_coeffs, (const float **)instance->b2, (const float **)instance->b4, instance->b2, N_VOICES, n);
+			bw_osc_tri_process_multi(&instance->vco2_tri_coeffs, (const float **)instance->b2, (const float **)instance->b4, instance->b2, n_va, n);
 			break;
 		}
 
 		// mixer
 
-		bw_gain_process_multi(&instance->vco1_gain_coeffs, (const float **)instance->b3, instance->b3, N_VOICES, n);
-		bw_gain_process_multi(&instance->vco2_gain_coeffs, (const float **)instance->b2, instance->b2, N_VOICES, n);
-		bw_gain_process_multi(&instance->vco3_gain_coeffs, (const float **)instance->b0, instance->b0, N_VOICES, n);
-		bw_gain_process_multi(&instance->noise_gain_coeffs, (const float **)instance->b1, instance->b1, N_VOICES, n);
-		bw_buf_mix_multi((const float * const *)instance->b0, (const float * const *)instance->b2, instance->b0, N_VOICES, n);
-		bw_buf_mix_multi((const float * const *)instance->b0, (const float * const *)instance->b3, instance->b0, N_VOICES, n);
+		bw_gain_process_multi(&instance->vco1_gain_coeffs, (const float **)instance->b3, instance->b3, n_va, n);
+		bw_gain_process_multi(&instance->vco2_gain_coeffs, (const float **)instance->b2, instance->b2, n_va, n);
+		bw_gain_process_multi(&instance->vco3_gain_coeffs, (const float **)instance->b0, instance->b0, n_va, n);
+		bw_gain_process_multi(&instance->noise_gain_coeffs, (const float **)instance->b1, instance->b1, n_va, n);
+		bw_buf_mix_multi((const float * const *)instance->b0, (const float * const *)instance->b2, instance->b0, n_va, n);
+		bw_buf_mix_multi((const float * const *)instance->b0, (const float * const *)instance->b3, instance->b0, n_va, n);
 
-		bw_osc_filt_process_multi(instance->osc_filt_states, (const float **)instance->b0, instance->b0, N_VOICES, n);
+		bw_osc_filt_process_multi(instance->osc_filt_states, (const float **)instance->b0, instance->b0, n_va, n);
 
-		bw_buf_scale_multi((const float * const *)instance->b1, noise_k, instance->b1, N_VOICES, n);
-		bw_buf_mix_multi((const float * const *)instance->b0, (const float * const *)instance->b1, instance->b0, N_VOICES, n);
+		bw_buf_scale_multi((const float * const *)instance->b1, noise_k, instance->b1, n_va, n);
+		bw_buf_mix_multi((const float * const *)instance->b0, (const float * const *)instance->b1, instance->b0, n_va, n);
 
 		// vcf
 
-		bw_env_gen_process_multi(&instance->vcf_env_gen_coeffs, instance->vcf_env_gen_states, gates, NULL, N_VOICES, n);
-		if (sync)
-			for (int j = 0; j < N_VOICES; j++) {
-				instance->voices[j].vcf_env_k = bw_env_gen_get_y_z1(instance->vcf_env_gen_states[j]);
+		bw_env_gen_process_multi(&instance->vcf_env_gen_coeffs, instance->vcf_env_gen_states, instance->gates, NULL, n_va, n);
+		for (size_t j = 0; j < n_va; j++)
+			if (sync || va[j]->fresh) {
+				va[j]->vcf_env_k = bw_env_gen_get_y_z1(instance->vcf_env_gen_states[j]);
 				const float cutoff_vpos =
 					cutoff_unmapped
-					+ instance->vcf_contour * instance->voices[j].vcf_env_k
-					+ 0.3f * instance->vcf_modulation * instance->voices[j].mod_k;
+					+ instance->vcf_contour * va[j]->vcf_env_k
+					+ 0.3f * instance->vcf_modulation * va[j]->mod_k;
 				float cutoff = cutoff_kbd_k[j] * 20.f * bw_expf(6.907755278982137 * cutoff_vpos);
-				bw_svf_set_cutoff(&instance->voices[j].vcf_coeffs, bw_clipf(cutoff, 20.f, 20e3f));
+				bw_svf_set_cutoff(&va[j]->vcf_coeffs, bw_clipf(cutoff, 20.f, 20e3f));
+				if (va[j]->fresh) {
+					bw_svf_reset_coeffs(&va[j]->vcf_coeffs);
+					float lp, bp, hp;
+					bw_svf_reset_state(&va[j]->vcf_coeffs, &va[j]->vcf_state, 0.f, &lp, &bp, &hp);
+					va[j]->fresh = 0;
+				}
 			}
-		for (int j = 0; j < N_VOICES; j++)
-			bw_svf_process(&instance->voices[j].vcf_coeffs, &instance->voices[j].vcf_state, instance->b0[j], instance->b0[j], NULL, NULL, n);
+		for (size_t j = 0; j < n_va; j++)
+			bw_svf_process(&va[j]->vcf_coeffs, &va[j]->vcf_state, instance->b0[j], instance->b0[j], NULL, NULL, n);
 
 		// vca
 
-		bw_env_gen_process_multi(&instance->vca_env_gen_coeffs, instance->vca_env_gen_states, gates, instance->b1, N_VOICES, n);
-		bw_buf_mul_multi((const float * const *)instance->b0, (const float * const *)instance->b1, instance->b0, N_VOICES, n);
+		bw_env_gen_process_multi(&instance->vca_env_gen_coeffs, instance->vca_env_gen_states, instance->gates, instance->b1, n_va, n);
+		bw_buf_mul_multi((const float * const *)instance->b0, (const float * const *)instance->b1, instance->b0, n_va, n);
 
 		// mix voices
 
 		bw_buf_fill(0.f, out, n);
-		for (int j = 0; j < N_VOICES; j++)
+		for (size_t j = 0; j < n_va; j++)
 			bw_buf_mix(out, instance->b0[j], out, n);
 
 		// A 440 Hz osc
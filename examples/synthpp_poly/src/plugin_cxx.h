@@ -41,45 +41,46 @@ using namespace Brickworks;
 #define SYNC_RATE	1e-3f	// synchronous control rate, seconds
 #define N_VOICES	8
 
-typedef struct plugin plugin;
-
+// Each voice owns its DSP objects, as opposed to using N_VOICES-channel
+// objects, so that idle voices can be skipped altogether in
+// plugin_process(). Since parameter smoothing does not advance while a voice
+// is idle, smoothers are reset when the voice is allocated again (see
+// noteOn() and plugin_process()).
 struct Voice {
 	PhaseGen<>		vco1PhaseGen;
+	OscSaw<>		vco1OscSaw;
+	OscPulse<>		vco1OscPulse;
+	OscTri<>		vco1OscTri;
+	Gain<>			vco1Gain;
 	PhaseGen<>		vco2PhaseGen;
+	OscSaw<>		vco2OscSaw;
+	OscPulse<>		vco2OscPulse;
+	OscTri<>		vco2OscTri;
+	Gain<>			vco2Gain;
 	PhaseGen<>		vco3PhaseGen;
+	OscSaw<>		vco3OscSaw;
+	OscPulse<>		vco3OscPulse;
+	OscTri<>		vco3OscTri;
+	Gain<>			vco3Gain;
+	OscFilt<>		oscFilt;
+	PinkFilt<>		pinkFilt;
+	Gain<>			noiseGain;
 	SVF<>			vcf;
+	EnvGen<>		vcfEnvGen;
+	EnvGen<>		vcaEnvGen;
 
 	unsigned char		note;
 	char			gate;
+	char			fresh;
 	float			modK;
 	float			vcfEnvK;
 
 	float			buf[5][BUFFER_SIZE];
-
-	plugin *		instance;
-	int			index;
 };
 
 struct plugin {
 	NoteQueue		noteQueue;
-	OscSaw<N_VOICES>	vco1OscSaw;
-	OscPulse<N_VOICES>	vco1OscPulse;
-	OscTri<N_VOICES>	vco1OscTri;
-	Gain<N_VOICES>		vco1Gain;
-	OscSaw<N_VOICES>	vco2OscSaw;
-	OscPulse<N_VOICES>	vco2OscPulse;
-	OscTri<N_VOICES>	vco2OscTri;
-	Gain<N_VOICES>		vco2Gain;
-	OscSaw<N_VOICES>	vco3OscSaw;
-	OscPulse<N_VOICES>	vco3OscPulse;
-	OscTri<N_VOICES>	vco3OscTri;
-	Gain<N_VOICES>		vco3Gain;
-	OscFilt<N_VOICES>	oscFilt;
-	NoiseGen<N_VOICES>	noiseGen;
-	PinkFilt<N_VOICES>	pinkFilt;
-	Gain<N_VOICES>		noiseGain;
-	EnvGen<N_VOICES>	vcfEnvGen;
-	EnvGen<N_VOICES>	vcaEnvGen;
+	NoiseGen<>		noiseGen;
 	PhaseGen<>		a440PhaseGen;
 	Gain<>			gain;
 	PPM<>			ppm;
@@ -119,65 +120,53 @@ struct plugin {
 	char			vco2WaveformCur;
 
 	float			buf[BUFFER_SIZE];
-
-	float *			b0[N_VOICES];
-	float *			b1[N_VOICES];
-	float *			b2[N_VOICES];
-	float *			b3[N_VOICES];
-	float *			b4[N_VOICES];
 };
 
 static void plugin_init(plugin *instance, plugin_callbacks *cbs) {
 	(void)cbs;
 	new(&instance->noteQueue) NoteQueue();
-	new(&instance->vco1OscSaw) OscSaw<N_VOICES>();
-	new(&instance->vco1OscPulse) OscPulse<N_VOICES>();
-	new(&instance->vco1OscTri) OscTri<N_VOICES>();
-	new(&instance->vco1Gain) Gain<N_VOICES>();
-	new(&instance->vco2OscSaw) OscSaw<N_VOICES>();
-	new(&instance->vco2OscPulse) OscPulse<N_VOICES>();
-	new(&instance->vco2OscTri) OscTri<N_VOICES>();
-	new(&instance->vco2Gain) Gain<N_VOICES>();
-	new(&instance->vco3OscSaw) OscSaw<N_VOICES>();
-	new(&instance->vco3OscPulse) OscPulse<N_VOICES>();
-	new(&instance->vco3OscTri) OscTri<N_VOICES>();
-	new(&instance->vco3Gain) Gain<N_VOICES>();
-	new(&instance->oscFilt) OscFilt<N_VOICES>();
-	new(&instance->noiseGen) NoiseGen<N_VOICES>(&instance->randState);
-	new(&instance->pinkFilt) PinkFilt<N_VOICES>();
-	new(&instance->noiseGain) Gain<N_VOICES>();
-	new(&instance->vcfEnvGen) EnvGen<N_VOICES>();
-	new(&instance->vcaEnvGen) EnvGen<N_VOICES>();
+	new(&instance->noiseGen) NoiseGen<>(&instance->randState);
 	new(&instance->a440PhaseGen) PhaseGen<>();
 	new(&instance->gain) Gain<>();
 	new(&instance->ppm) PPM<>();
 
-	instance->vco1OscSaw.setAntialiasing(true);
-	instance->vco1OscPulse.setAntialiasing(true);
-	instance->vco1OscTri.setAntialiasing(true);
-	instance->vco2OscSaw.setAntialiasing(true);
-	instance->vco2OscPulse.setAntialiasing(true);
-	instance->vco2OscTri.setAntialiasing(true);
-	instance->vco3OscSaw.setAntialiasing(true);
-	instance->vco3OscPulse.setAntialiasing(true);
-	instance->vco3OscTri.setAntialiasing(true);
 	instance->a440PhaseGen.setFrequency(440.f);
 
 	instance->randState = 0xbaddecaf600dfeed;
 
 	for (int i = 0; i < N_VOICES; i++) {
-		new(&instance->voices[i].vco1PhaseGen) PhaseGen<>();
-		new(&instance->voices[i].vco2PhaseGen) PhaseGen<>();
-		new(&instance->voices[i].vco3PhaseGen) PhaseGen<>();
-		new(&instance->voices[i].vcf) SVF<>();
-
-		instance->voices[i].instance = instance;
-		instance->voices[i].index = i;
-		instance->b0[i] = instance->voices[i].buf[0];
-		instance->b1[i] = instance->voices[i].buf[1];
-		instance->b2[i] = instance->voices[i].buf[2];
-		instance->b3[i] = instance->voices[i].buf[3];
-		instance->b4[i] = instance->voices[i].buf[4];
+		Voice *v = instance->voices + i;
+		new(&v->vco1PhaseGen) PhaseGen<>();
+		new(&v->vco1OscSaw) OscSaw<>();
+		new(&v->vco1OscPulse) OscPulse<>();
+		new(&v->vco1OscTri) OscTri<>();
+		new(&v->vco1Gain) Gain<>();
+		new(&v->vco2PhaseGen) PhaseGen<>();
+		new(&v->vco2OscSaw) OscSaw<>();
+		new(&v->vco2OscPulse) OscPulse<>();
+		new(&v->vco2OscTri) OscTri<>();
+		new(&v->vco2Gain) Gain<>();
+		new(&v->vco3PhaseGen) PhaseGen<>();
+		new(&v->vco3OscSaw) OscSaw<>();
+		new(&v->vco3OscPulse) OscPulse<>();
+		new(&v->vco3OscTri) OscTri<>();
+		new(&v->vco3Gain) Gain<>();
+		new(&v->oscFilt) OscFilt<>();
+		new(&v->pinkFilt) PinkFilt<>();
+		new(&v->noiseGain) Gain<>();
+		new(&v->vcf) SVF<>();
+		new(&v->vcfEnvGen) EnvGen<>();
+		new(&v->vcaEnvGen) EnvGen<>();
+
+		v->vco1OscSaw.setAntialiasing(true);
+		v->vco1OscPulse.setAntialiasing(true);
+		v->vco1OscTri.setAntialiasing(true);
+		v->vco2OscSaw.setAntialiasing(true);
+		v->vco2OscPulse.setAntialiasing(true);
+		v->vco2OscTri.setAntialiasing(true);
+		v->vco3OscSaw.setAntialiasing(true);
+		v->vco3OscPulse.setAntialiasing(true);
+		v->vco3OscTri.setAntialiasing(true);
 	}
 }
 
@@ -186,38 +175,39 @@ static void plugin_fini(plugin *instance) {
 }
 
 static void plugin_set_sample_rate(plugin *instance, float sample_rate) {
-	instance->vco1OscSaw.setSampleRate(sample_rate);
-	instance->vco1OscPulse.setSampleRate(sample_rate);
-	instance->vco1OscTri.setSampleRate(sample_rate);
-	instance->vco1Gain.setSampleRate(sample_rate);
-	instance->vco2OscSaw.setSampleRate(sample_rate);
-	instance->vco2OscPulse.setSampleRate(sample_rate);
-	instance->vco2OscTri.setSampleRate(sample_rate);
-	instance->vco2Gain.setSampleRate(sample_rate);
-	instance->vco3OscSaw.setSampleRate(sample_rate);
-	instance->vco3OscPulse.setSampleRate(sample_rate);
-	instance->vco3OscTri.setSampleRate(sample_rate);
-	instance->vco3Gain.setSampleRate(sample_rate);
 	instance->noiseGen.setSampleRate(sample_rate);
-	instance->pinkFilt.setSampleRate(sample_rate);
-	instance->noiseGain.setSampleRate(sample_rate);
-	instance->vcfEnvGen.setSampleRate(sample_rate);
-	instance->vcaEnvGen.setSampleRate(sample_rate);
 	instance->a440PhaseGen.setSampleRate(sample_rate);
 	instance->gain.setSampleRate(sample_rate);
 	instance->ppm.setSampleRate(sample_rate);
 
 	for (int i = 0; i < N_VOICES; i++) {
-		instance->voices[i].vco1PhaseGen.setSampleRate(sample_rate);
-		instance->voices[i].vco2PhaseGen.setSampleRate(sample_rate);
-		instance->voices[i].vco3PhaseGen.setSampleRate(sample_rate);
-		instance->voices[i].vcf.setSampleRate(sample_rate);
+		Voice *v = instance->voices + i;
+		v->vco1PhaseGen.setSampleRate(sample_rate);
+		v->vco1OscSaw.setSampleRate(sample_rate);
+		v->vco1OscPulse.setSampleRate(sample_rate);
+		v->vco1OscTri.setSampleRate(sample_rate);
+		v->vco1Gain.setSampleRate(sample_rate);
+		v->vco2PhaseGen.setSampleRate(sample_rate);
+		v->vco2OscSaw.setSampleRate(sample_rate);
+		v->vco2OscPulse.setSampleRate(sample_rate);
+		v->vco2OscTri.setSampleRate(sample_rate);
+		v->vco2Gain.setSampleRate(sample_rate);
+		v->vco3PhaseGen.setSampleRate(sample_rate);
+		v->vco3OscSaw.setSampleRate(sample_rate);
+		v->vco3OscPulse.setSampleRate(sample_rate);
+		v->vco3OscTri.setSampleRate(sample_rate);
+		v->vco3Gain.setSampleRate(sample_rate);
+		v->pinkFilt.setSampleRate(sample_rate);
+		v->noiseGain.setSampleRate(sample_rate);
+		v->vcf.setSampleRate(sample_rate);
+		v->vcfEnvGen.setSampleRate(sample_rate);
+		v->vcaEnvGen.setSampleRate(sample_rate);
 	}
 
 	instance->syncCount = (size_t)bw_roundf(sample_rate * SYNC_RATE);
 
 	instance->noiseKV[0] = 0.1f * instance->noiseGen.getScalingK();
-	instance->noiseKV[1] = 6.f * instance->noiseGen.getScalingK() * instance->pinkFilt.getScalingK();
+	instance->noiseKV[1] = 6.f * instance->noiseGen.getScalingK() * instance->voices[0].pinkFilt.getScalingK();
 }
 
 static size_t plugin_mem_req(plugin *instance) {
@@ -235,35 +225,37 @@ static void plugin_reset(plugin *instance) {
 		instance->voices[i].vcf.setCutoff(instance->vcfCutoff);
 
 	instance->noteQueue = NoteQueue();
-	instance->vco1OscSaw.reset();
-	instance->vco1OscPulse.reset();
-	instance->vco1OscTri.reset();
-	instance->vco1Gain.reset();
-	instance->vco2OscSaw.reset();
-	instance->vco2OscPulse.reset();
-	instance->vco2OscTri.reset();
-	instance->vco2Gain.reset();
-	instance->vco3OscSaw.reset();
-	instance->vco3OscPulse.reset();
-	instance->vco3OscTri.reset();
-	instance->vco3Gain.reset();
-	instance->oscFilt.reset();
 	instance->noiseGen.reset();
-	instance->pinkFilt.reset();
-	instance->noiseGain.reset();
-	instance->vcfEnvGen.reset();
-	instance->vcaEnvGen.reset();
 	instance->a440PhaseGen.reset();
 	instance->gain.reset();
 	instance->ppm.reset();
 	for (int i = 0; i < N_VOICES; i++) {
-		instance->voices[i].vco1PhaseGen.reset();
-		instance->voices[i].vco2PhaseGen.reset();
-		instance->voices[i].vco3PhaseGen.reset();
-		instance->voices[i].vcf.reset();
-
-		instance->voices[i].note = 60;
-		instance->voices[i].gate = 0;
+		Voice *v = instance->voices + i;
+		v->vco1PhaseGen.reset();
+		v->vco1OscSaw.reset();
+		v->vco1OscPulse.reset();
+		v->vco1OscTri.reset();
+		v->vco1Gain.reset();
+		v->vco2PhaseGen.reset();
+		v->vco2OscSaw.reset();
+		v->vco2OscPulse.reset();
+		v->vco2OscTri.reset();
+		v->vco2Gain.reset();
+		v->vco3PhaseGen.reset();
+		v->vco3OscSaw.reset();
+		v->vco3OscPulse.reset();
+		v->vco3OscTri.reset();
+		v->vco3Gain.reset();
+		v->oscFilt.reset();
+		v->pinkFilt.reset();
+		v->noiseGain.reset();
+		v->vcf.reset();
+		v->vcfEnvGen.reset();
+		v->vcaEnvGen.reset();
+
+		v->note = 60;
+		v->gate = 0;
+		v->fresh = 0;
 	}
 	instance->pitchBend = 0.f;
 	instance->modWheel = 0.f;
@@ -313,14 +305,17 @@ static void plugin_set_parameter(plugin *instance, size_t index, float value) {
 	case plugin_parameter_vco1_pw:
 	{
 		const float v = 0.01f * value;
-		instance->vco1OscPulse.setPulseWidth(v);
-		instance->vco1OscTri.setSlope(bw_clipf(v, 0.001f, 0.999f));
+		for (int i = 0; i < N_VOICES; i++) {
+			instance->voices[i].vco1OscPulse.setPulseWidth(v);
+			instance->voices[i].vco1OscTri.setSlope(bw_clipf(v, 0.001f, 0.999f));
+		}
 		break;
 	}
 	case plugin_parameter_vco1_level:
 	{
 		const float v = 0.01f * value;
-		instance->vco1Gain.setGainLin(v * v * v);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vco1Gain.setGainLin(v * v * v);
 		break;
 	}
 	case plugin_parameter_vco2_mod:
@@ -338,14 +333,17 @@ static void plugin_set_parameter(plugin *instance, size_t index, float value) {
 	case plugin_parameter_vco2_pw:
 	{
 		const float v = 0.01f * value;
-		instance->vco2OscPulse.setPulseWidth(v);
-		instance->vco2OscTri.setSlope(bw_clipf(v, 0.001f, 0.999f));
+		for (int i = 0; i < N_VOICES; i++) {
+			instance->voices[i].vco2OscPulse.setPulseWidth(v);
+			instance->voices[i].vco2OscTri.setSlope(bw_clipf(v, 0.001f, 0.999f));
+		}
 		break;
 	}
 	case plugin_parameter_vco2_level:
 	{
 		const float v = 0.01f * value;
-		instance->vco2Gain.setGainLin(v * v * v);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vco2Gain.setGainLin(v * v * v);
 		break;
 	}
 	case plugin_parameter_vco3_kbd_ctrl:
@@ -363,14 +361,17 @@ static void plugin_set_parameter(plugin *instance, size_t index, float value) {
 	case plugin_parameter_vco3_pw:
 	{
 		const float v = 0.01f * value;
-		instance->vco3OscPulse.setPulseWidth(v);
-		instance->vco3OscTri.setSlope(bw_clipf(v, 0.001f, 0.999f));
+		for (int i = 0; i < N_VOICES; i++) {
+			instance->voices[i].vco3OscPulse.setPulseWidth(v);
+			instance->voices[i].vco3OscTri.setSlope(bw_clipf(v, 0.001f, 0.999f));
+		}
 		break;
 	}
 	case plugin_parameter_vco3_level:
 	{
 		const float v = 0.01f * value;
-		instance->vco3Gain.setGainLin(v * v * v);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vco3Gain.setGainLin(v * v * v);
 		break;
 	}
 	case plugin_parameter_noise_color:
@@ -379,7 +380,8 @@ static void plugin_set_parameter(plugin *instance, size_t index, float value) {
 	case plugin_parameter_noise_level:
 	{
 		const float v = 0.01f * value;
-		instance->noiseGain.setGainLin(v * v * v);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].noiseGain.setGainLin(v * v * v);
 		break;
 	}
 	case plugin_parameter_vcf_mod:
@@ -402,28 +404,36 @@ static void plugin_set_parameter(plugin *instance, size_t index, float value) {
 		instance->vcfContour = 0.01f * value;
 		break;
 	case plugin_parameter_vcf_attack:
-		instance->vcfEnvGen.setAttack(0.001f * value);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vcfEnvGen.setAttack(0.001f * value);
 		break;
 	case plugin_parameter_vcf_decay:
-		instance->vcfEnvGen.setDecay(0.001f * value);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vcfEnvGen.setDecay(0.001f * value);
 		break;
 	case plugin_parameter_vcf_sustain:
-		instance->vcfEnvGen.setSustain(0.01f * value);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vcfEnvGen.setSustain(0.01f * value);
 		break;
 	case plugin_parameter_vcf_release:
-		instance->vcfEnvGen.setRelease(0.001f * value);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vcfEnvGen.setRelease(0.001f * value);
 		break;
 	case plugin_parameter_vca_attack:
-		instance->vcaEnvGen.setAttack(0.001f * value);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vcaEnvGen.setAttack(0.001f * value);
 		break;
 	case plugin_parameter_vca_decay:
-		instance->vcaEnvGen.setDecay(0.001f * value);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vcaEnvGen.setDecay(0.001f * value);
 		break;
 	case plugin_parameter_vca_sustain:
-		instance->vcaEnvGen.setSustain(0.01f * value);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vcaEnvGen.setSustain(0.01f * value);
 		break;
 	case plugin_parameter_vca_release:
-		instance->vcaEnvGen.setRelease(0.001f * value);
+		for (int i = 0; i < N_VOICES; i++)
+			instance->voices[i].vcaEnvGen.setRelease(0.001f * value);
 		break;
 	case plugin_parameter_a440:
 		instance->a440 = value >= 0.5f;
@@ -436,9 +446,31 @@ static float plugin_get_parameter(plugin *instance, size_t index) {
 	return bw_clipf(instance->ppm.getYZ1(0), -60.f, 0.f);
 }
 
+static char isFree(const void *BW_RESTRICT handle) {
+	Voice *v = (Voice *)handle;
+	bw_env_gen_phase phase = v->vcaEnvGen.getPhase(0);
+	return !v->gate && phase == bw_env_gen_phase_off;
+}
+
 static void noteOn(void *BW_RESTRICT handle, unsigned char note, float velocity) {
 	(void)velocity;
 	Voice *v = (Voice *)handle;
+	if (isFree(v)) {
+		v->vco1OscPulse.reset();
+		v->vco1OscTri.reset();
+		v->vco1Gain.reset();
+		v->vco2OscPulse.reset();
+		v->vco2OscTri.reset();
+		v->vco2Gain.reset();
+		v->vco3OscPulse.reset();
+		v->vco3OscTri.reset();
+		v->vco3Gain.reset();
+		v->noiseGain.reset();
+		v->oscFilt.reset();
+		v->vcfEnvGen.reset();
+		v->vcaEnvGen.reset();
+		v->fresh = 1; // vcf is reset in plugin_process() once cutoff is known
+	}
 	v->note = note;
 	v->gate = 1;
 }
@@ -454,12 +486,6 @@ static unsigned char getNote(const void *BW_RESTRICT handle) {
 	return v->note;
 }
 
-static char isFree(const void *BW_RESTRICT handle) {
-	Voice *v = (Voice *)handle;
-	bw_env_gen_phase phase = v->instance->vcaEnvGen.getPhase(v->index);
-	return !v->gate && phase == bw_env_gen_phase_off;
-}
-
 static void plugin_process(plugin *instance, const float **inputs, float **outputs, size_t n_samples) {
 	(void)inputs;
 
@@ -472,52 +498,63 @@ static void plugin_process(plugin *instance, const float **inputs, float **outpu
 	bw_voice_alloc(&alloc_opts, &instance->noteQueue.queue, voices, N_VOICES);
 	instance->noteQueue.clear();
 
+	// only voices that are not free are processed
+
+	Voice *va[N_VOICES];
+	size_t nVA = 0;
+	for (int i = 0; i < N_VOICES; i++)
+		if (!isFree(instance->voices + i))
+			va[nVA++] = instance->voices + i;
+
 	// asynchronous control-rate operations
 
 	const float df1 = instance->vco1Coarse + instance->pitchBend + (8.333333333333333e-2f * 0.01f) * instance->vco1Fine;
 	const float df2 = instance->vco2Coarse + instance->pitchBend + (8.333333333333333e-2f * 0.01f) * instance->vco2Fine;
 	const float df3 = instance->vco3Coarse + instance->pitchBend + (8.333333333333333e-2f * 0.01f) * instance->vco3Fine;
-	for (int i = 0; i < N_VOICES; i++) {
-		int n = instance->voices[i].note - 69;
+	for (size_t i = 0; i < nVA; i++) {
+		int n = va[i]->note - 69;
 		int n3 = instance->vco3KbdCtrl ? n : -69;
-		instance->voices[i].vco1PhaseGen.setFrequency(instance->masterTune * bw_pow2f(df1 + 8.333333333333333e-2f * n));
-		instance->voices[i].vco2PhaseGen.setFrequency(instance->masterTune * bw_pow2f(df2 + 8.333333333333333e-2f * n));
-		instance->voices[i].vco3PhaseGen.setFrequency(instance->masterTune * bw_pow2f(df3 + 8.333333333333333e-2f * n3));
+		va[i]->vco1PhaseGen.setFrequency(instance->masterTune * bw_pow2f(df1 + 8.333333333333333e-2f * n));
+		va[i]->vco2PhaseGen.setFrequency(instance->masterTune * bw_pow2f(df2 + 8.333333333333333e-2f * n));
+		va[i]->vco3PhaseGen.setFrequency(instance->masterTune * bw_pow2f(df3 + 8.333333333333333e-2f * n3));
 	}
 
 	if (instance->vco3WaveformCur != instance->vco3Waveform) {
-		switch (instance->vco3Waveform) {
-		case 2:
-			instance->vco3OscPulse.reset();
-			break;
-		case 3:
-			instance->vco3OscTri.reset();
-			break;
-		}
+		for (int i = 0; i < N_VOICES; i++)
+			switch (instance->vco3Waveform) {
+			case 2:
+				instance->voices[i].vco3OscPulse.reset();
+				break;
+			case 3:
+				instance->voices[i].vco3OscTri.reset();
+				break;
+			}
 		instance->vco3WaveformCur = instance->vco3Waveform;
 	}
 
 	if (instance->vco1WaveformCur != instance->vco1Waveform) {
-		switch (instance->vco1Waveform) {
-		case 2:
-			instance->vco1OscPulse.reset();
-			break;
-		case 3:
-			instance->vco1OscTri.reset();
-			break;
-		}
+		for (int i = 0; i < N_VOICES; i++)
+			switch (instance->vco1Waveform) {
+			case 2:
+				instance->voices[i].vco1OscPulse.reset();
+				break;
+			case 3:
+				instance->voices[i].vco1OscTri.reset();
+				break;
+			}
 		instance->vco1WaveformCur = instance->vco1Waveform;
 	}
 
 	if (instance->vco2WaveformCur != instance->vco2Waveform) {
-		switch (instance->vco2Waveform) {
-		case 2:
-			instance->vco2OscPulse.reset();
-			break;
-		case 3:
-			instance->vco2OscTri.reset();
-			break;
-		}
+		for (int i = 0; i < N_VOICES; i++)
+			switch (instance->vco2Waveform) {
+			case 2:
+				instance->voices[i].vco2OscPulse.reset();
+				break;
+			case 3:
+				instance->voices[i].vco2OscTri.reset();
+				break;
+			}
 		instance->vco2WaveformCur = instance->vco2Waveform;
 	}
 
@@ -529,15 +566,11 @@ static void plugin_process(plugin *instance, const float **inputs, float **outpu
 		8.333333333333333e-2f // full
 	};
 	float cutoffKbdK[N_VOICES];
-	for (int i = 0; i < N_VOICES; i++)
-		cutoffKbdK[i] = bw_pow2f(cutoffKbdKV[instance->vcfKbdCtrl - 1] * (instance->voices[i].note - 60));
+	for (size_t i = 0; i < nVA; i++)
+		cutoffKbdK[i] = bw_pow2f(cutoffKbdKV[instance->vcfKbdCtrl - 1] * (va[i]->note - 60));
 
 	const float noiseK = instance->noiseKV[instance->noiseColor - 1];
 
-	char gates[N_VOICES];
-	for (int j = 0; j < N_VOICES; j++)
-		gates[j] = instance->voices[j].gate;
-
 	// synchronous control-rate and audio-rate operations
 
 	for (size_t i = 0; i < n_samples; ) {
@@ -549,127 +582,119 @@ static void plugin_process(plugin *instance, const float **inputs, float **outpu
 		const char sync = instance->syncLeft == instance->syncCount;
 		float *y[1] = {out};
 
-		// vco 3
+		bufFill<1>(0.f, y, n);
 
-		for (int j = 0; j < N_VOICES; j++) {
-			float *vb0[1] = {instance->voices[j].buf[0]};
-			float *vb1[1] = {instance->voices[j].buf[1]};
-			instance->voices[j].vco3PhaseGen.process(nullptr, vb0, vb1, n);
-		}
-		switch (instance->vco3WaveformCur) {
-		case 1:
-			instance->vco3OscSaw.process(instance->b0, instance->b1, instance->b0, n);
-			break;
-		case 2:
-			instance->vco3OscPulse.process(instance->b0, instance->b1, instance->b0, n);
-			break;
-		default:
-			instance->vco3OscTri.process(instance->b0, instance->b1, instance->b0, n);
-			break;
-		}
+		for (size_t j = 0; j < nVA; j++) {
+			Voice *v = va[j];
+			const char vSync = sync || v->fresh;
+			float *b0[1] = {v->buf[0]};
+			float *b1[1] = {v->buf[1]};
+			float *b2[1] = {v->buf[2]};
+			float *b3[1] = {v->buf[3]};
+			float *b4[1] = {v->buf[4]};
+
+			// vco 3
+
+			v->vco3PhaseGen.process(nullptr, b0, b1, n);
+			switch (instance->vco3WaveformCur) {
+			case 1:
+				v->vco3OscSaw.process(b0, b1, b0, n);
+				break;
+			case 2:
+				v->vco3OscPulse.process(b0, b1, b0, n);
+				break;
+			default:
+				v->vco3OscTri.process(b0, b1, b0, n);
+				break;
+			}
 
-		// noise generator
+			// noise generator
 
-		instance->noiseGen.process(instance->b1, n);
-		if (instance->noiseColor == 2)
-			instance->pinkFilt.process(instance->b1, instance->b1, n);
-			// no need to ever reset pink filt, as inputs are noise and filters are static
-		bufScale<N_VOICES>(instance->b1, 5.f, instance->b1, n);
+			instance->noiseGen.process(b1, n);
+			if (instance->noiseColor == 2)
+				v->pinkFilt.process(b1, b1, n);
+				// no need to ever reset pink filt, as inputs are noise and filters are static
+			bufScale<1>(b1, 5.f, b1, n);
 
-		// modulation signals
+			// modulation signals
 
-		for (int j = 0; j < N_VOICES; j++) {
 			for (size_t k = 0; k < n; k++)
-				instance->b2[j][k] = instance->modWheel * (instance->b0[j][k] + instance->modulationMix * (instance->b1[j][k] - instance->b0[j][k]));
-		}
-		if (sync)
-			for (int j = 0; j < N_VOICES; j++)
-				instance->voices[j].modK = instance->b2[j][0];
-
-		// vco 1
-
-		for (int j = 0; j < N_VOICES; j++) {
-			float *vb2[1] = {instance->voices[j].buf[2]};
-			float *vb3[1] = {instance->voices[j].buf[3]};
-			float *vb4[1] = {instance->voices[j].buf[4]};
-			bufScale<1>(vb2, instance->vco1Modulation, vb3, n);
-			instance->voices[j].vco1PhaseGen.process(vb3, vb3, vb4, n);
-		}
-		switch (instance->vco1WaveformCur) {
-		case 1:
-			instance->vco1OscSaw.process(instance->b3, instance->b4, instance->b3, n);
-			break;
-		case 2:
-			instance->vco1OscPulse.process(instance->b3, instance->b4, instance->b3, n);
-			break;
-		default:
-			instance->vco1OscTri.process(instance->b3, instance->b4, instance->b3, n);
-			break;
-		}
-
-		// vco 2
+				b2[0][k] = instance->modWheel * (b0[0][k] + instance->modulationMix * (b1[0][k] - b0[0][k]));
+			if (vSync)
+				v->modK = b2[0][0];
+
+			// vco 1
+
+			bufScale<1>(b2, instance->vco1Modulation, b3, n);
+			v->vco1PhaseGen.process(b3, b3, b4, n);
+			switch (instance->vco1WaveformCur) {
+			case 1:
+				v->vco1OscSaw.process(b3, b4, b3, n);
+				break;
+			case 2:
+				v->vco1OscPulse.process(b3, b4, b3, n);
+				break;
+			default:
+				v->vco1OscTri.process(b3, b4, b3, n);
+				break;
+			}
 
-		for (int j = 0; j < N_VOICES; j++) {
-			float *vb2[1] = {instance->voices[j].buf[2]};
-			float *vb4[1] = {instance->voices[j].buf[4]};
-			bufScale<1>(vb2, instance->vco2Modulation, vb2, n);
-			instance->voices[j].vco2PhaseGen.process(vb2, vb2, vb4, n);
-		}
-		switch (instance->vco2WaveformCur) {
-		case 1:
-			instance->vco2OscSaw.process(instance->b2, instance->b4, instance->b2, n);
-			break;
-		case 2:
-			instance->vco2OscPulse.process(instance->b2, instance->b4, instance->b2, n);
-			break;
-		default:
-			instance->vco2OscTri.process(instance->b2, instance->b4, instance->b2, n);
-			break;
-		}
+			// vco 2
+
+			bufScale<1>(b2, instance->vco2Modulation, b2, n);
+			v->vco2PhaseGen.process(b2, b2, b4, n);
+			switch (instance->vco2WaveformCur) {
+			case 1:
+				v->vco2OscSaw.process(b2, b4, b2, n);
+				break;
+			case 2:
+				v->vco2OscPulse.process(b2, b4, b2, n);
+				break;
+			default:
+				v->vco2OscTri.process(b2, b4, b2, n);
+				break;
+			}
 
-		// mixer
+			// mixer
 
-		instance->vco1Gain.process(instance->b3, instance->b3, n);
-		instance->vco2Gain.process(instance->b2, instance->b2, n);
-		instance->vco3Gain.process(instance->b0, instance->b0, n);
-		instance->noiseGain.process(instance->b1, instance->b1, n);
-		bufMix<N_VOICES>(instance->b0, instance->b2, instance->b0, n);
-		bufMix<N_VOICES>(instance->b0, instance->b3, instance->b0, n);
+			v->vco1Gain.process(b3, b3, n);
+			v->vco2Gain.process(b2, b2, n);
+			v->vco3Gain.process(b0, b0, n);
+			v->noiseGain.process(b1, b1, n);
+			bufMix<1>(b0, b2, b0, n);
+			bufMix<1>(b0, b3, b0, n);
 
-		instance->oscFilt.process(instance->b0, instance->b0, n);
+			v->oscFilt.process(b0, b0, n);
 
-		bufScale<N_VOICES>(instance->b1, noiseK, instance->b1, n);
-		bufMix<N_VOICES>(instance->b0, instance->b1, instance->b0, n);
+			bufScale<1>(b1, noiseK, b1, n);
+			bufMix<1>(b0, b1, b0, n);
 
-		// vcf
+			// vcf
 
-		instance->vcfEnvGen.process(gates, nullptr, n);
-		if (sync)
-			for (int j = 0; j < N_VOICES; j++) {
-				instance->voices[j].vcfEnvK = instance->vcfEnvGen.getYZ1(j);
+			v->vcfEnvGen.process(&v->gate, nullptr, n);
+			if (vSync) {
+				v->vcfEnvK = v->vcfEnvGen.getYZ1(0);
 				const float cutoffVpos =
 					cutoffUnmapped
-					+ instance->vcfContour * instance->voices[j].vcfEnvK
-					+ 0.3f * instance->vcfModulation * instance->voices[j].modK;
+					+ instance->vcfContour * v->vcfEnvK
+					+ 0.3f * instance->vcfModulation * v->modK;
 				float cutoff = cutoffKbdK[j] * 20.f * bw_expf(6.907755278982137 * cutoffVpos);
-				instance->voices[j].vcf.setCutoff(bw_clipf(cutoff, 20.f, 20e3f));
+				v->vcf.setCutoff(bw_clipf(cutoff, 20.f, 20e3f));
+				if (v->fresh) {
+					v->vcf.reset();
+					v->fresh = 0;
+				}
 			}
-		for (int j = 0; j < N_VOICES; j++) {
-			float *vb0[1] = {instance->voices[j].buf[0]};
-			instance->voices[j].vcf.process(vb0, vb0, nullptr, nullptr, n);
-		}
+			v->vcf.process(b0, b0, nullptr, nullptr, n);
 
-		// vca
+			// vca
 
-		instance->vcaEnvGen.process(gates, instance->b1, n);
-		bufMul<N_VOICES>(instance->b0, instance->b1, instance->b0, n);
+			v->vcaEnvGen.process(&v->gate, b1, n);
+			bufMul<1>(b0, b1, b0, n);
 
-		// mix voices
+			// mix voices
 
-		bufFill<1>(0.f, y, n);
-		for (int j = 0; j < N_VOICES; j++) {
-			float *vb0[1] = {instance->voices[j].buf[0]};
-			bufMix<1>(y, vb0, y, n);
+			bufMix<1>(y, b0, y, n);
 		}
 
 		// A 440 Hz osc
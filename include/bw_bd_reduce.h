@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.2 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_math }}}
  *  description {{{
  *    Bit depth reducer with input gate.
@@ -31,6 +31,12 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.2</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -339,8 +345,8 @@ static inline void bw_bd_reduce_set_sample_rate(
 static inline void bw_bd_reduce_do_update_coeffs_ctrl(
 		bw_bd_reduce_coeffs * BW_RESTRICT coeffs) {
 	if (coeffs->bit_depth_prev != coeffs->bit_depth) {
-		coeffs->k = bw_pow2f(coeffs->bit_depth - 1);
-		coeffs->ki = bw_rcpf(coeffs->k);
+		coeffs->k = bw_pow2f_ctrl(coeffs->bit_depth - 1);
+		coeffs->ki = bw_rcpf_ctrl(coeffs->k);
 		coeffs->max = 1.f - 0.5f * coeffs->ki;
 		coeffs->bit_depth_prev = coeffs->bit_depth;
 	}
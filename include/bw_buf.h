@@ -20,13 +20,25 @@
 
 /*!
  *  module_type {{{ utility }}}
- *  version {{{ 1.2.1 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common }}}
  *  description {{{
  *    Common operations on buffers.
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Added <code>bw_buf_mac()</code>,
+ *              <code>bw_buf_scale_add()</code>,
+ *              <code>bw_buf_scale_ramp()</code>, <code>bw_buf_peak()</code>,
+ *              <code>bw_buf_sum_sq()</code>, and their
+ *              <code>_multi</code> counterparts.</li>
+ *          <li>Added <code>bw_buf_interleave()</code> and
+ *              <code>bw_buf_deinterleave()</code>.</li>
+ *          <li>Added corresponding C++ API.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.1</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -183,6 +195,67 @@ static inline void bw_buf_mul(
  *    Multiplies the first `n_elems` of `src1` and `src2` and stores the results
  *    in the first `n_elems` of `dest`.
  *
+ *    #### bw_buf_mac()
+ *  ```>>> */
+static inline void bw_buf_mac(
+	const float * src,
+	float         k,
+	float *       dest,
+	size_t        n_elems);
+/*! <<<```
+ *    Multiplies the first `n_elems` in `src` by `k` and adds the results to
+ *    the first `n_elems` of `dest`.
+ *
+ *    #### bw_buf_scale_add()
+ *  ```>>> */
+static inline void bw_buf_scale_add(
+	const float * src,
+	float         k_scale,
+	float         k_add,
+	float *       dest,
+	size_t        n_elems);
+/*! <<<```
+ *    Multiplies the first `n_elems` in `src` by `k_scale`, adds `k_add`, and
+ *    stores the results in the first `n_elems` of `dest`.
+ *
+ *    #### bw_buf_scale_ramp()
+ *  ```>>> */
+static inline void bw_buf_scale_ramp(
+	const float * src,
+	float         k_0,
+	float         k_1,
+	float *       dest,
+	size_t        n_elems);
+/*! <<<```
+ *    Multiplies the first `n_elems` in `src` by a factor that linearly goes
+ *    from `k_0` (first element) towards `k_1` and stores the results in the
+ *    first `n_elems` of `dest`.
+ *
+ *    `k_1` is reached right after the last element, so that a subsequent call
+ *    starting from `k_1` continues the ramp seamlessly.
+ *
+ *    `n_elems` must be less than 2^31.
+ *
+ *    #### bw_buf_peak()
+ *  ```>>> */
+static inline float bw_buf_peak(
+	const float * src,
+	size_t        n_elems);
+/*! <<<```
+ *    Returns the maximum absolute value among the first `n_elems` in `src`, or
+ *    `0.f` if `n_elems` is `0`.
+ *
+ *    #### bw_buf_sum_sq()
+ *  ```>>> */
+static inline float bw_buf_sum_sq(
+	const float * src,
+	size_t        n_elems);
+/*! <<<```
+ *    Returns the sum of the squares of the first `n_elems` in `src`.
+ *
+ *    Partial sums are accumulated independently and then added together,
+ *    hence the result may slightly differ from that of sequential summation.
+ *
  *    #### bw_buf_fill_multi()
  *  ```>>> */
 static inline void bw_buf_fill_multi(
@@ -268,6 +341,98 @@ static inline void bw_buf_mul_multi(
  *    Multiplies the first `n_elems` in each of the `n_channels` buffers `src1`
  *    and `src2` and stores the results in the first `n_elems` in each of the
  *    `n_channels` buffers `dest`.
+ *
+ *    #### bw_buf_mac_multi()
+ *  ```>>> */
+static inline void bw_buf_mac_multi(
+	const float * const * src,
+	float                 k,
+	float * const *       dest,
+	size_t                n_channels,
+	size_t                n_elems);
+/*! <<<```
+ *    Multiplies the first `n_elems` in each of the `n_channels` buffers `src`
+ *    by `k` and adds the results to the first `n_elems` in each of the
+ *    `n_channels` buffers `dest`.
+ *
+ *    #### bw_buf_scale_add_multi()
+ *  ```>>> */
+static inline void bw_buf_scale_add_multi(
+	const float * const * src,
+	float                 k_scale,
+	float                 k_add,
+	float * const *       dest,
+	size_t                n_channels,
+	size_t                n_elems);
+/*! <<<```
+ *    Multiplies the first `n_elems` in each of the `n_channels` buffers `src`
+ *    by `k_scale`, adds `k_add`, and stores the results in the first
+ *    `n_elems` in each of the `n_channels` buffers `dest`.
+ *
+ *    #### bw_buf_scale_ramp_multi()
+ *  ```>>> */
+static inline void bw_buf_scale_ramp_multi(
+	const float * const * src,
+	float                 k_0,
+	float                 k_1,
+	float * const *       dest,
+	size_t                n_channels,
+	size_t                n_elems);
+/*! <<<```
+ *    Multiplies the first `n_elems` in each of the `n_channels` buffers `src`
+ *    by a factor that linearly goes from `k_0` towards `k_1`, as in
+ *    `bw_buf_scale_ramp()`, and stores the results in the first `n_elems` in
+ *    each of the `n_channels` buffers `dest`.
+ *
+ *    `n_elems` must be less than 2^31.
+ *
+ *    #### bw_buf_peak_multi()
+ *  ```>>> */
+static inline void bw_buf_peak_multi(
+	const float * const * src,
+	float *               peak,
+	size_t                n_channels,
+	size_t                n_elems);
+/*! <<<```
+ *    Fills the first `n_channels` elements of `peak` with the maximum absolute
+ *    values among the first `n_elems` in each of the `n_channels` buffers
+ *    `src`.
+ *
+ *    #### bw_buf_sum_sq_multi()
+ *  ```>>> */
+static inline void bw_buf_sum_sq_multi(
+	const float * const * src,
+	float *               sum_sq,
+	size_t                n_channels,
+	size_t                n_elems);
+/*! <<<```
+ *    Fills the first `n_channels` elements of `sum_sq` with the sums of the
+ *    squares of the first `n_elems` in each of the `n_channels` buffers `src`,
+ *    as in `bw_buf_sum_sq()`.
+ *
+ *    #### bw_buf_interleave()
+ *  ```>>> */
+static inline void bw_buf_interleave(
+	const float * const * src,
+	float * BW_RESTRICT   dest,
+	size_t                n_channels,
+	size_t                n_elems);
+/*! <<<```
+ *    Interleaves the first `n_elems` in each of the `n_channels` buffers `src`
+ *    into the first `n_channels * n_elems` of `dest`, so that
+ *    `dest[n_channels * i + j]` is set to `src[j][i]`.
+ *
+ *    #### bw_buf_deinterleave()
+ *  ```>>> */
+static inline void bw_buf_deinterleave(
+	const float * BW_RESTRICT src,
+	float * const *           dest,
+	size_t                    n_channels,
+	size_t                    n_elems);
+/*! <<<```
+ *    Deinterleaves the first `n_channels * n_elems` in `src` into the first
+ *    `n_elems` in each of the `n_channels` buffers `dest`, so that
+ *    `dest[j][i]` is set to `src[n_channels * i + j]`.
  *  }}} */
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
@@ -390,6 +555,106 @@ static inline void bw_buf_mul(
 	BW_ASSERT_DEEP(!bw_has_nan(dest, n_elems));
 }
 
+static inline void bw_buf_mac(
+		const float * src,
+		float         k,
+		float *       dest,
+		size_t        n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(src, n_elems));
+	BW_ASSERT(!bw_is_nan(k));
+	BW_ASSERT(dest != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(dest, n_elems));
+
+	for (size_t i = 0; i < n_elems; i++)
+		dest[i] += k * src[i];
+
+	BW_ASSERT_DEEP(!bw_has_nan(dest, n_elems));
+}
+
+static inline void bw_buf_scale_add(
+		const float * src,
+		float         k_scale,
+		float         k_add,
+		float *       dest,
+		size_t        n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(src, n_elems));
+	BW_ASSERT(!bw_is_nan(k_scale));
+	BW_ASSERT(!bw_is_nan(k_add));
+	BW_ASSERT(dest != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		dest[i] = k_scale * src[i] + k_add;
+
+	BW_ASSERT_DEEP(!bw_has_nan(dest, n_elems));
+}
+
+static inline void bw_buf_scale_ramp(
+		const float * src,
+		float         k_0,
+		float         k_1,
+		float *       dest,
+		size_t        n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(src, n_elems));
+	BW_ASSERT(bw_is_finite(k_0));
+	BW_ASSERT(bw_is_finite(k_1));
+	BW_ASSERT(dest != BW_NULL);
+	BW_ASSERT(n_elems < 0x80000000u);
+
+	const float d = n_elems != 0 ? (k_1 - k_0) / (float)n_elems : 0.f;
+	// int32_t index so that the int-to-float conversion can be vectorized
+	for (size_t i = 0; i < n_elems; i++)
+		dest[i] = (k_0 + d * (float)(int32_t)i) * src[i];
+
+	BW_ASSERT_DEEP(!bw_has_nan(dest, n_elems));
+}
+
+static inline float bw_buf_peak(
+		const float * src,
+		size_t        n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(src, n_elems));
+
+	// the bit patterns of non-negative floats are ordered like unsigned
+	// integers, and integer max reductions are vectorized
+	union { float f; uint32_t u; } v;
+	uint32_t m = 0;
+	for (size_t i = 0; i < n_elems; i++) {
+		v.f = src[i];
+		const uint32_t a = v.u & 0x7fffffff;
+		m = a > m ? a : m;
+	}
+	v.u = m;
+
+	BW_ASSERT(!bw_is_nan(v.f));
+
+	return v.f;
+}
+
+static inline float bw_buf_sum_sq(
+		const float * src,
+		size_t        n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(src, n_elems));
+
+	// independent partial sums, otherwise the compiler would not reorder
+	// additions to vectorize
+	float s[8] = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+	size_t i = 0;
+	for (; i + 8 <= n_elems; i += 8)
+		for (size_t j = 0; j < 8; j++)
+			s[j] += src[i + j] * src[i + j];
+	for (size_t j = 0; i < n_elems; i++, j++)
+		s[j] += src[i] * src[i];
+	const float y = ((s[0] + s[4]) + (s[2] + s[6])) + ((s[1] + s[5]) + (s[3] + s[7]));
+
+	BW_ASSERT(!bw_is_nan(y));
+
+	return y;
+}
+
 static inline void bw_buf_fill_multi(
 		float                                   k,
 		float * BW_RESTRICT const * BW_RESTRICT dest,
@@ -539,6 +804,170 @@ static inline void bw_buf_mul_multi(
 		bw_buf_mul(src1[i], src2[i], dest[i], n_elems);
 }
 
+static inline void bw_buf_mac_multi(
+		const float * const * src,
+		float                 k,
+		float * const *       dest,
+		size_t                n_channels,
+		size_t                n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT(!bw_is_nan(k));
+	BW_ASSERT(dest != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(dest[i] != dest[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels; j++)
+			BW_ASSERT(i == j || src[i] != dest[j]);
+#endif
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_buf_mac(src[i], k, dest[i], n_elems);
+}
+
+static inline void bw_buf_scale_add_multi(
+		const float * const * src,
+		float                 k_scale,
+		float                 k_add,
+		float * const *       dest,
+		size_t                n_channels,
+		size_t                n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT(!bw_is_nan(k_scale));
+	BW_ASSERT(!bw_is_nan(k_add));
+	BW_ASSERT(dest != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(dest[i] != dest[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels; j++)
+			BW_ASSERT(i == j || src[i] != dest[j]);
+#endif
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_buf_scale_add(src[i], k_scale, k_add, dest[i], n_elems);
+}
+
+static inline void bw_buf_scale_ramp_multi(
+		const float * const * src,
+		float                 k_0,
+		float                 k_1,
+		float * const *       dest,
+		size_t                n_channels,
+		size_t                n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT(bw_is_finite(k_0));
+	BW_ASSERT(bw_is_finite(k_1));
+	BW_ASSERT(dest != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(dest[i] != dest[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels; j++)
+			BW_ASSERT(i == j || src[i] != dest[j]);
+#endif
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_buf_scale_ramp(src[i], k_0, k_1, dest[i], n_elems);
+}
+
+static inline void bw_buf_peak_multi(
+		const float * const * src,
+		float *               peak,
+		size_t                n_channels,
+		size_t                n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT(peak != BW_NULL);
+
+	for (size_t i = 0; i < n_channels; i++)
+		peak[i] = bw_buf_peak(src[i], n_elems);
+}
+
+static inline void bw_buf_sum_sq_multi(
+		const float * const * src,
+		float *               sum_sq,
+		size_t                n_channels,
+		size_t                n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT(sum_sq != BW_NULL);
+
+	for (size_t i = 0; i < n_channels; i++)
+		sum_sq[i] = bw_buf_sum_sq(src[i], n_elems);
+}
+
+static inline void bw_buf_interleave(
+		const float * const * src,
+		float * BW_RESTRICT   dest,
+		size_t                n_channels,
+		size_t                n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT(dest != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++) {
+		BW_ASSERT(src[i] != BW_NULL);
+		BW_ASSERT_DEEP(!bw_has_nan(src[i], n_elems));
+		BW_ASSERT(src[i] + n_elems <= dest || src[i] >= dest + n_channels * n_elems);
+	}
+#endif
+
+	if (n_channels == 2) {
+		// stereo is common enough to deserve a loop the compiler can vectorize
+		const float * BW_RESTRICT src0 = src[0];
+		const float * BW_RESTRICT src1 = src[1];
+		for (size_t i = 0; i < n_elems; i++) {
+			dest[i + i] = src0[i];
+			dest[i + i + 1] = src1[i];
+		}
+	} else
+		for (size_t j = 0; j < n_channels; j++) {
+			const float * BW_RESTRICT s = src[j];
+			for (size_t i = 0; i < n_elems; i++)
+				dest[n_channels * i + j] = s[i];
+		}
+
+	BW_ASSERT_DEEP(!bw_has_nan(dest, n_channels * n_elems));
+}
+
+static inline void bw_buf_deinterleave(
+		const float * BW_RESTRICT src,
+		float * const *           dest,
+		size_t                    n_channels,
+		size_t                    n_elems) {
+	BW_ASSERT(src != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(src, n_channels * n_elems));
+	BW_ASSERT(dest != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++) {
+		BW_ASSERT(dest[i] != BW_NULL);
+		BW_ASSERT(dest[i] + n_elems <= src || dest[i] >= src + n_channels * n_elems);
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(dest[i] != dest[j]);
+	}
+#endif
+
+	if (n_channels == 2) {
+		float * BW_RESTRICT dest0 = dest[0];
+		float * BW_RESTRICT dest1 = dest[1];
+		for (size_t i = 0; i < n_elems; i++) {
+			dest0[i] = src[i + i];
+			dest1[i] = src[i + i + 1];
+		}
+	} else
+		for (size_t j = 0; j < n_channels; j++) {
+			float * BW_RESTRICT d = dest[j];
+			for (size_t i = 0; i < n_elems; i++)
+				d[i] = src[n_channels * i + j];
+		}
+
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		BW_ASSERT_DEEP(!bw_has_nan(dest[i], n_elems));
+#endif
+}
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 }
 #endif
@@ -679,6 +1108,135 @@ inline void bufMul(
 	const std::array<float *, N_CHANNELS>       dest,
 	size_t                                      nSamples);
 # endif
+/*! <<<```
+ *
+ *    ##### Brickworks::bufMac()
+ *  ```>>> */
+template<size_t N_CHANNELS>
+inline void bufMac(
+	const float * const * src,
+	float                 k,
+	float * const *       dest,
+	size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufMac(
+	const std::array<const float *, N_CHANNELS> src,
+	float                                       k,
+	const std::array<float *, N_CHANNELS>       dest,
+	size_t                                      nSamples);
+# endif
+/*! <<<```
+ *
+ *    ##### Brickworks::bufScaleAdd()
+ *  ```>>> */
+template<size_t N_CHANNELS>
+inline void bufScaleAdd(
+	const float * const * src,
+	float                 kScale,
+	float                 kAdd,
+	float * const *       dest,
+	size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufScaleAdd(
+	const std::array<const float *, N_CHANNELS> src,
+	float                                       kScale,
+	float                                       kAdd,
+	const std::array<float *, N_CHANNELS>       dest,
+	size_t                                      nSamples);
+# endif
+/*! <<<```
+ *
+ *    ##### Brickworks::bufScaleRamp()
+ *  ```>>> */
+template<size_t N_CHANNELS>
+inline void bufScaleRamp(
+	const float * const * src,
+	float                 k0,
+	float                 k1,
+	float * const *       dest,
+	size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufScaleRamp(
+	const std::array<const float *, N_CHANNELS> src,
+	float                                       k0,
+	float                                       k1,
+	const std::array<float *, N_CHANNELS>       dest,
+	size_t                                      nSamples);
+# endif
+/*! <<<```
+ *
+ *    ##### Brickworks::bufPeak()
+ *  ```>>> */
+template<size_t N_CHANNELS>
+inline void bufPeak(
+	const float * const * src,
+	float *               peak,
+	size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufPeak(
+	const std::array<const float *, N_CHANNELS> src,
+	std::array<float, N_CHANNELS> &             peak,
+	size_t                                      nSamples);
+# endif
+/*! <<<```
+ *
+ *    ##### Brickworks::bufSumSq()
+ *  ```>>> */
+template<size_t N_CHANNELS>
+inline void bufSumSq(
+	const float * const * src,
+	float *               sumSq,
+	size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufSumSq(
+	const std::array<const float *, N_CHANNELS> src,
+	std::array<float, N_CHANNELS> &             sumSq,
+	size_t                                      nSamples);
+# endif
+/*! <<<```
+ *
+ *    ##### Brickworks::bufInterleave()
+ *  ```>>> */
+template<size_t N_CHANNELS>
+inline void bufInterleave(
+	const float * const * src,
+	float * BW_RESTRICT   dest,
+	size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufInterleave(
+	const std::array<const float *, N_CHANNELS> src,
+	float * BW_RESTRICT                         dest,
+	size_t                                      nSamples);
+# endif
+/*! <<<```
+ *
+ *    ##### Brickworks::bufDeinterleave()
+ *  ```>>> */
+template<size_t N_CHANNELS>
+inline void bufDeinterleave(
+	const float * BW_RESTRICT src,
+	float * const *           dest,
+	size_t                    nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufDeinterleave(
+	const float * BW_RESTRICT             src,
+	const std::array<float *, N_CHANNELS> dest,
+	size_t                                nSamples);
+# endif
 /*! <<<```
  *  }}} */
 
@@ -821,6 +1379,142 @@ inline void bufMul(
 }
 # endif
 
+template<size_t N_CHANNELS>
+inline void bufMac(
+		const float * const * src,
+		float                 k,
+		float * const *       dest,
+		size_t                nSamples) {
+	bw_buf_mac_multi(src, k, dest, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufMac(
+		const std::array<const float *, N_CHANNELS> src,
+		float                                       k,
+		const std::array<float *, N_CHANNELS>       dest,
+		size_t                                      nSamples) {
+	bufMac<N_CHANNELS>(src.data(), k, dest.data(), nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void bufScaleAdd(
+		const float * const * src,
+		float                 kScale,
+		float                 kAdd,
+		float * const *       dest,
+		size_t                nSamples) {
+	bw_buf_scale_add_multi(src, kScale, kAdd, dest, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufScaleAdd(
+		const std::array<const float *, N_CHANNELS> src,
+		float                                       kScale,
+		float                                       kAdd,
+		const std::array<float *, N_CHANNELS>       dest,
+		size_t                                      nSamples) {
+	bufScaleAdd<N_CHANNELS>(src.data(), kScale, kAdd, dest.data(), nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void bufScaleRamp(
+		const float * const * src,
+		float                 k0,
+		float                 k1,
+		float * const *       dest,
+		size_t                nSamples) {
+	bw_buf_scale_ramp_multi(src, k0, k1, dest, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufScaleRamp(
+		const std::array<const float *, N_CHANNELS> src,
+		float                                       k0,
+		float                                       k1,
+		const std::array<float *, N_CHANNELS>       dest,
+		size_t                                      nSamples) {
+	bufScaleRamp<N_CHANNELS>(src.data(), k0, k1, dest.data(), nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void bufPeak(
+		const float * const * src,
+		float *               peak,
+		size_t                nSamples) {
+	bw_buf_peak_multi(src, peak, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufPeak(
+		const std::array<const float *, N_CHANNELS> src,
+		std::array<float, N_CHANNELS> &             peak,
+		size_t                                      nSamples) {
+	bufPeak<N_CHANNELS>(src.data(), peak.data(), nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void bufSumSq(
+		const float * const * src,
+		float *               sumSq,
+		size_t                nSamples) {
+	bw_buf_sum_sq_multi(src, sumSq, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufSumSq(
+		const std::array<const float *, N_CHANNELS> src,
+		std::array<float, N_CHANNELS> &             sumSq,
+		size_t                                      nSamples) {
+	bufSumSq<N_CHANNELS>(src.data(), sumSq.data(), nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void bufInterleave(
+		const float * const * src,
+		float * BW_RESTRICT   dest,
+		size_t                nSamples) {
+	bw_buf_interleave(src, dest, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufInterleave(
+		const std::array<const float *, N_CHANNELS> src,
+		float * BW_RESTRICT                         dest,
+		size_t                                      nSamples) {
+	bufInterleave<N_CHANNELS>(src.data(), dest, nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void bufDeinterleave(
+		const float * BW_RESTRICT src,
+		float * const *           dest,
+		size_t                    nSamples) {
+	bw_buf_deinterleave(src, dest, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void bufDeinterleave(
+		const float * BW_RESTRICT             src,
+		const std::array<float *, N_CHANNELS> dest,
+		size_t                                nSamples) {
+	bufDeinterleave<N_CHANNELS>(src, dest.data(), nSamples);
+}
+# endif
+
 }
 #endif
 
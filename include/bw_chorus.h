@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.3.2 }}}
+ *  version {{{ 1.4.0 }}}
  *  requires {{{
  *    bw_buf bw_comb bw_common bw_delay bw_gain bw_math bw_one_pole bw_osc_sin
  *    bw_phase_gen
@@ -36,6 +36,12 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.4.0</strong>:
+ *        <ul>
+ *          <li>The sinusoidal LFO now uses the recursive mode of
+ *              bw_osc_sin.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.3.2</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -439,6 +445,7 @@ struct bw_chorus_coeffs {
 	// Sub-components
 	bw_phase_gen_coeffs		phase_gen_coeffs;
 	bw_phase_gen_state		phase_gen_state;
+	bw_osc_sin_state		osc_sin_state;
 	bw_comb_coeffs			comb_coeffs;
 
 	// Parameters
@@ -536,7 +543,7 @@ static inline void bw_chorus_reset_coeffs(
 	bw_phase_gen_reset_coeffs(&coeffs->phase_gen_coeffs);
 	float p, pi;
 	bw_phase_gen_reset_state(&coeffs->phase_gen_coeffs, &coeffs->phase_gen_state, 0.f, &p, &pi);
-	const float mod = coeffs->delay + coeffs->amount * bw_osc_sin_process1(p);
+	const float mod = coeffs->delay + coeffs->amount * bw_osc_sin_reset_state(&coeffs->osc_sin_state, p, pi);
 	bw_comb_set_delay_ff(&coeffs->comb_coeffs, mod);
 	bw_comb_reset_coeffs(&coeffs->comb_coeffs);
 
@@ -626,7 +633,7 @@ static inline void bw_chorus_update_coeffs_audio(
 	bw_phase_gen_update_coeffs_audio(&coeffs->phase_gen_coeffs);
 	float p, pi;
 	bw_phase_gen_process1(&coeffs->phase_gen_coeffs, &coeffs->phase_gen_state, &p, &pi);
-	const float mod = coeffs->delay + coeffs->amount * bw_osc_sin_process1(p);
+	const float mod = coeffs->delay + coeffs->amount * bw_osc_sin_process1_rec(&coeffs->osc_sin_state, p, pi);
 	bw_comb_set_delay_ff(&coeffs->comb_coeffs, mod);
 	bw_comb_update_coeffs_ctrl(&coeffs->comb_coeffs);
 	bw_comb_update_coeffs_audio(&coeffs->comb_coeffs);
@@ -847,6 +854,8 @@ static inline char bw_chorus_coeffs_is_valid(
 #ifdef BW_DEBUG_DEEP
 	if (coeffs->state >= bw_chorus_coeffs_state_reset_coeffs && !bw_phase_gen_state_is_valid(&coeffs->phase_gen_coeffs, &coeffs->phase_gen_state))
 		return 0;
+	if (coeffs->state >= bw_chorus_coeffs_state_reset_coeffs && !bw_osc_sin_state_is_valid(&coeffs->osc_sin_state))
+		return 0;
 #endif
 
 	return bw_comb_coeffs_is_valid(&coeffs->comb_coeffs);
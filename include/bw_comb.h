@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.3.2 }}}
+ *  version {{{ 1.4.0 }}}
  *  requires {{{
  *    bw_buf bw_common bw_delay bw_gain bw_math bw_one_pole
  *  }}}
@@ -37,6 +37,18 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.4.0</strong>:
+ *        <ul>
+ *          <li>Added <code>bw_comb_is_silent()</code> and corresponding C++
+ *              API.</li>
+ *          <li><code>bw_comb_process()</code> and
+ *              <code>bw_comb_process_multi()</code> now skip delay line
+ *              accesses and output zeros when the comb filter is silent and
+ *              the input is all zeros.</li>
+ *          <li>Fixed typo in debugging code of
+ *              <code>bw_comb_process_multi()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.3.2</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -347,6 +359,20 @@ static inline void bw_comb_set_coeff_fb(
  *
  *    Default value: `0.f`.
  *
+ *    #### bw_comb_is_silent()
+ *  ```>>> */
+static inline char bw_comb_is_silent(
+	const bw_comb_coeffs * BW_RESTRICT coeffs,
+	const bw_comb_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Returns non-`0` if the internal delay line in `state` only contains
+ *    zeros (see `bw_delay_is_silent()`), that is, if the comb filter would
+ *    output zeros for as long as the input is zero, `0` otherwise.
+ *
+ *    `bw_comb_process()` and `bw_comb_process_multi()` only update `coeffs`
+ *    and output zeros when this condition is met and the input buffers are
+ *    all zeros.
+ *
  *    #### bw_comb_coeffs_is_valid()
  *  ```>>> */
 static inline char bw_comb_coeffs_is_valid(
@@ -386,11 +412,13 @@ static inline char bw_comb_state_is_valid(
  * change at any time in future versions. Please, do not use it directly. */
 
 #ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_buf.h"
 # include "bw_delay.h"
 # include "bw_gain.h"
 # include "bw_one_pole.h"
 # include "bw_math.h"
 #else
+# include <bw_buf.h>
 # include <bw_delay.h>
 # include <bw_gain.h>
 # include <bw_one_pole.h>
@@ -732,10 +760,15 @@ static inline void bw_comb_process(
 	BW_ASSERT(y != BW_NULL);
 
 	bw_comb_update_coeffs_ctrl(coeffs);
-	for (size_t i = 0; i < n_samples; i++) {
-		bw_comb_update_coeffs_audio(coeffs);
-		y[i] = bw_comb_process1(coeffs, state, x[i]);
-	}
+	if (bw_comb_is_silent(coeffs, state) && bw_has_only_zeros(x, n_samples)) {
+		for (size_t i = 0; i < n_samples; i++)
+			bw_comb_update_coeffs_audio(coeffs);
+		bw_buf_fill(0.f, y, n_samples);
+	} else
+		for (size_t i = 0; i < n_samples; i++) {
+			bw_comb_update_coeffs_audio(coeffs);
+			y[i] = bw_comb_process1(coeffs, state, x[i]);
+		}
 
 	BW_ASSERT_DEEP(bw_comb_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_comb_coeffs_state_reset_coeffs);
@@ -759,7 +792,7 @@ static inline void bw_comb_process_multi(
 	for (size_t i = 0; i < n_channels; i++) {
 		BW_ASSERT(state[i] != BW_NULL);
 		BW_ASSERT_DEEP(bw_comb_state_is_valid(coeffs, state[i]));
-		BW_ASSERT_DEEP(state->state[i] >= bw_comb_state_state_reset_state);
+		BW_ASSERT_DEEP(state[i]->state >= bw_comb_state_state_reset_state);
 	}
 	for (size_t i = 0; i < n_channels; i++)
 		for (size_t j = i + 1; j < n_channels; j++)
@@ -781,12 +814,22 @@ static inline void bw_comb_process_multi(
 			BW_ASSERT(i == j || x[i] != y[j]);
 #endif
 
+	char silent = 1;
+	for (size_t j = 0; j < n_channels && silent; j++)
+		silent = bw_comb_is_silent(coeffs, state[j]) && bw_has_only_zeros(x[j], n_samples);
+
 	bw_comb_update_coeffs_ctrl(coeffs);
-	for (size_t i = 0; i < n_samples; i++) {
-		bw_comb_update_coeffs_audio(coeffs);
+	if (silent) {
+		for (size_t i = 0; i < n_samples; i++)
+			bw_comb_update_coeffs_audio(coeffs);
 		for (size_t j = 0; j < n_channels; j++)
-			y[j][i] = bw_comb_process1(coeffs, state[j], x[j][i]);
-	}
+			bw_buf_fill(0.f, y[j], n_samples);
+	} else
+		for (size_t i = 0; i < n_samples; i++) {
+			bw_comb_update_coeffs_audio(coeffs);
+			for (size_t j = 0; j < n_channels; j++)
+				y[j][i] = bw_comb_process1(coeffs, state[j], x[j][i]);
+		}
 
 	BW_ASSERT_DEEP(bw_comb_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_comb_coeffs_state_reset_coeffs);
@@ -870,6 +913,19 @@ static inline void bw_comb_set_coeff_fb(
 	BW_ASSERT_DEEP(coeffs->state >= bw_comb_coeffs_state_init);
 }
 
+static inline char bw_comb_is_silent(
+		const bw_comb_coeffs * BW_RESTRICT coeffs,
+		const bw_comb_state * BW_RESTRICT  state) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_comb_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_comb_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_comb_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_comb_state_state_reset_state);
+
+	return bw_delay_is_silent(&coeffs->delay_coeffs, &state->delay_state);
+}
+
 static inline char bw_comb_coeffs_is_valid(
 		const bw_comb_coeffs * BW_RESTRICT coeffs) {
 	BW_ASSERT(coeffs != BW_NULL);
@@ -1016,6 +1072,9 @@ public:
 
 	void setCoeffFB(
 		float value);
+
+	char isSilent(
+		size_t channel);
 /*! <<<...
  *  }
  *  ```
@@ -1168,6 +1227,12 @@ inline void Comb<N_CHANNELS>::setCoeffFB(
 	bw_comb_set_coeff_fb(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline char Comb<N_CHANNELS>::isSilent(
+		size_t channel) {
+	return bw_comb_is_silent(&coeffs, states + channel);
+}
+
 }
 #endif
 
@@ -20,13 +20,24 @@
 
 /*!
  *  module_type {{{ foundation }}}
- *  version {{{ 1.2.1 }}}
+ *  version {{{ 1.3.0 }}}
  *  description {{{
  *    A common header to make sure that a bunch of basic definitions are
  *    available and consistent for all modules.
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Added <code>BW_DENORMAL_KILL</code>,
+ *              <code>BW_FLUSH_DENORMALS_BEGIN</code>,
+ *              <code>BW_FLUSH_DENORMALS_END</code>,
+ *              <code>bw_kill_denormal()</code>,
+ *              <code>bw_flush_denormals_begin()</code>,
+ *              <code>bw_flush_denormals_end()</code>, and C++ API.</li>
+ *          <li>Added <code>bw_has_only_zeros()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.1</strong>:
  *        <ul>
  *          <li>Fixed typos in the documentation of <code>bw_has_inf()</code>,
@@ -273,6 +284,43 @@
 #  define BW_ASSERT_DEEP(ignore) ((void)0)
 # endif
 #endif
+/*! ...
+ *
+ *    #### BW_DENORMAL_KILL
+ *
+ *    Denormal numbers can make processing dramatically slower on some
+ *    platforms, typically when the states of feedback paths decay towards zero
+ *    after the input signal is gone.
+ *
+ *    If `BW_DENORMAL_KILL` is defined, modules that keep decaying states
+ *    flush to `0.f` such states when their absolute value is smaller than
+ *    `7.888609052210118e-31f` (i.e., 2^-100, roughly -600 dB), using
+ *    `bw_kill_denormal()`. This affects bw_delay (and hence modules using it,
+ *    such as bw_chorus, bw_comb, and bw_reverb), bw_lp1 (and hence modules
+ *    using it), bw_one_pole, and bw_svf.
+ *
+ *    #### BW_FLUSH_DENORMALS_BEGIN and BW_FLUSH_DENORMALS_END
+ *
+ *    These macros respectively open and close a block of code executed with
+ *    the floating-point environment of the calling thread set so that
+ *    denormals are flushed to zero, by means of `bw_flush_denormals_begin()`
+ *    and `bw_flush_denormals_end()`. The previous environment is restored at
+ *    the end of the block.
+ *
+ *    They must be used in pairs within the same scope, e.g.:
+ *
+ *    ```
+ *    BW_FLUSH_DENORMALS_BEGIN
+ *    bw_reverb_process(&coeffs, &state, x_l, x_r, y_l, y_r, n_samples);
+ *    BW_FLUSH_DENORMALS_END
+ *    ```
+ *  >>> */
+#define BW_FLUSH_DENORMALS_BEGIN \
+	{ \
+		const uint32_t bw_flush_denormals_fp_state = bw_flush_denormals_begin();
+#define BW_FLUSH_DENORMALS_END \
+		bw_flush_denormals_end(bw_flush_denormals_fp_state); \
+	}
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 extern "C" {
@@ -330,12 +378,50 @@ static inline char bw_has_only_finite(
  *    finds finite values (neither NaN nor positive or negative infinity), `0`
  *    otherwise.
  *
+ *    #### bw_has_only_zeros()
+ *  ```>>> */
+static inline char bw_has_only_zeros(
+	const float * BW_RESTRICT x,
+	size_t                    n_elems);
+/*! <<<```
+ *    Scans the first `n_elems` in buffer `x` and returns non-`0` if it only
+ *    finds zeros (positive or negative), `0` otherwise.
+ *
  *    #### bw_hash_sdbm()
  *  ```>>> */
 static inline uint32_t bw_hash_sdbm(
 	const char * BW_RESTRICT string);
 /*! <<<```
  *    Returns the sdbm hash of the given `string`.
+ *
+ *    #### bw_kill_denormal()
+ *  ```>>> */
+static inline float bw_kill_denormal(
+	float x);
+/*! <<<```
+ *    Returns `0.f` if the absolute value of `x` is smaller than
+ *    `7.888609052210118e-31f` (i.e., 2^-100), `x` otherwise.
+ *
+ *    #### bw_flush_denormals_begin()
+ *  ```>>> */
+static inline uint32_t bw_flush_denormals_begin(void);
+/*! <<<```
+ *    Sets the floating-point environment of the calling thread so that
+ *    denormal results are flushed to zero and, where supported, denormal
+ *    operands are treated as zero. Returns a value representing the previous
+ *    floating-point environment, to be passed to `bw_flush_denormals_end()`.
+ *
+ *    This is supported on x86 with SSE (FTZ and DAZ flags) and on ARM with VFP
+ *    or AArch64 (FZ flag). On other platforms it does nothing and returns `0`.
+ *
+ *    #### bw_flush_denormals_end()
+ *  ```>>> */
+static inline void bw_flush_denormals_end(
+	uint32_t fp_state);
+/*! <<<```
+ *    Restores the floating-point environment of the calling thread to
+ *    `fp_state`, as returned by a previous call to
+ *    `bw_flush_denormals_begin()`.
  *  }}} */
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
@@ -347,6 +433,21 @@ static inline uint32_t bw_hash_sdbm(
 /* WARNING: This part of the file is not part of the public API. Its content may
  * change at any time in future versions. Please, do not use it directly. */
 
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+# include <xmmintrin.h>
+# define BW_FP_ENV_SSE
+#elif defined(__GNUC__) && defined(__aarch64__)
+# define BW_FP_ENV_AARCH64
+#elif defined(__GNUC__) && defined(__arm__) && defined(__ARM_FP)
+# define BW_FP_ENV_ARM
+#endif
+
+#ifdef BW_DENORMAL_KILL
+# define BW_KILL_DENORMAL_STATE(x)	bw_kill_denormal(x)
+#else
+# define BW_KILL_DENORMAL_STATE(x)	(x)
+#endif
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 extern "C" {
 #endif
@@ -399,6 +500,15 @@ static inline char bw_has_only_finite(
 	return ret;
 }
 
+static inline char bw_has_only_zeros(
+		const float * BW_RESTRICT x,
+		size_t                    n_elems) {
+	char ret = 1;
+	for (size_t i = 0; i < n_elems && ret; i++)
+		ret = x[i] == 0.f;
+	return ret;
+}
+
 static inline uint32_t bw_hash_sdbm(
 		const char * BW_RESTRICT string) {
 	uint32_t hash = 0;
@@ -407,8 +517,99 @@ static inline uint32_t bw_hash_sdbm(
 	return hash;
 }
 
+static inline float bw_kill_denormal(
+		float x) {
+	union { uint32_t u; float f; } v;
+	v.f = x;
+	return (v.u & 0x7fffffff) < 0x0d800000 ? 0.f : x;
+}
+
+static inline uint32_t bw_flush_denormals_begin(void) {
+#if defined(BW_FP_ENV_SSE)
+	const uint32_t fp_state = _mm_getcsr();
+	_mm_setcsr(fp_state | 0x8040); // FTZ | DAZ
+	return fp_state;
+#elif defined(BW_FP_ENV_AARCH64)
+	uint64_t fpcr;
+	__asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+	__asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | 0x1000000)); // FZ
+	return (uint32_t)fpcr;
+#elif defined(BW_FP_ENV_ARM)
+	uint32_t fpscr;
+	__asm__ __volatile__("vmrs %0, fpscr" : "=r"(fpscr));
+	__asm__ __volatile__("vmsr fpscr, %0" : : "r"(fpscr | 0x1000000)); // FZ
+	return fpscr;
+#else
+	return 0;
+#endif
+}
+
+static inline void bw_flush_denormals_end(
+		uint32_t fp_state) {
+#if defined(BW_FP_ENV_SSE)
+	_mm_setcsr(fp_state);
+#elif defined(BW_FP_ENV_AARCH64)
+	const uint64_t fpcr = fp_state;
+	__asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#elif defined(BW_FP_ENV_ARM)
+	__asm__ __volatile__("vmsr fpscr, %0" : : "r"(fp_state));
+#else
+	(void)fp_state;
+#endif
+}
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 }
 #endif
 
+#if !defined(BW_NO_CXX) && defined(__cplusplus)
+
+namespace Brickworks {
+
+/*** Public C++ API ***/
+
+/*! api_cpp {{{
+ *    ##### Brickworks::FlushDenormals
+ *  ```>>> */
+class FlushDenormals {
+public:
+	FlushDenormals();
+
+	~FlushDenormals();
+/*! <<<...
+ *  }
+ *  ```
+ *
+ *    Scope guard that calls `bw_flush_denormals_begin()` when constructed and
+ *    `bw_flush_denormals_end()` when destroyed, e.g.:
+ *
+ *    ```
+ *    {
+ *        Brickworks::FlushDenormals fd;
+ *        reverb.process(x, y, nSamples);
+ *    }
+ *    ```
+ *  }}} */
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+private:
+	uint32_t	fpState;
+};
+
+inline FlushDenormals::FlushDenormals() {
+	fpState = bw_flush_denormals_begin();
+}
+
+inline FlushDenormals::~FlushDenormals() {
+	bw_flush_denormals_end(fpState);
+}
+
+}
+
+#endif
+
 #endif
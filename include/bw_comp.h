@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{
  *    bw_common bw_env_follow bw_gain bw_math bw_one_pole
  *  }}}
@@ -29,6 +29,12 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -501,7 +507,7 @@ static inline void bw_comp_do_update_coeffs_audio(
 	bw_gain_update_coeffs_audio(&coeffs->gain_coeffs);
 	bw_one_pole_process1(&coeffs->smooth_coeffs, &coeffs->smooth_thresh_state, coeffs->thresh);
 	coeffs->kc = 1.f - bw_one_pole_process1(&coeffs->smooth_coeffs, &coeffs->smooth_ratio_state, coeffs->ratio);
-	coeffs->lt = bw_log2f(bw_one_pole_get_y_z1(&coeffs->smooth_thresh_state));
+	coeffs->lt = bw_log2f_ctrl(bw_one_pole_get_y_z1(&coeffs->smooth_thresh_state));
 }
 
 static inline void bw_comp_reset_coeffs(
@@ -616,7 +622,7 @@ static inline void bw_comp_update_coeffs_audio(
 	bw_gain_update_coeffs_audio(&coeffs->gain_coeffs);
 	bw_one_pole_process1(&coeffs->smooth_coeffs, &coeffs->smooth_thresh_state, coeffs->thresh);
 	coeffs->kc = 1.f - bw_one_pole_process1(&coeffs->smooth_coeffs, &coeffs->smooth_ratio_state, coeffs->ratio);
-	coeffs->lt = bw_log2f(bw_one_pole_get_y_z1(&coeffs->smooth_thresh_state));
+	coeffs->lt = bw_log2f_ctrl(bw_one_pole_get_y_z1(&coeffs->smooth_thresh_state));
 
 	BW_ASSERT_DEEP(bw_comp_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_comp_coeffs_state_reset_coeffs);
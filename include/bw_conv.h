@@ -0,0 +1,1130 @@
+/*
+ * Brickworks
+ *
+ * Copyright (C) 2026 Orastron Srl unipersonale
+ *
+ * Brickworks is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * Brickworks is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Brickworks.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File author: Stefano D'Angelo
+ */
+
+/*!
+ *  module_type {{{ dsp }}}
+ *  version {{{ 1.0.0 }}}
+ *  requires {{{ bw_buf bw_common bw_math }}}
+ *  description {{{
+ *    Uniformly partitioned convolution, suitable for cabinet and room impulse
+ *    responses.
+ *
+ *    Each input channel is convolved with up to `n_irs` impulse responses
+ *    (IRs) at once, computing the input spectrum only once for all of them.
+ *    Impulse responses are split into partitions of `partition_size` samples
+ *    and convolution is performed in the frequency domain using the
+ *    overlap-save method and a frequency-domain delay line.
+ *
+ *    Output is delayed by `partition_size` samples, hence this parameter can
+ *    be used to trade latency for CPU usage. Processing is performed in
+ *    bursts every `partition_size` samples.
+ *
+ *    Fast Fourier transforms are computed internally using a radix-4
+ *    (radix-2 for the last stage, if needed) decimation-in-frequency
+ *    algorithm on `partition_size` complex values, which are then
+ *    rearranged into the spectrum of `2 * partition_size` real values.
+ *
+ *    See, e.g.,
+ *
+ *    F. Wefers, "Partitioned convolution algorithms for real-time
+ *    auralization", Ph.D. thesis, RWTH Aachen University, 2014.
+ *  }}}
+ *  changelog {{{
+ *    <ul>
+ *      <li>Version <strong>1.0.0</strong>:
+ *        <ul>
+ *          <li>First release.</li>
+ *        </ul>
+ *      </li>
+ *    </ul>
+ *  }}}
+ */
+
+#ifndef BW_CONV_H
+#define BW_CONV_H
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_common.h"
+#else
+# include <bw_common.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+/*** Public API ***/
+
+/*! api {{{
+ *    #### bw_conv_coeffs
+ *  ```>>> */
+typedef struct bw_conv_coeffs bw_conv_coeffs;
+/*! <<<```
+ *    Coefficients and related.
+ *
+ *    #### bw_conv_state
+ *  ```>>> */
+typedef struct bw_conv_state bw_conv_state;
+/*! <<<```
+ *    Internal state and related.
+ *
+ *    #### bw_conv_init()
+ *  ```>>> */
+static inline void bw_conv_init(
+	bw_conv_coeffs * BW_RESTRICT coeffs,
+	size_t                       partition_size,
+	size_t                       ir_length_max,
+	size_t                       n_irs);
+/*! <<<```
+ *    Initializes input parameter values in `coeffs` so that `n_irs` impulse
+ *    responses of up to `ir_length_max` samples each can be used, split into
+ *    partitions of `partition_size` samples.
+ *
+ *    `partition_size` must be a power of `2` greater than or equal to `4`,
+ *    while `ir_length_max` and `n_irs` must be positive.
+ *
+ *    #### bw_conv_coeffs_mem_req()
+ *  ```>>> */
+static inline size_t bw_conv_coeffs_mem_req(
+	const bw_conv_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the size, in bytes, of contiguous memory to be supplied to
+ *    `bw_conv_coeffs_mem_set()` using `coeffs`.
+ *
+ *    #### bw_conv_coeffs_mem_set()
+ *  ```>>> */
+static inline void bw_conv_coeffs_mem_set(
+	bw_conv_coeffs * BW_RESTRICT coeffs,
+	void * BW_RESTRICT           mem);
+/*! <<<```
+ *    Associates the contiguous memory block `mem` to the given `coeffs`.
+ *
+ *    Such memory holds precomputed data and the spectra of impulse responses,
+ *    which are all initially set to silence.
+ *
+ *    `mem` must be aligned for `size_t` values.
+ *
+ *    #### bw_conv_set_ir()
+ *  ```>>> */
+static inline void bw_conv_set_ir(
+	bw_conv_coeffs * BW_RESTRICT coeffs,
+	size_t                       ir,
+	const float * BW_RESTRICT    x,
+	size_t                       length);
+/*! <<<```
+ *    Sets the `ir`-th impulse response in `coeffs` to the first `length`
+ *    samples of the buffer `x`.
+ *
+ *    `ir` must be less than `n_irs` and `length` must be less than or equal to
+ *    `ir_length_max` (see `bw_conv_init()`). If `length` is `0`, `x` can be
+ *    `BW_NULL`.
+ *
+ *    This function computes the spectra of all partitions of the impulse
+ *    response. It does not allocate memory and can be called while processing
+ *    (the change is abrupt), yet it might be too computationally expensive to
+ *    be called from the audio thread.
+ *
+ *    #### bw_conv_reset_coeffs()
+ *  ```>>> */
+static inline void bw_conv_reset_coeffs(
+	bw_conv_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Resets coefficients in `coeffs` to assume their target values.
+ *
+ *    #### bw_conv_mem_req()
+ *  ```>>> */
+static inline size_t bw_conv_mem_req(
+	const bw_conv_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the size, in bytes, of contiguous memory to be supplied to
+ *    `bw_conv_mem_set()` using `coeffs`.
+ *
+ *    #### bw_conv_mem_set()
+ *  ```>>> */
+static inline void bw_conv_mem_set(
+	const bw_conv_coeffs * BW_RESTRICT coeffs,
+	bw_conv_state * BW_RESTRICT        state,
+	void * BW_RESTRICT                 mem);
+/*! <<<```
+ *    Associates the contiguous memory block `mem` to the given `state` using
+ *    `coeffs`.
+ *
+ *    #### bw_conv_reset_state()
+ *  ```>>> */
+static inline void bw_conv_reset_state(
+	const bw_conv_coeffs * BW_RESTRICT coeffs,
+	bw_conv_state * BW_RESTRICT        state,
+	float                              x_0,
+	float * BW_RESTRICT                y_0);
+/*! <<<```
+ *    Resets the given `state` to its initial values using the given `coeffs`
+ *    and the initial input value `x_0`.
+ *
+ *    The corresponding initial output values, one per impulse response, are
+ *    written into the `y_0` array, if not `BW_NULL`.
+ *
+ *    #### bw_conv_reset_state_multi()
+ *  ```>>> */
+static inline void bw_conv_reset_state_multi(
+	const bw_conv_coeffs * BW_RESTRICT              coeffs,
+	bw_conv_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float *                                   x_0,
+	float *                                         y_0,
+	size_t                                          n_channels);
+/*! <<<```
+ *    Resets each of the `n_channels` `state`s to its initial values using the
+ *    given `coeffs` and the corresponding initial input value in the `x_0`
+ *    array.
+ *
+ *    The corresponding initial output values are written into the `y_0` array,
+ *    if not `BW_NULL`, where `y_0[i * n_irs + j]` is the value for the `i`-th
+ *    channel and the `j`-th impulse response.
+ *
+ *    #### bw_conv_process()
+ *  ```>>> */
+static inline void bw_conv_process(
+	const bw_conv_coeffs * BW_RESTRICT coeffs,
+	bw_conv_state * BW_RESTRICT        state,
+	const float *                      x,
+	float * const *                    y,
+	size_t                             n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the input buffer `x` and fills the
+ *    first `n_samples` of the `n_irs` output buffers `y`, where `y[j]` is
+ *    convolved with the `j`-th impulse response, while using and updating
+ *    `state`.
+ *
+ *    `x` may coincide with any of the output buffers.
+ *
+ *    #### bw_conv_process_multi()
+ *  ```>>> */
+static inline void bw_conv_process_multi(
+	const bw_conv_coeffs * BW_RESTRICT              coeffs,
+	bw_conv_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float * const *                           x,
+	float * const *                                 y,
+	size_t                                          n_channels,
+	size_t                                          n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the `n_channels` input buffers `x` and
+ *    fills the first `n_samples` of the `n_channels * n_irs` output buffers
+ *    `y`, while using and updating each of the `n_channels` `state`s.
+ *
+ *    `y[i * n_irs + j]` is the output buffer for the `i`-th channel convolved
+ *    with the `j`-th impulse response.
+ *
+ *    #### bw_conv_get_latency()
+ *  ```>>> */
+static inline size_t bw_conv_get_latency(
+	const bw_conv_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the latency, in samples, introduced by processing, which is equal
+ *    to `partition_size` (see `bw_conv_init()`).
+ *
+ *    #### bw_conv_coeffs_is_valid()
+ *  ```>>> */
+static inline char bw_conv_coeffs_is_valid(
+	const bw_conv_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Tries to determine whether `coeffs` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    `coeffs` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_conv_coeffs`.
+ *
+ *    #### bw_conv_state_is_valid()
+ *  ```>>> */
+static inline char bw_conv_state_is_valid(
+	const bw_conv_coeffs * BW_RESTRICT coeffs,
+	const bw_conv_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Tries to determine whether `state` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    If `coeffs` is not `BW_NULL` extra cross-checks might be performed
+ *    (`state` is supposed to be associated to `coeffs`).
+ *
+ *    `state` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_conv_state`.
+ *  }}} */
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_buf.h"
+# include "bw_math.h"
+#else
+# include <bw_buf.h>
+# include <bw_math.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+#ifdef BW_DEBUG_DEEP
+enum bw_conv_coeffs_state {
+	bw_conv_coeffs_state_invalid,
+	bw_conv_coeffs_state_init,
+	bw_conv_coeffs_state_mem_set,
+	bw_conv_coeffs_state_reset_coeffs
+};
+
+enum bw_conv_state_state {
+	bw_conv_state_state_invalid,
+	bw_conv_state_state_mem_set,
+	bw_conv_state_state_reset_state
+};
+#endif
+
+struct bw_conv_coeffs {
+#ifdef BW_DEBUG_DEEP
+	uint32_t			hash;
+	enum bw_conv_coeffs_state	state;
+	uint32_t			reset_id;
+#endif
+
+	// Coefficients
+	size_t				part_len;	// partition size = half FFT size = complex FFT size
+	size_t				n_parts;
+	size_t				n_irs;
+	size_t				ir_len_max;
+	size_t				stride;		// distance between spectra (>= part_len + 1 bins, multiple of 4)
+
+	// Memory
+	size_t * BW_RESTRICT		rev;		// bit reversal permutation
+	float * BW_RESTRICT		tw_re;		// cos(2 * pi * k / (2 * part_len))
+	float * BW_RESTRICT		tw_im;		// -sin(2 * pi * k / (2 * part_len))
+	float * BW_RESTRICT		buf;		// 2 * part_len, for bw_conv_set_ir()
+	float * BW_RESTRICT		z_re;		// part_len, for bw_conv_set_ir()
+	float * BW_RESTRICT		z_im;		// part_len, for bw_conv_set_ir()
+	float * BW_RESTRICT		h_re;		// n_irs * n_parts spectra, scaled by 1 / (2 * part_len)
+	float * BW_RESTRICT		h_im;
+	float * BW_RESTRICT		h_sum;		// n_irs, sum of IR samples
+};
+
+struct bw_conv_state {
+#ifdef BW_DEBUG_DEEP
+	uint32_t			hash;
+	enum bw_conv_state_state	state;
+	uint32_t			coeffs_reset_id;
+#endif
+
+	// States
+	float * BW_RESTRICT		x_buf;		// 2 * part_len, last two input partitions
+	float * BW_RESTRICT		t_buf;		// 2 * part_len, inverse FFT output
+	float * BW_RESTRICT		z_re;		// part_len
+	float * BW_RESTRICT		z_im;		// part_len
+	float * BW_RESTRICT		acc_re;		// 1 spectrum
+	float * BW_RESTRICT		acc_im;
+	float * BW_RESTRICT		fdl_re;		// n_parts spectra, frequency-domain delay line
+	float * BW_RESTRICT		fdl_im;
+	float * BW_RESTRICT		y_buf;		// n_irs * part_len, current output partitions
+	size_t				pos;
+	size_t				fdl_idx;
+};
+
+// cos(2 * pi * k / n) and sin(2 * pi * k / n), computed in double precision
+// and independently for each k, so that FFT twiddle factors are accurate
+static inline void bw_conv_cos_sin(
+		size_t              k,
+		size_t              n,
+		float * BW_RESTRICT c,
+		float * BW_RESTRICT s) {
+	const size_t q = (4 * k + (n >> 1)) / n;
+	const double a = 6.283185307179586 * ((double)k - 0.25 * (double)q * (double)n) / (double)n; // in [-pi/4, pi/4]
+	const double a2 = a * a;
+	double ca = 1.0, sa = a, tc = 1.0, ts = a;
+	for (int i = 1; i <= 10; i++) {
+		tc *= -a2 / ((2 * i - 1) * (2 * i));
+		ts *= -a2 / ((2 * i) * (2 * i + 1));
+		ca += tc;
+		sa += ts;
+	}
+	switch (q & 3) {
+	case 0:
+		*c = (float)ca;
+		*s = (float)sa;
+		break;
+	case 1:
+		*c = (float)-sa;
+		*s = (float)ca;
+		break;
+	case 2:
+		*c = (float)-ca;
+		*s = (float)-sa;
+		break;
+	default:
+		*c = (float)sa;
+		*s = (float)-ca;
+		break;
+	}
+}
+
+// In-place forward complex FFT of part_len values, split into real and
+// imaginary parts. Radix-4 butterflies are two fused radix-2 DIF stages, so
+// that output is in bit-reversed order whatever the number of stages.
+static inline void bw_conv_fft(
+		const bw_conv_coeffs * BW_RESTRICT coeffs,
+		float * BW_RESTRICT                re,
+		float * BW_RESTRICT                im) {
+	const size_t n = coeffs->part_len;
+	size_t h = n;
+	for (; h >= 4; h >>= 2) {
+		const size_t q = h >> 2;
+		const size_t s = (n / h) << 1; // twiddle table stride, table size is 2 * n
+		for (size_t g = 0; g < n; g += h)
+			for (size_t j = 0; j < q; j++) {
+				const size_t i0 = g + j;
+				const size_t i1 = i0 + q;
+				const size_t i2 = i1 + q;
+				const size_t i3 = i2 + q;
+				const float t0r = re[i0] + re[i2];
+				const float t0i = im[i0] + im[i2];
+				const float t1r = re[i0] - re[i2];
+				const float t1i = im[i0] - im[i2];
+				const float t2r = re[i1] + re[i3];
+				const float t2i = im[i1] + im[i3];
+				const float t3r = re[i1] - re[i3];
+				const float t3i = im[i1] - im[i3];
+				const float w1r = coeffs->tw_re[j * s];
+				const float w1i = coeffs->tw_im[j * s];
+				const float w2r = coeffs->tw_re[2 * j * s];
+				const float w2i = coeffs->tw_im[2 * j * s];
+				const float w3r = coeffs->tw_re[3 * j * s];
+				const float w3i = coeffs->tw_im[3 * j * s];
+				re[i0] = t0r + t2r;
+				im[i0] = t0i + t2i;
+				const float u1r = t0r - t2r;
+				const float u1i = t0i - t2i;
+				re[i1] = u1r * w2r - u1i * w2i;
+				im[i1] = u1r * w2i + u1i * w2r;
+				const float u2r = t1r + t3i;
+				const float u2i = t1i - t3r;
+				re[i2] = u2r * w1r - u2i * w1i;
+				im[i2] = u2r * w1i + u2i * w1r;
+				const float u3r = t1r - t3i;
+				const float u3i = t1i + t3r;
+				re[i3] = u3r * w3r - u3i * w3i;
+				im[i3] = u3r * w3i + u3i * w3r;
+			}
+	}
+	if (h == 2)
+		for (size_t i = 0; i < n; i += 2) {
+			const float ar = re[i];
+			const float ai = im[i];
+			re[i] = ar + re[i + 1];
+			im[i] = ai + im[i + 1];
+			re[i + 1] = ar - re[i + 1];
+			im[i + 1] = ai - im[i + 1];
+		}
+	for (size_t i = 0; i < n; i++) {
+		const size_t j = coeffs->rev[i];
+		if (i < j) {
+			const float r = re[i];
+			const float m = im[i];
+			re[i] = re[j];
+			im[i] = im[j];
+			re[j] = r;
+			im[j] = m;
+		}
+	}
+}
+
+// Forward FFT of 2 * part_len real values x, producing part_len + 1 bins
+static inline void bw_conv_rfft(
+		const bw_conv_coeffs * BW_RESTRICT coeffs,
+		const float * BW_RESTRICT          x,
+		float * BW_RESTRICT                z_re,
+		float * BW_RESTRICT                z_im,
+		float * BW_RESTRICT                y_re,
+		float * BW_RESTRICT                y_im) {
+	const size_t n = coeffs->part_len;
+	for (size_t i = 0; i < n; i++) {
+		z_re[i] = x[i << 1];
+		z_im[i] = x[(i << 1) + 1];
+	}
+	bw_conv_fft(coeffs, z_re, z_im);
+	// even samples spectrum E = (Z[k] + Z*[n - k]) / 2
+	// odd samples spectrum O = (Z[k] - Z*[n - k]) / 2j
+	// X[k] = E + W^k * O
+	for (size_t k = 0; k <= n; k++) {
+		const size_t a = k == n ? 0 : k;
+		const size_t b = k == 0 ? 0 : n - k;
+		const float er = 0.5f * (z_re[a] + z_re[b]);
+		const float ei = 0.5f * (z_im[a] - z_im[b]);
+		const float or_ = 0.5f * (z_im[a] + z_im[b]);
+		const float oi = -0.5f * (z_re[a] - z_re[b]);
+		y_re[k] = er + coeffs->tw_re[k] * or_ - coeffs->tw_im[k] * oi;
+		y_im[k] = ei + coeffs->tw_re[k] * oi + coeffs->tw_im[k] * or_;
+	}
+}
+
+// Inverse FFT of part_len + 1 bins, producing 2 * part_len real values scaled
+// by 2 * part_len
+static inline void bw_conv_irfft(
+		const bw_conv_coeffs * BW_RESTRICT coeffs,
+		const float * BW_RESTRICT          x_re,
+		const float * BW_RESTRICT          x_im,
+		float * BW_RESTRICT                z_re,
+		float * BW_RESTRICT                z_im,
+		float * BW_RESTRICT                y) {
+	const size_t n = coeffs->part_len;
+	// 2 * Z[k] = 2 * (E + j * O), with 2 * E = X[k] + X*[n - k] and
+	// 2 * O = (X[k] - X*[n - k]) * W^-k, conjugated to get the inverse
+	// transform out of the forward one
+	for (size_t k = 0; k < n; k++) {
+		const float er = x_re[k] + x_re[n - k];
+		const float ei = x_im[k] - x_im[n - k];
+		const float dr = x_re[k] - x_re[n - k];
+		const float di = x_im[k] + x_im[n - k];
+		const float or_ = dr * coeffs->tw_re[k] + di * coeffs->tw_im[k];
+		const float oi = di * coeffs->tw_re[k] - dr * coeffs->tw_im[k];
+		z_re[k] = er - oi;
+		z_im[k] = -(ei + or_);
+	}
+	bw_conv_fft(coeffs, z_re, z_im);
+	for (size_t i = 0; i < n; i++) {
+		y[i << 1] = z_re[i];
+		y[(i << 1) + 1] = -z_im[i];
+	}
+}
+
+static inline void bw_conv_init(
+		bw_conv_coeffs * BW_RESTRICT coeffs,
+		size_t                       partition_size,
+		size_t                       ir_length_max,
+		size_t                       n_irs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT(partition_size >= 4 && (partition_size & (partition_size - 1)) == 0);
+	BW_ASSERT(ir_length_max > 0);
+	BW_ASSERT(n_irs > 0);
+
+	coeffs->part_len = partition_size;
+	coeffs->n_parts = (ir_length_max + partition_size - 1) / partition_size;
+	coeffs->n_irs = n_irs;
+	coeffs->ir_len_max = ir_length_max;
+	coeffs->stride = partition_size + 4;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->hash = bw_hash_sdbm("bw_conv_coeffs");
+	coeffs->state = bw_conv_coeffs_state_init;
+	coeffs->reset_id = coeffs->hash + 1;
+#endif
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_conv_coeffs_state_init);
+}
+
+static inline size_t bw_conv_coeffs_mem_req(
+		const bw_conv_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_init);
+
+	const size_t n = coeffs->part_len;
+	return n * sizeof(size_t)
+		+ (2 * (2 * n) + 2 * n + 2 * n + 2 * coeffs->n_irs * coeffs->n_parts * coeffs->stride + coeffs->n_irs)
+		* sizeof(float);
+}
+
+static inline void bw_conv_coeffs_mem_set(
+		bw_conv_coeffs * BW_RESTRICT coeffs,
+		void * BW_RESTRICT           mem) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_init);
+	BW_ASSERT(mem != BW_NULL);
+
+	const size_t n = coeffs->part_len;
+	const size_t hl = coeffs->n_irs * coeffs->n_parts * coeffs->stride;
+	coeffs->rev = (size_t *)mem;
+	coeffs->tw_re = (float *)(coeffs->rev + n);
+	coeffs->tw_im = coeffs->tw_re + 2 * n;
+	coeffs->buf = coeffs->tw_im + 2 * n;
+	coeffs->z_re = coeffs->buf + 2 * n;
+	coeffs->z_im = coeffs->z_re + n;
+	coeffs->h_re = coeffs->z_im + n;
+	coeffs->h_im = coeffs->h_re + hl;
+	coeffs->h_sum = coeffs->h_im + hl;
+
+	size_t bits = 0;
+	while (((size_t)1 << bits) < n)
+		bits++;
+	for (size_t i = 0; i < n; i++) {
+		size_t r = 0;
+		for (size_t b = 0; b < bits; b++)
+			r |= ((i >> b) & 1) << (bits - 1 - b);
+		coeffs->rev[i] = r;
+	}
+	for (size_t k = 0; k < 2 * n; k++) {
+		float s;
+		bw_conv_cos_sin(k, 2 * n, coeffs->tw_re + k, &s);
+		coeffs->tw_im[k] = -s;
+	}
+	bw_buf_fill(0.f, coeffs->h_re, hl);
+	bw_buf_fill(0.f, coeffs->h_im, hl);
+	bw_buf_fill(0.f, coeffs->h_sum, coeffs->n_irs);
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_conv_coeffs_state_mem_set;
+#endif
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_conv_coeffs_state_mem_set);
+}
+
+static inline void bw_conv_set_ir(
+		bw_conv_coeffs * BW_RESTRICT coeffs,
+		size_t                       ir,
+		const float * BW_RESTRICT    x,
+		size_t                       length) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_mem_set);
+	BW_ASSERT(ir < coeffs->n_irs);
+	BW_ASSERT(length <= coeffs->ir_len_max);
+	BW_ASSERT(length == 0 || x != BW_NULL);
+	BW_ASSERT_DEEP(length == 0 || bw_has_only_finite(x, length));
+
+	const size_t n = coeffs->part_len;
+	const float k = 0.5f / (float)n;
+	float sum = 0.f;
+	for (size_t p = 0; p < coeffs->n_parts; p++) {
+		const size_t o = p * n;
+		const size_t m = o >= length ? 0 : (length - o < n ? length - o : n);
+		if (m > 0)
+			bw_buf_copy(x + o, coeffs->buf, m);
+		bw_buf_fill(0.f, coeffs->buf + m, 2 * n - m);
+		for (size_t i = 0; i < m; i++)
+			sum += coeffs->buf[i];
+		float *h_re = coeffs->h_re + (ir * coeffs->n_parts + p) * coeffs->stride;
+		float *h_im = coeffs->h_im + (ir * coeffs->n_parts + p) * coeffs->stride;
+		bw_conv_rfft(coeffs, coeffs->buf, coeffs->z_re, coeffs->z_im, h_re, h_im);
+		bw_buf_scale(h_re, k, h_re, n + 1);
+		bw_buf_scale(h_im, k, h_im, n + 1);
+	}
+	coeffs->h_sum[ir] = sum;
+
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_mem_set);
+}
+
+static inline void bw_conv_reset_coeffs(
+		bw_conv_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_mem_set);
+
+	(void)coeffs;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_conv_coeffs_state_reset_coeffs;
+	coeffs->reset_id++;
+#endif
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_conv_coeffs_state_reset_coeffs);
+}
+
+static inline size_t bw_conv_mem_req(
+		const bw_conv_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_init);
+
+	const size_t n = coeffs->part_len;
+	return (2 * (2 * n) + 2 * n + 2 * coeffs->stride + 2 * coeffs->n_parts * coeffs->stride + coeffs->n_irs * n)
+		* sizeof(float);
+}
+
+static inline void bw_conv_mem_set(
+		const bw_conv_coeffs * BW_RESTRICT coeffs,
+		bw_conv_state * BW_RESTRICT        state,
+		void * BW_RESTRICT                 mem) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_init);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT(mem != BW_NULL);
+
+	const size_t n = coeffs->part_len;
+	state->x_buf = (float *)mem;
+	state->t_buf = state->x_buf + 2 * n;
+	state->z_re = state->t_buf + 2 * n;
+	state->z_im = state->z_re + n;
+	state->acc_re = state->z_im + n;
+	state->acc_im = state->acc_re + coeffs->stride;
+	state->fdl_re = state->acc_im + coeffs->stride;
+	state->fdl_im = state->fdl_re + coeffs->n_parts * coeffs->stride;
+	state->y_buf = state->fdl_im + coeffs->n_parts * coeffs->stride;
+
+#ifdef BW_DEBUG_DEEP
+	state->hash = bw_hash_sdbm("bw_conv_state");
+	state->state = bw_conv_state_state_mem_set;
+#endif
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_init);
+	BW_ASSERT_DEEP(bw_conv_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state == bw_conv_state_state_mem_set);
+}
+
+static inline void bw_conv_reset_state(
+		const bw_conv_coeffs * BW_RESTRICT coeffs,
+		bw_conv_state * BW_RESTRICT        state,
+		float                              x_0,
+		float * BW_RESTRICT                y_0) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_conv_state_state_mem_set);
+	BW_ASSERT(bw_is_finite(x_0));
+
+	// steady state for constant input: all past input spectra are the same
+	// and output is x_0 times the sum of IR samples
+	const size_t n = coeffs->part_len;
+	bw_buf_fill(x_0, state->x_buf, 2 * n);
+	bw_conv_rfft(coeffs, state->x_buf, state->z_re, state->z_im, state->fdl_re, state->fdl_im);
+	for (size_t p = 1; p < coeffs->n_parts; p++) {
+		bw_buf_copy(state->fdl_re, state->fdl_re + p * coeffs->stride, n + 1);
+		bw_buf_copy(state->fdl_im, state->fdl_im + p * coeffs->stride, n + 1);
+	}
+	for (size_t j = 0; j < coeffs->n_irs; j++) {
+		const float y = x_0 * coeffs->h_sum[j];
+		bw_buf_fill(y, state->y_buf + j * n, n);
+		if (y_0 != BW_NULL)
+			y_0[j] = y;
+	}
+	state->pos = 0;
+	state->fdl_idx = 0;
+
+#ifdef BW_DEBUG_DEEP
+	state->state = bw_conv_state_state_reset_state;
+	state->coeffs_reset_id = coeffs->reset_id;
+#endif
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_conv_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state == bw_conv_state_state_reset_state);
+	BW_ASSERT_DEEP(y_0 != BW_NULL ? bw_has_only_finite(y_0, coeffs->n_irs) : 1);
+}
+
+static inline void bw_conv_reset_state_multi(
+		const bw_conv_coeffs * BW_RESTRICT              coeffs,
+		bw_conv_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float *                                   x_0,
+		float *                                         y_0,
+		size_t                                          n_channels) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x_0 != BW_NULL);
+
+	if (y_0 != BW_NULL)
+		for (size_t i = 0; i < n_channels; i++)
+			bw_conv_reset_state(coeffs, state[i], x_0[i], y_0 + i * coeffs->n_irs);
+	else
+		for (size_t i = 0; i < n_channels; i++)
+			bw_conv_reset_state(coeffs, state[i], x_0[i], BW_NULL);
+
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(y_0 != BW_NULL ? bw_has_only_finite(y_0, n_channels * coeffs->n_irs) : 1);
+}
+
+// Computes output partitions once a whole input partition is available
+static inline void bw_conv_process_part(
+		const bw_conv_coeffs * BW_RESTRICT coeffs,
+		bw_conv_state * BW_RESTRICT        state) {
+	const size_t n = coeffs->part_len;
+	const size_t n_bins = n + 1;
+	const size_t stride = coeffs->stride;
+	const size_t n_parts = coeffs->n_parts;
+
+	bw_conv_rfft(coeffs, state->x_buf, state->z_re, state->z_im,
+		state->fdl_re + state->fdl_idx * stride, state->fdl_im + state->fdl_idx * stride);
+	bw_buf_copy(state->x_buf + n, state->x_buf, n);
+
+	for (size_t j = 0; j < coeffs->n_irs; j++) {
+		float * BW_RESTRICT acc_re = state->acc_re;
+		float * BW_RESTRICT acc_im = state->acc_im;
+		bw_buf_fill(0.f, acc_re, n_bins);
+		bw_buf_fill(0.f, acc_im, n_bins);
+		// partition p of the IR multiplies the spectrum of input p partitions ago
+		size_t s = state->fdl_idx;
+		for (size_t p = 0; p < n_parts; p++) {
+			const float * BW_RESTRICT x_re = state->fdl_re + s * stride;
+			const float * BW_RESTRICT x_im = state->fdl_im + s * stride;
+			const float * BW_RESTRICT h_re = coeffs->h_re + (j * n_parts + p) * stride;
+			const float * BW_RESTRICT h_im = coeffs->h_im + (j * n_parts + p) * stride;
+			for (size_t k = 0; k < n_bins; k++) {
+				acc_re[k] += x_re[k] * h_re[k] - x_im[k] * h_im[k];
+				acc_im[k] += x_re[k] * h_im[k] + x_im[k] * h_re[k];
+			}
+			s = s == 0 ? n_parts - 1 : s - 1;
+		}
+		bw_conv_irfft(coeffs, acc_re, acc_im, state->z_re, state->z_im, state->t_buf);
+		bw_buf_copy(state->t_buf + n, state->y_buf + j * n, n);
+	}
+
+	state->fdl_idx = state->fdl_idx + 1 == n_parts ? 0 : state->fdl_idx + 1;
+}
+
+static inline void bw_conv_process(
+		const bw_conv_coeffs * BW_RESTRICT coeffs,
+		bw_conv_state * BW_RESTRICT        state,
+		const float *                      x,
+		float * const *                    y,
+		size_t                             n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_conv_state_state_reset_state);
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
+	BW_ASSERT(y != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t j = 0; j < coeffs->n_irs; j++) {
+		BW_ASSERT(y[j] != BW_NULL);
+		for (size_t k = j + 1; k < coeffs->n_irs; k++)
+			BW_ASSERT(y[j] != y[k]);
+	}
+#endif
+
+	const size_t n = coeffs->part_len;
+	for (size_t i = 0; i < n_samples; ) {
+		const size_t m = n_samples - i < n - state->pos ? n_samples - i : n - state->pos;
+		// input is copied first, as x may coincide with any of y
+		bw_buf_copy(x + i, state->x_buf + n + state->pos, m);
+		for (size_t j = 0; j < coeffs->n_irs; j++)
+			bw_buf_copy(state->y_buf + j * n + state->pos, y[j] + i, m);
+		state->pos += m;
+		i += m;
+		if (state->pos == n) {
+			bw_conv_process_part(coeffs, state);
+			state->pos = 0;
+		}
+	}
+
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_conv_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_conv_state_state_reset_state);
+#ifndef BW_NO_DEBUG
+	for (size_t j = 0; j < coeffs->n_irs; j++)
+		BW_ASSERT_DEEP(bw_has_only_finite(y[j], n_samples));
+#endif
+}
+
+static inline void bw_conv_process_multi(
+		const bw_conv_coeffs * BW_RESTRICT              coeffs,
+		bw_conv_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float * const *                           x,
+		float * const *                                 y,
+		size_t                                          n_channels,
+		size_t                                          n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(y != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels * coeffs->n_irs; i++)
+		for (size_t j = i + 1; j < n_channels * coeffs->n_irs; j++)
+			BW_ASSERT(y[i] != y[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels * coeffs->n_irs; j++)
+			BW_ASSERT(j / coeffs->n_irs == i || x[i] != y[j]);
+#endif
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_conv_process(coeffs, state[i], x[i], y + i * coeffs->n_irs, n_samples);
+
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_reset_coeffs);
+}
+
+static inline size_t bw_conv_get_latency(
+		const bw_conv_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_coeffs_state_init);
+
+	return coeffs->part_len;
+}
+
+static inline char bw_conv_coeffs_is_valid(
+		const bw_conv_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->hash != bw_hash_sdbm("bw_conv_coeffs"))
+		return 0;
+	if (coeffs->state < bw_conv_coeffs_state_init || coeffs->state > bw_conv_coeffs_state_reset_coeffs)
+		return 0;
+#endif
+
+	if (coeffs->part_len < 4 || (coeffs->part_len & (coeffs->part_len - 1)) != 0)
+		return 0;
+	if (coeffs->ir_len_max == 0 || coeffs->n_irs == 0)
+		return 0;
+	if (coeffs->n_parts != (coeffs->ir_len_max + coeffs->part_len - 1) / coeffs->part_len)
+		return 0;
+	if (coeffs->stride < coeffs->part_len + 1)
+		return 0;
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->state >= bw_conv_coeffs_state_mem_set) {
+		if (coeffs->rev == BW_NULL || coeffs->tw_re == BW_NULL || coeffs->h_sum == BW_NULL)
+			return 0;
+		if (coeffs->rev[1] != coeffs->part_len >> 1)
+			return 0;
+		if (coeffs->tw_re[0] != 1.f || coeffs->tw_im[0] != 0.f)
+			return 0;
+		for (size_t i = 0; i < coeffs->n_irs; i++)
+			if (!bw_is_finite(coeffs->h_sum[i]))
+				return 0;
+	}
+#endif
+
+	return 1;
+}
+
+static inline char bw_conv_state_is_valid(
+		const bw_conv_coeffs * BW_RESTRICT coeffs,
+		const bw_conv_state * BW_RESTRICT  state) {
+	BW_ASSERT(state != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (state->hash != bw_hash_sdbm("bw_conv_state"))
+		return 0;
+	if (state->state < bw_conv_state_state_mem_set || state->state > bw_conv_state_state_reset_state)
+		return 0;
+
+	if (state->state >= bw_conv_state_state_reset_state && coeffs != BW_NULL && coeffs->reset_id != state->coeffs_reset_id)
+		return 0;
+#endif
+
+	if (state->x_buf == BW_NULL)
+		return 0;
+
+	if (coeffs != BW_NULL) {
+		const size_t n = coeffs->part_len;
+		if (state->y_buf != state->x_buf + 6 * n + 2 * (coeffs->n_parts + 1) * coeffs->stride)
+			return 0;
+#ifdef BW_DEBUG_DEEP
+		if (state->state >= bw_conv_state_state_reset_state) {
+			if (state->pos >= n || state->fdl_idx >= coeffs->n_parts)
+				return 0;
+			if (!bw_has_only_finite(state->x_buf, 2 * n))
+				return 0;
+			if (!bw_has_only_finite(state->y_buf, coeffs->n_irs * n))
+				return 0;
+		}
+#endif
+	}
+
+	return 1;
+}
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+#if !defined(BW_NO_CXX) && defined(__cplusplus)
+
+# ifndef BW_CXX_NO_ARRAY
+#  include <array>
+# endif
+
+namespace Brickworks {
+
+/*** Public C++ API ***/
+
+/*! api_cpp {{{
+ *    ##### Brickworks::Conv
+ *  ```>>> */
+template<size_t N_CHANNELS = 1>
+class Conv {
+public:
+	Conv(
+		size_t partitionSize,
+		size_t irLengthMax,
+		size_t nIRs = 1);
+
+	~Conv();
+
+	void setIR(
+		size_t                    ir,
+		const float * BW_RESTRICT x,
+		size_t                    length);
+
+	void reset(
+		float               x0 = 0.f,
+		float * BW_RESTRICT y0 = BW_NULL);
+
+	void reset(
+		const float * x0,
+		float *       y0 = BW_NULL);
+
+# ifndef BW_CXX_NO_ARRAY
+	void reset(
+		std::array<float, N_CHANNELS> x0,
+		float *                       y0 = BW_NULL);
+# endif
+
+	void process(
+		const float * const * x,
+		float * const *       y,
+		size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+	void process(
+		std::array<const float *, N_CHANNELS> x,
+		float * const *                       y,
+		size_t                                nSamples);
+# endif
+
+	size_t getLatency();
+/*! <<<...
+ *  }
+ *  ```
+ *
+ *    `y0` and `y` are arrays of `N_CHANNELS * nIRs` elements, as in
+ *    `bw_conv_reset_state_multi()` and `bw_conv_process_multi()`.
+ *  }}} */
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+private:
+	bw_conv_coeffs			coeffs;
+	bw_conv_state			states[N_CHANNELS];
+	bw_conv_state * BW_RESTRICT	statesP[N_CHANNELS];
+	void * BW_RESTRICT		mem;
+};
+
+template<size_t N_CHANNELS>
+inline Conv<N_CHANNELS>::Conv(
+		size_t partitionSize,
+		size_t irLengthMax,
+		size_t nIRs) {
+	bw_conv_init(&coeffs, partitionSize, irLengthMax, nIRs);
+	const size_t coeffsReq = bw_conv_coeffs_mem_req(&coeffs);
+	const size_t req = bw_conv_mem_req(&coeffs);
+	mem = operator new(coeffsReq + req * N_CHANNELS);
+	bw_conv_coeffs_mem_set(&coeffs, mem);
+	char *m = static_cast<char *>(mem) + coeffsReq;
+	for (size_t i = 0; i < N_CHANNELS; i++, m += req) {
+		bw_conv_mem_set(&coeffs, states + i, m);
+		statesP[i] = states + i;
+	}
+}
+
+template<size_t N_CHANNELS>
+inline Conv<N_CHANNELS>::~Conv() {
+	operator delete(mem);
+}
+
+template<size_t N_CHANNELS>
+inline void Conv<N_CHANNELS>::setIR(
+		size_t                    ir,
+		const float * BW_RESTRICT x,
+		size_t                    length) {
+	bw_conv_set_ir(&coeffs, ir, x, length);
+}
+
+template<size_t N_CHANNELS>
+inline void Conv<N_CHANNELS>::reset(
+		float               x0,
+		float * BW_RESTRICT y0) {
+	bw_conv_reset_coeffs(&coeffs);
+	for (size_t i = 0; i < N_CHANNELS; i++)
+		bw_conv_reset_state(&coeffs, states + i, x0, y0 != BW_NULL ? y0 + i * coeffs.n_irs : BW_NULL);
+}
+
+template<size_t N_CHANNELS>
+inline void Conv<N_CHANNELS>::reset(
+		const float * x0,
+		float *       y0) {
+	bw_conv_reset_coeffs(&coeffs);
+	bw_conv_reset_state_multi(&coeffs, statesP, x0, y0, N_CHANNELS);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void Conv<N_CHANNELS>::reset(
+		std::array<float, N_CHANNELS> x0,
+		float *                       y0) {
+	reset(x0.data(), y0);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void Conv<N_CHANNELS>::process(
+		const float * const * x,
+		float * const *       y,
+		size_t                nSamples) {
+	bw_conv_process_multi(&coeffs, statesP, x, y, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void Conv<N_CHANNELS>::process(
+		std::array<const float *, N_CHANNELS> x,
+		float * const *                       y,
+		size_t                                nSamples) {
+	process(x.data(), y, nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline size_t Conv<N_CHANNELS>::getLatency() {
+	return bw_conv_get_latency(&coeffs);
+}
+
+}
+#endif
+
+#endif
@@ -0,0 +1,1155 @@
+/*
+ * Brickworks
+ *
+ * Copyright (C) 2026 Orastron Srl unipersonale
+ *
+ * Brickworks is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * Brickworks is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Brickworks.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File author: Stefano D'Angelo
+ */
+
+/*!
+ *  module_type {{{ dsp }}}
+ *  version {{{ 1.0.0 }}}
+ *  requires {{{ bw_buf bw_common bw_conv bw_math }}}
+ *  description {{{
+ *    Non-uniformly partitioned convolution for long impulse responses, with
+ *    optional processing of the tail on a worker thread.
+ *
+ *    Impulse responses are split into a head, which is convolved in the
+ *    audio thread using short partitions of `head_partition_size` samples,
+ *    and a tail, which is convolved using long partitions of
+ *    `tail_partition_size` samples. The head covers the first
+ *    `2 * tail_partition_size - head_partition_size` samples of impulse
+ *    responses, so that the computation of each tail partition can be
+ *    spread over a whole tail partition period. Output is delayed by
+ *    `head_partition_size` samples.
+ *
+ *    Tail partitions are computed by calling `bw_conv_nu_work()`, typically
+ *    from a lower-priority worker thread, at any time after
+ *    `bw_conv_nu_process()` has been called. Audio and worker threads
+ *    synchronize via atomic operations on a single job slot per channel,
+ *    without locks or memory allocation, and the audio thread never waits
+ *    for the worker thread.
+ *
+ *    The computation of each tail partition has a deadline of
+ *    `tail_partition_size` samples after it is submitted, that is, when its
+ *    output is needed. If the worker thread did not start computing it by
+ *    then, the audio thread computes it itself. If instead the worker thread
+ *    is still computing it, the audio thread replaces the tail part of the
+ *    output with silence for the next `tail_partition_size` samples and sets
+ *    the new input partition aside, and the tail catches up at the first
+ *    deadline after the worker thread is done, treating any input partition
+ *    it could not set aside as silence. Therefore, as long as the worker
+ *    thread either completes each tail partition before its deadline or does
+ *    not start it, output does not depend on thread scheduling, and not using
+ *    a worker thread at all (e.g., when rendering offline) gives the same
+ *    results.
+ *
+ *    This module requires a compiler that supports either GCC-style
+ *    (<code>\_\_atomic\_\*</code>) or MSVC-style
+ *    (<code>\_Interlocked\*</code>) atomic intrinsics.
+ *  }}}
+ *  changelog {{{
+ *    <ul>
+ *      <li>Version <strong>1.0.0</strong>:
+ *        <ul>
+ *          <li>First release.</li>
+ *        </ul>
+ *      </li>
+ *    </ul>
+ *  }}}
+ */
+
+#ifndef BW_CONV_NU_H
+#define BW_CONV_NU_H
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_common.h"
+#else
+# include <bw_common.h>
+#endif
+
+#if !defined(__GNUC__) && defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+/*** Public API ***/
+
+/*! api {{{
+ *    #### bw_conv_nu_coeffs
+ *  ```>>> */
+typedef struct bw_conv_nu_coeffs bw_conv_nu_coeffs;
+/*! <<<```
+ *    Coefficients and related.
+ *
+ *    #### bw_conv_nu_state
+ *  ```>>> */
+typedef struct bw_conv_nu_state bw_conv_nu_state;
+/*! <<<```
+ *    Internal state and related.
+ *
+ *    #### bw_conv_nu_init()
+ *  ```>>> */
+static inline void bw_conv_nu_init(
+	bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+	size_t                          head_partition_size,
+	size_t                          tail_partition_size,
+	size_t                          ir_length_max,
+	size_t                          n_irs);
+/*! <<<```
+ *    Initializes input parameter values in `coeffs` so that `n_irs` impulse
+ *    responses of up to `ir_length_max` samples each can be used, using head
+ *    partitions of `head_partition_size` samples and tail partitions of
+ *    `tail_partition_size` samples.
+ *
+ *    `head_partition_size` and `tail_partition_size` must be powers of `2`,
+ *    with `head_partition_size` greater than or equal to `4` and
+ *    `tail_partition_size` greater than or equal to `head_partition_size`,
+ *    while `ir_length_max` and `n_irs` must be positive.
+ *
+ *    #### bw_conv_nu_coeffs_mem_req()
+ *  ```>>> */
+static inline size_t bw_conv_nu_coeffs_mem_req(
+	const bw_conv_nu_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the size, in bytes, of contiguous memory to be supplied to
+ *    `bw_conv_nu_coeffs_mem_set()` using `coeffs`.
+ *
+ *    #### bw_conv_nu_coeffs_mem_set()
+ *  ```>>> */
+static inline void bw_conv_nu_coeffs_mem_set(
+	bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+	void * BW_RESTRICT              mem);
+/*! <<<```
+ *    Associates the contiguous memory block `mem` to the given `coeffs`.
+ *
+ *    Impulse responses are all initially set to silence.
+ *
+ *    `mem` must be aligned for `size_t` values.
+ *
+ *    #### bw_conv_nu_set_ir()
+ *  ```>>> */
+static inline void bw_conv_nu_set_ir(
+	bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+	size_t                          ir,
+	const float * BW_RESTRICT       x,
+	size_t                          length);
+/*! <<<```
+ *    Sets the `ir`-th impulse response in `coeffs` to the first `length`
+ *    samples of the buffer `x`.
+ *
+ *    `ir` must be less than `n_irs` and `length` must be less than or equal to
+ *    `ir_length_max` (see `bw_conv_nu_init()`). If `length` is `0`, `x` can be
+ *    `BW_NULL`.
+ *
+ *    It must not be called while `bw_conv_nu_work()` might be running on any
+ *    associated state.
+ *
+ *    #### bw_conv_nu_reset_coeffs()
+ *  ```>>> */
+static inline void bw_conv_nu_reset_coeffs(
+	bw_conv_nu_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Resets coefficients in `coeffs` to assume their target values.
+ *
+ *    #### bw_conv_nu_mem_req()
+ *  ```>>> */
+static inline size_t bw_conv_nu_mem_req(
+	const bw_conv_nu_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the size, in bytes, of contiguous memory to be supplied to
+ *    `bw_conv_nu_mem_set()` using `coeffs`.
+ *
+ *    #### bw_conv_nu_mem_set()
+ *  ```>>> */
+static inline void bw_conv_nu_mem_set(
+	const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+	bw_conv_nu_state * BW_RESTRICT        state,
+	void * BW_RESTRICT                    mem);
+/*! <<<```
+ *    Associates the contiguous memory block `mem` to the given `state` using
+ *    `coeffs`.
+ *
+ *    `mem` must be aligned for pointers.
+ *
+ *    #### bw_conv_nu_reset_state()
+ *  ```>>> */
+static inline void bw_conv_nu_reset_state(
+	const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+	bw_conv_nu_state * BW_RESTRICT        state,
+	float                                 x_0,
+	float * BW_RESTRICT                   y_0);
+/*! <<<```
+ *    Resets the given `state` to its initial values using the given `coeffs`
+ *    and the initial input value `x_0`.
+ *
+ *    The corresponding initial output values, one per impulse response, are
+ *    written into the `y_0` array, if not `BW_NULL`.
+ *
+ *    It must not be called while `bw_conv_nu_work()` might be running on
+ *    `state`.
+ *
+ *    #### bw_conv_nu_reset_state_multi()
+ *  ```>>> */
+static inline void bw_conv_nu_reset_state_multi(
+	const bw_conv_nu_coeffs * BW_RESTRICT              coeffs,
+	bw_conv_nu_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float *                                      x_0,
+	float *                                            y_0,
+	size_t                                             n_channels);
+/*! <<<```
+ *    Resets each of the `n_channels` `state`s to its initial values using the
+ *    given `coeffs` and the corresponding initial input value in the `x_0`
+ *    array.
+ *
+ *    The corresponding initial output values are written into the `y_0` array,
+ *    if not `BW_NULL`, where `y_0[i * n_irs + j]` is the value for the `i`-th
+ *    channel and the `j`-th impulse response.
+ *
+ *    #### bw_conv_nu_process()
+ *  ```>>> */
+static inline void bw_conv_nu_process(
+	const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+	bw_conv_nu_state * BW_RESTRICT        state,
+	const float *                         x,
+	float * const *                       y,
+	size_t                                n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the input buffer `x` and fills the
+ *    first `n_samples` of the `n_irs` output buffers `y`, where `y[j]` is
+ *    convolved with the `j`-th impulse response, while using and updating
+ *    `state`.
+ *
+ *    `x` may coincide with any of the output buffers.
+ *
+ *    This function never waits for `bw_conv_nu_work()` to finish. Yet, each
+ *    time a whole tail input partition becomes available, it might compute a
+ *    tail partition itself, as described in the module description, and so
+ *    its worst-case cost is that of computing the head partitions plus one
+ *    tail partition (and one more FFT of `2 * tail_partition_size` samples
+ *    when catching up after the worker thread was late).
+ *
+ *    #### bw_conv_nu_process_multi()
+ *  ```>>> */
+static inline void bw_conv_nu_process_multi(
+	const bw_conv_nu_coeffs * BW_RESTRICT              coeffs,
+	bw_conv_nu_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float * const *                              x,
+	float * const *                                    y,
+	size_t                                             n_channels,
+	size_t                                             n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the `n_channels` input buffers `x` and
+ *    fills the first `n_samples` of the `n_channels * n_irs` output buffers
+ *    `y`, while using and updating each of the `n_channels` `state`s.
+ *
+ *    `y[i * n_irs + j]` is the output buffer for the `i`-th channel convolved
+ *    with the `j`-th impulse response.
+ *
+ *    #### bw_conv_nu_work()
+ *  ```>>> */
+static inline char bw_conv_nu_work(
+	const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+	bw_conv_nu_state * BW_RESTRICT        state);
+/*! <<<```
+ *    Computes the pending tail partition of `state`, if any, using `coeffs`.
+ *    Returns non-`0` if a tail partition was computed and `0` otherwise.
+ *
+ *    This function can be called from a different thread than the one calling
+ *    the other functions of this module. At most one thread may call it for a
+ *    given `state` at any time.
+ *
+ *    Once it starts computing a tail partition, it should complete it before
+ *    its deadline, i.e., before `bw_conv_nu_process()` is given
+ *    `tail_partition_size` more input samples, otherwise the tail part of the
+ *    output is replaced with silence (see `bw_conv_nu_get_n_dropped()`). If
+ *    it cannot be run with enough priority, it is better not to call it at
+ *    all, so that tail partitions are computed by `bw_conv_nu_process()`.
+ *
+ *    #### bw_conv_nu_work_multi()
+ *  ```>>> */
+static inline size_t bw_conv_nu_work_multi(
+	const bw_conv_nu_coeffs * BW_RESTRICT              coeffs,
+	bw_conv_nu_state * BW_RESTRICT const * BW_RESTRICT state,
+	size_t                                             n_channels);
+/*! <<<```
+ *    Calls `bw_conv_nu_work()` on each of the `n_channels` `state`s using
+ *    `coeffs` and returns the number of tail partitions that were computed.
+ *
+ *    #### bw_conv_nu_get_latency()
+ *  ```>>> */
+static inline size_t bw_conv_nu_get_latency(
+	const bw_conv_nu_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the latency, in samples, introduced by processing, which is equal
+ *    to `head_partition_size` (see `bw_conv_nu_init()`).
+ *
+ *    #### bw_conv_nu_get_n_missed()
+ *  ```>>> */
+static inline size_t bw_conv_nu_get_n_missed(
+	const bw_conv_nu_state * BW_RESTRICT state);
+/*! <<<```
+ *    Returns the number of tail partitions whose computation was not
+ *    completed by `bw_conv_nu_work()` before their deadline since `state` was
+ *    last reset.
+ *
+ *    #### bw_conv_nu_get_n_dropped()
+ *  ```>>> */
+static inline size_t bw_conv_nu_get_n_dropped(
+	const bw_conv_nu_state * BW_RESTRICT state);
+/*! <<<```
+ *    Returns the number of times, since `state` was last reset, that the tail
+ *    part of the output was replaced with silence for `tail_partition_size`
+ *    samples because `bw_conv_nu_work()` was still computing a tail partition
+ *    at its deadline.
+ *
+ *    #### bw_conv_nu_coeffs_is_valid()
+ *  ```>>> */
+static inline char bw_conv_nu_coeffs_is_valid(
+	const bw_conv_nu_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Tries to determine whether `coeffs` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    `coeffs` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_conv_nu_coeffs`.
+ *
+ *    #### bw_conv_nu_state_is_valid()
+ *  ```>>> */
+static inline char bw_conv_nu_state_is_valid(
+	const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+	const bw_conv_nu_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Tries to determine whether `state` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    If `coeffs` is not `BW_NULL` extra cross-checks might be performed
+ *    (`state` is supposed to be associated to `coeffs`).
+ *
+ *    `state` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_conv_nu_state`.
+ *  }}} */
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_buf.h"
+# include "bw_conv.h"
+#else
+# include <bw_buf.h>
+# include <bw_conv.h>
+#endif
+
+#if defined(__GNUC__)
+# define BW_CONV_NU_LOAD_ACQUIRE(p)		__atomic_load_n(p, __ATOMIC_ACQUIRE)
+# define BW_CONV_NU_STORE_RELEASE(p, v)		__atomic_store_n(p, v, __ATOMIC_RELEASE)
+# define BW_CONV_NU_CAS(p, e, d) \
+	bw_conv_nu_cas_gnu(p, e, d)
+#elif defined(_MSC_VER)
+# define BW_CONV_NU_LOAD_ACQUIRE(p)		((uint32_t)_InterlockedOr((volatile long *)(p), 0))
+# define BW_CONV_NU_STORE_RELEASE(p, v)		((void)_InterlockedExchange((volatile long *)(p), (long)(v)))
+# define BW_CONV_NU_CAS(p, e, d) \
+	(_InterlockedCompareExchange((volatile long *)(p), (long)(d), (long)(e)) == (long)(e))
+#else
+# error bw_conv_nu requires GCC-style or MSVC-style atomic intrinsics
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+#ifdef BW_DEBUG_DEEP
+enum bw_conv_nu_coeffs_state {
+	bw_conv_nu_coeffs_state_invalid,
+	bw_conv_nu_coeffs_state_init,
+	bw_conv_nu_coeffs_state_mem_set,
+	bw_conv_nu_coeffs_state_reset_coeffs
+};
+
+enum bw_conv_nu_state_state {
+	bw_conv_nu_state_state_invalid,
+	bw_conv_nu_state_state_mem_set,
+	bw_conv_nu_state_state_reset_state
+};
+#endif
+
+// tail job slot states
+enum {
+	bw_conv_nu_job_done,		// tail output ready, owned by audio thread
+	bw_conv_nu_job_submitted,	// tail input ready, can be claimed by either thread
+	bw_conv_nu_job_running		// claimed, being computed
+};
+
+struct bw_conv_nu_coeffs {
+#ifdef BW_DEBUG_DEEP
+	uint32_t			hash;
+	enum bw_conv_nu_coeffs_state	state;
+	uint32_t			reset_id;
+#endif
+
+	// Sub-components
+	bw_conv_coeffs			head_coeffs;
+	bw_conv_coeffs			tail_coeffs;
+
+	// Coefficients
+	size_t				head_len;
+	size_t				tail_part_len;
+	size_t				ir_len_max;
+	size_t				n_irs;
+};
+
+struct bw_conv_nu_state {
+#ifdef BW_DEBUG_DEEP
+	uint32_t			hash;
+	enum bw_conv_nu_state_state	state;
+	uint32_t			coeffs_reset_id;
+#endif
+
+	// Sub-components
+	bw_conv_state			head_state;
+	bw_conv_state			tail_state;	// owned by whoever claimed the job
+
+	// States
+	float ** BW_RESTRICT		y_p;		// n_irs output pointers
+	float * BW_RESTRICT		tail_in;	// tail_part_len, current tail input partition
+	float * BW_RESTRICT		tail_pending;	// tail_part_len, input partition set aside while the worker is late
+	float * BW_RESTRICT		tail_out;	// n_irs * tail_part_len, current tail output partitions
+	size_t				pos;
+	size_t				n_missed;
+	size_t				n_dropped;
+	size_t				n_lost;		// input partitions lost while the worker is late
+	char				pending;
+
+	// Shared between threads
+	uint32_t			job;
+	char				pad_job[64 - sizeof(uint32_t)];
+};
+
+#if defined(__GNUC__)
+static inline char bw_conv_nu_cas_gnu(
+		uint32_t * p,
+		uint32_t   e,
+		uint32_t   d) {
+	return __atomic_compare_exchange_n(p, &e, d, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+#endif
+
+static inline size_t bw_conv_nu_align(
+		size_t size) {
+	return (size + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+}
+
+static inline void bw_conv_nu_init(
+		bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		size_t                          head_partition_size,
+		size_t                          tail_partition_size,
+		size_t                          ir_length_max,
+		size_t                          n_irs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT(head_partition_size >= 4 && (head_partition_size & (head_partition_size - 1)) == 0);
+	BW_ASSERT(tail_partition_size >= head_partition_size && (tail_partition_size & (tail_partition_size - 1)) == 0);
+	BW_ASSERT(ir_length_max > 0);
+	BW_ASSERT(n_irs > 0);
+
+	coeffs->head_len = 2 * tail_partition_size - head_partition_size;
+	if (coeffs->head_len > ir_length_max)
+		coeffs->head_len = ir_length_max;
+	coeffs->tail_part_len = tail_partition_size;
+	coeffs->ir_len_max = ir_length_max;
+	coeffs->n_irs = n_irs;
+	bw_conv_init(&coeffs->head_coeffs, head_partition_size, coeffs->head_len, n_irs);
+	if (ir_length_max > coeffs->head_len)
+		bw_conv_init(&coeffs->tail_coeffs, tail_partition_size, ir_length_max - coeffs->head_len, n_irs);
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->hash = bw_hash_sdbm("bw_conv_nu_coeffs");
+	coeffs->state = bw_conv_nu_coeffs_state_init;
+	coeffs->reset_id = coeffs->hash + 1;
+#endif
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_conv_nu_coeffs_state_init);
+}
+
+static inline size_t bw_conv_nu_coeffs_mem_req(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_init);
+
+	size_t req = bw_conv_nu_align(bw_conv_coeffs_mem_req(&coeffs->head_coeffs));
+	if (coeffs->ir_len_max > coeffs->head_len)
+		req += bw_conv_coeffs_mem_req(&coeffs->tail_coeffs);
+	return req;
+}
+
+static inline void bw_conv_nu_coeffs_mem_set(
+		bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		void * BW_RESTRICT              mem) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_init);
+	BW_ASSERT(mem != BW_NULL);
+
+	char *m = (char *)mem;
+	bw_conv_coeffs_mem_set(&coeffs->head_coeffs, m);
+	if (coeffs->ir_len_max > coeffs->head_len)
+		bw_conv_coeffs_mem_set(&coeffs->tail_coeffs, m + bw_conv_nu_align(bw_conv_coeffs_mem_req(&coeffs->head_coeffs)));
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_conv_nu_coeffs_state_mem_set;
+#endif
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_conv_nu_coeffs_state_mem_set);
+}
+
+static inline void bw_conv_nu_set_ir(
+		bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		size_t                          ir,
+		const float * BW_RESTRICT       x,
+		size_t                          length) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_mem_set);
+	BW_ASSERT(ir < coeffs->n_irs);
+	BW_ASSERT(length <= coeffs->ir_len_max);
+	BW_ASSERT(length == 0 || x != BW_NULL);
+	BW_ASSERT_DEEP(length == 0 || bw_has_only_finite(x, length));
+
+	const size_t head_len = length < coeffs->head_len ? length : coeffs->head_len;
+	bw_conv_set_ir(&coeffs->head_coeffs, ir, x, head_len);
+	if (coeffs->ir_len_max > coeffs->head_len)
+		bw_conv_set_ir(&coeffs->tail_coeffs, ir, length > head_len ? x + head_len : BW_NULL, length - head_len);
+
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_mem_set);
+}
+
+static inline void bw_conv_nu_reset_coeffs(
+		bw_conv_nu_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_mem_set);
+
+	bw_conv_reset_coeffs(&coeffs->head_coeffs);
+	if (coeffs->ir_len_max > coeffs->head_len)
+		bw_conv_reset_coeffs(&coeffs->tail_coeffs);
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_conv_nu_coeffs_state_reset_coeffs;
+	coeffs->reset_id++;
+#endif
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_conv_nu_coeffs_state_reset_coeffs);
+}
+
+static inline size_t bw_conv_nu_mem_req(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_init);
+
+	size_t req = coeffs->n_irs * sizeof(float *) + bw_conv_mem_req(&coeffs->head_coeffs);
+	if (coeffs->ir_len_max > coeffs->head_len)
+		req += bw_conv_mem_req(&coeffs->tail_coeffs)
+			+ (coeffs->n_irs + 2) * coeffs->tail_part_len * sizeof(float);
+	return req;
+}
+
+static inline void bw_conv_nu_mem_set(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		bw_conv_nu_state * BW_RESTRICT        state,
+		void * BW_RESTRICT                    mem) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_init);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT(mem != BW_NULL);
+
+	char *m = (char *)mem;
+	state->y_p = (float **)m;
+	m += coeffs->n_irs * sizeof(float *);
+	bw_conv_mem_set(&coeffs->head_coeffs, &state->head_state, m);
+	m += bw_conv_mem_req(&coeffs->head_coeffs);
+	if (coeffs->ir_len_max > coeffs->head_len) {
+		bw_conv_mem_set(&coeffs->tail_coeffs, &state->tail_state, m);
+		m += bw_conv_mem_req(&coeffs->tail_coeffs);
+		state->tail_out = (float *)m;
+		state->tail_in = state->tail_out + coeffs->n_irs * coeffs->tail_part_len;
+		state->tail_pending = state->tail_in + coeffs->tail_part_len;
+	} else {
+		state->tail_in = BW_NULL;
+		state->tail_pending = BW_NULL;
+		state->tail_out = BW_NULL;
+	}
+
+#ifdef BW_DEBUG_DEEP
+	state->hash = bw_hash_sdbm("bw_conv_nu_state");
+	state->state = bw_conv_nu_state_state_mem_set;
+#endif
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_init);
+	BW_ASSERT_DEEP(bw_conv_nu_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state == bw_conv_nu_state_state_mem_set);
+}
+
+static inline void bw_conv_nu_reset_state(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		bw_conv_nu_state * BW_RESTRICT        state,
+		float                                 x_0,
+		float * BW_RESTRICT                   y_0) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_conv_nu_state_state_mem_set);
+	BW_ASSERT(bw_is_finite(x_0));
+
+	bw_conv_reset_state(&coeffs->head_coeffs, &state->head_state, x_0, y_0);
+	if (coeffs->ir_len_max > coeffs->head_len) {
+		// the tail output of the steady state is already in the tail
+		// state, as if the job had just been completed
+		bw_conv_reset_state(&coeffs->tail_coeffs, &state->tail_state, x_0, BW_NULL);
+		bw_buf_copy(state->tail_state.y_buf, state->tail_out, coeffs->n_irs * coeffs->tail_part_len);
+		if (y_0 != BW_NULL)
+			for (size_t j = 0; j < coeffs->n_irs; j++)
+				y_0[j] += x_0 * coeffs->tail_coeffs.h_sum[j];
+	}
+	state->pos = 0;
+	state->n_missed = 0;
+	state->n_dropped = 0;
+	state->n_lost = 0;
+	state->pending = 0;
+	BW_CONV_NU_STORE_RELEASE(&state->job, bw_conv_nu_job_done);
+
+#ifdef BW_DEBUG_DEEP
+	state->state = bw_conv_nu_state_state_reset_state;
+	state->coeffs_reset_id = coeffs->reset_id;
+#endif
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_conv_nu_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state == bw_conv_nu_state_state_reset_state);
+	BW_ASSERT_DEEP(y_0 != BW_NULL ? bw_has_only_finite(y_0, coeffs->n_irs) : 1);
+}
+
+static inline void bw_conv_nu_reset_state_multi(
+		const bw_conv_nu_coeffs * BW_RESTRICT              coeffs,
+		bw_conv_nu_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float *                                      x_0,
+		float *                                            y_0,
+		size_t                                             n_channels) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x_0 != BW_NULL);
+
+	if (y_0 != BW_NULL)
+		for (size_t i = 0; i < n_channels; i++)
+			bw_conv_nu_reset_state(coeffs, state[i], x_0[i], y_0 + i * coeffs->n_irs);
+	else
+		for (size_t i = 0; i < n_channels; i++)
+			bw_conv_nu_reset_state(coeffs, state[i], x_0[i], BW_NULL);
+
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(y_0 != BW_NULL ? bw_has_only_finite(y_0, n_channels * coeffs->n_irs) : 1);
+}
+
+// Pushes silence into the tail state in place of the input partitions lost
+// while the worker was late. Only the first one can have a nonzero spectrum,
+// since the previous input partition is still in the first half of x_buf,
+// and after n_parts of them the frequency-domain delay line is all zeros.
+static inline void bw_conv_nu_push_lost(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		bw_conv_nu_state * BW_RESTRICT        state) {
+	const bw_conv_coeffs * BW_RESTRICT tc = &coeffs->tail_coeffs;
+	bw_conv_state * BW_RESTRICT ts = &state->tail_state;
+	const size_t n = tc->part_len;
+	const size_t n_push = state->n_lost < tc->n_parts ? state->n_lost : tc->n_parts;
+	for (size_t i = 0; i < n_push; i++) {
+		float * BW_RESTRICT fdl_re = ts->fdl_re + ts->fdl_idx * tc->stride;
+		float * BW_RESTRICT fdl_im = ts->fdl_im + ts->fdl_idx * tc->stride;
+		if (i == 0) {
+			bw_buf_fill(0.f, ts->x_buf + n, n);
+			bw_conv_rfft(tc, ts->x_buf, ts->z_re, ts->z_im, fdl_re, fdl_im);
+			bw_buf_fill(0.f, ts->x_buf, n);
+		} else {
+			bw_buf_fill(0.f, fdl_re, n + 1);
+			bw_buf_fill(0.f, fdl_im, n + 1);
+		}
+		ts->fdl_idx = ts->fdl_idx + 1 == tc->n_parts ? 0 : ts->fdl_idx + 1;
+	}
+	state->n_lost = 0;
+}
+
+// Called by the audio thread when a whole tail input partition is available:
+// collects the output of the previous job, computing it if the worker thread
+// did not even start it, and submits the new one. It never waits for the
+// worker thread: if that is still computing the previous job, the tail output
+// is silenced and the new input partition is set aside (losing the one that
+// was possibly set aside earlier) until the tail state is released.
+static inline void bw_conv_nu_swap_tail(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		bw_conv_nu_state * BW_RESTRICT        state) {
+	const size_t n = coeffs->tail_part_len;
+	uint32_t job = BW_CONV_NU_LOAD_ACQUIRE(&state->job);
+	if (job == bw_conv_nu_job_submitted) {
+		if (BW_CONV_NU_CAS(&state->job, bw_conv_nu_job_submitted, bw_conv_nu_job_running)) {
+			state->n_missed++;
+			bw_conv_process_part(&coeffs->tail_coeffs, &state->tail_state);
+			job = bw_conv_nu_job_done;
+		} else
+			job = BW_CONV_NU_LOAD_ACQUIRE(&state->job);	// claimed by the worker thread in the meantime
+	}
+	if (job == bw_conv_nu_job_done) {
+		if (state->pending) {
+			// the late job is done, but its output was already
+			// replaced by silence: catch up by computing the job of
+			// the input partition set aside
+			bw_conv_nu_push_lost(coeffs, state);
+			bw_buf_copy(state->tail_pending, state->tail_state.x_buf + n, n);
+			bw_conv_process_part(&coeffs->tail_coeffs, &state->tail_state);
+			state->pending = 0;
+		}
+		bw_buf_copy(state->tail_state.y_buf, state->tail_out, coeffs->n_irs * n);
+		bw_buf_copy(state->tail_in, state->tail_state.x_buf + n, n);
+		BW_CONV_NU_STORE_RELEASE(&state->job, bw_conv_nu_job_submitted);
+	} else {
+		state->n_missed++;
+		state->n_dropped++;
+		bw_buf_fill(0.f, state->tail_out, coeffs->n_irs * n);
+		state->n_lost += state->pending;
+		float *t = state->tail_pending;
+		state->tail_pending = state->tail_in;
+		state->tail_in = t;
+		state->pending = 1;
+	}
+}
+
+static inline void bw_conv_nu_process(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		bw_conv_nu_state * BW_RESTRICT        state,
+		const float *                         x,
+		float * const *                       y,
+		size_t                                n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_conv_nu_state_state_reset_state);
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
+	BW_ASSERT(y != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t j = 0; j < coeffs->n_irs; j++) {
+		BW_ASSERT(y[j] != BW_NULL);
+		for (size_t k = j + 1; k < coeffs->n_irs; k++)
+			BW_ASSERT(y[j] != y[k]);
+	}
+#endif
+
+	if (coeffs->ir_len_max > coeffs->head_len) {
+		const size_t n = coeffs->tail_part_len;
+		for (size_t i = 0; i < n_samples; ) {
+			const size_t m = n_samples - i < n - state->pos ? n_samples - i : n - state->pos;
+			// input is copied first, as x may coincide with any of y
+			bw_buf_copy(x + i, state->tail_in + state->pos, m);
+			for (size_t j = 0; j < coeffs->n_irs; j++)
+				state->y_p[j] = y[j] + i;
+			bw_conv_process(&coeffs->head_coeffs, &state->head_state, x + i, state->y_p, m);
+			for (size_t j = 0; j < coeffs->n_irs; j++)
+				bw_buf_mix(state->y_p[j], state->tail_out + j * n + state->pos, state->y_p[j], m);
+			state->pos += m;
+			i += m;
+			if (state->pos == n) {
+				bw_conv_nu_swap_tail(coeffs, state);
+				state->pos = 0;
+			}
+		}
+	} else
+		bw_conv_process(&coeffs->head_coeffs, &state->head_state, x, y, n_samples);
+
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_conv_nu_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_conv_nu_state_state_reset_state);
+#ifndef BW_NO_DEBUG
+	for (size_t j = 0; j < coeffs->n_irs; j++)
+		BW_ASSERT_DEEP(bw_has_only_finite(y[j], n_samples));
+#endif
+}
+
+static inline void bw_conv_nu_process_multi(
+		const bw_conv_nu_coeffs * BW_RESTRICT              coeffs,
+		bw_conv_nu_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float * const *                              x,
+		float * const *                                    y,
+		size_t                                             n_channels,
+		size_t                                             n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(y != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels * coeffs->n_irs; i++)
+		for (size_t j = i + 1; j < n_channels * coeffs->n_irs; j++)
+			BW_ASSERT(y[i] != y[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels * coeffs->n_irs; j++)
+			BW_ASSERT(j / coeffs->n_irs == i || x[i] != y[j]);
+#endif
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_conv_nu_process(coeffs, state[i], x[i], y + i * coeffs->n_irs, n_samples);
+
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_reset_coeffs);
+}
+
+static inline char bw_conv_nu_work(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		bw_conv_nu_state * BW_RESTRICT        state) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT(state != BW_NULL);
+
+	if (coeffs->ir_len_max <= coeffs->head_len
+		|| !BW_CONV_NU_CAS(&state->job, bw_conv_nu_job_submitted, bw_conv_nu_job_running))
+		return 0;
+	bw_conv_process_part(&coeffs->tail_coeffs, &state->tail_state);
+	BW_CONV_NU_STORE_RELEASE(&state->job, bw_conv_nu_job_done);
+	return 1;
+}
+
+static inline size_t bw_conv_nu_work_multi(
+		const bw_conv_nu_coeffs * BW_RESTRICT              coeffs,
+		bw_conv_nu_state * BW_RESTRICT const * BW_RESTRICT state,
+		size_t                                             n_channels) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT(state != BW_NULL);
+
+	size_t n = 0;
+	for (size_t i = 0; i < n_channels; i++)
+		n += bw_conv_nu_work(coeffs, state[i]);
+	return n;
+}
+
+static inline size_t bw_conv_nu_get_latency(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_conv_nu_coeffs_state_init);
+
+	return bw_conv_get_latency(&coeffs->head_coeffs);
+}
+
+static inline size_t bw_conv_nu_get_n_missed(
+		const bw_conv_nu_state * BW_RESTRICT state) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_state_is_valid(BW_NULL, state));
+	BW_ASSERT_DEEP(state->state >= bw_conv_nu_state_state_reset_state);
+
+	return state->n_missed;
+}
+
+static inline size_t bw_conv_nu_get_n_dropped(
+		const bw_conv_nu_state * BW_RESTRICT state) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_conv_nu_state_is_valid(BW_NULL, state));
+	BW_ASSERT_DEEP(state->state >= bw_conv_nu_state_state_reset_state);
+
+	return state->n_dropped;
+}
+
+static inline char bw_conv_nu_coeffs_is_valid(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->hash != bw_hash_sdbm("bw_conv_nu_coeffs"))
+		return 0;
+	if (coeffs->state < bw_conv_nu_coeffs_state_init || coeffs->state > bw_conv_nu_coeffs_state_reset_coeffs)
+		return 0;
+#endif
+
+	if (coeffs->ir_len_max == 0 || coeffs->n_irs == 0 || coeffs->head_len == 0 || coeffs->head_len > coeffs->ir_len_max)
+		return 0;
+	if (coeffs->tail_part_len == 0 || (coeffs->tail_part_len & (coeffs->tail_part_len - 1)) != 0)
+		return 0;
+
+	if (!bw_conv_coeffs_is_valid(&coeffs->head_coeffs))
+		return 0;
+	return coeffs->ir_len_max > coeffs->head_len ? bw_conv_coeffs_is_valid(&coeffs->tail_coeffs) : 1;
+}
+
+static inline char bw_conv_nu_state_is_valid(
+		const bw_conv_nu_coeffs * BW_RESTRICT coeffs,
+		const bw_conv_nu_state * BW_RESTRICT  state) {
+	BW_ASSERT(state != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (state->hash != bw_hash_sdbm("bw_conv_nu_state"))
+		return 0;
+	if (state->state < bw_conv_nu_state_state_mem_set || state->state > bw_conv_nu_state_state_reset_state)
+		return 0;
+
+	if (state->state >= bw_conv_nu_state_state_reset_state && coeffs != BW_NULL && coeffs->reset_id != state->coeffs_reset_id)
+		return 0;
+#endif
+
+	if (state->y_p == BW_NULL)
+		return 0;
+
+	if (coeffs != BW_NULL) {
+		if (!bw_conv_state_is_valid(&coeffs->head_coeffs, &state->head_state))
+			return 0;
+		if (coeffs->ir_len_max > coeffs->head_len) {
+			if (state->tail_out == BW_NULL || state->tail_in == BW_NULL || state->tail_pending == BW_NULL || state->tail_in == state->tail_pending)
+				return 0;
+#ifdef BW_DEBUG_DEEP
+			if (state->state >= bw_conv_nu_state_state_reset_state && state->pos >= coeffs->tail_part_len)
+				return 0;
+#endif
+		}
+	}
+
+	return 1;
+}
+
+#undef BW_CONV_NU_LOAD_ACQUIRE
+#undef BW_CONV_NU_STORE_RELEASE
+#undef BW_CONV_NU_CAS
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+#if !defined(BW_NO_CXX) && defined(__cplusplus)
+
+# ifndef BW_CXX_NO_ARRAY
+#  include <array>
+# endif
+
+namespace Brickworks {
+
+/*** Public C++ API ***/
+
+/*! api_cpp {{{
+ *    ##### Brickworks::ConvNU
+ *  ```>>> */
+template<size_t N_CHANNELS = 1>
+class ConvNU {
+public:
+	ConvNU(
+		size_t headPartitionSize,
+		size_t tailPartitionSize,
+		size_t irLengthMax,
+		size_t nIRs = 1);
+
+	~ConvNU();
+
+	void setIR(
+		size_t                    ir,
+		const float * BW_RESTRICT x,
+		size_t                    length);
+
+	void reset(
+		float               x0 = 0.f,
+		float * BW_RESTRICT y0 = BW_NULL);
+
+	void reset(
+		const float * x0,
+		float *       y0 = BW_NULL);
+
+# ifndef BW_CXX_NO_ARRAY
+	void reset(
+		std::array<float, N_CHANNELS> x0,
+		float *                       y0 = BW_NULL);
+# endif
+
+	void process(
+		const float * const * x,
+		float * const *       y,
+		size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+	void process(
+		std::array<const float *, N_CHANNELS> x,
+		float * const *                       y,
+		size_t                                nSamples);
+# endif
+
+	size_t work();
+
+	size_t getLatency();
+
+	size_t getNMissed();
+
+	size_t getNDropped();
+/*! <<<...
+ *  }
+ *  ```
+ *
+ *    `y0` and `y` are arrays of `N_CHANNELS * nIRs` elements, as in
+ *    `bw_conv_nu_reset_state_multi()` and `bw_conv_nu_process_multi()`.
+ *
+ *    `work()` can be called from a worker thread, as
+ *    `bw_conv_nu_work_multi()`, and `getNMissed()` and `getNDropped()` return
+ *    the sum over all channels.
+ *  }}} */
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+private:
+	bw_conv_nu_coeffs		coeffs;
+	bw_conv_nu_state		states[N_CHANNELS];
+	bw_conv_nu_state * BW_RESTRICT	statesP[N_CHANNELS];
+	void * BW_RESTRICT		mem;
+};
+
+template<size_t N_CHANNELS>
+inline ConvNU<N_CHANNELS>::ConvNU(
+		size_t headPartitionSize,
+		size_t tailPartitionSize,
+		size_t irLengthMax,
+		size_t nIRs) {
+	bw_conv_nu_init(&coeffs, headPartitionSize, tailPartitionSize, irLengthMax, nIRs);
+	const size_t coeffsReq = (bw_conv_nu_coeffs_mem_req(&coeffs) + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+	const size_t req = (bw_conv_nu_mem_req(&coeffs) + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+	mem = operator new(coeffsReq + req * N_CHANNELS);
+	bw_conv_nu_coeffs_mem_set(&coeffs, mem);
+	char *m = static_cast<char *>(mem) + coeffsReq;
+	for (size_t i = 0; i < N_CHANNELS; i++, m += req) {
+		bw_conv_nu_mem_set(&coeffs, states + i, m);
+		statesP[i] = states + i;
+	}
+}
+
+template<size_t N_CHANNELS>
+inline ConvNU<N_CHANNELS>::~ConvNU() {
+	operator delete(mem);
+}
+
+template<size_t N_CHANNELS>
+inline void ConvNU<N_CHANNELS>::setIR(
+		size_t                    ir,
+		const float * BW_RESTRICT x,
+		size_t                    length) {
+	bw_conv_nu_set_ir(&coeffs, ir, x, length);
+}
+
+template<size_t N_CHANNELS>
+inline void ConvNU<N_CHANNELS>::reset(
+		float               x0,
+		float * BW_RESTRICT y0) {
+	bw_conv_nu_reset_coeffs(&coeffs);
+	for (size_t i = 0; i < N_CHANNELS; i++)
+		bw_conv_nu_reset_state(&coeffs, states + i, x0, y0 != BW_NULL ? y0 + i * coeffs.n_irs : BW_NULL);
+}
+
+template<size_t N_CHANNELS>
+inline void ConvNU<N_CHANNELS>::reset(
+		const float * x0,
+		float *       y0) {
+	bw_conv_nu_reset_coeffs(&coeffs);
+	bw_conv_nu_reset_state_multi(&coeffs, statesP, x0, y0, N_CHANNELS);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void ConvNU<N_CHANNELS>::reset(
+		std::array<float, N_CHANNELS> x0,
+		float *                       y0) {
+	reset(x0.data(), y0);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void ConvNU<N_CHANNELS>::process(
+		const float * const * x,
+		float * const *       y,
+		size_t                nSamples) {
+	bw_conv_nu_process_multi(&coeffs, statesP, x, y, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void ConvNU<N_CHANNELS>::process(
+		std::array<const float *, N_CHANNELS> x,
+		float * const *                       y,
+		size_t                                nSamples) {
+	process(x.data(), y, nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline size_t ConvNU<N_CHANNELS>::work() {
+	return bw_conv_nu_work_multi(&coeffs, statesP, N_CHANNELS);
+}
+
+template<size_t N_CHANNELS>
+inline size_t ConvNU<N_CHANNELS>::getLatency() {
+	return bw_conv_nu_get_latency(&coeffs);
+}
+
+template<size_t N_CHANNELS>
+inline size_t ConvNU<N_CHANNELS>::getNMissed() {
+	size_t n = 0;
+	for (size_t i = 0; i < N_CHANNELS; i++)
+		n += bw_conv_nu_get_n_missed(states + i);
+	return n;
+}
+
+template<size_t N_CHANNELS>
+inline size_t ConvNU<N_CHANNELS>::getNDropped() {
+	size_t n = 0;
+	for (size_t i = 0; i < N_CHANNELS; i++)
+		n += bw_conv_nu_get_n_dropped(states + i);
+	return n;
+}
+
+}
+#endif
+
+#endif
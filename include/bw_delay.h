@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.3.2 }}}
+ *  version {{{ 1.4.0 }}}
  *  requires {{{ bw_buf bw_common bw_math }}}
  *  description {{{
  *    Interpolated delay line, not smoothed.
@@ -31,6 +31,27 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.4.0</strong>:
+ *        <ul>
+ *          <li>Added optional denormal killing via
+ *              <code>BW_DENORMAL_KILL</code>.</li>
+ *          <li>Added optional power-of-two delay line length via
+ *              <code>BW_DELAY_POW2</code>.</li>
+ *          <li>Added <code>bw_delay_read_block()</code> and
+ *              <code>bw_delay_write_block()</code>.</li>
+ *          <li><code>bw_delay_process()</code> and
+ *              <code>bw_delay_process_multi()</code> now process blocks of
+ *              samples at once when the delay is long enough.</li>
+ *          <li>Added optional reduced-precision delay line storage via
+ *              <code>BW_DELAY_STORAGE</code>.</li>
+ *          <li>Added <code>bw_delay_is_silent()</code> and corresponding
+ *              C++ API.</li>
+ *          <li><code>bw_delay_process()</code> and
+ *              <code>bw_delay_process_multi()</code> now skip writing and
+ *              reading the delay line and output zeros when it is silent and
+ *              the input is all zeros.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.3.2</strong>:
  *        <ul>
  *          <li>More robust input delay range definition for
@@ -138,6 +159,39 @@ extern "C" {
 /*** Public API ***/
 
 /*! api {{{
+ *    #### BW_DELAY_POW2
+ *
+ *    If `BW_DELAY_POW2` is defined, the length of delay lines is rounded up to
+ *    the next power of `2`, so that read and write positions can be wrapped
+ *    around using a bitmask instead of a comparison. This requires up to
+ *    twice as much memory.
+ *
+ *    #### BW_DELAY_STORAGE
+ *
+ *    Selects the format used to store samples in delay lines at compile time.
+ *    Valid values are:
+ *
+ *    * `0`: 32-bit floating point (default);
+ *    * `1`: 16-bit floating point (IEEE 754 half precision, 11-bit
+ *      significand), saturated to [`-65504.f`, `65504.f`];
+ *    * `2`: 16-bit signed fixed point, saturated to [`-1.f`, `1.f`).
+ *
+ *    `1` and `2` halve memory requirements and bandwidth of delay lines at the
+ *    cost of quantization noise and are thus only suitable where such noise is
+ *    masked (e.g., long delays and reverb tails). This setting affects all
+ *    modules that use `bw_delay` internally (e.g., `bw_chorus`, `bw_comb`, and
+ *    `bw_reverb`).
+ *  >>> */
+#ifndef BW_DELAY_STORAGE
+# define BW_DELAY_STORAGE	0
+#endif
+
+#if BW_DELAY_STORAGE < 0 || BW_DELAY_STORAGE > 2
+# error BW_DELAY_STORAGE must be 0, 1, or 2
+#endif
+
+/*! ...
+ *
  *    #### bw_delay_coeffs
  *  ```>>> */
 typedef struct bw_delay_coeffs bw_delay_coeffs;
@@ -246,6 +300,44 @@ static void bw_delay_write(
  *    Pushes the new sample `x` on the delay line identified by `coeffs` and
  *    `state`.
  *
+ *    #### bw_delay_read_block()
+ *  ```>>> */
+static void bw_delay_read_block(
+	const bw_delay_coeffs * BW_RESTRICT coeffs,
+	const bw_delay_state * BW_RESTRICT  state,
+	size_t                              di,
+	float                               df,
+	float * BW_RESTRICT                 y,
+	size_t                              n_samples);
+/*! <<<```
+ *    Fills the first `n_samples` of the output buffer `y` with the values
+ *    that `bw_delay_read()` would have returned using `di` + `df` as delay
+ *    just after each of the last `n_samples` pushes on the delay line
+ *    identified by `coeffs` and `state`, that is, `y[i]` gets the value read
+ *    by applying a delay of `di + n_samples - 1 - i` + `df` samples.
+ *
+ *    Samples are copied in at most two contiguous segments, which amounts to
+ *    plain memory copies if `df` is `0.f`.
+ *
+ *    `df` must be in [`0.f`, `1.f`) and `di + n_samples` must not exceed the
+ *    delay line length (see `bw_delay_get_length()`). Hence, writing a block of
+ *    `n_samples` using `bw_delay_write_block()` and then reading it with this
+ *    function is equivalent to alternating `bw_delay_write()` and
+ *    `bw_delay_read()` sample by sample if `di + n_samples` is less than the
+ *    delay line length.
+ *
+ *    #### bw_delay_write_block()
+ *  ```>>> */
+static void bw_delay_write_block(
+	const bw_delay_coeffs * BW_RESTRICT coeffs,
+	bw_delay_state * BW_RESTRICT        state,
+	const float * BW_RESTRICT           x,
+	size_t                              n_samples);
+/*! <<<```
+ *    Pushes the first `n_samples` of the input buffer `x` on the delay line
+ *    identified by `coeffs` and `state`, as if `bw_delay_write()` was called
+ *    for each of them, in at most two contiguous segments.
+ *
  *    #### bw_delay_update_coeffs_ctrl()
  *  ```>>> */
 static inline void bw_delay_update_coeffs_ctrl(
@@ -319,6 +411,21 @@ static inline size_t bw_delay_get_length(
  *
  *    `coeffs` must be at least in the "sample-rate-set" state.
  *
+ *    #### bw_delay_is_silent()
+ *  ```>>> */
+static inline char bw_delay_is_silent(
+	const bw_delay_coeffs * BW_RESTRICT coeffs,
+	const bw_delay_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Returns non-`0` if the delay line identified by `coeffs` and `state` only
+ *    contains zeros, that is, if at least as many consecutive zeros as its
+ *    length have been pushed on it since the last non-zero sample, `0`
+ *    otherwise.
+ *
+ *    `bw_delay_process()` and `bw_delay_process_multi()` only output zeros,
+ *    without touching the delay line, when this condition is met and the
+ *    input buffers are all zeros.
+ *
  *    #### bw_delay_coeffs_is_valid()
  *  ```>>> */
 static inline char bw_delay_coeffs_is_valid(
@@ -396,6 +503,9 @@ struct bw_delay_coeffs {
 	// Coefficients
 	float				fs;
 	size_t				len;
+#ifdef BW_DELAY_POW2
+	size_t				mask;
+#endif
 
 	size_t				di;
 	float				df;
@@ -406,6 +516,14 @@ struct bw_delay_coeffs {
 	char				delay_changed;
 };
 
+#if BW_DELAY_STORAGE == 0
+typedef float bw_delay_sample;
+#elif BW_DELAY_STORAGE == 1
+typedef uint16_t bw_delay_sample;
+#else
+typedef int16_t bw_delay_sample;
+#endif
+
 struct bw_delay_state {
 #ifdef BW_DEBUG_DEEP
 	uint32_t			hash;
@@ -414,10 +532,54 @@ struct bw_delay_state {
 #endif
 
 	// States
-	float * BW_RESTRICT		buf;
+	bw_delay_sample * BW_RESTRICT	buf;
 	size_t				idx;
+	size_t				n_zeros;
 };
 
+static inline bw_delay_sample bw_delay_sample_from_float(
+		float x) {
+#if BW_DELAY_STORAGE == 0
+	return x;
+#elif BW_DELAY_STORAGE == 1
+	// round to nearest even, see F. Giesen, "Float->half variants", 2012
+	union { float f; uint32_t u; } v;
+	v.f = x;
+	const uint32_t s = (v.u >> 16) & 0x8000u;
+	const uint32_t a = v.u & 0x7fffffffu;
+	if (a >= 0x477ff000u) // would round to +/-inf
+		return (bw_delay_sample)(s | 0x7bffu);
+	if (a < 0x38800000u) { // subnormal, let the FPU do the rounding
+		v.u = a;
+		v.f += 0.5f;
+		return (bw_delay_sample)(s | (v.u - 0x3f000000u));
+	}
+	return (bw_delay_sample)(s | ((a + 0xc8000fffu + ((a >> 13) & 1)) >> 13));
+#else
+	const float v = bw_clipf(32768.f * x, -32768.f, 32767.f);
+	return (bw_delay_sample)(v + (v < 0.f ? -0.5f : 0.5f));
+#endif
+}
+
+static inline float bw_delay_sample_to_float(
+		bw_delay_sample x) {
+#if BW_DELAY_STORAGE == 0
+	return x;
+#elif BW_DELAY_STORAGE == 1
+	union { float f; uint32_t u; } v;
+	v.u = (uint32_t)(x & 0x7fffu) << 13;
+	if (v.u < 0x00800000u) { // subnormal or zero
+		v.u += 0x38800000u;
+		v.f -= 6.103515625e-5f;
+	} else
+		v.u += 0x38000000u;
+	v.u |= (uint32_t)(x & 0x8000u) << 16;
+	return v.f;
+#else
+	return (1.f / 32768.f) * (float)x;
+#endif
+}
+
 static inline void bw_delay_init(
 		bw_delay_coeffs * BW_RESTRICT coeffs,
 		float                         max_delay) {
@@ -447,6 +609,13 @@ static inline void bw_delay_set_sample_rate(
 
 	coeffs->fs = sample_rate;
 	coeffs->len = (size_t)bw_ceilf(coeffs->fs * coeffs->max_delay) + 1;
+#ifdef BW_DELAY_POW2
+	size_t len = 1;
+	while (len < coeffs->len)
+		len <<= 1;
+	coeffs->len = len;
+	coeffs->mask = len - 1;
+#endif
 
 #ifdef BW_DEBUG_DEEP
 	coeffs->state = bw_delay_coeffs_state_set_sample_rate;
@@ -461,7 +630,7 @@ static inline size_t bw_delay_mem_req(
 	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_set_sample_rate);
 
-	return coeffs->len * sizeof(float);
+	return coeffs->len * sizeof(bw_delay_sample);
 }
 
 static inline void bw_delay_mem_set(
@@ -475,7 +644,7 @@ static inline void bw_delay_mem_set(
 	BW_ASSERT(mem != BW_NULL);
 
 	(void)coeffs;
-	state->buf = (float *)mem;
+	state->buf = (bw_delay_sample *)mem;
 
 #ifdef BW_DEBUG_DEEP
 	state->hash = bw_hash_sdbm("bw_delay_state");
@@ -525,9 +694,17 @@ static inline float bw_delay_reset_state(
 	BW_ASSERT_DEEP(state->state >= bw_delay_state_state_mem_set);
 	BW_ASSERT(bw_is_finite(x_0));
 
+#if BW_DELAY_STORAGE == 0
 	bw_buf_fill(x_0, state->buf, coeffs->len);
-	state->idx = 0;
 	const float y = x_0;
+#else
+	const bw_delay_sample v = bw_delay_sample_from_float(x_0);
+	for (size_t i = 0; i < coeffs->len; i++)
+		state->buf[i] = v;
+	const float y = bw_delay_sample_to_float(v);
+#endif
+	state->idx = 0;
+	state->n_zeros = y == 0.f ? coeffs->len : 0;
 
 #ifdef BW_DEBUG_DEEP
 	state->state = bw_delay_state_state_reset_state;
@@ -586,9 +763,15 @@ static float bw_delay_read(
 	BW_ASSERT(df >= 0.f && df < 1.f);
 	BW_ASSERT(di < coeffs->len);
 
+#ifdef BW_DELAY_POW2
+	const size_t n = (state->idx - di) & coeffs->mask;
+	const size_t p = (n - 1) & coeffs->mask;
+#else
 	const size_t n = (state->idx + (state->idx >= di ? 0 : coeffs->len)) - di;
 	const size_t p = (n ? n : coeffs->len) - 1;
-	const float y = state->buf[n] + df * (state->buf[p] - state->buf[n]);
+#endif
+	const float yn = bw_delay_sample_to_float(state->buf[n]);
+	const float y = yn + df * (bw_delay_sample_to_float(state->buf[p]) - yn);
 
 	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_reset_coeffs);
@@ -611,9 +794,135 @@ static void bw_delay_write(
 	BW_ASSERT_DEEP(state->state >= bw_delay_state_state_reset_state);
 	BW_ASSERT(bw_is_finite(x));
 
+#ifdef BW_DELAY_POW2
+	state->idx = (state->idx + 1) & coeffs->mask;
+#else
 	state->idx++;
 	state->idx = state->idx == coeffs->len ? 0 : state->idx;
-	state->buf[state->idx] = x;
+#endif
+	const float v = BW_KILL_DENORMAL_STATE(x);
+	state->buf[state->idx] = bw_delay_sample_from_float(v);
+	state->n_zeros = v != 0.f ? 0 : (state->n_zeros < coeffs->len ? state->n_zeros + 1 : coeffs->len);
+
+	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_delay_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_delay_state_state_reset_state);
+}
+
+static inline void bw_delay_read_segment(
+		const bw_delay_sample * BW_RESTRICT src,
+		float                               prev,
+		float                               df,
+		float * BW_RESTRICT                 y,
+		size_t                              n) {
+#if BW_DELAY_STORAGE == 0
+	if (df == 0.f)
+		bw_buf_copy(src, y, n);
+	else
+		for (size_t i = 0; i < n; i++) {
+			y[i] = src[i] + df * (prev - src[i]);
+			prev = src[i];
+		}
+#else
+	if (df == 0.f)
+		for (size_t i = 0; i < n; i++)
+			y[i] = bw_delay_sample_to_float(src[i]);
+	else
+		for (size_t i = 0; i < n; i++) {
+			const float v = bw_delay_sample_to_float(src[i]);
+			y[i] = v + df * (prev - v);
+			prev = v;
+		}
+#endif
+}
+
+static void bw_delay_read_block(
+		const bw_delay_coeffs * BW_RESTRICT coeffs,
+		const bw_delay_state * BW_RESTRICT  state,
+		size_t                              di,
+		float                               df,
+		float * BW_RESTRICT                 y,
+		size_t                              n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_delay_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_delay_state_state_reset_state);
+	BW_ASSERT(bw_is_finite(df));
+	BW_ASSERT(df >= 0.f && df < 1.f);
+	BW_ASSERT(di + n_samples <= coeffs->len);
+	BW_ASSERT(y != BW_NULL);
+
+	if (n_samples == 0)
+		return;
+
+	// oldest sample to read and the one preceding it
+	const size_t d = di + n_samples - 1;
+	const size_t s = (state->idx + (state->idx >= d ? 0 : coeffs->len)) - d;
+	const float prev = bw_delay_sample_to_float(state->buf[(s ? s : coeffs->len) - 1]);
+	const size_t n1 = coeffs->len - s < n_samples ? coeffs->len - s : n_samples;
+	bw_delay_read_segment(state->buf + s, prev, df, y, n1);
+	if (n1 != n_samples)
+		bw_delay_read_segment(state->buf, bw_delay_sample_to_float(state->buf[coeffs->len - 1]), df, y + n1,
+			n_samples - n1);
+
+	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_delay_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_delay_state_state_reset_state);
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_samples));
+}
+
+static inline void bw_delay_write_segment(
+		const float * BW_RESTRICT     x,
+		bw_delay_sample * BW_RESTRICT dest,
+		size_t                        n) {
+#if BW_DELAY_STORAGE == 0 && !defined(BW_DENORMAL_KILL)
+	bw_buf_copy(x, dest, n);
+#else
+	for (size_t i = 0; i < n; i++)
+		dest[i] = bw_delay_sample_from_float(BW_KILL_DENORMAL_STATE(x[i]));
+#endif
+}
+
+static void bw_delay_write_block(
+		const bw_delay_coeffs * BW_RESTRICT coeffs,
+		bw_delay_state * BW_RESTRICT        state,
+		const float * BW_RESTRICT           x,
+		size_t                              n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_delay_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_delay_state_state_reset_state);
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
+
+	if (n_samples == 0)
+		return;
+
+	// samples that would be overwritten within this same block are skipped
+	size_t n = n_samples;
+	if (n > coeffs->len) {
+		const size_t skip = n - coeffs->len;
+		state->idx = (state->idx + skip) % coeffs->len;
+		x += skip;
+		n = coeffs->len;
+	}
+
+	const size_t s = state->idx + 1 == coeffs->len ? 0 : state->idx + 1;
+	const size_t n1 = coeffs->len - s < n ? coeffs->len - s : n;
+	bw_delay_write_segment(x, state->buf + s, n1);
+	bw_delay_write_segment(x + n1, state->buf, n - n1);
+	state->idx = n1 != n ? n - n1 - 1 : s + n - 1;
+
+	size_t z = 0;
+	while (z < n && BW_KILL_DENORMAL_STATE(x[n - 1 - z]) == 0.f)
+		z++;
+	state->n_zeros = z != n ? z : (state->n_zeros < coeffs->len - n ? state->n_zeros + n : coeffs->len);
 
 	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_reset_coeffs);
@@ -683,8 +992,14 @@ static inline void bw_delay_process(
 	BW_ASSERT(y != BW_NULL);
 
 	bw_delay_update_coeffs_ctrl(coeffs);
-	for (size_t i = 0; i < n_samples; i++)
-		y[i] = bw_delay_process1(coeffs, state, x[i]);
+	if (bw_delay_is_silent(coeffs, state) && bw_has_only_zeros(x, n_samples))
+		bw_buf_fill(0.f, y, n_samples);
+	else if (coeffs->di + n_samples < coeffs->len) {
+		bw_delay_write_block(coeffs, state, x, n_samples);
+		bw_delay_read_block(coeffs, state, coeffs->di, coeffs->df, y, n_samples);
+	} else
+		for (size_t i = 0; i < n_samples; i++)
+			y[i] = bw_delay_process1(coeffs, state, x[i]);
 
 	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_reset_coeffs);
@@ -730,10 +1045,18 @@ static inline void bw_delay_process_multi(
 			BW_ASSERT(i == j || x[i] != y[j]);
 #endif
 
+	// channels are independent and coefficients only change at control rate,
+	// hence each channel can be processed on its own
 	bw_delay_update_coeffs_ctrl(coeffs);
-	for (size_t i = 0; i < n_samples; i++)
-		for (size_t j = 0; j < n_channels; j++)
-			y[j][i] = bw_delay_process1(coeffs, state[j], x[j][i]);
+	for (size_t j = 0; j < n_channels; j++)
+		if (bw_delay_is_silent(coeffs, state[j]) && bw_has_only_zeros(x[j], n_samples))
+			bw_buf_fill(0.f, y[j], n_samples);
+		else if (coeffs->di + n_samples < coeffs->len) {
+			bw_delay_write_block(coeffs, state[j], x[j], n_samples);
+			bw_delay_read_block(coeffs, state[j], coeffs->di, coeffs->df, y[j], n_samples);
+		} else
+			for (size_t i = 0; i < n_samples; i++)
+				y[j][i] = bw_delay_process1(coeffs, state[j], x[j][i]);
 
 	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_reset_coeffs);
@@ -772,6 +1095,19 @@ static inline size_t bw_delay_get_length(
 	return coeffs->len;
 }
 
+static inline char bw_delay_is_silent(
+		const bw_delay_coeffs * BW_RESTRICT coeffs,
+		const bw_delay_state * BW_RESTRICT  state) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_delay_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_delay_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_delay_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_delay_state_state_reset_state);
+
+	return state->n_zeros >= coeffs->len;
+}
+
 static inline char bw_delay_coeffs_is_valid(
 		const bw_delay_coeffs * BW_RESTRICT coeffs) {
 	BW_ASSERT(coeffs != BW_NULL);
@@ -831,6 +1167,8 @@ static inline char bw_delay_state_is_valid(
 
 		if (state->idx >= coeffs->len)
 			return 0;
+		if (state->n_zeros > coeffs->len)
+			return 0;
 	}
 #endif
 
@@ -905,6 +1243,9 @@ public:
 		float value);
 
 	size_t getLength();
+
+	char isSilent(
+		size_t channel);
 /*! <<<...
  *  }
  *  ```
@@ -1037,6 +1378,12 @@ inline size_t Delay<N_CHANNELS>::getLength() {
 	return bw_delay_get_length(&coeffs);
 }
 
+template<size_t N_CHANNELS>
+inline char Delay<N_CHANNELS>::isSilent(
+		size_t channel) {
+	return bw_delay_is_silent(&coeffs, states + channel);
+}
+
 }
 #endif
 
@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_math bw_one_pole }}}
  *  description {{{
  *    Linear ADSR envelope generator.
@@ -40,6 +40,12 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -554,13 +560,13 @@ static inline void bw_env_gen_do_update_coeffs_ctrl(
 	if (coeffs->param_changed) {
 		// coeffs->T = actual minimum duration
 		if (coeffs->param_changed & BW_ENV_GEN_PARAM_ATTACK)
-			coeffs->attack_inc = coeffs->attack > coeffs->T ? (float)BW_ENV_GEN_V_MAX * (coeffs->T * bw_rcpf(coeffs->attack)) : BW_ENV_GEN_V_MAX;
+			coeffs->attack_inc = coeffs->attack > coeffs->T ? (float)BW_ENV_GEN_V_MAX * (coeffs->T * bw_rcpf_ctrl(coeffs->attack)) : BW_ENV_GEN_V_MAX;
 		if (coeffs->param_changed & (BW_ENV_GEN_PARAM_DECAY | BW_ENV_GEN_PARAM_SUSTAIN))
-			coeffs->decay_dec = (1.f - coeffs->sustain) * (coeffs->decay > coeffs->T ? ((float)BW_ENV_GEN_V_MAX * (coeffs->T * bw_rcpf(coeffs->decay))) : BW_ENV_GEN_V_MAX);
+			coeffs->decay_dec = (1.f - coeffs->sustain) * (coeffs->decay > coeffs->T ? ((float)BW_ENV_GEN_V_MAX * (coeffs->T * bw_rcpf_ctrl(coeffs->decay))) : BW_ENV_GEN_V_MAX);
 		if (coeffs->param_changed & BW_ENV_GEN_PARAM_SUSTAIN)
 			coeffs->sustain_v = (float)BW_ENV_GEN_V_MAX * coeffs->sustain;
 		if (coeffs->param_changed & (BW_ENV_GEN_PARAM_SUSTAIN | BW_ENV_GEN_PARAM_RELEASE))
-			coeffs->release_dec = coeffs->sustain * (coeffs->release > coeffs->T ? ((float)BW_ENV_GEN_V_MAX * (coeffs->T * bw_rcpf(coeffs->release))) : BW_ENV_GEN_V_MAX);
+			coeffs->release_dec = coeffs->sustain * (coeffs->release > coeffs->T ? ((float)BW_ENV_GEN_V_MAX * (coeffs->T * bw_rcpf_ctrl(coeffs->release))) : BW_ENV_GEN_V_MAX);
 		coeffs->param_changed = 0;
 	}
 }
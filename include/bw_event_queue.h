@@ -0,0 +1,415 @@
+/*
+ * Brickworks
+ *
+ * Copyright (C) 2026 Orastron Srl unipersonale
+ *
+ * Brickworks is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * Brickworks is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Brickworks.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File author: Stefano D'Angelo
+ */
+
+/*!
+ *  module_type {{{ utility }}}
+ *  version {{{ 1.0.0 }}}
+ *  requires {{{ bw_common bw_note_queue }}}
+ *  description {{{
+ *    Wait-free single-producer single-consumer queue of timestamped note,
+ *    controller, and parameter events.
+ *
+ *    It is meant to pass events from one thread (e.g., MIDI input) to the
+ *    audio processing thread without locks or memory allocation, and it
+ *    helps the latter to split processing blocks at event boundaries, so
+ *    that events are handled with sample accuracy.
+ *
+ *    It requires a compiler that supports either GCC-style
+ *    (<code>\_\_atomic\_\*</code>) or MSVC-style
+ *    (<code>\_Interlocked\*</code>) atomic intrinsics.
+ *  }}}
+ *  changelog {{{
+ *    <ul>
+ *      <li>Version <strong>1.0.0</strong>:
+ *        <ul>
+ *          <li>First release.</li>
+ *        </ul>
+ *      </li>
+ *    </ul>
+ *  }}}
+ */
+
+#ifndef BW_EVENT_QUEUE_H
+#define BW_EVENT_QUEUE_H
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_common.h"
+# include "bw_note_queue.h"
+#else
+# include <bw_common.h>
+# include <bw_note_queue.h>
+#endif
+
+#if !defined(__GNUC__) && defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+/*** Public API ***/
+
+/*! api {{{
+ *
+ *    #### BW_EVENT_QUEUE_SIZE
+ *
+ *    Capacity of `bw_event_queue`, that is, the maximum number of events that
+ *    can be pushed and not yet consumed at any given time. It must be a power
+ *    of `2` and its default value is `1024`.
+ *  >>> */
+#ifndef BW_EVENT_QUEUE_SIZE
+# define BW_EVENT_QUEUE_SIZE	1024
+#endif
+
+#if BW_EVENT_QUEUE_SIZE < 1 || (BW_EVENT_QUEUE_SIZE & (BW_EVENT_QUEUE_SIZE - 1)) != 0
+# error BW_EVENT_QUEUE_SIZE must be a power of 2
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+/*! ...
+ *
+ *    #### bw_event_queue_type
+ *  ```>>> */
+typedef enum {
+	bw_event_queue_type_note,
+	bw_event_queue_type_controller,
+	bw_event_queue_type_parameter
+} bw_event_queue_type;
+/*! <<<```
+ *    Event type:
+ *     * `bw_event_queue_type_note`: note on/off event;
+ *     * `bw_event_queue_type_controller`: controller change event;
+ *     * `bw_event_queue_type_parameter`: parameter change event.
+ *
+ *    #### bw_event_queue_event
+ *  ```>>> */
+typedef struct {
+	uint32_t            time;
+	bw_event_queue_type type;
+	uint32_t            index;
+	float               value;
+	char                pressed;
+} bw_event_queue_event;
+/*! <<<```
+ *    Timestamped event:
+ *     * `time`: time in samples, as counted by the consumer (see
+ *       `bw_event_queue_drain()`), wrapping around at `2^32`;
+ *     * `type`: event type;
+ *     * `index`: note number in [`0`, `127`] for note events, or otherwise
+ *       controller or parameter index;
+ *     * `value`: velocity in [`0.f`, `1.f`] or otherwise negative to indicate
+ *       unknown / not available for note events, or otherwise controller or
+ *       parameter value;
+ *     * `pressed`: whether the note is pressed (non-`0`) or not (`0`) for note
+ *       events, ignored otherwise.
+ *
+ *    #### bw_event_queue
+ *  ```>>> */
+typedef struct bw_event_queue bw_event_queue;
+/*! <<<```
+ *    Event queue.
+ *
+ *    Only one thread at a time can act as producer, that is, call
+ *    `bw_event_queue_push()`, and only one thread at a time can act as
+ *    consumer, that is, call `bw_event_queue_pop()` or
+ *    `bw_event_queue_drain()`. Events must be pushed in non-decreasing
+ *    `time` order.
+ *
+ *    #### bw_event_queue_reset()
+ *  ```>>> */
+static inline void bw_event_queue_reset(
+	bw_event_queue * BW_RESTRICT queue);
+/*! <<<```
+ *    Empties `queue`.
+ *
+ *    It must not be called while other threads are using `queue`.
+ *
+ *    #### bw_event_queue_push()
+ *  ```>>> */
+static inline char bw_event_queue_push(
+	bw_event_queue * BW_RESTRICT             queue,
+	const bw_event_queue_event * BW_RESTRICT event);
+/*! <<<```
+ *    Adds a copy of `event` to `queue`, to be called by the producer.
+ *
+ *    Returns non-`0` on success or `0` if `queue` is full, in which case
+ *    `event` is discarded.
+ *
+ *    #### bw_event_queue_pop()
+ *  ```>>> */
+static inline char bw_event_queue_pop(
+	bw_event_queue * BW_RESTRICT       queue,
+	bw_event_queue_event * BW_RESTRICT event);
+/*! <<<```
+ *    Removes the oldest event from `queue` and copies it into `event`, to be
+ *    called by the consumer, regardless of its timestamp.
+ *
+ *    Returns non-`0` on success or `0` if `queue` is empty.
+ *
+ *    #### bw_event_queue_drain()
+ *  ```>>> */
+static inline char bw_event_queue_drain(
+	bw_event_queue * BW_RESTRICT       queue,
+	bw_note_queue * BW_RESTRICT        note_queue,
+	uint32_t                           time,
+	size_t                             n_samples,
+	size_t * BW_RESTRICT               n,
+	bw_event_queue_event * BW_RESTRICT event);
+/*! <<<```
+ *    Consumes events from `queue` that are due at or before `time`, to be
+ *    called by the consumer at the start of each portion of the processing
+ *    block of `n_samples` samples starting at `time`.
+ *
+ *    Note events are added to `note_queue` using `bw_note_queue_add()`.
+ *    If a controller or parameter event is found and `event` is not
+ *    `BW_NULL`, it is copied into `event` and the function returns non-`0`
+ *    immediately, so that the caller can handle it and call this function
+ *    again. Otherwise, if `event` is `BW_NULL`, such events are discarded.
+ *
+ *    When it returns `0`, the number of samples that can be processed before
+ *    the next pending event, in [`1`, `n_samples`] if `n_samples` is
+ *    positive, is written into `n`. The caller then typically processes
+ *    such samples, clears `note_queue`, and starts over from `time + n`.
+ *
+ *    Late events (those due before `time`) are handled as if they were due
+ *    at `time`. Events due more than `2^31 - 1` samples after `time` are
+ *    considered late.
+ *
+ *    #### bw_event_queue_is_valid()
+ *  ```>>> */
+static inline char bw_event_queue_is_valid(
+	const bw_event_queue * BW_RESTRICT queue);
+/*! <<<```
+ *    Tries to determine whether `queue` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    `queue` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_event_queue`.
+ *  }}} */
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+#if defined(__GNUC__)
+# define BW_EVENT_QUEUE_LOAD_ACQUIRE(p)		__atomic_load_n(p, __ATOMIC_ACQUIRE)
+# define BW_EVENT_QUEUE_STORE_RELEASE(p, v)	__atomic_store_n(p, v, __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+# define BW_EVENT_QUEUE_LOAD_ACQUIRE(p)		((uint32_t)_InterlockedOr((volatile long *)(p), 0))
+# define BW_EVENT_QUEUE_STORE_RELEASE(p, v)	((void)_InterlockedExchange((volatile long *)(p), (long)(v)))
+#else
+# error bw_event_queue requires GCC-style or MSVC-style atomic intrinsics
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+struct bw_event_queue {
+#ifdef BW_DEBUG_DEEP
+	uint32_t		hash;
+#endif
+
+	bw_event_queue_event	events[BW_EVENT_QUEUE_SIZE];
+
+	// head is only written by the producer and tail only by the consumer,
+	// padding keeps them on different cache lines
+	uint32_t		head;
+	char			pad_head[64 - sizeof(uint32_t)];
+	uint32_t		tail;
+	char			pad_tail[64 - sizeof(uint32_t)];
+};
+
+static inline void bw_event_queue_reset(
+		bw_event_queue * BW_RESTRICT queue) {
+	BW_ASSERT(queue != BW_NULL);
+
+	queue->head = 0;
+	queue->tail = 0;
+
+#ifdef BW_DEBUG_DEEP
+	queue->hash = bw_hash_sdbm("bw_event_queue");
+#endif
+	BW_ASSERT_DEEP(bw_event_queue_is_valid(queue));
+}
+
+static inline char bw_event_queue_push(
+		bw_event_queue * BW_RESTRICT             queue,
+		const bw_event_queue_event * BW_RESTRICT event) {
+	BW_ASSERT(queue != BW_NULL);
+	BW_ASSERT(event != BW_NULL);
+	BW_ASSERT(event->type >= bw_event_queue_type_note && event->type <= bw_event_queue_type_parameter);
+	BW_ASSERT(event->type != bw_event_queue_type_note || event->index < 128);
+	BW_ASSERT(event->type != bw_event_queue_type_note || (bw_is_finite(event->value) && event->value <= 1.f));
+
+	const uint32_t head = queue->head;
+	if (head - BW_EVENT_QUEUE_LOAD_ACQUIRE(&queue->tail) >= BW_EVENT_QUEUE_SIZE)
+		return 0;
+	queue->events[head & (BW_EVENT_QUEUE_SIZE - 1)] = *event;
+	BW_EVENT_QUEUE_STORE_RELEASE(&queue->head, head + 1);
+	return 1;
+}
+
+static inline char bw_event_queue_pop(
+		bw_event_queue * BW_RESTRICT       queue,
+		bw_event_queue_event * BW_RESTRICT event) {
+	BW_ASSERT(queue != BW_NULL);
+	BW_ASSERT(event != BW_NULL);
+
+	const uint32_t tail = queue->tail;
+	if (tail == BW_EVENT_QUEUE_LOAD_ACQUIRE(&queue->head))
+		return 0;
+	*event = queue->events[tail & (BW_EVENT_QUEUE_SIZE - 1)];
+	BW_EVENT_QUEUE_STORE_RELEASE(&queue->tail, tail + 1);
+	return 1;
+}
+
+static inline char bw_event_queue_drain(
+		bw_event_queue * BW_RESTRICT       queue,
+		bw_note_queue * BW_RESTRICT        note_queue,
+		uint32_t                           time,
+		size_t                             n_samples,
+		size_t * BW_RESTRICT               n,
+		bw_event_queue_event * BW_RESTRICT event) {
+	BW_ASSERT(queue != BW_NULL);
+	BW_ASSERT(note_queue != BW_NULL);
+	BW_ASSERT_DEEP(bw_note_queue_is_valid(note_queue));
+	BW_ASSERT(n != BW_NULL);
+
+	const uint32_t head = BW_EVENT_QUEUE_LOAD_ACQUIRE(&queue->head);
+	uint32_t tail = queue->tail;
+	size_t m = n_samples;
+	char ret = 0;
+	while (tail != head) {
+		const bw_event_queue_event *ev = queue->events + (tail & (BW_EVENT_QUEUE_SIZE - 1));
+		const uint32_t d = ev->time - time;
+		if (d != 0 && d < 0x80000000) {
+			m = d < m ? d : m;
+			break;
+		}
+		tail++;
+		if (ev->type == bw_event_queue_type_note)
+			bw_note_queue_add(note_queue, (unsigned char)ev->index, ev->pressed, ev->value, 0);
+		else if (event != BW_NULL) {
+			*event = *ev;
+			ret = 1;
+			break;
+		}
+	}
+	BW_EVENT_QUEUE_STORE_RELEASE(&queue->tail, tail);
+	*n = m;
+
+	BW_ASSERT_DEEP(bw_note_queue_is_valid(note_queue));
+	BW_ASSERT(ret || n_samples == 0 || (*n >= 1 && *n <= n_samples));
+
+	return ret;
+}
+
+static inline char bw_event_queue_is_valid(
+		const bw_event_queue * BW_RESTRICT queue) {
+	BW_ASSERT(queue != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (queue->hash != bw_hash_sdbm("bw_event_queue"))
+		return 0;
+#endif
+
+	return queue->head - queue->tail <= BW_EVENT_QUEUE_SIZE;
+}
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+#undef BW_EVENT_QUEUE_LOAD_ACQUIRE
+#undef BW_EVENT_QUEUE_STORE_RELEASE
+
+#if !defined(BW_NO_CXX) && defined(__cplusplus)
+
+/*** Public C++ API ***/
+
+namespace Brickworks {
+
+/*! api_cpp {{{
+ *    ##### Brickworks::EventQueue
+ *  ```>>> */
+class EventQueue {
+public:
+	EventQueue();
+
+	bool push(
+		const bw_event_queue_event & event);
+
+	bool pop(
+		bw_event_queue_event & event);
+
+	bool drain(
+		NoteQueue &            noteQueue,
+		uint32_t               time,
+		size_t                 nSamples,
+		size_t &               n,
+		bw_event_queue_event * event = BW_NULL);
+/*! <<<...
+ *  }
+ *  ```
+ *  }}} */
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+private:
+	bw_event_queue	queue;
+};
+
+inline EventQueue::EventQueue() {
+	bw_event_queue_reset(&queue);
+}
+
+inline bool EventQueue::push(
+		const bw_event_queue_event & event) {
+	return bw_event_queue_push(&queue, &event);
+}
+
+inline bool EventQueue::pop(
+		bw_event_queue_event & event) {
+	return bw_event_queue_pop(&queue, &event);
+}
+
+inline bool EventQueue::drain(
+		NoteQueue &            noteQueue,
+		uint32_t               time,
+		size_t                 nSamples,
+		size_t &               n,
+		bw_event_queue_event * event) {
+	return bw_event_queue_drain(&queue, &noteQueue.queue, time, nSamples, &n, event);
+}
+
+}
+#endif
+
+#endif
@@ -0,0 +1,1353 @@
+/*
+ * Brickworks
+ *
+ * Copyright (C) 2026 Orastron Srl unipersonale
+ *
+ * Brickworks is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * Brickworks is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Brickworks.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File author: Stefano D'Angelo
+ */
+
+/*!
+ *  module_type {{{ dsp }}}
+ *  version {{{ 1.0.0 }}}
+ *  requires {{{
+ *    bw_buf bw_common bw_delay bw_dry_wet bw_gain bw_lp1 bw_math bw_one_pole
+ *  }}}
+ *  description {{{
+ *    Stereo feedback delay network reverb with 4, 8, or 16 delay lines.
+ *
+ *    The outputs of the delay lines are lowpass filtered, attenuated according
+ *    to the desired decay time, mixed by means of an orthogonal feedback
+ *    matrix (Hadamard or Householder), and fed back into the delay lines along
+ *    with the input signal. The left input is fed into even delay lines and
+ *    the right input into odd ones, and similarly the left output is taken
+ *    from even delay lines and the right output from odd ones.
+ *
+ *    Delay line lengths are fixed and range between about 21 ms and 100 ms.
+ *
+ *    The Hadamard matrix is applied using the fast Walsh-Hadamard transform
+ *    (O(N log N) operations) and the Householder matrix using its rank-one
+ *    structure (O(N) operations), where N is the number of delay lines.
+ *
+ *    See, e.g.,
+ *
+ *    J.-M. Jot and A. Chaigne, "Digital Delay Networks for Designing
+ *    Artificial Reverberators", 90th AES Convention, Paris, France, February
+ *    1991.
+ *  }}}
+ *  changelog {{{
+ *    <ul>
+ *      <li>Version <strong>1.0.0</strong>:
+ *        <ul>
+ *          <li>First release.</li>
+ *        </ul>
+ *      </li>
+ *    </ul>
+ *  }}}
+ */
+
+#ifndef BW_FDN_H
+#define BW_FDN_H
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_common.h"
+#else
+# include <bw_common.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+/*** Public API ***/
+
+/*! api {{{
+ *    #### bw_fdn_matrix
+ *  ```>>> */
+typedef enum {
+	bw_fdn_matrix_hadamard,
+	bw_fdn_matrix_householder
+} bw_fdn_matrix;
+/*! <<<```
+ *    Feedback matrix types:
+ *     * `bw_fdn_matrix_hadamard`: normalized Hadamard matrix, maximally
+ *       diffusive;
+ *     * `bw_fdn_matrix_householder`: Householder reflection
+ *       (I - (2 / N) * 1 * 1<sup>T</sup>), less diffusive and cheaper.
+ *
+ *    #### bw_fdn_coeffs
+ *  ```>>> */
+typedef struct bw_fdn_coeffs bw_fdn_coeffs;
+/*! <<<```
+ *    Coefficients and related.
+ *
+ *    #### bw_fdn_state
+ *  ```>>> */
+typedef struct bw_fdn_state bw_fdn_state;
+/*! <<<```
+ *    Internal state and related.
+ *
+ *    #### bw_fdn_init()
+ *  ```>>> */
+static inline void bw_fdn_init(
+	bw_fdn_coeffs * BW_RESTRICT coeffs,
+	size_t                      n_lines);
+/*! <<<```
+ *    Initializes input parameter values in `coeffs` using `n_lines` delay
+ *    lines.
+ *
+ *    `n_lines` must be either `4`, `8`, or `16`.
+ *
+ *    #### bw_fdn_set_sample_rate()
+ *  ```>>> */
+static inline void bw_fdn_set_sample_rate(
+	bw_fdn_coeffs * BW_RESTRICT coeffs,
+	float                       sample_rate);
+/*! <<<```
+ *    Sets the `sample_rate` (Hz) value in `coeffs`.
+ *
+ *    #### bw_fdn_mem_req()
+ *  ```>>> */
+static inline size_t bw_fdn_mem_req(
+	const bw_fdn_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the size, in bytes, of contiguous memory to be supplied to
+ *    `bw_fdn_mem_set()` using `coeffs`.
+ *
+ *    #### bw_fdn_mem_set()
+ *  ```>>> */
+static inline void bw_fdn_mem_set(
+	const bw_fdn_coeffs * BW_RESTRICT coeffs,
+	bw_fdn_state * BW_RESTRICT        state,
+	void * BW_RESTRICT                mem);
+/*! <<<```
+ *    Associates the contiguous memory block `mem` to the given `state` using
+ *    `coeffs`.
+ *
+ *    #### bw_fdn_reset_coeffs()
+ *  ```>>> */
+static inline void bw_fdn_reset_coeffs(
+	bw_fdn_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Resets coefficients in `coeffs` to assume their target values.
+ *
+ *    #### bw_fdn_reset_state()
+ *  ```>>> */
+static inline void bw_fdn_reset_state(
+	const bw_fdn_coeffs * BW_RESTRICT coeffs,
+	bw_fdn_state * BW_RESTRICT        state,
+	float                             x_l_0,
+	float                             x_r_0,
+	float * BW_RESTRICT               y_l_0,
+	float * BW_RESTRICT               y_r_0);
+/*! <<<```
+ *    Resets the given `state` to its initial values using the given `coeffs`
+ *    and the initial input values `x_l_0` (left) and `x_r_0` (right).
+ *
+ *    The corresponding initial output values are put into `y_l_0` (left) and
+ *    `y_r_0` (right).
+ *
+ *    The delay network is always reset to silence, hence initial output
+ *    values only consist of the dry component of initial input values.
+ *
+ *    #### bw_fdn_reset_state_multi()
+ *  ```>>> */
+static inline void bw_fdn_reset_state_multi(
+	const bw_fdn_coeffs * BW_RESTRICT              coeffs,
+	bw_fdn_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float *                                  x_l_0,
+	const float *                                  x_r_0,
+	float *                                        y_l_0,
+	float *                                        y_r_0,
+	size_t                                         n_channels);
+/*! <<<```
+ *    Resets each of the `n_channels` `state`s to its initial values using the
+ *    given `coeffs` and the corresponding initial input values in the `x_l_0`
+ *    (left) and `x_r_0` (right) arrays.
+ *
+ *    The corresponding initial output values are written into the `y_l_0`
+ *    (left) and `y_r_0` arrays, if each is not `BW_NULL`.
+ *
+ *    #### bw_fdn_update_coeffs_ctrl()
+ *  ```>>> */
+static inline void bw_fdn_update_coeffs_ctrl(
+	bw_fdn_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Triggers control-rate update of coefficients in `coeffs`.
+ *
+ *    #### bw_fdn_update_coeffs_audio()
+ *  ```>>> */
+static inline void bw_fdn_update_coeffs_audio(
+	bw_fdn_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Triggers audio-rate update of coefficients in `coeffs`.
+ *
+ *    #### bw_fdn_process1()
+ *  ```>>> */
+static inline void bw_fdn_process1(
+	const bw_fdn_coeffs * BW_RESTRICT coeffs,
+	bw_fdn_state * BW_RESTRICT        state,
+	float                             x_l,
+	float                             x_r,
+	float * BW_RESTRICT               y_l,
+	float * BW_RESTRICT               y_r);
+/*! <<<```
+ *    Processes one set of input samples `x_l` (left) and `x_r` (right) using
+ *    `coeffs`, while using and updating `state`. The left and right output
+ *    samples are put into `y_l` (left) and `y_r` (right) respectively.
+ *
+ *    #### bw_fdn_process()
+ *  ```>>> */
+static inline void bw_fdn_process(
+	bw_fdn_coeffs * BW_RESTRICT coeffs,
+	bw_fdn_state * BW_RESTRICT  state,
+	const float *               x_l,
+	const float *               x_r,
+	float *                     y_l,
+	float *                     y_r,
+	size_t                      n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the input buffers `x_l` (left) and
+ *    `x_r` (right) and fills the first `n_samples` of the output buffers `y_l`
+ *    (left) and `y_r` (right), while using and updating both `coeffs` and
+ *    `state` (control and audio rate).
+ *
+ *    #### bw_fdn_process_multi()
+ *  ```>>> */
+static inline void bw_fdn_process_multi(
+	bw_fdn_coeffs * BW_RESTRICT                    coeffs,
+	bw_fdn_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float * const *                          x_l,
+	const float * const *                          x_r,
+	float * const *                                y_l,
+	float * const *                                y_r,
+	size_t                                         n_channels,
+	size_t                                         n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the `n_channels` input buffers `x_l`
+ *    (left) and `x_r` (right) and fills the first `n_samples` of the
+ *    `n_channels` output buffers `y_l` (left) and `y_r` (right), while using
+ *    and updating both the common `coeffs` and each of the `n_channels`
+ *    `state`s (control and audio rate).
+ *
+ *    #### bw_fdn_set_matrix()
+ *  ```>>> */
+static inline void bw_fdn_set_matrix(
+	bw_fdn_coeffs * BW_RESTRICT coeffs,
+	bw_fdn_matrix               value);
+/*! <<<```
+ *    Sets the feedback matrix type to `value` in `coeffs`.
+ *
+ *    Default value: `bw_fdn_matrix_hadamard`.
+ *
+ *    #### bw_fdn_set_damping()
+ *  ```>>> */
+static inline void bw_fdn_set_damping(
+	bw_fdn_coeffs * BW_RESTRICT coeffs,
+	float                       value);
+/*! <<<```
+ *    Sets the high-frequency damping cutoff `value` (Hz) in `coeffs`.
+ *
+ *    Valid range: [`20.f`, `20e3f`].
+ *
+ *    Default value: `20e3f`.
+ *
+ *    #### bw_fdn_set_decay()
+ *  ```>>> */
+static inline void bw_fdn_set_decay(
+	bw_fdn_coeffs * BW_RESTRICT coeffs,
+	float                       value);
+/*! <<<```
+ *    Sets the decay time `value` (s) in `coeffs`, that is, the time it takes
+ *    for the low-frequency content of the reverb tail to decay by 60 dB.
+ *
+ *    Valid range: [`0.01f`, `100.f`].
+ *
+ *    Default value: `2.f`.
+ *
+ *    #### bw_fdn_set_wet()
+ *  ```>>> */
+static inline void bw_fdn_set_wet(
+	bw_fdn_coeffs * BW_RESTRICT coeffs,
+	float                       value);
+/*! <<<```
+ *    Sets the output wet mixing `value` (linear gain) in `coeffs`.
+ *
+ *    Valid range: [`0.f`, `1.f`].
+ *
+ *    Default value: `0.5f`.
+ *
+ *    #### bw_fdn_coeffs_is_valid()
+ *  ```>>> */
+static inline char bw_fdn_coeffs_is_valid(
+	const bw_fdn_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Tries to determine whether `coeffs` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    `coeffs` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_fdn_coeffs`.
+ *
+ *    #### bw_fdn_state_is_valid()
+ *  ```>>> */
+static inline char bw_fdn_state_is_valid(
+	const bw_fdn_coeffs * BW_RESTRICT coeffs,
+	const bw_fdn_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Tries to determine whether `state` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    If `coeffs` is not `BW_NULL` extra cross-checks might be performed
+ *    (`state` is supposed to be associated to `coeffs`).
+ *
+ *    `state` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_fdn_state`.
+ *  }}} */
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_delay.h"
+# include "bw_dry_wet.h"
+# include "bw_lp1.h"
+# include "bw_math.h"
+# include "bw_one_pole.h"
+#else
+# include <bw_delay.h>
+# include <bw_dry_wet.h>
+# include <bw_lp1.h>
+# include <bw_math.h>
+# include <bw_one_pole.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+#define BW_FDN_N_LINES_MAX	16
+#define BW_FDN_BLOCK		32
+
+#ifdef BW_DEBUG_DEEP
+enum bw_fdn_coeffs_state {
+	bw_fdn_coeffs_state_invalid,
+	bw_fdn_coeffs_state_init,
+	bw_fdn_coeffs_state_set_sample_rate,
+	bw_fdn_coeffs_state_reset_coeffs
+};
+
+enum bw_fdn_state_state {
+	bw_fdn_state_state_invalid,
+	bw_fdn_state_state_mem_set,
+	bw_fdn_state_state_reset_state
+};
+#endif
+
+struct bw_fdn_coeffs {
+#ifdef BW_DEBUG_DEEP
+	uint32_t			hash;
+	enum bw_fdn_coeffs_state	state;
+	uint32_t			reset_id;
+#endif
+
+	// Sub-components
+	bw_delay_coeffs			delay_coeffs[BW_FDN_N_LINES_MAX];
+	bw_lp1_coeffs			damping_coeffs;
+	bw_dry_wet_coeffs		dry_wet_coeffs;
+	bw_one_pole_coeffs		smooth_coeffs;
+	bw_one_pole_state		smooth_decay_state;
+
+	// Coefficients
+	size_t				n_lines;
+	float				fs;
+	float				T;
+	float				norm;
+	float				out_gain;
+	size_t				d[BW_FDN_N_LINES_MAX];
+	float				g[BW_FDN_N_LINES_MAX];
+
+	// Parameters
+	bw_fdn_matrix			matrix;
+	float				decay;
+};
+
+struct bw_fdn_state {
+#ifdef BW_DEBUG_DEEP
+	uint32_t			hash;
+	enum bw_fdn_state_state		state;
+	uint32_t			coeffs_reset_id;
+#endif
+
+	// Sub-components
+	bw_delay_state			delay_state[BW_FDN_N_LINES_MAX];
+	bw_lp1_state			damping_state[BW_FDN_N_LINES_MAX];
+};
+
+// delay line lengths are prime numbers of samples at 48 kHz, roughly in
+// geometric progression, evenly picked when using less than 16 lines
+static inline float bw_fdn_line_time(
+		size_t n_lines,
+		size_t i) {
+	static const float t[BW_FDN_N_LINES_MAX] = {
+		1009.f / 48e3f, 1117.f / 48e3f, 1237.f / 48e3f, 1373.f / 48e3f,
+		1523.f / 48e3f, 1693.f / 48e3f, 1873.f / 48e3f, 2081.f / 48e3f,
+		2309.f / 48e3f, 2579.f / 48e3f, 2851.f / 48e3f, 3163.f / 48e3f,
+		3511.f / 48e3f, 3907.f / 48e3f, 4327.f / 48e3f, 4799.f / 48e3f
+	};
+	const size_t s = BW_FDN_N_LINES_MAX / n_lines;
+	return t[s * i + (s >> 1)];
+}
+
+static inline void bw_fdn_init(
+		bw_fdn_coeffs * BW_RESTRICT coeffs,
+		size_t                      n_lines) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT(n_lines == 4 || n_lines == 8 || n_lines == 16);
+
+	coeffs->n_lines = n_lines;
+	for (size_t i = 0; i < n_lines; i++)
+		bw_delay_init(coeffs->delay_coeffs + i, bw_fdn_line_time(n_lines, i));
+	bw_lp1_init(&coeffs->damping_coeffs);
+	bw_dry_wet_init(&coeffs->dry_wet_coeffs);
+	bw_one_pole_init(&coeffs->smooth_coeffs);
+
+	bw_lp1_set_cutoff(&coeffs->damping_coeffs, 20e3f);
+	bw_dry_wet_set_wet(&coeffs->dry_wet_coeffs, 0.5f);
+	bw_one_pole_set_tau(&coeffs->smooth_coeffs, 0.05f);
+	bw_one_pole_set_sticky_thresh(&coeffs->smooth_coeffs, 1e-6f);
+
+	coeffs->norm = bw_sqrtf(1.f / (float)n_lines);
+	coeffs->out_gain = bw_sqrtf(2.f / (float)n_lines);
+
+	coeffs->matrix = bw_fdn_matrix_hadamard;
+	coeffs->decay = 2.f;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->hash = bw_hash_sdbm("bw_fdn_coeffs");
+	coeffs->state = bw_fdn_coeffs_state_init;
+	coeffs->reset_id = coeffs->hash + 1;
+#endif
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_fdn_coeffs_state_init);
+}
+
+static inline void bw_fdn_set_sample_rate(
+		bw_fdn_coeffs * BW_RESTRICT coeffs,
+		float                       sample_rate) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_init);
+	BW_ASSERT(bw_is_finite(sample_rate) && sample_rate > 0.f);
+
+	for (size_t i = 0; i < coeffs->n_lines; i++) {
+		bw_delay_set_sample_rate(coeffs->delay_coeffs + i, sample_rate);
+		coeffs->d[i] = (size_t)bw_maxf(bw_roundf(sample_rate * bw_fdn_line_time(coeffs->n_lines, i)), 1.f) - 1;
+	}
+	bw_lp1_set_sample_rate(&coeffs->damping_coeffs, sample_rate);
+	bw_dry_wet_set_sample_rate(&coeffs->dry_wet_coeffs, sample_rate);
+	bw_one_pole_set_sample_rate(&coeffs->smooth_coeffs, sample_rate);
+	bw_one_pole_reset_coeffs(&coeffs->smooth_coeffs);
+	coeffs->fs = sample_rate;
+	coeffs->T = 1.f / sample_rate;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_fdn_coeffs_state_set_sample_rate;
+#endif
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_fdn_coeffs_state_set_sample_rate);
+}
+
+static inline size_t bw_fdn_mem_req(
+		const bw_fdn_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_set_sample_rate);
+
+	size_t req = 0;
+	for (size_t i = 0; i < coeffs->n_lines; i++)
+		req += bw_delay_mem_req(coeffs->delay_coeffs + i);
+	return req;
+}
+
+static inline void bw_fdn_mem_set(
+		const bw_fdn_coeffs * BW_RESTRICT coeffs,
+		bw_fdn_state * BW_RESTRICT        state,
+		void * BW_RESTRICT                mem) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_set_sample_rate);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT(mem != BW_NULL);
+
+	char *m = (char *)mem;
+	for (size_t i = 0; i < coeffs->n_lines; i++) {
+		bw_delay_mem_set(coeffs->delay_coeffs + i, state->delay_state + i, m);
+		m += bw_delay_mem_req(coeffs->delay_coeffs + i);
+	}
+
+#ifdef BW_DEBUG_DEEP
+	state->hash = bw_hash_sdbm("bw_fdn_state");
+	state->state = bw_fdn_state_state_mem_set;
+#endif
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_set_sample_rate);
+	BW_ASSERT_DEEP(bw_fdn_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state == bw_fdn_state_state_mem_set);
+}
+
+static inline void bw_fdn_do_update_coeffs(
+		bw_fdn_coeffs * BW_RESTRICT coeffs,
+		char                        force) {
+	float decay_cur = bw_one_pole_get_y_z1(&coeffs->smooth_decay_state);
+	if (force || decay_cur != coeffs->decay) {
+		decay_cur = bw_one_pole_process1_sticky_abs(&coeffs->smooth_coeffs, &coeffs->smooth_decay_state, coeffs->decay);
+		// -60 dB after decay_cur seconds: g = 10^(-3 * d / decay_cur)
+		const float k = -9.965784284662087f * coeffs->T * bw_rcpf_ctrl(decay_cur);
+		for (size_t i = 0; i < coeffs->n_lines; i++)
+			coeffs->g[i] = bw_pow2f_ctrl(k * (float)(coeffs->d[i] + 1));
+	}
+}
+
+static inline void bw_fdn_reset_coeffs(
+		bw_fdn_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_set_sample_rate);
+
+	for (size_t i = 0; i < coeffs->n_lines; i++)
+		bw_delay_reset_coeffs(coeffs->delay_coeffs + i);
+	bw_lp1_reset_coeffs(&coeffs->damping_coeffs);
+	bw_dry_wet_reset_coeffs(&coeffs->dry_wet_coeffs);
+	bw_one_pole_reset_state(&coeffs->smooth_coeffs, &coeffs->smooth_decay_state, coeffs->decay);
+	bw_fdn_do_update_coeffs(coeffs, 1);
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_fdn_coeffs_state_reset_coeffs;
+	coeffs->reset_id++;
+#endif
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_fdn_coeffs_state_reset_coeffs);
+}
+
+static inline void bw_fdn_reset_state(
+		const bw_fdn_coeffs * BW_RESTRICT coeffs,
+		bw_fdn_state * BW_RESTRICT        state,
+		float                             x_l_0,
+		float                             x_r_0,
+		float * BW_RESTRICT               y_l_0,
+		float * BW_RESTRICT               y_r_0) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_fdn_state_state_mem_set);
+	BW_ASSERT(bw_is_finite(x_l_0));
+	BW_ASSERT(bw_is_finite(x_r_0));
+	BW_ASSERT(y_l_0 != BW_NULL);
+	BW_ASSERT(y_r_0 != BW_NULL);
+	BW_ASSERT(y_l_0 != y_r_0);
+
+	for (size_t i = 0; i < coeffs->n_lines; i++) {
+		bw_delay_reset_state(coeffs->delay_coeffs + i, state->delay_state + i, 0.f);
+		bw_lp1_reset_state(&coeffs->damping_coeffs, state->damping_state + i, 0.f);
+	}
+
+	*y_l_0 = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, x_l_0, 0.f);
+	*y_r_0 = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, x_r_0, 0.f);
+
+#ifdef BW_DEBUG_DEEP
+	state->state = bw_fdn_state_state_reset_state;
+	state->coeffs_reset_id = coeffs->reset_id;
+#endif
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_fdn_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state == bw_fdn_state_state_reset_state);
+	BW_ASSERT(bw_is_finite(*y_l_0));
+	BW_ASSERT(bw_is_finite(*y_r_0));
+}
+
+static inline void bw_fdn_reset_state_multi(
+		const bw_fdn_coeffs * BW_RESTRICT              coeffs,
+		bw_fdn_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float *                                  x_l_0,
+		const float *                                  x_r_0,
+		float *                                        y_l_0,
+		float *                                        y_r_0,
+		size_t                                         n_channels) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x_l_0 != BW_NULL);
+	BW_ASSERT(x_r_0 != BW_NULL);
+	BW_ASSERT(y_l_0 != BW_NULL && y_r_0 != BW_NULL ? y_l_0 != y_r_0 : 1);
+
+	if (y_l_0 != BW_NULL) {
+		if (y_r_0 != BW_NULL) {
+			for (size_t i = 0; i < n_channels; i++)
+				bw_fdn_reset_state(coeffs, state[i], x_l_0[i], x_r_0[i], y_l_0 + i, y_r_0 + i);
+		} else {
+			float yr;
+			for (size_t i = 0; i < n_channels; i++)
+				bw_fdn_reset_state(coeffs, state[i], x_l_0[i], x_r_0[i], y_l_0 + i, &yr);
+		}
+	} else {
+		if (y_r_0 != BW_NULL) {
+			float yl;
+			for (size_t i = 0; i < n_channels; i++)
+				bw_fdn_reset_state(coeffs, state[i], x_l_0[i], x_r_0[i], &yl, y_r_0 + i);
+		} else {
+			float yl, yr;
+			for (size_t i = 0; i < n_channels; i++)
+				bw_fdn_reset_state(coeffs, state[i], x_l_0[i], x_r_0[i], &yl, &yr);
+		}
+	}
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(y_l_0 != BW_NULL ? bw_has_only_finite(y_l_0, n_channels) : 1);
+	BW_ASSERT_DEEP(y_r_0 != BW_NULL ? bw_has_only_finite(y_r_0, n_channels) : 1);
+}
+
+static inline void bw_fdn_update_coeffs_ctrl(
+		bw_fdn_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+
+	bw_lp1_update_coeffs_ctrl(&coeffs->damping_coeffs);
+	bw_dry_wet_update_coeffs_ctrl(&coeffs->dry_wet_coeffs);
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+}
+
+static inline void bw_fdn_update_coeffs_audio(
+		bw_fdn_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+
+	bw_lp1_update_coeffs_audio(&coeffs->damping_coeffs);
+	bw_dry_wet_update_coeffs_audio(&coeffs->dry_wet_coeffs);
+	bw_fdn_do_update_coeffs(coeffs, 0);
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+}
+
+// Applies the feedback matrix to n_samples sets of delay line outputs, x[i *
+// stride + k] being the k-th sample of the i-th delay line, so that the inner
+// loops can be vectorized
+static inline void bw_fdn_mix(
+		const bw_fdn_coeffs * BW_RESTRICT coeffs,
+		float * BW_RESTRICT               x,
+		size_t                            stride,
+		size_t                            n_samples) {
+	const size_t n = coeffs->n_lines;
+	if (coeffs->matrix == bw_fdn_matrix_hadamard) {
+		for (size_t h = 1; h < n; h <<= 1)
+			for (size_t i = 0; i < n; i += h << 1)
+				for (size_t j = i; j < i + h; j++) {
+					float * BW_RESTRICT a = x + j * stride;
+					float * BW_RESTRICT b = x + (j + h) * stride;
+					for (size_t k = 0; k < n_samples; k++) {
+						const float u = a[k];
+						const float v = b[k];
+						a[k] = u + v;
+						b[k] = u - v;
+					}
+				}
+		for (size_t i = 0; i < n; i++) {
+			float * BW_RESTRICT a = x + i * stride;
+			for (size_t k = 0; k < n_samples; k++)
+				a[k] = coeffs->norm * a[k];
+		}
+	} else {
+		const float c = 2.f / (float)n;
+		float s[BW_FDN_BLOCK];
+		for (size_t k = 0; k < n_samples; k++)
+			s[k] = x[k];
+		for (size_t i = 1; i < n; i++) {
+			const float * BW_RESTRICT a = x + i * stride;
+			for (size_t k = 0; k < n_samples; k++)
+				s[k] += a[k];
+		}
+		for (size_t i = 0; i < n; i++) {
+			float * BW_RESTRICT a = x + i * stride;
+			for (size_t k = 0; k < n_samples; k++)
+				a[k] -= c * s[k];
+		}
+	}
+}
+
+static inline void bw_fdn_process1(
+		const bw_fdn_coeffs * BW_RESTRICT coeffs,
+		bw_fdn_state * BW_RESTRICT        state,
+		float                             x_l,
+		float                             x_r,
+		float * BW_RESTRICT               y_l,
+		float * BW_RESTRICT               y_r) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_fdn_state_state_reset_state);
+	BW_ASSERT(bw_is_finite(x_l));
+	BW_ASSERT(bw_is_finite(x_r));
+	BW_ASSERT(y_l != BW_NULL);
+	BW_ASSERT(y_r != BW_NULL);
+	BW_ASSERT(y_l != y_r);
+
+	float v[BW_FDN_N_LINES_MAX];
+	float yl = 0.f;
+	float yr = 0.f;
+	for (size_t i = 0; i < coeffs->n_lines; i += 2) {
+		const float o_l = bw_delay_read(coeffs->delay_coeffs + i, state->delay_state + i, coeffs->d[i], 0.f);
+		const float o_r = bw_delay_read(coeffs->delay_coeffs + i + 1, state->delay_state + i + 1, coeffs->d[i + 1], 0.f);
+		yl = i & 4 ? yl - o_l : yl + o_l;
+		yr = i & 4 ? yr - o_r : yr + o_r;
+		v[i] = coeffs->g[i] * bw_lp1_process1(&coeffs->damping_coeffs, state->damping_state + i, o_l);
+		v[i + 1] = coeffs->g[i + 1] * bw_lp1_process1(&coeffs->damping_coeffs, state->damping_state + i + 1, o_r);
+	}
+	bw_fdn_mix(coeffs, v, 1, 1);
+	for (size_t i = 0; i < coeffs->n_lines; i += 2) {
+		bw_delay_write(coeffs->delay_coeffs + i, state->delay_state + i, v[i] + (i & 2 ? -x_l : x_l));
+		bw_delay_write(coeffs->delay_coeffs + i + 1, state->delay_state + i + 1, v[i + 1] + (i & 2 ? -x_r : x_r));
+	}
+	*y_l = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, x_l, coeffs->out_gain * yl);
+	*y_r = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, x_r, coeffs->out_gain * yr);
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_fdn_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_fdn_state_state_reset_state);
+	BW_ASSERT(bw_is_finite(*y_l));
+	BW_ASSERT(bw_is_finite(*y_r));
+}
+
+// Processes n_samples <= min(coeffs->d[0] + 1, BW_FDN_BLOCK) samples, so that
+// delay lines can be read for the whole block before being written. Delay lines
+// are then processed as parallel lanes, with only audio-rate coefficient updates
+// and damping filters being computed sample by sample.
+static inline void bw_fdn_process_block(
+		bw_fdn_coeffs * BW_RESTRICT coeffs,
+		bw_fdn_state * BW_RESTRICT  state,
+		const float *               x_l,
+		const float *               x_r,
+		float *                     y_l,
+		float *                     y_r,
+		size_t                      n_samples) {
+	const size_t n = coeffs->n_lines;
+	const size_t o = n_samples - 1;
+	float out[BW_FDN_N_LINES_MAX * BW_FDN_BLOCK];
+	float v[BW_FDN_N_LINES_MAX * BW_FDN_BLOCK];
+	float wet[BW_FDN_BLOCK], yl[BW_FDN_BLOCK], yr[BW_FDN_BLOCK];
+
+	for (size_t i = 0; i < n; i++)
+		bw_delay_read_block(coeffs->delay_coeffs + i, state->delay_state + i, coeffs->d[i] - o, 0.f,
+			out + i * BW_FDN_BLOCK, n_samples);
+
+	for (size_t k = 0; k < n_samples; k++) {
+		bw_fdn_update_coeffs_audio(coeffs);
+		for (size_t i = 0; i < n; i++)
+			v[i * BW_FDN_BLOCK + k] = coeffs->g[i]
+				* bw_lp1_process1(&coeffs->damping_coeffs, state->damping_state + i, out[i * BW_FDN_BLOCK + k]);
+		wet[k] = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, 0.f, 1.f);
+	}
+
+	bw_fdn_mix(coeffs, v, BW_FDN_BLOCK, n_samples);
+
+	// inputs are read before writing outputs as buffers may be shared
+	for (size_t i = 0; i < n; i += 2) {
+		float * BW_RESTRICT vl = v + i * BW_FDN_BLOCK;
+		float * BW_RESTRICT vr = vl + BW_FDN_BLOCK;
+		if (i & 2)
+			for (size_t k = 0; k < n_samples; k++) {
+				vl[k] += -x_l[k];
+				vr[k] += -x_r[k];
+			}
+		else
+			for (size_t k = 0; k < n_samples; k++) {
+				vl[k] += x_l[k];
+				vr[k] += x_r[k];
+			}
+		bw_delay_write_block(coeffs->delay_coeffs + i, state->delay_state + i, vl, n_samples);
+		bw_delay_write_block(coeffs->delay_coeffs + i + 1, state->delay_state + i + 1, vr, n_samples);
+	}
+
+	for (size_t k = 0; k < n_samples; k++) {
+		yl[k] = 0.f;
+		yr[k] = 0.f;
+	}
+	for (size_t i = 0; i < n; i += 2) {
+		const float * BW_RESTRICT o_l = out + i * BW_FDN_BLOCK;
+		const float * BW_RESTRICT o_r = o_l + BW_FDN_BLOCK;
+		if (i & 4)
+			for (size_t k = 0; k < n_samples; k++) {
+				yl[k] -= o_l[k];
+				yr[k] -= o_r[k];
+			}
+		else
+			for (size_t k = 0; k < n_samples; k++) {
+				yl[k] += o_l[k];
+				yr[k] += o_r[k];
+			}
+	}
+	for (size_t k = 0; k < n_samples; k++) {
+		const float xl = x_l[k];
+		const float xr = x_r[k];
+		y_l[k] = wet[k] * (coeffs->out_gain * yl[k] - xl) + xl;
+		y_r[k] = wet[k] * (coeffs->out_gain * yr[k] - xr) + xr;
+	}
+}
+
+static inline void bw_fdn_process(
+		bw_fdn_coeffs * BW_RESTRICT coeffs,
+		bw_fdn_state * BW_RESTRICT  state,
+		const float *               x_l,
+		const float *               x_r,
+		float *                     y_l,
+		float *                     y_r,
+		size_t                      n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_fdn_state_state_reset_state);
+	BW_ASSERT(x_l != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x_l, n_samples));
+	BW_ASSERT(x_r != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x_r, n_samples));
+	BW_ASSERT(y_l != BW_NULL);
+	BW_ASSERT(y_r != BW_NULL);
+	BW_ASSERT(y_l != y_r);
+
+	bw_fdn_update_coeffs_ctrl(coeffs);
+	const size_t b = coeffs->d[0] < BW_FDN_BLOCK ? coeffs->d[0] + 1 : BW_FDN_BLOCK;
+	for (size_t i = 0; i < n_samples; i += b) {
+		const size_t m = n_samples - i < b ? n_samples - i : b;
+		bw_fdn_process_block(coeffs, state, x_l + i, x_r + i, y_l + i, y_r + i, m);
+	}
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_fdn_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_fdn_state_state_reset_state);
+	BW_ASSERT_DEEP(bw_has_only_finite(y_l, n_samples));
+	BW_ASSERT_DEEP(bw_has_only_finite(y_r, n_samples));
+}
+
+static inline void bw_fdn_process_multi(
+		bw_fdn_coeffs * BW_RESTRICT                    coeffs,
+		bw_fdn_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float * const *                          x_l,
+		const float * const *                          x_r,
+		float * const *                                y_l,
+		float * const *                                y_r,
+		size_t                                         n_channels,
+		size_t                                         n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++) {
+		BW_ASSERT(state[i] != BW_NULL);
+		BW_ASSERT_DEEP(bw_fdn_state_is_valid(coeffs, state[i]));
+		BW_ASSERT_DEEP(state[i]->state >= bw_fdn_state_state_reset_state);
+	}
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x_l != BW_NULL);
+	BW_ASSERT(x_r != BW_NULL);
+	BW_ASSERT(y_l != BW_NULL);
+	BW_ASSERT(y_r != BW_NULL);
+	BW_ASSERT(y_l != y_r);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++) {
+		BW_ASSERT(x_l[i] != BW_NULL);
+		BW_ASSERT_DEEP(bw_has_only_finite(x_l[i], n_samples));
+		BW_ASSERT(x_r[i] != BW_NULL);
+		BW_ASSERT_DEEP(bw_has_only_finite(x_r[i], n_samples));
+		BW_ASSERT(y_l[i] != BW_NULL);
+		BW_ASSERT(y_r[i] != BW_NULL);
+		BW_ASSERT(y_l[i] != y_r[i]);
+	}
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++) {
+			BW_ASSERT(y_l[i] != y_l[j]);
+			BW_ASSERT(y_r[i] != y_r[j]);
+		}
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels; j++)
+			BW_ASSERT(y_l[i] != y_r[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels; j++) {
+			BW_ASSERT(i == j || x_l[i] != y_l[j]);
+			BW_ASSERT(i == j || x_l[i] != y_r[j]);
+			BW_ASSERT(i == j || x_r[i] != y_l[j]);
+			BW_ASSERT(i == j || x_r[i] != y_r[j]);
+		}
+#endif
+
+	bw_fdn_update_coeffs_ctrl(coeffs);
+	const size_t b = coeffs->d[0] < BW_FDN_BLOCK ? coeffs->d[0] + 1 : BW_FDN_BLOCK;
+	for (size_t i = 0; i < n_samples; i += b) {
+		const size_t m = n_samples - i < b ? n_samples - i : b;
+		// all channels but the last work on a copy of coeffs, so that they
+		// all get the same audio-rate coefficient updates
+		for (size_t j = 0; j + 1 < n_channels; j++) {
+			bw_fdn_coeffs c = *coeffs;
+			bw_fdn_process_block(&c, state[j], x_l[j] + i, x_r[j] + i, y_l[j] + i, y_r[j] + i, m);
+		}
+		if (n_channels > 0)
+			bw_fdn_process_block(coeffs, state[n_channels - 1], x_l[n_channels - 1] + i, x_r[n_channels - 1] + i,
+				y_l[n_channels - 1] + i, y_r[n_channels - 1] + i, m);
+	}
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_reset_coeffs);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++) {
+		BW_ASSERT_DEEP(bw_fdn_state_is_valid(coeffs, state[i]));
+		BW_ASSERT_DEEP(bw_has_only_finite(y_l[i], n_samples));
+		BW_ASSERT_DEEP(bw_has_only_finite(y_r[i], n_samples));
+	}
+#endif
+}
+
+static inline void bw_fdn_set_matrix(
+		bw_fdn_coeffs * BW_RESTRICT coeffs,
+		bw_fdn_matrix               value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_init);
+	BW_ASSERT(value == bw_fdn_matrix_hadamard || value == bw_fdn_matrix_householder);
+
+	coeffs->matrix = value;
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_init);
+}
+
+static inline void bw_fdn_set_damping(
+		bw_fdn_coeffs * BW_RESTRICT coeffs,
+		float                       value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_init);
+	BW_ASSERT(bw_is_finite(value));
+	BW_ASSERT(value >= 20.f && value <= 20e3f);
+
+	bw_lp1_set_cutoff(&coeffs->damping_coeffs, value);
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_init);
+}
+
+static inline void bw_fdn_set_decay(
+		bw_fdn_coeffs * BW_RESTRICT coeffs,
+		float                       value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_init);
+	BW_ASSERT(bw_is_finite(value));
+	BW_ASSERT(value >= 0.01f && value <= 100.f);
+
+	coeffs->decay = value;
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_init);
+}
+
+static inline void bw_fdn_set_wet(
+		bw_fdn_coeffs * BW_RESTRICT coeffs,
+		float                       value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_init);
+	BW_ASSERT(bw_is_finite(value));
+	BW_ASSERT(value >= 0.f && value <= 1.f);
+
+	bw_dry_wet_set_wet(&coeffs->dry_wet_coeffs, value);
+
+	BW_ASSERT_DEEP(bw_fdn_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_fdn_coeffs_state_init);
+}
+
+static inline char bw_fdn_coeffs_is_valid(
+		const bw_fdn_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->hash != bw_hash_sdbm("bw_fdn_coeffs"))
+		return 0;
+	if (coeffs->state < bw_fdn_coeffs_state_init || coeffs->state > bw_fdn_coeffs_state_reset_coeffs)
+		return 0;
+#endif
+
+	if (coeffs->n_lines != 4 && coeffs->n_lines != 8 && coeffs->n_lines != 16)
+		return 0;
+	if (coeffs->matrix != bw_fdn_matrix_hadamard && coeffs->matrix != bw_fdn_matrix_householder)
+		return 0;
+	if (!bw_is_finite(coeffs->decay) || coeffs->decay < 0.01f || coeffs->decay > 100.f)
+		return 0;
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->state >= bw_fdn_coeffs_state_set_sample_rate) {
+		if (!bw_is_finite(coeffs->fs) || coeffs->fs <= 0.f)
+			return 0;
+		if (!bw_is_finite(coeffs->T) || coeffs->T <= 0.f)
+			return 0;
+		for (size_t i = 0; i < coeffs->n_lines; i++)
+			if (coeffs->d[i] >= bw_delay_get_length(coeffs->delay_coeffs + i))
+				return 0;
+	}
+
+	if (coeffs->state >= bw_fdn_coeffs_state_reset_coeffs) {
+		for (size_t i = 0; i < coeffs->n_lines; i++)
+			if (!bw_is_finite(coeffs->g[i]) || coeffs->g[i] < 0.f || coeffs->g[i] >= 1.f)
+				return 0;
+		if (!bw_one_pole_state_is_valid(&coeffs->smooth_coeffs, &coeffs->smooth_decay_state))
+			return 0;
+	}
+#endif
+
+	for (size_t i = 0; i < coeffs->n_lines; i++)
+		if (!bw_delay_coeffs_is_valid(coeffs->delay_coeffs + i))
+			return 0;
+
+	return bw_lp1_coeffs_is_valid(&coeffs->damping_coeffs)
+		&& bw_dry_wet_coeffs_is_valid(&coeffs->dry_wet_coeffs)
+		&& bw_one_pole_coeffs_is_valid(&coeffs->smooth_coeffs);
+}
+
+static inline char bw_fdn_state_is_valid(
+		const bw_fdn_coeffs * BW_RESTRICT coeffs,
+		const bw_fdn_state * BW_RESTRICT  state) {
+	BW_ASSERT(state != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (state->hash != bw_hash_sdbm("bw_fdn_state"))
+		return 0;
+	if (state->state < bw_fdn_state_state_mem_set || state->state > bw_fdn_state_state_reset_state)
+		return 0;
+
+	if (state->state >= bw_fdn_state_state_reset_state && coeffs != BW_NULL && coeffs->reset_id != state->coeffs_reset_id)
+		return 0;
+#endif
+
+	if (coeffs == BW_NULL)
+		return 1;
+
+	for (size_t i = 0; i < coeffs->n_lines; i++)
+		if (!bw_delay_state_is_valid(coeffs->delay_coeffs + i, state->delay_state + i))
+			return 0;
+
+#ifdef BW_DEBUG_DEEP
+	if (state->state >= bw_fdn_state_state_reset_state)
+		for (size_t i = 0; i < coeffs->n_lines; i++)
+			if (!bw_lp1_state_is_valid(&coeffs->damping_coeffs, state->damping_state + i))
+				return 0;
+#endif
+
+	return 1;
+}
+
+#undef BW_FDN_N_LINES_MAX
+#undef BW_FDN_BLOCK
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+#if !defined(BW_NO_CXX) && defined(__cplusplus)
+
+# ifndef BW_CXX_NO_ARRAY
+#  include <array>
+# endif
+
+namespace Brickworks {
+
+/*** Public C++ API ***/
+
+/*! api_cpp {{{
+ *    ##### Brickworks::FDN
+ *  ```>>> */
+template<size_t N_CHANNELS = 1>
+class FDN {
+public:
+	FDN(
+		size_t nLines = 8);
+
+	~FDN();
+
+	void setSampleRate(
+		float                sampleRate,
+		size_t * BW_RESTRICT memReq = BW_NULL);
+
+	void memSet(
+		void * BW_RESTRICT mem);
+
+	void reset(
+		float               xL0 = 0.f,
+		float               xR0 = 0.f,
+		float * BW_RESTRICT yL0 = BW_NULL,
+		float * BW_RESTRICT yR0 = BW_NULL);
+
+# ifndef BW_CXX_NO_ARRAY
+	void reset(
+		float                                       xL0,
+		float                                       xR0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT yL0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT yR0);
+# endif
+
+	void reset(
+		const float * xL0,
+		const float * xR0,
+		float *       yL0 = BW_NULL,
+		float *       yR0 = BW_NULL);
+
+# ifndef BW_CXX_NO_ARRAY
+	void reset(
+		std::array<float, N_CHANNELS>               xL0,
+		std::array<float, N_CHANNELS>               xR0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT yL0 = BW_NULL,
+		std::array<float, N_CHANNELS> * BW_RESTRICT yR0 = BW_NULL);
+# endif
+
+	void process(
+		const float * const * xL,
+		const float * const * xR,
+		float * const *       yL,
+		float * const *       yR,
+		size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+	void process(
+		std::array<const float *, N_CHANNELS> xL,
+		std::array<const float *, N_CHANNELS> xR,
+		std::array<float *, N_CHANNELS>       yL,
+		std::array<float *, N_CHANNELS>       yR,
+		size_t                                nSamples);
+# endif
+
+	void setMatrix(
+		bw_fdn_matrix value);
+
+	void setDamping(
+		float value);
+
+	void setDecay(
+		float value);
+
+	void setWet(
+		float value);
+/*! <<<...
+ *  }
+ *  ```
+ *  }}} */
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+private:
+	bw_fdn_coeffs			coeffs;
+	bw_fdn_state			states[N_CHANNELS];
+	bw_fdn_state * BW_RESTRICT	statesP[N_CHANNELS];
+	bool				memAllocated;
+	void * BW_RESTRICT		mem;
+};
+
+template<size_t N_CHANNELS>
+inline FDN<N_CHANNELS>::FDN(
+		size_t nLines) {
+	bw_fdn_init(&coeffs, nLines);
+	for (size_t i = 0; i < N_CHANNELS; i++)
+		statesP[i] = states + i;
+	memAllocated = false;
+	mem = BW_NULL;
+}
+
+template<size_t N_CHANNELS>
+inline FDN<N_CHANNELS>::~FDN() {
+	if (memAllocated)
+		operator delete(mem);
+}
+
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::setSampleRate(
+		float                sampleRate,
+		size_t * BW_RESTRICT memReq) {
+	bw_fdn_set_sample_rate(&coeffs, sampleRate);
+	size_t req = bw_fdn_mem_req(&coeffs);
+	if (memAllocated) {
+		operator delete(mem);
+		memAllocated = false;
+	}
+	if (memReq != BW_NULL) {
+		*memReq = req * N_CHANNELS;
+	} else {
+		mem = operator new(req * N_CHANNELS);
+		memAllocated = true;
+		void *m = mem;
+		for (size_t i = 0; i < N_CHANNELS; i++, m = static_cast<char *>(m) + req)
+			bw_fdn_mem_set(&coeffs, states + i, m);
+	}
+}
+
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::memSet(
+		void * BW_RESTRICT mem) {
+	this->mem = mem;
+	void *m = mem;
+	size_t req = bw_fdn_mem_req(&coeffs);
+	for (size_t i = 0; i < N_CHANNELS; i++, m = static_cast<char *>(m) + req)
+		bw_fdn_mem_set(&coeffs, states + i, m);
+}
+
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::reset(
+		float               xL0,
+		float               xR0,
+		float * BW_RESTRICT yL0,
+		float * BW_RESTRICT yR0) {
+	bw_fdn_reset_coeffs(&coeffs);
+	if (yL0 != BW_NULL) {
+		if (yR0 != BW_NULL) {
+			for (size_t i = 0; i < N_CHANNELS; i++)
+				bw_fdn_reset_state(&coeffs, states + i, xL0, xR0, yL0 + i, yR0 + i);
+		} else {
+			float yr;
+			for (size_t i = 0; i < N_CHANNELS; i++)
+				bw_fdn_reset_state(&coeffs, states + i, xL0, xR0, yL0 + i, &yr);
+		}
+	} else {
+		if (yR0 != BW_NULL) {
+			float yl;
+			for (size_t i = 0; i < N_CHANNELS; i++)
+				bw_fdn_reset_state(&coeffs, states + i, xL0, xR0, &yl, yR0 + i);
+		} else {
+			float yl, yr;
+			for (size_t i = 0; i < N_CHANNELS; i++)
+				bw_fdn_reset_state(&coeffs, states + i, xL0, xR0, &yl, &yr);
+		}
+	}
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::reset(
+		float                                       xL0,
+		float                                       xR0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT yL0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT yR0) {
+	reset(xL0, xR0, yL0 != BW_NULL ? yL0->data() : BW_NULL, yR0 != BW_NULL ? yR0->data() : BW_NULL);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::reset(
+		const float * xL0,
+		const float * xR0,
+		float *       yL0,
+		float *       yR0) {
+	bw_fdn_reset_coeffs(&coeffs);
+	bw_fdn_reset_state_multi(&coeffs, statesP, xL0, xR0, yL0, yR0, N_CHANNELS);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::reset(
+		std::array<float, N_CHANNELS>               xL0,
+		std::array<float, N_CHANNELS>               xR0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT yL0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT yR0) {
+	reset(xL0.data(), xR0.data(), yL0 != BW_NULL ? yL0->data() : BW_NULL, yR0 != BW_NULL ? yR0->data() : BW_NULL);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::process(
+		const float * const * xL,
+		const float * const * xR,
+		float * const *       yL,
+		float * const *       yR,
+		size_t                nSamples) {
+	bw_fdn_process_multi(&coeffs, statesP, xL, xR, yL, yR, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::process(
+		std::array<const float *, N_CHANNELS> xL,
+		std::array<const float *, N_CHANNELS> xR,
+		std::array<float *, N_CHANNELS>       yL,
+		std::array<float *, N_CHANNELS>       yR,
+		size_t                                nSamples) {
+	process(xL.data(), xR.data(), yL.data(), yR.data(), nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::setMatrix(
+		bw_fdn_matrix value) {
+	bw_fdn_set_matrix(&coeffs, value);
+}
+
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::setDamping(
+		float value) {
+	bw_fdn_set_damping(&coeffs, value);
+}
+
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::setDecay(
+		float value) {
+	bw_fdn_set_decay(&coeffs, value);
+}
+
+template<size_t N_CHANNELS>
+inline void FDN<N_CHANNELS>::setWet(
+		float value) {
+	bw_fdn_set_wet(&coeffs, value);
+}
+
+}
+#endif
+
+#endif
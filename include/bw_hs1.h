@@ -20,13 +20,19 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_gain bw_lp1 bw_math bw_mm1 bw_one_pole }}}
  *  description {{{
  *    First-order high shelf filter (6 dB/oct) with unitary DC gain.
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -457,7 +463,7 @@ static inline void bw_hs1_update_mm1_params(
 		bw_hs1_coeffs * BW_RESTRICT coeffs) {
 	bw_mm1_set_prewarp_freq(&coeffs->mm1_coeffs, coeffs->prewarp_freq + coeffs->prewarp_k * (coeffs->cutoff - coeffs->prewarp_freq));
 	if (coeffs->update) {
-		bw_mm1_set_cutoff(&coeffs->mm1_coeffs, coeffs->cutoff * bw_sqrtf(coeffs->high_gain));
+		bw_mm1_set_cutoff(&coeffs->mm1_coeffs, coeffs->cutoff * bw_sqrtf_ctrl(coeffs->high_gain));
 		bw_mm1_set_coeff_x(&coeffs->mm1_coeffs, coeffs->high_gain);
 		bw_mm1_set_coeff_lp(&coeffs->mm1_coeffs, 1.f - coeffs->high_gain);
 		coeffs->update = 0;
@@ -20,13 +20,21 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.5 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_gain bw_math bw_mm2 bw_one_pole bw_svf }}}
  *  description {{{
  *    Second-order high shelf filter (12 dB/oct) with unitary DC gain.
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *          <li>Added <code>bw_hs2_set_update_interval()</code> and
+ *              <code>setUpdateInterval()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.5</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -314,6 +322,21 @@ static inline void bw_hs2_set_prewarp_freq(
  *
  *    Default value: `1e3f`.
  *
+ *    #### bw_hs2_set_update_interval()
+ *  ```>>> */
+static inline void bw_hs2_set_update_interval(
+	bw_hs2_coeffs * BW_RESTRICT coeffs,
+	size_t                      value);
+/*! <<<```
+ *    Sets the coefficient update interval to the given `value` (samples) in
+ *    `coeffs`.
+ *
+ *    See `bw_svf_set_update_interval()`.
+ *
+ *    `value` must be positive.
+ *
+ *    Default value: `1`.
+ *
  *    #### bw_hs2_set_high_gain_lin()
  *  ```>>> */
 static inline void bw_hs2_set_high_gain_lin(
@@ -486,8 +509,8 @@ static inline void bw_hs2_update_mm2_params(
 	bw_mm2_set_prewarp_freq(&coeffs->mm2_coeffs, coeffs->prewarp_freq + coeffs->prewarp_k * (coeffs->cutoff - coeffs->prewarp_freq));
 	if (coeffs->param_changed) {
 		if (coeffs->param_changed & BW_HS2_PARAM_HIGH_GAIN) {
-			coeffs->sg = bw_sqrtf(coeffs->high_gain);
-			coeffs->ssg = bw_sqrtf(coeffs->sg);
+			coeffs->sg = bw_sqrtf_ctrl(coeffs->high_gain);
+			coeffs->ssg = bw_sqrtf_ctrl(coeffs->sg);
 			bw_mm2_set_coeff_x(&coeffs->mm2_coeffs, coeffs->sg);
 			bw_mm2_set_coeff_lp(&coeffs->mm2_coeffs, 1.f - coeffs->sg);
 			bw_mm2_set_coeff_hp(&coeffs->mm2_coeffs, coeffs->high_gain - coeffs->sg);
@@ -763,6 +786,20 @@ static inline void bw_hs2_set_prewarp_freq(
 	BW_ASSERT_DEEP(coeffs->state >= bw_hs2_coeffs_state_init);
 }
 
+static inline void bw_hs2_set_update_interval(
+		bw_hs2_coeffs * BW_RESTRICT coeffs,
+		size_t                      value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_hs2_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_hs2_coeffs_state_init);
+	BW_ASSERT(value > 0);
+
+	bw_mm2_set_update_interval(&coeffs->mm2_coeffs, value);
+
+	BW_ASSERT_DEEP(bw_hs2_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_hs2_coeffs_state_init);
+}
+
 static inline void bw_hs2_set_high_gain_lin(
 		bw_hs2_coeffs * BW_RESTRICT coeffs,
 		float                       value) {
@@ -916,6 +953,9 @@ public:
 	void setPrewarpFreq(
 		float value);
 
+	void setUpdateInterval(
+		size_t value);
+
 	void setHighGainLin(
 		float value);
 
@@ -1031,6 +1071,12 @@ inline void HS2<N_CHANNELS>::setPrewarpFreq(
 	bw_hs2_set_prewarp_freq(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline void HS2<N_CHANNELS>::setUpdateInterval(
+		size_t value) {
+	bw_hs2_set_update_interval(&coeffs, value);
+}
+
 template<size_t N_CHANNELS>
 inline void HS2<N_CHANNELS>::setHighGainLin(
 		float value) {
@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ utility }}}
- *  version {{{ 1.0.2 }}}
+ *  version {{{ 1.1.0 }}}
  *  requires {{{ bw_common bw_math }}}
  *  description {{{
  *    Lightweight and fast first-order IIR filter in TDF-II form.
@@ -33,6 +33,12 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.1.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.0.2</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -514,9 +520,9 @@ static inline void bw_iir1_process_multi(
 #define BW_IIR1_COEFFS_COMMON \
 	prewarp_freq = prewarp_at_cutoff ? cutoff : prewarp_freq; \
 	prewarp_freq = bw_minf(prewarp_freq, 0.499f * sample_rate); \
-	const float t = bw_tanf(3.141592653589793f * prewarp_freq * bw_rcpf(sample_rate)); \
+	const float t = bw_tanf_ctrl(3.141592653589793f * prewarp_freq * bw_rcpf_ctrl(sample_rate)); \
 	const float k = t * cutoff; \
-	const float d = bw_rcpf(k + prewarp_freq); \
+	const float d = bw_rcpf_ctrl(k + prewarp_freq); \
 	*a1 = d * (k - prewarp_freq);
 
 static inline void bw_iir1_assert_valid_params(
@@ -598,11 +604,11 @@ static inline void bw_iir1_coeffs_hs1(
 	BW_ASSERT(bw_is_finite(high_gain));
 	BW_ASSERT(high_gain_dB ? high_gain >= -600.f && high_gain <= 600.f : high_gain >= 1e-30f && high_gain <= 1e30f);
 
-	high_gain = high_gain_dB ? bw_dB2linf(high_gain) : high_gain;
+	high_gain = high_gain_dB ? bw_dB2linf_ctrl(high_gain) : high_gain;
 
 	BW_ASSERT_DEEP(cutoff * bw_sqrtf(high_gain) >= 1e-6f && cutoff * bw_sqrtf(high_gain) <= 1e12f);
 
-	cutoff = cutoff * bw_sqrtf(high_gain);
+	cutoff = cutoff * bw_sqrtf_ctrl(high_gain);
 	BW_IIR1_COEFFS_COMMON
 	const float k2 = high_gain * prewarp_freq;
 	*b0 = d * (k + k2);
@@ -644,11 +650,11 @@ static inline void bw_iir1_coeffs_ls1(
 	BW_ASSERT(bw_is_finite(dc_gain));
 	BW_ASSERT(dc_gain_dB ? dc_gain >= -600.f && dc_gain <= 600.f : dc_gain >= 1e-30f && dc_gain <= 1e30f);
 
-	dc_gain = dc_gain_dB ? bw_dB2linf(dc_gain) : dc_gain;
+	dc_gain = dc_gain_dB ? bw_dB2linf_ctrl(dc_gain) : dc_gain;
 
 	BW_ASSERT_DEEP(cutoff * bw_rcpf(bw_sqrtf(dc_gain)) >= 1e-6f && cutoff * bw_rcpf(bw_sqrtf(dc_gain)) <= 1e12f);
 
-	cutoff = cutoff * bw_rcpf(bw_sqrtf(dc_gain));
+	cutoff = cutoff * bw_rcpf_ctrl(bw_sqrtf_ctrl(dc_gain));
 	BW_IIR1_COEFFS_COMMON
 	const float k2 = dc_gain * k;
 	*b0 = d * (k2 + prewarp_freq);
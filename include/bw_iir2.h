@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ utility }}}
- *  version {{{ 1.0.2 }}}
+ *  version {{{ 1.1.0 }}}
  *  requires {{{ bw_common bw_math }}}
  *  description {{{
  *    Lightweight and fast second-order IIR filter (biquad) in TDF-II form.
@@ -33,6 +33,21 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.1.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *          <li>Fixed missing normalization in
+ *              <code>bw_iir2_coeffs_bp2()</code>,
+ *              <code>bw_iir2_coeffs_hp2()</code>, and
+ *              <code>bw_iir2_coeffs_lp2()</code>.</li>
+ *          <li>Fixed <code>prewarp_freq</code> debugging checks being
+ *              performed when <code>prewarp_at_cutoff</code> is
+ *              non-<code>0</code> instead of <code>0</code>.</li>
+ *          <li>Fixed debugging code in <code>bw_iir2_coeffs_hs2()</code> and
+ *              <code>bw_iir2_coeffs_ls2()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.0.2</strong>:
  *        <ul>
  *          <li>Fixed coefficients' validity checks in
@@ -700,13 +715,13 @@ static inline void bw_iir2_process_multi(
 #define BW_IIR2_COEFFS_COMMON \
 	prewarp_freq = prewarp_at_cutoff ? cutoff : prewarp_freq; \
 	prewarp_freq = bw_minf(prewarp_freq, 0.499f * sample_rate); \
-	const float t = bw_tanf(3.141592653589793f * prewarp_freq * bw_rcpf(sample_rate)); \
+	const float t = bw_tanf_ctrl(3.141592653589793f * prewarp_freq * bw_rcpf_ctrl(sample_rate)); \
 	const float k1 = prewarp_freq * prewarp_freq; \
 	const float k2 = t * cutoff; \
 	const float k3 = k2 * k2; \
 	const float k4 = k2 * prewarp_freq; \
 	const float k5 = Q * (k1 + k3); \
-	const float d = bw_rcpf(k5 + k4); \
+	const float d = bw_rcpf_ctrl(k5 + k4); \
 	*a1 = d * (Q + Q) * (k3 - k1); \
 	*a2 = d * (k5 - k4);
 
@@ -723,8 +738,8 @@ static inline void bw_iir2_assert_valid_params(
 	BW_ASSERT(cutoff >= 1e-6f && cutoff <= 1e12f);
 	BW_ASSERT(bw_is_finite(Q));
 	BW_ASSERT(Q >= 1e-6f && Q <= 1e6f);
-	BW_ASSERT(prewarp_at_cutoff ? bw_is_finite(prewarp_freq) : 1);
-	BW_ASSERT(prewarp_at_cutoff ? prewarp_freq >= 1e-6f && prewarp_freq <= 1e12f : 1);
+	BW_ASSERT(!prewarp_at_cutoff ? bw_is_finite(prewarp_freq) : 1);
+	BW_ASSERT(!prewarp_at_cutoff ? prewarp_freq >= 1e-6f && prewarp_freq <= 1e12f : 1);
 #else
 	(void)sample_rate;
 	(void)cutoff;
@@ -788,7 +803,7 @@ static inline void bw_iir2_coeffs_bp2(
 	BW_IIR2_ASSERT_VALID_COEFF_PTRS
 
 	BW_IIR2_COEFFS_COMMON
-	*b0 = Q * k4;
+	*b0 = d * Q * k4;
 	*b1 = 0.f;
 	*b2 = -*b0;
 
@@ -810,7 +825,7 @@ static inline void bw_iir2_coeffs_hp2(
 	BW_IIR2_ASSERT_VALID_COEFF_PTRS
 
 	BW_IIR2_COEFFS_COMMON
-	*b0 = Q * k1;
+	*b0 = d * Q * k1;
 	*b1 = -(*b0 + *b0);
 	*b2 = *b0;
 
@@ -835,12 +850,12 @@ static inline void bw_iir2_coeffs_hs2(
 	BW_ASSERT(bw_is_finite(high_gain));
 	BW_ASSERT(high_gain_dB ? high_gain >= -600.f && high_gain <= 600.f : high_gain >= 1e-30f && high_gain <= 1e30f);
 
-	high_gain = high_gain_dB ? bw_dB2linf(high_gain) : high_gain;
+	high_gain = high_gain_dB ? bw_dB2linf_ctrl(high_gain) : high_gain;
 
-	BW_ASSERT_DEEP(cutoff * bw_sqrt(bw_sqrtf(high_gain)) >= 1e-6f && cutoff * bw_sqrt(bw_sqrtf(high_gain)) <= 1e12f);
+	BW_ASSERT_DEEP(cutoff * bw_sqrtf(bw_sqrtf(high_gain)) >= 1e-6f && cutoff * bw_sqrtf(bw_sqrtf(high_gain)) <= 1e12f);
 
-	const float sg = bw_sqrtf(high_gain);
-	const float ssg = bw_sqrtf(sg);
+	const float sg = bw_sqrtf_ctrl(high_gain);
+	const float ssg = bw_sqrtf_ctrl(sg);
 	cutoff = cutoff * ssg;
 	BW_IIR2_COEFFS_COMMON
 	const float k6 = k1 * high_gain;
@@ -869,7 +884,7 @@ static inline void bw_iir2_coeffs_lp2(
 	BW_IIR2_ASSERT_VALID_COEFF_PTRS
 
 	BW_IIR2_COEFFS_COMMON
-	*b0 = Q * k3;
+	*b0 = d * Q * k3;
 	*b1 = *b0 + *b0;
 	*b2 = *b0;
 
@@ -894,12 +909,12 @@ static inline void bw_iir2_coeffs_ls2(
 	BW_ASSERT(bw_is_finite(dc_gain));
 	BW_ASSERT(dc_gain_dB ? dc_gain >= -600.f && dc_gain <= 600.f : dc_gain >= 1e-30f && dc_gain <= 1e30f);
 
-	dc_gain = dc_gain_dB ? bw_dB2linf(dc_gain) : dc_gain;
+	dc_gain = dc_gain_dB ? bw_dB2linf_ctrl(dc_gain) : dc_gain;
 
-	BW_ASSERT_DEEP(cutoff * bw_rcpf(bw_sqrt(bw_sqrtf(dc_gain))) >= 1e-6f && cutoff * bw_rcpf(bw_sqrt(bw_sqrtf(dc_gain))) <= 1e12f);
+	BW_ASSERT_DEEP(cutoff * bw_rcpf(bw_sqrtf(bw_sqrtf(dc_gain))) >= 1e-6f && cutoff * bw_rcpf(bw_sqrtf(bw_sqrtf(dc_gain))) <= 1e12f);
 
-	const float sg = bw_sqrtf(dc_gain);
-	const float issg = bw_rcpf(bw_sqrtf(sg));
+	const float sg = bw_sqrtf_ctrl(dc_gain);
+	const float issg = bw_rcpf_ctrl(bw_sqrtf_ctrl(sg));
 	cutoff = cutoff * issg;
 	BW_IIR2_COEFFS_COMMON
 	const float k6 = k3 * (dc_gain - sg);
@@ -983,11 +998,11 @@ static inline void bw_iir2_coeffs_peak(
 	BW_ASSERT(bw_is_finite(peak_gain));
 	BW_ASSERT(peak_gain_dB ? peak_gain >= -600.f && peak_gain <= 600.f : peak_gain >= 1e-30f && peak_gain <= 1e30f);
 
-	peak_gain = peak_gain_dB ? bw_dB2linf(peak_gain) : peak_gain;
+	peak_gain = peak_gain_dB ? bw_dB2linf_ctrl(peak_gain) : peak_gain;
 	float Q;
 	if (use_bandwidth) {
-		const float k6 = bw_pow2f(Q_bandwidth);
-		Q = bw_sqrtf(k6 * peak_gain) * bw_rcpf(k6 - 1.f);
+		const float k6 = bw_pow2f_ctrl(Q_bandwidth);
+		Q = bw_sqrtf_ctrl(k6 * peak_gain) * bw_rcpf_ctrl(k6 - 1.f);
 	} else
 		Q = Q_bandwidth;
 
@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_math bw_one_pole }}}
  *  description {{{
  *    First-order lowpass filter (6 dB/oct) with unitary DC gain.
@@ -30,6 +30,20 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *          <li>Added optional denormal killing via
+ *              <code>BW_DENORMAL_KILL</code>.</li>
+ *          <li>Added <code>bw_lp1_is_silent()</code> and corresponding C++
+ *              API.</li>
+ *          <li><code>bw_lp1_process()</code> and
+ *              <code>bw_lp1_process_multi()</code> now skip state updates and
+ *              output zeros when the filter is silent and the input is all
+ *              zeros.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -285,6 +299,20 @@ static inline void bw_lp1_set_prewarp_freq(
  *
  *    Default value: `1e3f`.
  *
+ *    #### bw_lp1_is_silent()
+ *  ```>>> */
+static inline char bw_lp1_is_silent(
+	const bw_lp1_coeffs * BW_RESTRICT coeffs,
+	const bw_lp1_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Returns non-`0` if the internal state of the filter in `state` is all
+ *    zeros, that is, if it would output zeros for as long as the input is
+ *    zero, `0` otherwise.
+ *
+ *    `bw_lp1_process()` and `bw_lp1_process_multi()` only update `coeffs` and
+ *    output zeros when this condition is met and the input buffers are all
+ *    zeros.
+ *
  *    #### bw_lp1_coeffs_is_valid()
  *  ```>>> */
 static inline char bw_lp1_coeffs_is_valid(
@@ -431,13 +459,13 @@ static inline void bw_lp1_do_update_coeffs(
 	if (prewarp_freq_changed || cutoff_changed) {
 		if (prewarp_freq_changed) {
 			prewarp_freq_cur = bw_one_pole_process1_sticky_rel(&coeffs->smooth_coeffs, &coeffs->smooth_prewarp_freq_state, prewarp_freq);
-			coeffs->t = bw_tanf(bw_minf(coeffs->t_k * prewarp_freq_cur, 1.567654734141306f)); // max = 0.499 * fs
+			coeffs->t = bw_tanf_ctrl(bw_minf(coeffs->t_k * prewarp_freq_cur, 1.567654734141306f)); // max = 0.499 * fs
 		}
 		if (cutoff_changed) {
 			cutoff_cur = bw_one_pole_process1_sticky_rel(&coeffs->smooth_coeffs, &coeffs->smooth_cutoff_state, coeffs->cutoff);
-			coeffs->y_X = bw_rcpf(cutoff_cur);
+			coeffs->y_X = bw_rcpf_ctrl(cutoff_cur);
 		}
-		const float k = cutoff_cur * bw_rcpf(cutoff_cur * coeffs->t + prewarp_freq_cur);
+		const float k = cutoff_cur * bw_rcpf_ctrl(cutoff_cur * coeffs->t + prewarp_freq_cur);
 		coeffs->X_x = k * prewarp_freq_cur;
 		coeffs->X_X_z1 = k * coeffs->t;
 	}
@@ -551,8 +579,8 @@ static inline float bw_lp1_process1(
 
 	const float X = coeffs->X_x * (x - state->y_z1) - coeffs->X_X_z1 * state->X_z1;
 	const float y = x - coeffs->y_X * X;
-	state->y_z1 = y;
-	state->X_z1 = X;
+	state->y_z1 = BW_KILL_DENORMAL_STATE(y);
+	state->X_z1 = BW_KILL_DENORMAL_STATE(X);
 
 	BW_ASSERT_DEEP(bw_lp1_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_lp1_coeffs_state_reset_coeffs);
@@ -577,10 +605,16 @@ static inline void bw_lp1_process(
 	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
 	BW_ASSERT(y != BW_NULL);
 
-	for (size_t i = 0; i < n_samples; i++) {
-		bw_lp1_update_coeffs_audio(coeffs);
-		y[i] = bw_lp1_process1(coeffs, state, x[i]);
-	}
+	if (bw_lp1_is_silent(coeffs, state) && bw_has_only_zeros(x, n_samples)) {
+		for (size_t i = 0; i < n_samples; i++)
+			bw_lp1_update_coeffs_audio(coeffs);
+		for (size_t i = 0; i < n_samples; i++)
+			y[i] = 0.f;
+	} else
+		for (size_t i = 0; i < n_samples; i++) {
+			bw_lp1_update_coeffs_audio(coeffs);
+			y[i] = bw_lp1_process1(coeffs, state, x[i]);
+		}
 
 	BW_ASSERT_DEEP(bw_lp1_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_lp1_coeffs_state_reset_coeffs);
@@ -624,11 +658,22 @@ static inline void bw_lp1_process_multi(
 			BW_ASSERT(i == j || x[i] != y[j]);
 #endif
 
-	for (size_t i = 0; i < n_samples; i++) {
-		bw_lp1_update_coeffs_audio(coeffs);
+	char silent = 1;
+	for (size_t j = 0; j < n_channels && silent; j++)
+		silent = bw_lp1_is_silent(coeffs, state[j]) && bw_has_only_zeros(x[j], n_samples);
+
+	if (silent) {
+		for (size_t i = 0; i < n_samples; i++)
+			bw_lp1_update_coeffs_audio(coeffs);
 		for (size_t j = 0; j < n_channels; j++)
-			y[j][i] = bw_lp1_process1(coeffs, state[j], x[j][i]);
-	}
+			for (size_t i = 0; i < n_samples; i++)
+				y[j][i] = 0.f;
+	} else
+		for (size_t i = 0; i < n_samples; i++) {
+			bw_lp1_update_coeffs_audio(coeffs);
+			for (size_t j = 0; j < n_channels; j++)
+				y[j][i] = bw_lp1_process1(coeffs, state[j], x[j][i]);
+		}
 
 	BW_ASSERT_DEEP(bw_lp1_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_lp1_coeffs_state_reset_coeffs);
@@ -683,6 +728,18 @@ static inline void bw_lp1_set_prewarp_freq(
 	BW_ASSERT_DEEP(coeffs->state >= bw_lp1_coeffs_state_init);
 }
 
+static inline char bw_lp1_is_silent(
+		const bw_lp1_coeffs * BW_RESTRICT coeffs,
+		const bw_lp1_state * BW_RESTRICT  state) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_lp1_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_lp1_state_is_valid(coeffs, state));
+
+	(void)coeffs;
+	return state->y_z1 == 0.f && state->X_z1 == 0.f;
+}
+
 static inline char bw_lp1_coeffs_is_valid(
 		const bw_lp1_coeffs * BW_RESTRICT coeffs) {
 	BW_ASSERT(coeffs != BW_NULL);
@@ -813,6 +870,9 @@ public:
 
 	void setPrewarpFreq(
 		float value);
+
+	char isSilent(
+		size_t channel);
 /*! <<<...
  *  }
  *  ```
@@ -917,6 +977,12 @@ inline void LP1<N_CHANNELS>::setPrewarpFreq(
 	bw_lp1_set_prewarp_freq(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline char LP1<N_CHANNELS>::isSilent(
+		size_t channel) {
+	return bw_lp1_is_silent(&coeffs, states + channel);
+}
+
 }
 #endif
 
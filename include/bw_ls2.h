@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.5 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_gain bw_math bw_mm2 bw_one_pole bw_svf }}}
  *  description {{{
  *    Second-order low shelf filter (12 dB/oct) with gain asymptotically
@@ -28,6 +28,14 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *          <li>Added <code>bw_ls2_set_update_interval()</code> and
+ *              <code>setUpdateInterval()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.5</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -320,6 +328,21 @@ static inline void bw_ls2_set_prewarp_freq(
  *
  *    Default value: `1e3f`.
  *
+ *    #### bw_ls2_set_update_interval()
+ *  ```>>> */
+static inline void bw_ls2_set_update_interval(
+	bw_ls2_coeffs * BW_RESTRICT coeffs,
+	size_t                      value);
+/*! <<<```
+ *    Sets the coefficient update interval to the given `value` (samples) in
+ *    `coeffs`.
+ *
+ *    See `bw_svf_set_update_interval()`.
+ *
+ *    `value` must be positive.
+ *
+ *    Default value: `1`.
+ *
  *    #### bw_ls2_set_dc_gain_lin()
  *  ```>>> */
 static inline void bw_ls2_set_dc_gain_lin(
@@ -492,8 +515,8 @@ static inline void bw_ls2_update_mm2_params(
 	bw_mm2_set_prewarp_freq(&coeffs->mm2_coeffs, coeffs->prewarp_freq + coeffs->prewarp_k * (coeffs->cutoff - coeffs->prewarp_freq));
 	if (coeffs->param_changed) {
 		if (coeffs->param_changed & BW_LS2_PARAM_DC_GAIN) {
-			coeffs->sg = bw_sqrtf(coeffs->dc_gain);
-			coeffs->issg = bw_rcpf(bw_sqrtf(coeffs->sg));
+			coeffs->sg = bw_sqrtf_ctrl(coeffs->dc_gain);
+			coeffs->issg = bw_rcpf_ctrl(bw_sqrtf_ctrl(coeffs->sg));
 			bw_mm2_set_coeff_x(&coeffs->mm2_coeffs, coeffs->sg);
 			bw_mm2_set_coeff_lp(&coeffs->mm2_coeffs, coeffs->dc_gain - coeffs->sg);
 			bw_mm2_set_coeff_hp(&coeffs->mm2_coeffs, 1.f - coeffs->sg);
@@ -769,6 +792,20 @@ static inline void bw_ls2_set_prewarp_freq(
 	BW_ASSERT_DEEP(coeffs->state >= bw_ls2_coeffs_state_init);
 }
 
+static inline void bw_ls2_set_update_interval(
+		bw_ls2_coeffs * BW_RESTRICT coeffs,
+		size_t                      value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_ls2_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_ls2_coeffs_state_init);
+	BW_ASSERT(value > 0);
+
+	bw_mm2_set_update_interval(&coeffs->mm2_coeffs, value);
+
+	BW_ASSERT_DEEP(bw_ls2_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_ls2_coeffs_state_init);
+}
+
 static inline void bw_ls2_set_dc_gain_lin(
 		bw_ls2_coeffs * BW_RESTRICT coeffs,
 		float                       value) {
@@ -922,6 +959,9 @@ public:
 	void setPrewarpFreq(
 		float value);
 
+	void setUpdateInterval(
+		size_t value);
+
 	void setDcGainLin(
 		float value);
 
@@ -1037,6 +1077,12 @@ inline void LS2<N_CHANNELS>::setPrewarpFreq(
 	bw_ls2_set_prewarp_freq(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline void LS2<N_CHANNELS>::setUpdateInterval(
+		size_t value) {
+	bw_ls2_set_update_interval(&coeffs, value);
+}
+
 template<size_t N_CHANNELS>
 inline void LS2<N_CHANNELS>::setDcGainLin(
 		float value) {
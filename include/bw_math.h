@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ utility }}}
- *  version {{{ 1.2.1 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common }}}
  *  description {{{
  *    A collection of mathematical routines that strive to be better suited to
@@ -44,6 +44,17 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Added
+ *              <code>bw_{rcp,sin2pi,sin,cos2pi,cos,tan2pi,tan}f_buf()</code>,
+ *              <code>bw_{log2,log,log10,pow2,exp,pow10}f_buf()</code>, and
+ *              <code>bw_{dB2lin,lin2dB,sqrt,tanh}f_buf()</code>.</li>
+ *          <li>Added <code>BW_MATH_PRECISION</code> and
+ *              <code>BW_MATH_PRECISION_CTRL</code>.</li>
+ *          <li>Added <code>bw_{rcp,tan,log2,pow2,dB2lin,sqrt}f_ctrl()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.1</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -153,13 +164,51 @@
 # include <bw_common.h>
 #endif
 
+/*** Public API ***/
+
+/*! api {{{
+ *
+ *    #### BW_MATH_PRECISION
+ *
+ *    Selects the precision tier of the approximations computed by this module
+ *    at compile time. Valid values are:
+ *
+ *    * `0`: low precision, cheaper lower-order approximations;
+ *    * `1`: medium precision (default);
+ *    * `2`: high precision, costlier higher-order approximations.
+ *
+ *    Approximation errors in this documentation refer to medium precision
+ *    unless otherwise stated.
+ *
+ *    #### BW_MATH_PRECISION_CTRL
+ *
+ *    Selects the precision tier of `bw_*f_ctrl()` functions, which other
+ *    modules use where they only need control-rate precision (e.g., coefficient
+ *    computation and parameter smoothing). Valid values are the same as for
+ *    `BW_MATH_PRECISION`, which is also its default value.
+ *  >>> */
+#ifndef BW_MATH_PRECISION
+# define BW_MATH_PRECISION	1
+#endif
+
+#if BW_MATH_PRECISION < 0 || BW_MATH_PRECISION > 2
+# error BW_MATH_PRECISION must be 0, 1, or 2
+#endif
+
+#ifndef BW_MATH_PRECISION_CTRL
+# define BW_MATH_PRECISION_CTRL	BW_MATH_PRECISION
+#endif
+
+#if BW_MATH_PRECISION_CTRL < 0 || BW_MATH_PRECISION_CTRL > 2
+# error BW_MATH_PRECISION_CTRL must be 0, 1, or 2
+#endif
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 extern "C" {
 #endif
 
-/*** Public API ***/
-
-/*! api {{{
+/*! ...
+ *
  *    #### bw_signfilli8()
  *  ```>>> */
 static inline int8_t bw_signfilli8(
@@ -525,6 +574,9 @@ static inline float bw_rcpf(
  *
  *    Relative error < 0.0013%.
  *
+ *    If `BW_MATH_PRECISION` is `0`: relative error < 0.35%.
+ *    If `BW_MATH_PRECISION` is `2`: relative error < 0.00001%.
+ *
  *    #### bw_sin2pif()
  *  ```>>> */
 static inline float bw_sin2pif(
@@ -537,6 +589,9 @@ static inline float bw_sin2pif(
  *
  *    Absolute error < 0.011 or relative error < 1.7%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.054.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 4.5e-6.
+ *
  *    #### bw_sinf()
  *  ```>>> */
 static inline float bw_sinf(
@@ -547,7 +602,11 @@ static inline float bw_sinf(
  *
  *    `x` must be finite.
  *
- *    Absolute error < 0.011 or relative error < 1.7%, whatever is worse.
+ *    Absolute error < 0.011 + 1e-7 * |`x`| or relative error < 1.7%, whatever
+ *    is worse.
+ *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.054 + 1e-7 * |`x`|.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 4.5e-6 + 1e-7 * |`x`|.
  *
  *    #### bw_cos2pif()
  *  ```>>> */
@@ -561,6 +620,9 @@ static inline float bw_cos2pif(
  * 
  *    Absolute error < 0.011 or relative error < 1.7%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.054.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 4.5e-6.
+ *
  *    #### bw_cosf()
  *  ```>>> */
 static inline float bw_cosf(
@@ -571,7 +633,11 @@ static inline float bw_cosf(
  *
  *    `x` must be finite.
  *
- *    Absolute error < 0.011 or relative error < 1.7%, whatever is worse.
+ *    Absolute error < 0.011 + 1e-7 * |`x`| or relative error < 1.7%, whatever
+ *    is worse.
+ *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.054 + 1e-7 * |`x`|.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 4.5e-6 + 1e-7 * |`x`|.
  *
  *    #### bw_tan2pif()
  *  ```>>> */
@@ -586,6 +652,11 @@ static inline float bw_tan2pif(
 *
  *    Absolute error < 0.06 or relative error < 0.8%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.06 or
+ *    relative error < 5.2%, whatever is worse.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 0.06 or
+ *    relative error < 0.014%, whatever is worse.
+ *
  *    #### bw_tanf()
  *  ```>>> */
 static inline float bw_tanf(
@@ -599,6 +670,11 @@ static inline float bw_tanf(
  *
  *    Absolute error < 0.06 or relative error < 0.8%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.06 or
+ *    relative error < 5.2%, whatever is worse.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 0.06 or
+ *    relative error < 0.014%, whatever is worse.
+ *
  *    #### bw_log2f()
  *  ```>>> */
 static inline float bw_log2f(
@@ -610,6 +686,10 @@ static inline float bw_log2f(
  * 
  *    Absolute error < 0.0055 or relative error < 1.2%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.0064.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 1.4e-6 or
+ *    relative error < 0.00002%, whatever is worse.
+ *
  *    #### bw_logf()
  *  ```>>> */
 static inline float bw_logf(
@@ -621,6 +701,10 @@ static inline float bw_logf(
  * 
  *    Absolute error < 0.0038 or relative error < 1.2%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.0045.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 1.5e-6 or
+ *    relative error < 0.00002%, whatever is worse.
+ *
  *    #### bw_log10f()
  *  ```>>> */
 static inline float bw_log10f(
@@ -632,6 +716,10 @@ static inline float bw_log10f(
  *
  *    Absolute error < 0.0017 or relative error < 1.2%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.002.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 1e-6 or
+ *    relative error < 0.00002%, whatever is worse.
+ *
  *    #### bw_pow2f()
  *  ```>>> */
 static inline float bw_pow2f(
@@ -644,6 +732,9 @@ static inline float bw_pow2f(
  *
  *    Relative error < 0.062%.
  *
+ *    If `BW_MATH_PRECISION` is `0`: relative error < 0.21%.
+ *    If `BW_MATH_PRECISION` is `2`: relative error < 0.000018%.
+ *
  *    #### bw_expf()
  *  ```>>> */
 static inline float bw_expf(
@@ -656,6 +747,9 @@ static inline float bw_expf(
  *
  *    Relative error < 0.062%.
  *
+ *    If `BW_MATH_PRECISION` is `0`: relative error < 0.21%.
+ *    If `BW_MATH_PRECISION` is `2`: relative error < 0.0005%.
+ *
  *    #### bw_pow10f() 
  *  ```>>> */
 static inline float bw_pow10f(
@@ -668,6 +762,9 @@ static inline float bw_pow10f(
  *
  *    Relative error < 0.062%.
  *
+ *    If `BW_MATH_PRECISION` is `0`: relative error < 0.21%.
+ *    If `BW_MATH_PRECISION` is `2`: relative error < 0.0005%.
+ *
  *    #### bw_log2_1p2xf()
  *  ```>>> */
 static inline float bw_log2_1p2xf(
@@ -677,6 +774,8 @@ static inline float bw_log2_1p2xf(
  *
  *    Absolute error < 0.006.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.0077.
+ *
  *    #### bw_log_1pexpxf()
  *  ```>>> */
 static inline float bw_log_1pexpxf(
@@ -686,6 +785,8 @@ static inline float bw_log_1pexpxf(
  *
  *    Absolute error < 0.004.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.0064.
+ *
  *    #### bw_log10_1p10xf()
  *  ```>>> */
 static inline float bw_log10_1p10xf(
@@ -695,6 +796,8 @@ static inline float bw_log10_1p10xf(
  *
  *    Absolute error < 0.002.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.0027.
+ *
  *    #### bw_dB2linf()
  *  ```>>> */
 static inline float bw_dB2linf(
@@ -708,6 +811,9 @@ static inline float bw_dB2linf(
  *
  *    Relative error < 0.062%.
  *
+ *    If `BW_MATH_PRECISION` is `0`: relative error < 0.21%.
+ *    If `BW_MATH_PRECISION` is `2`: relative error < 0.0005%.
+ *
  *    #### bw_lin2dBf()
  *  ```>>> */
 static inline float bw_lin2dBf(
@@ -719,6 +825,10 @@ static inline float bw_lin2dBf(
  *    `x` must be finite and greater than or equal to `1.175494350822287e-38f`.
  *
  *    Absolute error < 0.032 or relative error < 1.2%, whatever is worse.
+ *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.039.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 2.2e-5 or
+ *    relative error < 0.00002%, whatever is worse.
  * 
  *    #### bw_sqrtf()
  *  ```>>> */
@@ -731,6 +841,11 @@ static inline float bw_sqrtf(
  *
  *    Absolute error < 1.09e-19 or relative error < 0.0007%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 1.09e-19 or
+ *    relative error < 0.14%, whatever is worse.
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 1.09e-19 or
+ *    relative error < 0.000013%, whatever is worse.
+ *
  *    #### bw_tanhf()
  *  ```>>> */
 static inline float bw_tanhf(
@@ -740,6 +855,8 @@ static inline float bw_tanhf(
  *
  *    Absolute error < 0.035 or relative error < 6.5%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `2`: absolute error < 9.7e-5.
+ *
  *    #### bw_sinhf()
  *  ```>>> */
 static inline float bw_sinhf(
@@ -751,6 +868,9 @@ static inline float bw_sinhf(
  *
  *    Absolute error < 1e-7 or relative error < 0.07%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 0.0021 or
+ *    relative error < 0.21%, whatever is worse.
+ *
  *    #### bw_coshf()
  *  ```>>> */
 static inline float bw_coshf(
@@ -762,6 +882,8 @@ static inline float bw_coshf(
  *
  *    Relative error < 0.07%.
  *
+ *    If `BW_MATH_PRECISION` is `0`: relative error < 0.21%.
+ *
  *    #### bw_sechf()
  *  ```>>> */
 static inline float bw_sechf(
@@ -771,6 +893,9 @@ static inline float bw_sechf(
  *
  *    Absolute error < 1e-9 or relative error < 0.07%, whatever is worse.
  *
+ *    If `BW_MATH_PRECISION` is `0`: absolute error < 1e-9 or
+ *    relative error < 0.56%, whatever is worse.
+ *
  *    #### bw_asinhf()
  *  ```>>> */
 static inline float bw_asinhf(
@@ -792,6 +917,132 @@ static inline float bw_acoshf(
  *    `x` must be in [`1.f`, `8.507059173023462e+37f`].
  *
  *    Absolute error < 0.004 or relative error < 0.8%, whatever is worse.
+ *
+ *    #### bw_\*f_buf()
+ *  ```>>> */
+static inline void bw_rcpf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_sin2pif_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_sinf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_cos2pif_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_cosf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_tan2pif_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_tanf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_log2f_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_logf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_log10f_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_pow2f_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_expf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_pow10f_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_dB2linf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_lin2dBf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_sqrtf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+
+static inline void bw_tanhf_buf(
+	const float * x,
+	float *       y,
+	size_t        n_elems);
+/*! <<<```
+ *    These functions compute the same approximations as the corresponding
+ *    scalar functions (e.g., `bw_sin2pif_buf()` is the buffer counterpart of
+ *    `bw_sin2pif()`) on the first `n_elems` of `x` and store the results in the
+ *    first `n_elems` of `y`. Input validity ranges and approximation errors are
+ *    also the same.
+ *
+ *    They are written so that compilers can vectorize them and they return
+ *    the same values as their scalar counterparts, net of the sign of zero
+ *    results and of differences due to floating-point contraction.
+ *
+ *    `x` and `y` may point to the same buffer.
+ *
+ *    #### bw_\*f_ctrl()
+ *  ```>>> */
+static inline float bw_rcpf_ctrl(
+	float x);
+
+static inline float bw_tanf_ctrl(
+	float x);
+
+static inline float bw_log2f_ctrl(
+	float x);
+
+static inline float bw_pow2f_ctrl(
+	float x);
+
+static inline float bw_dB2linf_ctrl(
+	float x);
+
+static inline float bw_sqrtf_ctrl(
+	float x);
+/*! <<<```
+ *    These functions compute the same approximations as the corresponding
+ *    functions without `_ctrl` suffix (e.g., `bw_rcpf_ctrl()` is the
+ *    counterpart of `bw_rcpf()`), but using the precision tier selected by
+ *    `BW_MATH_PRECISION_CTRL` rather than `BW_MATH_PRECISION`. Input validity
+ *    ranges are the same and approximation errors are those of the selected
+ *    tier.
  *  }}} */
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
@@ -1144,27 +1395,146 @@ static inline void bw_intfracf(
 	BW_ASSERT(bw_is_finite(*f));
 }
 
-static inline float bw_rcpf(
-		float x) {
-	BW_ASSERT(bw_is_finite(x));
-	BW_ASSERT((x >= 8.077935669e-28f && x <= 1.237940039e27f) || (x <= -8.077935669e-28f && x >= -1.237940039e27f));
+// Tiered implementations, tier being 0 (low), 1 (medium), or 2 (high)
+// precision. tier is always a constant, hence branches are optimized away.
+
+static inline float bw_rcpf_tier(
+		float x,
+		int   tier) {
 	union { float f; int32_t i; } v;
 	v.f = x;
 	v.i = 0x7ef0e840 - v.i;
 	v.f = v.f + v.f - x * v.f * v.f;
-	v.f = v.f + v.f - x * v.f * v.f;
-	BW_ASSERT(bw_is_finite(v.f));
+	if (tier >= 1)
+		v.f = v.f + v.f - x * v.f * v.f;
+	if (tier >= 2)
+		v.f = v.f + v.f - x * v.f * v.f;
 	return v.f;
 }
 
-static inline float bw_sin2pif(
-		float x) {
-	BW_ASSERT(bw_is_finite(x));
-	x = x - bw_floorf(x);
+// x in [0.f, 1.f)
+static inline float bw_sin2pif_frac_tier(
+		float x,
+		int   tier) {
 	float xp1 = x + x - 1.f;
 	float xp2 = bw_absf(xp1);
 	float xp = 1.570796326794897f - 1.570796326794897f * bw_absf(xp2 + xp2 - 1.f);
-	const float y = -bw_copysignf(1.f, xp1) * (xp + xp * xp * (-0.05738534102710938f - 0.1107398163618408f * xp));
+	float y;
+	if (tier == 0)
+		y = xp - 0.2097602543608809f * xp * xp;
+	else if (tier == 1)
+		y = xp + xp * xp * (-0.05738534102710938f - 0.1107398163618408f * xp);
+	else {
+		const float xp_2 = xp * xp;
+		y = xp + xp * xp_2 * (-0.166665263383088f + xp_2 * (0.008322640963840361f - 0.00018766038034289195f * xp_2));
+	}
+	return -bw_copysignf(1.f, xp1) * y;
+}
+
+static inline float bw_sin2pif_tier(
+		float x,
+		int   tier) {
+	return bw_sin2pif_frac_tier(x - bw_floorf(x), tier);
+}
+
+static inline float bw_tanf_tier(
+		float x,
+		int   tier) {
+	x = 0.1591549430918953f * x;
+	return bw_sin2pif_tier(x, tier) * bw_rcpf_tier(bw_sin2pif_tier(x + 0.25f, tier), tier);
+}
+
+static inline float bw_log2f_tier(
+		float x,
+		int   tier) {
+	union { float f; int32_t i; } v;
+	v.f = x;
+	int e = v.i >> 23;
+	v.i = (v.i & 0x007fffff) | 0x3f800000;
+	if (tier == 1)
+		return (float)e - 129.213475204444817f + v.f * (3.148297929334117f + v.f * (-1.098865286222744f + v.f * 0.1640425613334452f));
+	const float t = v.f - 1.f;
+	if (tier == 0)
+		return (float)(e - 127) + t * (1.356951570888117f - 0.3632772467211983f * t);
+	return (float)(e - 127) + t * (1.442667829040675f + t * (-0.7205854662633071f + t * (0.4735533965639029f + t * (-0.3259019339882057f
+		+ t * (0.1942942666590697f + t * (-0.07955769175247833f + t * 0.0155299064182786f))))));
+}
+
+// f in [0.f, 1.f), returns p such that 2^f ~= 1 + f * p
+static inline float bw_pow2f_frac_tier(
+		float f,
+		int   tier) {
+	if (tier == 0)
+		return 0.6659609419458767f + f * 0.3299324036740856f;
+	if (tier == 1)
+		return 0.6931471805599453f + f * (0.2274112777602189f + f * 0.07944154167983575f);
+	return 0.6931513118075205f + f * (0.2401644501360859f + f * (0.05579991314591706f + f * (0.009017030284495981f + f * 0.001867130081882691f)));
+}
+
+static inline float bw_pow2f_tier(
+		float x,
+		int   tier) {
+	if (x < -126.f)
+		return 0.f;
+	union { float f; int32_t i; } v;
+	v.f = x;
+	int xi = (int)x;
+	int l = xi - ((v.i >> 31) & 1);
+	float f = x - (float)l;
+	v.i = (l + 127) << 23;
+	return v.f + v.f * f * bw_pow2f_frac_tier(f, tier);
+}
+
+static inline float bw_sqrtf_tier(
+		float x,
+		int   tier) {
+	if (x < 1.1754943508222875e-38f)
+		return 0.f;
+	union { float f; int32_t i; } v;
+	v.f = x;
+	int i = (v.i >> 26) & 0x38;
+	v.i += (int32_t)((0x200000e0 << i) & (int32_t)0xff000000);
+	const float r = bw_rcpf_tier(v.f, tier);
+	v.i = (((v.i - 0x3f82a127) >> 1) + 0x3f7d8fc7) & 0x7fffffff;
+	v.f = v.f + v.f * (0.5f - 0.5f * r * v.f * v.f);
+	if (tier >= 1)
+		v.f = v.f + v.f * (0.5f - 0.5f * r * v.f * v.f);
+	if (tier >= 2)
+		v.f = v.f + v.f * (0.5f - 0.5f * r * v.f * v.f);
+	v.i -= (int32_t)((0x100000f0 << i) & (int32_t)0xff000000);
+	return v.f;
+}
+
+// x in [-4.971786858527607f, 4.971786858527607f], [7/6] Pade approximant
+static inline float bw_tanhf_pade(
+		float x) {
+	const float x2 = x * x;
+	return x * (135135.f + x2 * (17325.f + x2 * (378.f + x2))) * bw_rcpf_tier(135135.f + x2 * (62370.f + x2 * (3150.f + 28.f * x2)), 2);
+}
+
+static inline float bw_tanhf_tier(
+		float x,
+		int   tier) {
+	if (tier == 2)
+		return bw_tanhf_pade(bw_clipf(x, -4.971786858527607f, 4.971786858527607f));
+	const float xm = bw_clipf(x, -2.115287308554551f, 2.115287308554551f);
+	const float axm = bw_absf(xm);
+	return xm * axm * (0.01218073260037716f * axm - 0.2750231331124371f) + xm;
+}
+
+static inline float bw_rcpf(
+		float x) {
+	BW_ASSERT(bw_is_finite(x));
+	BW_ASSERT((x >= 8.077935669e-28f && x <= 1.237940039e27f) || (x <= -8.077935669e-28f && x >= -1.237940039e27f));
+	const float y = bw_rcpf_tier(x, BW_MATH_PRECISION);
+	BW_ASSERT(bw_is_finite(y));
+	return y;
+}
+
+static inline float bw_sin2pif(
+		float x) {
+	BW_ASSERT(bw_is_finite(x));
+	const float y = bw_sin2pif_tier(x, BW_MATH_PRECISION);
 	BW_ASSERT(bw_is_finite(y));
 	return y;
 }
@@ -1218,11 +1588,7 @@ static inline float bw_log2f(
 		float x) {
 	BW_ASSERT(bw_is_finite(x));
 	BW_ASSERT(x >= 1.175494350822287e-38f);
-	union { float f; int32_t i; } v;
-	v.f = x;
-	int e = v.i >> 23;
-	v.i = (v.i & 0x007fffff) | 0x3f800000;
-	const float y = (float)e - 129.213475204444817f + v.f * (3.148297929334117f + v.f * (-1.098865286222744f + v.f * 0.1640425613334452f));
+	const float y = bw_log2f_tier(x, BW_MATH_PRECISION);
 	BW_ASSERT(bw_is_finite(y));
 	return y;
 }
@@ -1249,15 +1615,7 @@ static inline float bw_pow2f(
 		float x) {
 	BW_ASSERT(!bw_is_nan(x));
 	BW_ASSERT(x <= 127.999f);
-	if (x < -126.f)
-		return 0.f;
-	union { float f; int32_t i; } v;
-	v.f = x;
-	int xi = (int)x;
-	int l = xi - ((v.i >> 31) & 1);
-	float f = x - (float)l;
-	v.i = (l + 127) << 23;
-	const float y = v.f + v.f * f * (0.6931471805599453f + f * (0.2274112777602189f + f * 0.07944154167983575f));
+	const float y = bw_pow2f_tier(x, BW_MATH_PRECISION);
 	BW_ASSERT(bw_is_finite(y));
 	return y;
 }
@@ -1326,27 +1684,15 @@ static inline float bw_sqrtf(
 		float x) {
 	BW_ASSERT(bw_is_finite(x));
 	BW_ASSERT(x >= 0.f);
-	if (x < 1.1754943508222875e-38f)
-		return 0.f;
-	union { float f; int32_t i; } v;
-	v.f = x;
-	int i = (v.i >> 26) & 0x38;
-	v.i += (int32_t)((0x200000e0 << i) & (int32_t)0xff000000);
-	const float r = bw_rcpf(v.f);
-	v.i = (((v.i - 0x3f82a127) >> 1) + 0x3f7d8fc7) & 0x7fffffff;
-	v.f = v.f + v.f * (0.5f - 0.5f * r * v.f * v.f);
-	v.f = v.f + v.f * (0.5f - 0.5f * r * v.f * v.f);
-	v.i -= (int32_t)((0x100000f0 << i) & (int32_t)0xff000000);
-	BW_ASSERT(bw_is_finite(v.f));
-	return v.f;
+	const float y = bw_sqrtf_tier(x, BW_MATH_PRECISION);
+	BW_ASSERT(bw_is_finite(y));
+	return y;
 }
 
 static inline float bw_tanhf(
 		float x) {
 	BW_ASSERT(!bw_is_nan(x));
-	const float xm = bw_clipf(x, -2.115287308554551f, 2.115287308554551f);
-	const float axm = bw_absf(xm);
-	const float y = xm * axm * (0.01218073260037716f * axm - 0.2750231331124371f) + xm;
+	const float y = bw_tanhf_tier(x, BW_MATH_PRECISION);
 	BW_ASSERT(!bw_is_nan(y));
 	return y;
 }
@@ -1399,6 +1745,425 @@ static inline float bw_acoshf(
 	return y;
 }
 
+// The following functions are branchless and bit-identical (but for the sign of
+// zero) reformulations of scalar ones. Conditionals are done on integer
+// representations as compilers seem to be more willing to vectorize them.
+
+static inline float bw_floorf_lane(
+		float x) {
+	union { float f; int32_t i; } v, c, t, s;
+	v.f = x;
+	// |x| >= 2^23 means that x is already an integer
+	const int32_t m = -(int32_t)((v.i & 0x7fffffff) < 0x4b000000);
+	c.i = v.i & m;
+	t.f = (float)(int32_t)c.f;
+	c.f = t.f - c.f; // positive when t > c, never -0.f
+	s.f = 1.f;
+	s.i &= bw_signfilli32(-c.i);
+	t.f = t.f - s.f;
+	t.i = (t.i & m) | (v.i & ~m);
+	return t.f;
+}
+
+static inline float bw_sin2pif_lane(
+		float x) {
+	return bw_sin2pif_frac_tier(x - bw_floorf_lane(x), BW_MATH_PRECISION);
+}
+
+static inline float bw_pow2f_lane(
+		float x) {
+	union { float f; int32_t i; uint32_t u; } v, y;
+	v.f = x;
+	// x < -126.f iff v.u > 0xc2fc0000u
+	const int32_t m = -(int32_t)(v.u <= 0xc2fc0000u);
+	v.i &= m;
+	const int32_t l = (int32_t)v.f - ((v.i >> 31) & 1);
+	const float f = v.f - (float)l;
+	y.i = (l + 127) << 23;
+	y.f = y.f + y.f * f * bw_pow2f_frac_tier(f, BW_MATH_PRECISION);
+	y.i &= m;
+	return y.f;
+}
+
+static inline float bw_sqrtf_lane(
+		float x) {
+	union { float f; int32_t i; } v;
+	v.f = x;
+	const int32_t m = -(int32_t)(v.i >= 0x00800000);
+	const int32_t lo = -(int32_t)(v.i < 0x20000000);
+	const int32_t hi = -(int32_t)(v.i >= 0x60000000);
+	v.i += (0x20000000 & lo) | ((int32_t)0xe0000000 & hi);
+	const float r = bw_rcpf_tier(v.f, BW_MATH_PRECISION);
+	v.i = (((v.i - 0x3f82a127) >> 1) + 0x3f7d8fc7) & 0x7fffffff;
+	v.f = v.f + v.f * (0.5f - 0.5f * r * v.f * v.f);
+	if (BW_MATH_PRECISION >= 1)
+		v.f = v.f + v.f * (0.5f - 0.5f * r * v.f * v.f);
+	if (BW_MATH_PRECISION >= 2)
+		v.f = v.f + v.f * (0.5f - 0.5f * r * v.f * v.f);
+	v.i -= (0x10000000 & lo) | ((int32_t)0xf0000000 & hi);
+	v.i &= m;
+	return v.f;
+}
+
+static inline float bw_tanhf_lane(
+		float x) {
+	union { float f; int32_t i; } v, a;
+	v.f = x;
+	if (BW_MATH_PRECISION == 2) {
+		a.i = bw_mini32(v.i & 0x7fffffff, 0x409f18e1); // 4.971786858527607f
+		v.i = a.i | (v.i & (int32_t)0x80000000);
+		return bw_tanhf_pade(v.f);
+	}
+	a.i = bw_mini32(v.i & 0x7fffffff, 0x400760de); // 2.115287308554551f
+	v.i = a.i | (v.i & (int32_t)0x80000000);
+	return v.f * a.f * (0.01218073260037716f * a.f - 0.2750231331124371f) + v.f;
+}
+
+static inline void bw_rcpf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT((x[i] >= 8.077935669e-28f && x[i] <= 1.237940039e27f) || (x[i] <= -8.077935669e-28f && x[i] >= -1.237940039e27f));
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_rcpf(x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_sin2pif_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_sin2pif_lane(x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_sinf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_sin2pif_lane(0.1591549430918953f * x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_cos2pif_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_sin2pif_lane(x[i] + 0.25f);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_cosf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_sin2pif_lane(0.1591549430918953f * x[i] + 0.25f);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_tan2pif_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT((x[i] - 0.5f * bw_floorf(x[i] + x[i]) <= 0.249840845056908f)
+			|| (x[i] - 0.5f * bw_floorf(x[i] + x[i]) >= 0.250159154943092f));
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_sin2pif_lane(x[i]) * bw_rcpf(bw_sin2pif_lane(x[i] + 0.25f));
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_tanf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT((x[i] - 3.141592653589793f * bw_floorf(0.318309886183791f * x[i]) <= 1.569796326794897f)
+			|| (x[i] - 3.141592653589793f * bw_floorf(0.318309886183791f * x[i]) >= 1.571796326794896f));
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++) {
+		const float t = 0.1591549430918953f * x[i];
+		y[i] = bw_sin2pif_lane(t) * bw_rcpf(bw_sin2pif_lane(t + 0.25f));
+	}
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_log2f_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT(x[i] >= 1.175494350822287e-38f);
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_log2f(x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_logf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT(x[i] >= 1.175494350822287e-38f);
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = 0.693147180559945f * bw_log2f(x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_log10f_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT(x[i] >= 1.175494350822287e-38f);
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = 0.3010299956639811f * bw_log2f(x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_pow2f_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT(x[i] <= 127.999f);
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_pow2f_lane(x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_expf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT(x[i] <= 88.722f);
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_pow2f_lane(1.442695040888963f * x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_pow10f_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT(x[i] <= 38.531f);
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_pow2f_lane(3.321928094887363f * x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_dB2linf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT(x[i] <= 770.630f);
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_pow2f_lane(0.1660964047443682f * x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_lin2dBf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT(x[i] >= 1.175494350822287e-38f);
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = 20.f * (0.3010299956639811f * bw_log2f(x[i]));
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_sqrtf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_elems));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_elems; i++)
+		BW_ASSERT(x[i] >= 0.f);
+#endif
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_sqrtf_lane(x[i]);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+static inline void bw_tanhf_buf(
+		const float * x,
+		float *       y,
+		size_t        n_elems) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(!bw_has_nan(x, n_elems));
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_elems; i++)
+		y[i] = bw_tanhf_lane(x[i]);
+
+	BW_ASSERT_DEEP(!bw_has_nan(y, n_elems));
+}
+
+static inline float bw_rcpf_ctrl(
+		float x) {
+	BW_ASSERT(bw_is_finite(x));
+	BW_ASSERT((x >= 8.077935669e-28f && x <= 1.237940039e27f) || (x <= -8.077935669e-28f && x >= -1.237940039e27f));
+	const float y = bw_rcpf_tier(x, BW_MATH_PRECISION_CTRL);
+	BW_ASSERT(bw_is_finite(y));
+	return y;
+}
+
+static inline float bw_tanf_ctrl(
+		float x) {
+	BW_ASSERT(bw_is_finite(x));
+	BW_ASSERT((x - 3.141592653589793f * bw_floorf(0.318309886183791f * x) <= 1.569796326794897f)
+			|| (x - 3.141592653589793f * bw_floorf(0.318309886183791f * x) >= 1.571796326794896f));
+	const float y = bw_tanf_tier(x, BW_MATH_PRECISION_CTRL);
+	BW_ASSERT(bw_is_finite(y));
+	return y;
+}
+
+static inline float bw_log2f_ctrl(
+		float x) {
+	BW_ASSERT(bw_is_finite(x));
+	BW_ASSERT(x >= 1.175494350822287e-38f);
+	const float y = bw_log2f_tier(x, BW_MATH_PRECISION_CTRL);
+	BW_ASSERT(bw_is_finite(y));
+	return y;
+}
+
+static inline float bw_pow2f_ctrl(
+		float x) {
+	BW_ASSERT(!bw_is_nan(x));
+	BW_ASSERT(x <= 127.999f);
+	const float y = bw_pow2f_tier(x, BW_MATH_PRECISION_CTRL);
+	BW_ASSERT(bw_is_finite(y));
+	return y;
+}
+
+static inline float bw_dB2linf_ctrl(
+		float x) {
+	BW_ASSERT(!bw_is_nan(x));
+	BW_ASSERT(x <= 770.630f);
+	const float y = bw_pow2f_tier(0.1660964047443682f * x, BW_MATH_PRECISION_CTRL);
+	BW_ASSERT(bw_is_finite(y));
+	return y;
+}
+
+static inline float bw_sqrtf_ctrl(
+		float x) {
+	BW_ASSERT(bw_is_finite(x));
+	BW_ASSERT(x >= 0.f);
+	const float y = bw_sqrtf_tier(x, BW_MATH_PRECISION_CTRL);
+	BW_ASSERT(bw_is_finite(y));
+	return y;
+}
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 }
 #endif
@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.5 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_gain bw_math bw_one_pole bw_svf }}}
  *  description {{{
  *    Second-order multimode filter.
@@ -34,6 +34,12 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Added <code>bw_mm2_set_update_interval()</code> and
+ *              <code>setUpdateInterval()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.5</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -310,6 +316,21 @@ static inline void bw_mm2_set_prewarp_freq(
  *
  *    Default value: `1e3f`.
  *
+ *    #### bw_mm2_set_update_interval()
+ *  ```>>> */
+static inline void bw_mm2_set_update_interval(
+	bw_mm2_coeffs * BW_RESTRICT coeffs,
+	size_t                      value);
+/*! <<<```
+ *    Sets the coefficient update interval to the given `value` (samples) in
+ *    `coeffs`.
+ *
+ *    See `bw_svf_set_update_interval()`.
+ *
+ *    `value` must be positive.
+ *
+ *    Default value: `1`.
+ *
  *    #### bw_mm2_set_coeff_x()
  *  ```>>> */
 static inline void bw_mm2_set_coeff_x(
@@ -766,6 +787,20 @@ static inline void bw_mm2_set_prewarp_freq(
 	BW_ASSERT_DEEP(coeffs->state >= bw_mm2_coeffs_state_init);
 }
 
+static inline void bw_mm2_set_update_interval(
+		bw_mm2_coeffs * BW_RESTRICT coeffs,
+		size_t                      value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_mm2_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_mm2_coeffs_state_init);
+	BW_ASSERT(value > 0);
+
+	bw_svf_set_update_interval(&coeffs->svf_coeffs, value);
+
+	BW_ASSERT_DEEP(bw_mm2_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_mm2_coeffs_state_init);
+}
+
 static inline void bw_mm2_set_coeff_x(
 		bw_mm2_coeffs * BW_RESTRICT coeffs,
 		float                       value) {
@@ -925,6 +960,9 @@ public:
 	void setPrewarpFreq(
 		float value);
 
+	void setUpdateInterval(
+		size_t value);
+
 	void setCoeffX(
 		float value);
 
@@ -1046,6 +1084,12 @@ inline void MM2<N_CHANNELS>::setPrewarpFreq(
 	bw_mm2_set_prewarp_freq(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline void MM2<N_CHANNELS>::setUpdateInterval(
+		size_t value) {
+	bw_mm2_set_update_interval(&coeffs, value);
+}
+
 template<size_t N_CHANNELS>
 inline void MM2<N_CHANNELS>::setCoeffX(
 		float value) {
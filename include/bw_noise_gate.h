@@ -20,13 +20,19 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_env_follow bw_math bw_one_pole }}}
  *  description {{{
  *    Noise gate with independent sidechain input.
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -467,9 +473,9 @@ static inline void bw_noise_gate_do_update_coeffs_audio(
 		bw_noise_gate_coeffs * BW_RESTRICT coeffs) {
 	bw_env_follow_update_coeffs_audio(&coeffs->env_follow_coeffs);
 	bw_one_pole_process1(&coeffs->smooth_coeffs, &coeffs->smooth_thresh_state, coeffs->thresh);
-	const float rev_ratio = bw_one_pole_process1(&coeffs->smooth_coeffs, &coeffs->smooth_ratio_state, coeffs->ratio > 1e12f ? 0.f : bw_rcpf(coeffs->ratio));
-	coeffs->kc = rev_ratio < 1e-12f ? -INFINITY : 1.f - bw_rcpf(rev_ratio);
-	coeffs->lt = bw_log2f(bw_one_pole_get_y_z1(&coeffs->smooth_thresh_state));
+	const float rev_ratio = bw_one_pole_process1(&coeffs->smooth_coeffs, &coeffs->smooth_ratio_state, coeffs->ratio > 1e12f ? 0.f : bw_rcpf_ctrl(coeffs->ratio));
+	coeffs->kc = rev_ratio < 1e-12f ? -INFINITY : 1.f - bw_rcpf_ctrl(rev_ratio);
+	coeffs->lt = bw_log2f_ctrl(bw_one_pole_get_y_z1(&coeffs->smooth_thresh_state));
 }
 
 static inline void bw_noise_gate_reset_coeffs(
@@ -480,7 +486,7 @@ static inline void bw_noise_gate_reset_coeffs(
 
 	bw_env_follow_reset_coeffs(&coeffs->env_follow_coeffs);
 	bw_one_pole_reset_state(&coeffs->smooth_coeffs, &coeffs->smooth_thresh_state, coeffs->thresh);
-	bw_one_pole_reset_state(&coeffs->smooth_coeffs, &coeffs->smooth_ratio_state, coeffs->ratio > 1e12f ? 0.f : bw_rcpf(coeffs->ratio));
+	bw_one_pole_reset_state(&coeffs->smooth_coeffs, &coeffs->smooth_ratio_state, coeffs->ratio > 1e12f ? 0.f : bw_rcpf_ctrl(coeffs->ratio));
 	bw_noise_gate_do_update_coeffs_audio(coeffs);
 
 #ifdef BW_DEBUG_DEEP
@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.2 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_math bw_rand }}}
  *  description {{{
  *    Generator of white noise with uniform distribution.
@@ -31,6 +31,16 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li><code>bw_noise_gen_process()</code> and
+ *              <code>bw_noise_gen_process_multi()</code> now use
+ *              <code>bw_rand_fill()</code>.</li>
+ *          <li>Fixed <code>bw_noise_gen_process()</code> and
+ *              <code>bw_noise_gen_process_multi()</code> applying sample
+ *              rate scaling only when it was disabled.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.2</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -383,12 +393,10 @@ static inline void bw_noise_gen_process(
 	BW_ASSERT_DEEP(coeffs->state >= bw_noise_gen_coeffs_state_reset_coeffs);
 	BW_ASSERT(y != BW_NULL);
 
+	bw_rand_fill(coeffs->rand_state, y, n_samples);
 	if (coeffs->sample_rate_scaling)
 		for (size_t i = 0; i < n_samples; i++)
-			y[i] = bw_noise_gen_process1(coeffs);
-	else
-		for (size_t i = 0; i < n_samples; i++)
-			y[i] = bw_noise_gen_process1_scaling(coeffs);
+			y[i] *= coeffs->scaling_k;
 
 	BW_ASSERT_DEEP(bw_noise_gen_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_noise_gen_coeffs_state_reset_coeffs);
@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.5 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_math bw_one_pole bw_svf }}}
  *  description {{{
  *    Second-order notch filter with unitary gain at DC and asymptotically as
@@ -28,6 +28,12 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Added <code>bw_notch_set_update_interval()</code> and
+ *              <code>setUpdateInterval()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.5</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -301,6 +307,21 @@ static inline void bw_notch_set_prewarp_freq(
  *
  *    Default value: `1e3f`.
  *
+ *    #### bw_notch_set_update_interval()
+ *  ```>>> */
+static inline void bw_notch_set_update_interval(
+	bw_notch_coeffs * BW_RESTRICT coeffs,
+	size_t                        value);
+/*! <<<```
+ *    Sets the coefficient update interval to the given `value` (samples) in
+ *    `coeffs`.
+ *
+ *    See `bw_svf_set_update_interval()`.
+ *
+ *    `value` must be positive.
+ *
+ *    Default value: `1`.
+ *
  *    #### bw_notch_coeffs_is_valid()
  *  ```>>> */
 static inline char bw_notch_coeffs_is_valid(
@@ -667,6 +688,20 @@ static inline void bw_notch_set_prewarp_freq(
 	BW_ASSERT_DEEP(coeffs->state >= bw_notch_coeffs_state_init);
 }
 
+static inline void bw_notch_set_update_interval(
+		bw_notch_coeffs * BW_RESTRICT coeffs,
+		size_t                        value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_notch_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_notch_coeffs_state_init);
+	BW_ASSERT(value > 0);
+
+	bw_svf_set_update_interval(&coeffs->svf_coeffs, value);
+
+	BW_ASSERT_DEEP(bw_notch_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_notch_coeffs_state_init);
+}
+
 static inline char bw_notch_coeffs_is_valid(
 		const bw_notch_coeffs * BW_RESTRICT coeffs) {
 	BW_ASSERT(coeffs != BW_NULL);
@@ -765,6 +800,9 @@ public:
 
 	void setPrewarpFreq(
 		float value);
+
+	void setUpdateInterval(
+		size_t value);
 /*! <<<...
  *  }
  *  ```
@@ -875,6 +913,12 @@ inline void Notch<N_CHANNELS>::setPrewarpFreq(
 	bw_notch_set_prewarp_freq(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline void Notch<N_CHANNELS>::setUpdateInterval(
+		size_t value) {
+	bw_notch_set_update_interval(&coeffs, value);
+}
+
 }
 #endif
 
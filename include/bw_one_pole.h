@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_math }}}
  *  description {{{
  *    One-pole (6 dB/oct) lowpass filter with unitary DC gain, separate attack
@@ -30,6 +30,22 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li><code>bw_one_pole_process_multi()</code> now processes
+ *              channels in interleaved groups that can be vectorized by the
+ *              compiler.</li>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *          <li>Added optional denormal killing via
+ *              <code>BW_DENORMAL_KILL</code>.</li>
+ *          <li>Added <code>bw_one_pole_is_settled()</code> and corresponding
+ *              C++ API.</li>
+ *          <li><code>bw_one_pole_process()</code> and
+ *              <code>bw_one_pole_process_multi()</code> now just copy the
+ *              input to the output when the filter is settled.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Fixed typo in changelog.</li>
@@ -482,6 +498,20 @@ static inline float bw_one_pole_get_y_z1(
 /*! <<<```
  *    Returns the last output sample as stored in `state`.
  *
+ *    #### bw_one_pole_is_settled()
+ *  ```>>> */
+static inline char bw_one_pole_is_settled(
+	const bw_one_pole_coeffs * BW_RESTRICT coeffs,
+	const bw_one_pole_state * BW_RESTRICT  state,
+	float                                  x);
+/*! <<<```
+ *    Returns non-`0` if the filter whose `coeffs` and `state` are given has
+ *    reached the constant input value `x`, that is, if it would output `x`
+ *    for as long as the input stays at such value, `0` otherwise.
+ *
+ *    `bw_one_pole_process()` and `bw_one_pole_process_multi()` detect this
+ *    condition on each input buffer and, if met, just copy input to output.
+ *
  *    #### bw_one_pole_coeffs_is_valid()
  *  ```>>> */
 static inline char bw_one_pole_coeffs_is_valid(
@@ -616,10 +646,10 @@ static inline void bw_one_pole_do_update_coeffs_ctrl(
 		bw_one_pole_coeffs * BW_RESTRICT coeffs) {
 	if (coeffs->param_changed) {
 		if (coeffs->param_changed & BW_ONE_POLE_PARAM_CUTOFF_UP)
-			coeffs->mA1u = coeffs->cutoff_up > 1.591549430918953e8f ? 0.f : coeffs->fs_2pi * bw_rcpf(coeffs->fs_2pi + coeffs->cutoff_up);
+			coeffs->mA1u = coeffs->cutoff_up > 1.591549430918953e8f ? 0.f : coeffs->fs_2pi * bw_rcpf_ctrl(coeffs->fs_2pi + coeffs->cutoff_up);
 			// tau < 1 ns is instantaneous for any practical purpose
 		if (coeffs->param_changed & BW_ONE_POLE_PARAM_CUTOFF_DOWN)
-			coeffs->mA1d = coeffs->cutoff_down > 1.591549430918953e8f ? 0.f : coeffs->fs_2pi * bw_rcpf(coeffs->fs_2pi + coeffs->cutoff_down);
+			coeffs->mA1d = coeffs->cutoff_down > 1.591549430918953e8f ? 0.f : coeffs->fs_2pi * bw_rcpf_ctrl(coeffs->fs_2pi + coeffs->cutoff_down);
 			// as before
 		if (coeffs->param_changed & BW_ONE_POLE_PARAM_STICKY_THRESH)
 			coeffs->st2 = coeffs->sticky_thresh * coeffs->sticky_thresh;
@@ -732,7 +762,7 @@ static inline float bw_one_pole_process1(
 	BW_ASSERT(bw_is_finite(x));
 
 	const float y = x + coeffs->mA1u * (state->y_z1 - x);
-	state->y_z1 = y;
+	state->y_z1 = BW_KILL_DENORMAL_STATE(y);
 
 	BW_ASSERT_DEEP(bw_one_pole_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_one_pole_coeffs_state_reset_coeffs);
@@ -757,7 +787,7 @@ static inline float bw_one_pole_process1_sticky_abs(
 	const float d = y - x;
 	if (d * d <= coeffs->st2)
 		y = x;
-	state->y_z1 = y;
+	state->y_z1 = BW_KILL_DENORMAL_STATE(y);
 
 	BW_ASSERT_DEEP(bw_one_pole_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_one_pole_coeffs_state_reset_coeffs);
@@ -782,7 +812,7 @@ static inline float bw_one_pole_process1_sticky_rel(
 	const float d = y - x;
 	if (d * d <= coeffs->st2 * x * x)
 		y = x;
-	state->y_z1 = y;
+	state->y_z1 = BW_KILL_DENORMAL_STATE(y);
 
 	BW_ASSERT_DEEP(bw_one_pole_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_one_pole_coeffs_state_reset_coeffs);
@@ -804,7 +834,7 @@ static inline float bw_one_pole_process1_asym(
 	BW_ASSERT(bw_is_finite(x));
 
 	const float y = x + (x >= state->y_z1 ? coeffs->mA1u : coeffs->mA1d) * (state->y_z1 - x);
-	state->y_z1 = y;
+	state->y_z1 = BW_KILL_DENORMAL_STATE(y);
 
 	BW_ASSERT_DEEP(bw_one_pole_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_one_pole_coeffs_state_reset_coeffs);
@@ -829,7 +859,7 @@ static inline float bw_one_pole_process1_asym_sticky_abs(
 	const float d = y - x;
 	if (d * d <= coeffs->st2)
 		y = x;
-	state->y_z1 = y;
+	state->y_z1 = BW_KILL_DENORMAL_STATE(y);
 
 	BW_ASSERT_DEEP(bw_one_pole_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_one_pole_coeffs_state_reset_coeffs);
@@ -854,7 +884,7 @@ static inline float bw_one_pole_process1_asym_sticky_rel(
 	const float d = y - x;
 	if (d * d <= coeffs->st2 * x * x)
 		y = x;
-	state->y_z1 = y;
+	state->y_z1 = BW_KILL_DENORMAL_STATE(y);
 
 	BW_ASSERT_DEEP(bw_one_pole_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_one_pole_coeffs_state_reset_coeffs);
@@ -864,6 +894,16 @@ static inline float bw_one_pole_process1_asym_sticky_rel(
 	return y;
 }
 
+static inline char bw_one_pole_is_settled_buf(
+		float                     y_z1,
+		const float * BW_RESTRICT x,
+		size_t                    n_samples) {
+	char ret = 1;
+	for (size_t i = 0; i < n_samples && ret; i++)
+		ret = x[i] == y_z1;
+	return ret;
+}
+
 static inline void bw_one_pole_process(
 		bw_one_pole_coeffs * BW_RESTRICT coeffs,
 		bw_one_pole_state * BW_RESTRICT  state,
@@ -879,7 +919,14 @@ static inline void bw_one_pole_process(
 	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
 
 	bw_one_pole_update_coeffs_ctrl(coeffs);
-	if (y != BW_NULL) {
+	if (bw_one_pole_is_settled_buf(state->y_z1, x, n_samples)) {
+		// output would be equal to input sample by sample
+		if (y != BW_NULL && y != x)
+			for (size_t i = 0; i < n_samples; i++)
+				y[i] = x[i];
+		if (n_samples != 0)
+			state->y_z1 = BW_KILL_DENORMAL_STATE(x[n_samples - 1]);
+	} else if (y != BW_NULL) {
 		if (coeffs->mA1u != coeffs->mA1d) {
 			if (coeffs->st2 != 0.f) {
 				if (coeffs->sticky_mode == bw_one_pole_sticky_mode_abs)
@@ -945,6 +992,104 @@ static inline void bw_one_pole_process(
 	BW_ASSERT_DEEP(y != BW_NULL ? bw_has_only_finite(y, n_samples) : 1);
 }
 
+#define BW_ONE_POLE_LANES	8
+#define BW_ONE_POLE_BLOCK	32
+
+// x and y are lane-interleaved, i.e., x[BW_ONE_POLE_LANES * i + k] is the i-th
+// sample of the k-th lane, so that the inner loops can be vectorized
+static inline void bw_one_pole_process_lanes(
+		const bw_one_pole_coeffs * BW_RESTRICT coeffs,
+		float * BW_RESTRICT                    y_z1,
+		const float * BW_RESTRICT              x,
+		float * BW_RESTRICT                    y,
+		size_t                                 n_samples) {
+	const float mA1u = coeffs->mA1u;
+	const float mA1d = coeffs->mA1d;
+	const float st2 = coeffs->st2;
+	float z[BW_ONE_POLE_LANES];
+	for (size_t k = 0; k < BW_ONE_POLE_LANES; k++)
+		z[k] = y_z1[k];
+
+	if (mA1u != mA1d) {
+		if (st2 != 0.f) {
+			if (coeffs->sticky_mode == bw_one_pole_sticky_mode_abs)
+				for (size_t i = 0; i < n_samples; i++) {
+					const float * BW_RESTRICT xi = x + BW_ONE_POLE_LANES * i;
+					float * BW_RESTRICT yi = y + BW_ONE_POLE_LANES * i;
+					for (size_t k = 0; k < BW_ONE_POLE_LANES; k++) {
+						float v = xi[k] + (xi[k] >= z[k] ? mA1u : mA1d) * (z[k] - xi[k]);
+						const float d = v - xi[k];
+						v = d * d <= st2 ? xi[k] : v;
+						z[k] = BW_KILL_DENORMAL_STATE(v);
+						yi[k] = v;
+					}
+				}
+			else
+				for (size_t i = 0; i < n_samples; i++) {
+					const float * BW_RESTRICT xi = x + BW_ONE_POLE_LANES * i;
+					float * BW_RESTRICT yi = y + BW_ONE_POLE_LANES * i;
+					for (size_t k = 0; k < BW_ONE_POLE_LANES; k++) {
+						float v = xi[k] + (xi[k] >= z[k] ? mA1u : mA1d) * (z[k] - xi[k]);
+						const float d = v - xi[k];
+						v = d * d <= st2 * xi[k] * xi[k] ? xi[k] : v;
+						z[k] = BW_KILL_DENORMAL_STATE(v);
+						yi[k] = v;
+					}
+				}
+		} else {
+			for (size_t i = 0; i < n_samples; i++) {
+				const float * BW_RESTRICT xi = x + BW_ONE_POLE_LANES * i;
+				float * BW_RESTRICT yi = y + BW_ONE_POLE_LANES * i;
+				for (size_t k = 0; k < BW_ONE_POLE_LANES; k++) {
+					const float v = xi[k] + (xi[k] >= z[k] ? mA1u : mA1d) * (z[k] - xi[k]);
+					z[k] = BW_KILL_DENORMAL_STATE(v);
+					yi[k] = v;
+				}
+			}
+		}
+	} else {
+		if (st2 != 0.f) {
+			if (coeffs->sticky_mode == bw_one_pole_sticky_mode_abs)
+				for (size_t i = 0; i < n_samples; i++) {
+					const float * BW_RESTRICT xi = x + BW_ONE_POLE_LANES * i;
+					float * BW_RESTRICT yi = y + BW_ONE_POLE_LANES * i;
+					for (size_t k = 0; k < BW_ONE_POLE_LANES; k++) {
+						float v = xi[k] + mA1u * (z[k] - xi[k]);
+						const float d = v - xi[k];
+						v = d * d <= st2 ? xi[k] : v;
+						z[k] = BW_KILL_DENORMAL_STATE(v);
+						yi[k] = v;
+					}
+				}
+			else
+				for (size_t i = 0; i < n_samples; i++) {
+					const float * BW_RESTRICT xi = x + BW_ONE_POLE_LANES * i;
+					float * BW_RESTRICT yi = y + BW_ONE_POLE_LANES * i;
+					for (size_t k = 0; k < BW_ONE_POLE_LANES; k++) {
+						float v = xi[k] + mA1u * (z[k] - xi[k]);
+						const float d = v - xi[k];
+						v = d * d <= st2 * xi[k] * xi[k] ? xi[k] : v;
+						z[k] = BW_KILL_DENORMAL_STATE(v);
+						yi[k] = v;
+					}
+				}
+		} else {
+			for (size_t i = 0; i < n_samples; i++) {
+				const float * BW_RESTRICT xi = x + BW_ONE_POLE_LANES * i;
+				float * BW_RESTRICT yi = y + BW_ONE_POLE_LANES * i;
+				for (size_t k = 0; k < BW_ONE_POLE_LANES; k++) {
+					const float v = xi[k] + mA1u * (z[k] - xi[k]);
+					z[k] = BW_KILL_DENORMAL_STATE(v);
+					yi[k] = v;
+				}
+			}
+		}
+	}
+
+	for (size_t k = 0; k < BW_ONE_POLE_LANES; k++)
+		y_z1[k] = z[k];
+}
+
 static inline void bw_one_pole_process_multi(
 		bw_one_pole_coeffs * BW_RESTRICT                    coeffs,
 		bw_one_pole_state * BW_RESTRICT const * BW_RESTRICT state,
@@ -981,100 +1126,56 @@ static inline void bw_one_pole_process_multi(
 	}
 #endif
 
-	bw_one_pole_update_coeffs_ctrl(coeffs);
-	if (y != BW_NULL) {
-		if (coeffs->mA1u != coeffs->mA1d) {
-			if (coeffs->st2 != 0.f) {
-				if (coeffs->sticky_mode == bw_one_pole_sticky_mode_abs)
-					for (size_t j = 0; j < n_channels; j++)
-						if (y[j] != BW_NULL)
-							for (size_t i = 0; i < n_samples; i++)
-								y[j][i] = bw_one_pole_process1_asym_sticky_abs(coeffs, state[j], x[j][i]);
-						else
-							for (size_t i = 0; i < n_samples; i++)
-								bw_one_pole_process1_asym_sticky_abs(coeffs, state[j], x[j][i]);
-
-				else
-					for (size_t j = 0; j < n_channels; j++)
-						if (y[j] != BW_NULL)
-							for (size_t i = 0; i < n_samples; i++)
-								y[j][i] = bw_one_pole_process1_asym_sticky_rel(coeffs, state[j], x[j][i]);
-						else
-							for (size_t i = 0; i < n_samples; i++)
-								bw_one_pole_process1_asym_sticky_rel(coeffs, state[j], x[j][i]);
-			}
-			else {
-				for (size_t j = 0; j < n_channels; j++)
-					if (y[j] != BW_NULL)
-						for (size_t i = 0; i < n_samples; i++)
-							y[j][i] = bw_one_pole_process1_asym(coeffs, state[j], x[j][i]);
-					else
-						for (size_t i = 0; i < n_samples; i++)
-							bw_one_pole_process1_asym(coeffs, state[j], x[j][i]);
-			}
-		}
-		else {
-			if (coeffs->st2 != 0.f) {
-				if (coeffs->sticky_mode == bw_one_pole_sticky_mode_abs)
-					for (size_t j = 0; j < n_channels; j++)
-						if (y[j] != BW_NULL)
-							for (size_t i = 0; i < n_samples; i++)
-								y[j][i] = bw_one_pole_process1_sticky_abs(coeffs, state[j], x[j][i]);
-						else
-							for (size_t i = 0; i < n_samples; i++)
-								bw_one_pole_process1_sticky_abs(coeffs, state[j], x[j][i]);
-				else
-					for (size_t j = 0; j < n_channels; j++)
-						if (y[j] != BW_NULL)
-							for (size_t i = 0; i < n_samples; i++)
-								y[j][i] = bw_one_pole_process1_sticky_rel(coeffs, state[j], x[j][i]);
-						else
-							for (size_t i = 0; i < n_samples; i++)
-								bw_one_pole_process1_sticky_rel(coeffs, state[j], x[j][i]);
-			}
-			else {
-				for (size_t j = 0; j < n_channels; j++)
-					if (y[j] != BW_NULL)
-						for (size_t i = 0; i < n_samples; i++)
-							y[j][i] = bw_one_pole_process1(coeffs, state[j], x[j][i]);
-					else
+	if (n_channels == 1)
+		bw_one_pole_process(coeffs, state[0], x[0], y != BW_NULL ? y[0] : BW_NULL, n_samples);
+	else {
+		// channels are processed in groups of BW_ONE_POLE_LANES, each group
+		// being transposed in blocks of BW_ONE_POLE_BLOCK samples
+		bw_one_pole_update_coeffs_ctrl(coeffs);
+		float y_z1[BW_ONE_POLE_LANES];
+		float xb[BW_ONE_POLE_LANES * BW_ONE_POLE_BLOCK];
+		float yb[BW_ONE_POLE_LANES * BW_ONE_POLE_BLOCK];
+		for (size_t j = 0; j < n_channels; j += BW_ONE_POLE_LANES) {
+			const size_t n = n_channels - j < BW_ONE_POLE_LANES ? n_channels - j : BW_ONE_POLE_LANES;
+			char settled = 1;
+			for (size_t k = 0; k < n && settled; k++)
+				settled = bw_one_pole_is_settled_buf(state[j + k]->y_z1, x[j + k], n_samples);
+			if (settled) {
+				for (size_t k = 0; k < n; k++) {
+					if (y != BW_NULL && y[j + k] != BW_NULL && y[j + k] != x[j + k])
 						for (size_t i = 0; i < n_samples; i++)
-							bw_one_pole_process1(coeffs, state[j], x[j][i]);
-			}
-		}
-	} else {
-		if (coeffs->mA1u != coeffs->mA1d) {
-			if (coeffs->st2 != 0.f) {
-				if (coeffs->sticky_mode == bw_one_pole_sticky_mode_abs)
-					for (size_t i = 0; i < n_samples; i++)
-						for (size_t j = 0; j < n_channels; j++)
-							bw_one_pole_process1_asym_sticky_abs(coeffs, state[j], x[j][i]);
-				else
-					for (size_t i = 0; i < n_samples; i++)
-						for (size_t j = 0; j < n_channels; j++)
-							bw_one_pole_process1_asym_sticky_rel(coeffs, state[j], x[j][i]);
-			}
-			else {
-				for (size_t i = 0; i < n_samples; i++)
-					for (size_t j = 0; j < n_channels; j++)
-						bw_one_pole_process1_asym(coeffs, state[j], x[j][i]);
-			}
-		}
-		else {
-			if (coeffs->st2 != 0.f) {
-				if (coeffs->sticky_mode == bw_one_pole_sticky_mode_abs)
-					for (size_t i = 0; i < n_samples; i++)
-						for (size_t j = 0; j < n_channels; j++)
-							bw_one_pole_process1_sticky_abs(coeffs, state[j], x[j][i]);
-				else
-					for (size_t i = 0; i < n_samples; i++)
-						for (size_t j = 0; j < n_channels; j++)
-							bw_one_pole_process1_sticky_rel(coeffs, state[j], x[j][i]);
-			}
-			else {
-				for (size_t i = 0; i < n_samples; i++)
-					for (size_t j = 0; j < n_channels; j++)
-						bw_one_pole_process1(coeffs, state[j], x[j][i]);
+							y[j + k][i] = x[j + k][i];
+					if (n_samples != 0)
+						state[j + k]->y_z1 = BW_KILL_DENORMAL_STATE(x[j + k][n_samples - 1]);
+				}
+			} else {
+				for (size_t k = 0; k < n; k++)
+					y_z1[k] = state[j + k]->y_z1;
+				for (size_t k = n; k < BW_ONE_POLE_LANES; k++) {
+					y_z1[k] = 0.f;
+					for (size_t i = 0; i < BW_ONE_POLE_BLOCK; i++)
+						xb[BW_ONE_POLE_LANES * i + k] = 0.f;
+				}
+
+				for (size_t i = 0; i < n_samples; i += BW_ONE_POLE_BLOCK) {
+					const size_t m = n_samples - i < BW_ONE_POLE_BLOCK ? n_samples - i : BW_ONE_POLE_BLOCK;
+					for (size_t k = 0; k < n; k++) {
+						const float * BW_RESTRICT xk = x[j + k] + i;
+						for (size_t l = 0; l < m; l++)
+							xb[BW_ONE_POLE_LANES * l + k] = xk[l];
+					}
+					bw_one_pole_process_lanes(coeffs, y_z1, xb, yb, m);
+					if (y != BW_NULL)
+						for (size_t k = 0; k < n; k++)
+							if (y[j + k] != BW_NULL) {
+								float * BW_RESTRICT yk = y[j + k] + i;
+								for (size_t l = 0; l < m; l++)
+									yk[l] = yb[BW_ONE_POLE_LANES * l + k];
+							}
+				}
+
+				for (size_t k = 0; k < n; k++)
+					state[j + k]->y_z1 = y_z1[k];
 			}
 		}
 	}
@@ -1245,6 +1346,20 @@ static inline float bw_one_pole_get_y_z1(
 	return state->y_z1;
 }
 
+static inline char bw_one_pole_is_settled(
+		const bw_one_pole_coeffs * BW_RESTRICT coeffs,
+		const bw_one_pole_state * BW_RESTRICT  state,
+		float                                  x) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_one_pole_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_one_pole_state_is_valid(coeffs, state));
+	BW_ASSERT(bw_is_finite(x));
+
+	(void)coeffs;
+	return state->y_z1 == x;
+}
+
 static inline char bw_one_pole_coeffs_is_valid(
 		const bw_one_pole_coeffs * BW_RESTRICT coeffs) {
 	BW_ASSERT(coeffs != BW_NULL);
@@ -1305,6 +1420,8 @@ static inline char bw_one_pole_state_is_valid(
 #undef BW_ONE_POLE_PARAM_CUTOFF_UP
 #undef BW_ONE_POLE_PARAM_CUTOFF_DOWN
 #undef BW_ONE_POLE_PARAM_STICKY_THRESH
+#undef BW_ONE_POLE_LANES
+#undef BW_ONE_POLE_BLOCK
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 }
@@ -1393,6 +1510,10 @@ public:
 
 	float getYZ1(
 		size_t channel);
+
+	char isSettled(
+		size_t channel,
+		float  x);
 /*! <<<...
  *  }
  *  ```
@@ -1543,6 +1664,13 @@ inline float OnePole<N_CHANNELS>::getYZ1(
 	return bw_one_pole_get_y_z1(states + channel);
 }
 
+template<size_t N_CHANNELS>
+inline char OnePole<N_CHANNELS>::isSettled(
+		size_t channel,
+		float  x) {
+	return bw_one_pole_is_settled(&coeffs, states + channel, x);
+}
+
 }
 #endif
 
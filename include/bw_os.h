@@ -0,0 +1,951 @@
+/*
+ * Brickworks
+ *
+ * Copyright (C) 2026 Orastron Srl unipersonale
+ *
+ * Brickworks is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * Brickworks is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Brickworks.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File author: Stefano D'Angelo
+ */
+
+/*!
+ *  module_type {{{ dsp }}}
+ *  version {{{ 1.0.0 }}}
+ *  requires {{{ bw_common bw_math }}}
+ *  description {{{
+ *    Oversampling by a factor of 2, 4, 8, or 16 using cascaded polyphase
+ *    halfband FIR filters, meant to run nonlinear processing (e.g.,
+ *    `bw_clip`, `bw_satur`, `bw_dist`, `bw_drive`, `bw_fuzz`) at a higher
+ *    sample rate to reduce aliasing.
+ *
+ *    Each stage doubles (upsampling) or halves (downsampling) the sample
+ *    rate. The first stage passes frequencies up to 0.4 times the original
+ *    sample rate and has a stopband attenuation of about 95 dB; the following
+ *    stages only need to reject images and aliases of that band and are
+ *    therefore much shorter. All filters are linear-phase, so that the
+ *    overall latency is constant (see `bw_os_get_latency()`).
+ *
+ *    Since the filters are halfband, half of the polyphase components are
+ *    trivial delays, and the other half are evaluated a block at a time with
+ *    the inner loop running over output samples, which compilers can
+ *    vectorize.
+ *  }}}
+ *  changelog {{{
+ *    <ul>
+ *      <li>Version <strong>1.0.0</strong>:
+ *        <ul>
+ *          <li>First release.</li>
+ *        </ul>
+ *      </li>
+ *    </ul>
+ *  }}}
+ */
+
+#ifndef BW_OS_H
+#define BW_OS_H
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_common.h"
+#else
+# include <bw_common.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+/*** Public API ***/
+
+/*! api {{{
+ *    #### bw_os_coeffs
+ *  ```>>> */
+typedef struct bw_os_coeffs bw_os_coeffs;
+/*! <<<```
+ *    Coefficients and related.
+ *
+ *    #### bw_os_state
+ *  ```>>> */
+typedef struct bw_os_state bw_os_state;
+/*! <<<```
+ *    Internal state and related.
+ *
+ *    #### bw_os_init()
+ *  ```>>> */
+static inline void bw_os_init(
+	bw_os_coeffs * BW_RESTRICT coeffs,
+	size_t                     factor);
+/*! <<<```
+ *    Initializes `coeffs` using the given oversampling `factor`.
+ *
+ *    `factor` must be either `2`, `4`, `8`, or `16`.
+ *
+ *    #### bw_os_reset_state()
+ *  ```>>> */
+static inline void bw_os_reset_state(
+	const bw_os_coeffs * BW_RESTRICT coeffs,
+	bw_os_state * BW_RESTRICT        state,
+	float                            x_0,
+	float                            y_0);
+/*! <<<```
+ *    Resets the given `state` to its initial values using the given `coeffs`,
+ *    so that upsampling filters are in steady state with constant input `x_0`
+ *    and downsampling filters are in steady state with constant input `y_0`.
+ *
+ *    `y_0` should be the initial output value of the processing performed at
+ *    the higher sample rate (e.g., the value returned by the corresponding
+ *    `reset_state()` function), or `x_0` if there is none.
+ *
+ *    #### bw_os_reset_state_multi()
+ *  ```>>> */
+static inline void bw_os_reset_state_multi(
+	const bw_os_coeffs * BW_RESTRICT              coeffs,
+	bw_os_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float *                                 x_0,
+	const float *                                 y_0,
+	size_t                                        n_channels);
+/*! <<<```
+ *    Resets each of the `n_channels` `state`s to its initial values using the
+ *    given `coeffs` and the corresponding values in the `x_0` and `y_0`
+ *    arrays, as in `bw_os_reset_state()`.
+ *
+ *    #### bw_os_upsample()
+ *  ```>>> */
+static inline void bw_os_upsample(
+	const bw_os_coeffs * BW_RESTRICT coeffs,
+	bw_os_state * BW_RESTRICT        state,
+	const float * BW_RESTRICT        x,
+	float * BW_RESTRICT              y,
+	size_t                           n_samples);
+/*! <<<```
+ *    Upsamples the first `n_samples` of the input buffer `x` and fills the
+ *    first `factor * n_samples` of the output buffer `y` using `coeffs`, while
+ *    using and updating `state`.
+ *
+ *    #### bw_os_upsample_multi()
+ *  ```>>> */
+static inline void bw_os_upsample_multi(
+	const bw_os_coeffs * BW_RESTRICT              coeffs,
+	bw_os_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float * BW_RESTRICT const * BW_RESTRICT x,
+	float * BW_RESTRICT const * BW_RESTRICT       y,
+	size_t                                        n_channels,
+	size_t                                        n_samples);
+/*! <<<```
+ *    Upsamples the first `n_samples` of the `n_channels` input buffers `x` and
+ *    fills the first `factor * n_samples` of the `n_channels` output buffers
+ *    `y` using `coeffs`, while using and updating each of the `n_channels`
+ *    `state`s.
+ *
+ *    #### bw_os_downsample()
+ *  ```>>> */
+static inline void bw_os_downsample(
+	const bw_os_coeffs * BW_RESTRICT coeffs,
+	bw_os_state * BW_RESTRICT        state,
+	const float * BW_RESTRICT        x,
+	float * BW_RESTRICT              y,
+	size_t                           n_samples);
+/*! <<<```
+ *    Downsamples the first `factor * n_samples` of the input buffer `x` and
+ *    fills the first `n_samples` of the output buffer `y` using `coeffs`,
+ *    while using and updating `state`.
+ *
+ *    #### bw_os_downsample_multi()
+ *  ```>>> */
+static inline void bw_os_downsample_multi(
+	const bw_os_coeffs * BW_RESTRICT              coeffs,
+	bw_os_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float * BW_RESTRICT const * BW_RESTRICT x,
+	float * BW_RESTRICT const * BW_RESTRICT       y,
+	size_t                                        n_channels,
+	size_t                                        n_samples);
+/*! <<<```
+ *    Downsamples the first `factor * n_samples` of the `n_channels` input
+ *    buffers `x` and fills the first `n_samples` of the `n_channels` output
+ *    buffers `y` using `coeffs`, while using and updating each of the
+ *    `n_channels` `state`s.
+ *
+ *    #### bw_os_process()
+ *  ```>>> */
+static inline void bw_os_process(
+	const bw_os_coeffs * BW_RESTRICT coeffs,
+	bw_os_state * BW_RESTRICT        state,
+	const float *                    x,
+	float *                          y,
+	size_t                           n_samples,
+	float                         (* process1)(void *data, float x),
+	void *                           data);
+/*! <<<```
+ *    Processes the first `n_samples` of the input buffer `x` and fills the
+ *    first `n_samples` of the output buffer `y` by upsampling, calling
+ *    `process1` once for each oversampled sample (passing `data` and the input
+ *    sample and expecting the output sample to be returned), and downsampling,
+ *    using `coeffs`, while using and updating `state`.
+ *
+ *    Processing happens in blocks of at most 32 input samples.
+ *
+ *    `x` and `y` may coincide.
+ *
+ *    #### bw_os_process_multi()
+ *  ```>>> */
+static inline void bw_os_process_multi(
+	const bw_os_coeffs * BW_RESTRICT              coeffs,
+	bw_os_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float * const *                         x,
+	float * const *                               y,
+	size_t                                        n_channels,
+	size_t                                        n_samples,
+	float                                      (* process1)(void *data, float x),
+	void * const *                                data);
+/*! <<<```
+ *    Processes the first `n_samples` of the `n_channels` input buffers `x` and
+ *    fills the first `n_samples` of the `n_channels` output buffers `y` as in
+ *    `bw_os_process()`, passing the corresponding element of the `data` array
+ *    to `process1` for each channel, using `coeffs`, while using and updating
+ *    each of the `n_channels` `state`s.
+ *
+ *    #### bw_os_get_latency()
+ *  ```>>> */
+static inline float bw_os_get_latency(
+	const bw_os_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the latency, in samples at the original sample rate, introduced
+ *    by upsampling followed by downsampling. It is not necessarily an integer
+ *    number.
+ *
+ *    #### bw_os_coeffs_is_valid()
+ *  ```>>> */
+static inline char bw_os_coeffs_is_valid(
+	const bw_os_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Tries to determine whether `coeffs` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    `coeffs` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_os_coeffs`.
+ *
+ *    #### bw_os_state_is_valid()
+ *  ```>>> */
+static inline char bw_os_state_is_valid(
+	const bw_os_coeffs * BW_RESTRICT coeffs,
+	const bw_os_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Tries to determine whether `state` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    If `coeffs` is not `BW_NULL` extra cross-checks might be performed
+ *    (`state` is supposed to be associated to `coeffs`).
+ *
+ *    `state` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_os_state`.
+ *  }}} */
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_math.h"
+#else
+# include <bw_math.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+#define BW_OS_N_STAGES_MAX	4
+#define BW_OS_TAPS_MAX		32	// 2 * number of distinct coefficients of first stage
+#define BW_OS_Z_LEN		(BW_OS_TAPS_MAX - 1)
+#define BW_OS_BLOCK		32	// at original sample rate
+
+struct bw_os_coeffs {
+#ifdef BW_DEBUG_DEEP
+	uint32_t	hash;
+	uint32_t	reset_id;
+#endif
+
+	// Coefficients
+	size_t		factor;
+	size_t		n_stages;
+	size_t		n_taps[BW_OS_N_STAGES_MAX];
+	// nonzero taps of the odd polyphase component, in full (symmetric)
+	// form, so that they can be read sequentially
+	float		taps_up[BW_OS_N_STAGES_MAX][BW_OS_TAPS_MAX];
+	float		taps_down[BW_OS_N_STAGES_MAX][BW_OS_TAPS_MAX];
+};
+
+struct bw_os_state {
+#ifdef BW_DEBUG_DEEP
+	uint32_t	hash;
+	uint32_t	coeffs_reset_id;
+#endif
+
+	// States
+	float		up_z[BW_OS_N_STAGES_MAX][BW_OS_Z_LEN];
+	float		down_even_z[BW_OS_N_STAGES_MAX][BW_OS_Z_LEN];
+	float		down_odd_z[BW_OS_N_STAGES_MAX][BW_OS_Z_LEN];
+};
+
+static inline void bw_os_init(
+		bw_os_coeffs * BW_RESTRICT coeffs,
+		size_t                     factor) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT(factor == 2 || factor == 4 || factor == 8 || factor == 16);
+
+	// Kaiser-windowed halfband lowpass filters of length 4 * K - 1, with
+	// only the K distinct nonzero coefficients of the odd polyphase
+	// component given here, normalized for unity DC gain, and designed for
+	// passband edge 0.4 / 2^(stage + 1) and stopband edge
+	// 0.5 - 0.4 / 2^(stage + 1), relative to the higher sample rate
+	static const size_t k[BW_OS_N_STAGES_MAX] = { 16, 6, 5, 4 };
+	static const float a[BW_OS_N_STAGES_MAX][BW_OS_TAPS_MAX / 2] = {
+		{ 3.168031499e-01f, -1.016621020e-01f, 5.650604955e-02f, -3.594503412e-02f,
+		  2.390076889e-02f, -1.601410441e-02f, 1.059849148e-02f, -6.834486323e-03f,
+		  4.245261107e-03f, -2.510728201e-03f, 1.394524311e-03f, -7.140213142e-04f,
+		  3.275194372e-04f, -1.278561181e-04f, 3.777036910e-05f, -5.202609236e-06f },
+		{ 3.054193277e-01f, -7.269175336e-02f, 2.144931133e-02f, -4.713801131e-03f,
+		  5.433070647e-04f, -6.391583170e-06f },
+		{ 2.978357239e-01f, -5.746649559e-02f, 1.051198254e-02f, -8.850337173e-04f,
+		  3.822921193e-06f },
+		{ 2.959661209e-01f, -5.359949732e-02f, 7.784325050e-03f, -1.509486434e-04f }
+	};
+
+	coeffs->factor = factor;
+	coeffs->n_stages = factor == 2 ? 1 : (factor == 4 ? 2 : (factor == 8 ? 3 : 4));
+	for (size_t i = 0; i < BW_OS_N_STAGES_MAX; i++) {
+		coeffs->n_taps[i] = 2 * k[i];
+		for (size_t j = 0; j < BW_OS_TAPS_MAX; j++) {
+			coeffs->taps_up[i][j] = 0.f;
+			coeffs->taps_down[i][j] = 0.f;
+		}
+		for (size_t j = 0; j < k[i]; j++) {
+			coeffs->taps_down[i][k[i] - 1 - j] = a[i][j];
+			coeffs->taps_down[i][k[i] + j] = a[i][j];
+			coeffs->taps_up[i][k[i] - 1 - j] = 2.f * a[i][j];
+			coeffs->taps_up[i][k[i] + j] = 2.f * a[i][j];
+		}
+	}
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->hash = bw_hash_sdbm("bw_os_coeffs");
+	coeffs->reset_id = coeffs->hash + 1;
+#endif
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+}
+
+static inline void bw_os_reset_state(
+		const bw_os_coeffs * BW_RESTRICT coeffs,
+		bw_os_state * BW_RESTRICT        state,
+		float                            x_0,
+		float                            y_0) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT(bw_is_finite(x_0));
+	BW_ASSERT(bw_is_finite(y_0));
+
+	(void)coeffs;
+	for (size_t i = 0; i < BW_OS_N_STAGES_MAX; i++) {
+		for (size_t j = 0; j < BW_OS_Z_LEN; j++) {
+			state->up_z[i][j] = x_0;
+			state->down_even_z[i][j] = y_0;
+			state->down_odd_z[i][j] = y_0;
+		}
+	}
+
+#ifdef BW_DEBUG_DEEP
+	state->hash = bw_hash_sdbm("bw_os_state");
+	state->coeffs_reset_id = coeffs->reset_id;
+#endif
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(bw_os_state_is_valid(coeffs, state));
+}
+
+static inline void bw_os_reset_state_multi(
+		const bw_os_coeffs * BW_RESTRICT              coeffs,
+		bw_os_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float *                                 x_0,
+		const float *                                 y_0,
+		size_t                                        n_channels) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x_0 != BW_NULL);
+	BW_ASSERT(y_0 != BW_NULL);
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_os_reset_state(coeffs, state[i], x_0[i], y_0[i]);
+
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+}
+
+// Histories are always BW_OS_Z_LEN samples long, the filters of the later
+// stages just skip the oldest ones.
+
+// n_samples <= BW_OS_BLOCK * 2^stage input samples -> 2 * n_samples output
+// samples
+static inline void bw_os_upsample_stage(
+		const bw_os_coeffs * BW_RESTRICT coeffs,
+		bw_os_state * BW_RESTRICT        state,
+		size_t                           stage,
+		const float * BW_RESTRICT        x,
+		float * BW_RESTRICT              y,
+		size_t                           n_samples) {
+	const size_t n_taps = coeffs->n_taps[stage];
+	const float * BW_RESTRICT taps = coeffs->taps_up[stage];
+	float * BW_RESTRICT z = state->up_z[stage];
+	float buf[BW_OS_Z_LEN + (BW_OS_BLOCK << (BW_OS_N_STAGES_MAX - 1))];
+
+	for (size_t i = 0; i < BW_OS_Z_LEN; i++)
+		buf[i] = z[i];
+	for (size_t i = 0; i < n_samples; i++)
+		buf[BW_OS_Z_LEN + i] = x[i];
+
+	const float * BW_RESTRICT b = buf + BW_OS_TAPS_MAX - n_taps;
+	float acc[BW_OS_BLOCK << (BW_OS_N_STAGES_MAX - 1)];
+	for (size_t i = 0; i < n_samples; i++)
+		acc[i] = taps[0] * b[i];
+	for (size_t j = 1; j < n_taps; j++)
+		for (size_t i = 0; i < n_samples; i++)
+			acc[i] += taps[j] * b[i + j];
+	// the other polyphase component is a pure delay of half the filter
+	// order
+	for (size_t i = 0; i < n_samples; i++) {
+		y[i << 1] = acc[i];
+		y[(i << 1) + 1] = b[i + (n_taps >> 1)];
+	}
+
+	for (size_t i = 0; i < BW_OS_Z_LEN; i++)
+		z[i] = buf[n_samples + i];
+}
+
+// 2 * n_samples <= BW_OS_BLOCK * 2^(stage + 1) input samples -> n_samples
+// output samples
+static inline void bw_os_downsample_stage(
+		const bw_os_coeffs * BW_RESTRICT coeffs,
+		bw_os_state * BW_RESTRICT        state,
+		size_t                           stage,
+		const float * BW_RESTRICT        x,
+		float * BW_RESTRICT              y,
+		size_t                           n_samples) {
+	const size_t n_taps = coeffs->n_taps[stage];
+	const float * BW_RESTRICT taps = coeffs->taps_down[stage];
+	float * BW_RESTRICT ze = state->down_even_z[stage];
+	float * BW_RESTRICT zo = state->down_odd_z[stage];
+	float buf_e[BW_OS_Z_LEN + (BW_OS_BLOCK << (BW_OS_N_STAGES_MAX - 1))];
+	float buf_o[BW_OS_Z_LEN + (BW_OS_BLOCK << (BW_OS_N_STAGES_MAX - 1))];
+
+	for (size_t i = 0; i < BW_OS_Z_LEN; i++) {
+		buf_e[i] = ze[i];
+		buf_o[i] = zo[i];
+	}
+	for (size_t i = 0; i < n_samples; i++) {
+		buf_e[BW_OS_Z_LEN + i] = x[i << 1];
+		buf_o[BW_OS_Z_LEN + i] = x[(i << 1) + 1];
+	}
+
+	const float * BW_RESTRICT be = buf_e + BW_OS_TAPS_MAX - n_taps;
+	const float * BW_RESTRICT bo = buf_o + BW_OS_Z_LEN - (n_taps >> 1);
+	float acc[BW_OS_BLOCK << (BW_OS_N_STAGES_MAX - 1)];
+	for (size_t i = 0; i < n_samples; i++)
+		acc[i] = 0.5f * bo[i];
+	for (size_t j = 0; j < n_taps; j++)
+		for (size_t i = 0; i < n_samples; i++)
+			acc[i] += taps[j] * be[i + j];
+	for (size_t i = 0; i < n_samples; i++)
+		y[i] = acc[i];
+
+	for (size_t i = 0; i < BW_OS_Z_LEN; i++) {
+		ze[i] = buf_e[n_samples + i];
+		zo[i] = buf_o[n_samples + i];
+	}
+}
+
+// n_samples <= BW_OS_BLOCK, y has room for factor * BW_OS_BLOCK samples
+static inline void bw_os_upsample_block(
+		const bw_os_coeffs * BW_RESTRICT coeffs,
+		bw_os_state * BW_RESTRICT        state,
+		const float * BW_RESTRICT        x,
+		float * BW_RESTRICT              y,
+		size_t                           n_samples) {
+	float buf[BW_OS_BLOCK << (BW_OS_N_STAGES_MAX - 1)];
+	// ping-pong between buf and y so that the last stage writes to y
+	const float *src = x;
+	size_t n = n_samples;
+	for (size_t i = 0; i < coeffs->n_stages; i++) {
+		float *dest = (coeffs->n_stages - i) & 1 ? y : buf;
+		bw_os_upsample_stage(coeffs, state, i, src, dest, n);
+		src = dest;
+		n <<= 1;
+	}
+}
+
+// n_samples <= BW_OS_BLOCK output samples, x is overwritten
+static inline void bw_os_downsample_block(
+		const bw_os_coeffs * BW_RESTRICT coeffs,
+		bw_os_state * BW_RESTRICT        state,
+		float * BW_RESTRICT              x,
+		float * BW_RESTRICT              y,
+		size_t                           n_samples) {
+	float buf[BW_OS_BLOCK << (BW_OS_N_STAGES_MAX - 1)];
+	float *src = x;
+	size_t n = n_samples << (coeffs->n_stages - 1);
+	for (size_t i = coeffs->n_stages - 1; ; i--) {
+		float *dest = i == 0 ? y : (src == x ? buf : x);
+		bw_os_downsample_stage(coeffs, state, i, src, dest, n);
+		if (i == 0)
+			break;
+		src = dest;
+		n >>= 1;
+	}
+}
+
+static inline void bw_os_upsample(
+		const bw_os_coeffs * BW_RESTRICT coeffs,
+		bw_os_state * BW_RESTRICT        state,
+		const float * BW_RESTRICT        x,
+		float * BW_RESTRICT              y,
+		size_t                           n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_state_is_valid(coeffs, state));
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
+	BW_ASSERT(y != BW_NULL);
+
+	float buf[BW_OS_BLOCK << BW_OS_N_STAGES_MAX];
+	for (size_t i = 0; i < n_samples; i += BW_OS_BLOCK) {
+		const size_t n = n_samples - i < BW_OS_BLOCK ? n_samples - i : BW_OS_BLOCK;
+		bw_os_upsample_block(coeffs, state, x + i, buf, n);
+		for (size_t j = 0; j < coeffs->factor * n; j++)
+			y[coeffs->factor * i + j] = buf[j];
+	}
+
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(bw_os_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(bw_has_only_finite(y, coeffs->factor * n_samples));
+}
+
+static inline void bw_os_upsample_multi(
+		const bw_os_coeffs * BW_RESTRICT              coeffs,
+		bw_os_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float * BW_RESTRICT const * BW_RESTRICT x,
+		float * BW_RESTRICT const * BW_RESTRICT       y,
+		size_t                                        n_channels,
+		size_t                                        n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_os_upsample(coeffs, state[i], x[i], y[i], n_samples);
+
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+}
+
+static inline void bw_os_downsample(
+		const bw_os_coeffs * BW_RESTRICT coeffs,
+		bw_os_state * BW_RESTRICT        state,
+		const float * BW_RESTRICT        x,
+		float * BW_RESTRICT              y,
+		size_t                           n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_state_is_valid(coeffs, state));
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, coeffs->factor * n_samples));
+	BW_ASSERT(y != BW_NULL);
+
+	float buf[BW_OS_BLOCK << BW_OS_N_STAGES_MAX];
+	for (size_t i = 0; i < n_samples; i += BW_OS_BLOCK) {
+		const size_t n = n_samples - i < BW_OS_BLOCK ? n_samples - i : BW_OS_BLOCK;
+		for (size_t j = 0; j < coeffs->factor * n; j++)
+			buf[j] = x[coeffs->factor * i + j];
+		bw_os_downsample_block(coeffs, state, buf, y + i, n);
+	}
+
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(bw_os_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_samples));
+}
+
+static inline void bw_os_downsample_multi(
+		const bw_os_coeffs * BW_RESTRICT              coeffs,
+		bw_os_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float * BW_RESTRICT const * BW_RESTRICT x,
+		float * BW_RESTRICT const * BW_RESTRICT       y,
+		size_t                                        n_channels,
+		size_t                                        n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_os_downsample(coeffs, state[i], x[i], y[i], n_samples);
+
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+}
+
+static inline void bw_os_process(
+		const bw_os_coeffs * BW_RESTRICT coeffs,
+		bw_os_state * BW_RESTRICT        state,
+		const float *                    x,
+		float *                          y,
+		size_t                           n_samples,
+		float                         (* process1)(void *data, float x),
+		void *                           data) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_state_is_valid(coeffs, state));
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
+	BW_ASSERT(y != BW_NULL);
+	BW_ASSERT(process1 != BW_NULL);
+
+	float buf[BW_OS_BLOCK << BW_OS_N_STAGES_MAX];
+	for (size_t i = 0; i < n_samples; i += BW_OS_BLOCK) {
+		const size_t n = n_samples - i < BW_OS_BLOCK ? n_samples - i : BW_OS_BLOCK;
+		bw_os_upsample_block(coeffs, state, x + i, buf, n);
+		for (size_t j = 0; j < coeffs->factor * n; j++)
+			buf[j] = process1(data, buf[j]);
+		bw_os_downsample_block(coeffs, state, buf, y + i, n);
+	}
+
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(bw_os_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_samples));
+}
+
+static inline void bw_os_process_multi(
+		const bw_os_coeffs * BW_RESTRICT              coeffs,
+		bw_os_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float * const *                         x,
+		float * const *                               y,
+		size_t                                        n_channels,
+		size_t                                        n_samples,
+		float                                      (* process1)(void *data, float x),
+		void * const *                                data) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(y != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(y[i] != y[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels; j++)
+			BW_ASSERT(i == j || x[i] != y[j]);
+#endif
+	BW_ASSERT(process1 != BW_NULL);
+	BW_ASSERT(data != BW_NULL);
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_os_process(coeffs, state[i], x[i], y[i], n_samples, process1, data[i]);
+
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+}
+
+static inline float bw_os_get_latency(
+		const bw_os_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_os_coeffs_is_valid(coeffs));
+
+	// each stage delays by half the filter order at the higher sample rate
+	// both when upsampling and downsampling
+	float l = 0.f;
+	for (size_t i = 0; i < coeffs->n_stages; i++)
+		l += (float)(coeffs->n_taps[i] - 1) / (float)((size_t)1 << i);
+	return l;
+}
+
+static inline char bw_os_coeffs_is_valid(
+		const bw_os_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->hash != bw_hash_sdbm("bw_os_coeffs"))
+		return 0;
+#endif
+
+	if (coeffs->factor != 2 && coeffs->factor != 4 && coeffs->factor != 8 && coeffs->factor != 16)
+		return 0;
+	if (((size_t)1 << coeffs->n_stages) != coeffs->factor)
+		return 0;
+	for (size_t i = 0; i < BW_OS_N_STAGES_MAX; i++)
+		if (coeffs->n_taps[i] < 2 || coeffs->n_taps[i] > BW_OS_TAPS_MAX || (coeffs->n_taps[i] & 1) != 0)
+			return 0;
+
+	return 1;
+}
+
+static inline char bw_os_state_is_valid(
+		const bw_os_coeffs * BW_RESTRICT coeffs,
+		const bw_os_state * BW_RESTRICT  state) {
+	BW_ASSERT(state != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (state->hash != bw_hash_sdbm("bw_os_state"))
+		return 0;
+
+	if (coeffs != BW_NULL && coeffs->reset_id != state->coeffs_reset_id)
+		return 0;
+#endif
+
+	(void)coeffs;
+
+	for (size_t i = 0; i < BW_OS_N_STAGES_MAX; i++) {
+		if (!bw_has_only_finite(state->up_z[i], BW_OS_Z_LEN))
+			return 0;
+		if (!bw_has_only_finite(state->down_even_z[i], BW_OS_Z_LEN))
+			return 0;
+		if (!bw_has_only_finite(state->down_odd_z[i], BW_OS_Z_LEN))
+			return 0;
+	}
+
+	return 1;
+}
+
+#undef BW_OS_N_STAGES_MAX
+#undef BW_OS_TAPS_MAX
+#undef BW_OS_Z_LEN
+#undef BW_OS_BLOCK
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+#if !defined(BW_NO_CXX) && defined(__cplusplus)
+
+# ifndef BW_CXX_NO_ARRAY
+#  include <array>
+# endif
+
+namespace Brickworks {
+
+/*** Public C++ API ***/
+
+/*! api_cpp {{{
+ *    ##### Brickworks::OS
+ *  ```>>> */
+template<size_t N_CHANNELS = 1>
+class OS {
+public:
+	OS(
+		size_t factor = 2);
+
+	void reset(
+		float x0 = 0.f,
+		float y0 = 0.f);
+
+	void reset(
+		const float * x0,
+		const float * y0);
+
+# ifndef BW_CXX_NO_ARRAY
+	void reset(
+		std::array<float, N_CHANNELS> x0,
+		std::array<float, N_CHANNELS> y0);
+# endif
+
+	void upsample(
+		const float * BW_RESTRICT const * BW_RESTRICT x,
+		float * BW_RESTRICT const * BW_RESTRICT       y,
+		size_t                                        nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+	void upsample(
+		std::array<const float * BW_RESTRICT, N_CHANNELS> x,
+		std::array<float * BW_RESTRICT, N_CHANNELS>       y,
+		size_t                                            nSamples);
+# endif
+
+	void downsample(
+		const float * BW_RESTRICT const * BW_RESTRICT x,
+		float * BW_RESTRICT const * BW_RESTRICT       y,
+		size_t                                        nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+	void downsample(
+		std::array<const float * BW_RESTRICT, N_CHANNELS> x,
+		std::array<float * BW_RESTRICT, N_CHANNELS>       y,
+		size_t                                            nSamples);
+# endif
+
+	void process(
+		const float * const * x,
+		float * const *       y,
+		size_t                nSamples,
+		float              (* process1)(void *data, float x),
+		void * const *        data);
+
+# ifndef BW_CXX_NO_ARRAY
+	void process(
+		std::array<const float *, N_CHANNELS> x,
+		std::array<float *, N_CHANNELS>       y,
+		size_t                                nSamples,
+		float                              (* process1)(void *data, float x),
+		std::array<void *, N_CHANNELS>        data);
+# endif
+
+	float getLatency();
+/*! <<<...
+ *  }
+ *  ```
+ *  }}} */
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+private:
+	bw_os_coeffs			coeffs;
+	bw_os_state			states[N_CHANNELS];
+	bw_os_state * BW_RESTRICT	statesP[N_CHANNELS];
+};
+
+template<size_t N_CHANNELS>
+inline OS<N_CHANNELS>::OS(
+		size_t factor) {
+	bw_os_init(&coeffs, factor);
+	for (size_t i = 0; i < N_CHANNELS; i++)
+		statesP[i] = states + i;
+}
+
+template<size_t N_CHANNELS>
+inline void OS<N_CHANNELS>::reset(
+		float x0,
+		float y0) {
+	for (size_t i = 0; i < N_CHANNELS; i++)
+		bw_os_reset_state(&coeffs, states + i, x0, y0);
+}
+
+template<size_t N_CHANNELS>
+inline void OS<N_CHANNELS>::reset(
+		const float * x0,
+		const float * y0) {
+	bw_os_reset_state_multi(&coeffs, statesP, x0, y0, N_CHANNELS);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void OS<N_CHANNELS>::reset(
+		std::array<float, N_CHANNELS> x0,
+		std::array<float, N_CHANNELS> y0) {
+	reset(x0.data(), y0.data());
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void OS<N_CHANNELS>::upsample(
+		const float * BW_RESTRICT const * BW_RESTRICT x,
+		float * BW_RESTRICT const * BW_RESTRICT       y,
+		size_t                                        nSamples) {
+	bw_os_upsample_multi(&coeffs, statesP, x, y, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void OS<N_CHANNELS>::upsample(
+		std::array<const float * BW_RESTRICT, N_CHANNELS> x,
+		std::array<float * BW_RESTRICT, N_CHANNELS>       y,
+		size_t                                            nSamples) {
+	upsample(x.data(), y.data(), nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void OS<N_CHANNELS>::downsample(
+		const float * BW_RESTRICT const * BW_RESTRICT x,
+		float * BW_RESTRICT const * BW_RESTRICT       y,
+		size_t                                        nSamples) {
+	bw_os_downsample_multi(&coeffs, statesP, x, y, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void OS<N_CHANNELS>::downsample(
+		std::array<const float * BW_RESTRICT, N_CHANNELS> x,
+		std::array<float * BW_RESTRICT, N_CHANNELS>       y,
+		size_t                                            nSamples) {
+	downsample(x.data(), y.data(), nSamples);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void OS<N_CHANNELS>::process(
+		const float * const * x,
+		float * const *       y,
+		size_t                nSamples,
+		float              (* process1)(void *data, float x),
+		void * const *        data) {
+	bw_os_process_multi(&coeffs, statesP, x, y, N_CHANNELS, nSamples, process1, data);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void OS<N_CHANNELS>::process(
+		std::array<const float *, N_CHANNELS> x,
+		std::array<float *, N_CHANNELS>       y,
+		size_t                                nSamples,
+		float                              (* process1)(void *data, float x),
+		std::array<void *, N_CHANNELS>        data) {
+	process(x.data(), y.data(), nSamples, process1, data.data());
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline float OS<N_CHANNELS>::getLatency() {
+	return bw_os_get_latency(&coeffs);
+}
+
+}
+#endif
+
+#endif
@@ -20,16 +20,31 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.3 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_math }}}
  *  description {{{
  *    Sinusoidal oscillator waveshaper.
  * 
  *    It turns a normalized phase signal, such as that geneated by
  *    [bw\_phase\_gen](bw_phase_gen), into a sinusoidal wave.
+ *
+ *    Besides the stateless phase-based functions, it offers a recursive mode
+ *    that, as long as the phase increment stays constant, computes the output
+ *    using a "magic circle" rotation recurrence (two multiply-adds per sample),
+ *    which is resynchronized to the input phase every 256 samples, and
+ *    otherwise falls back to phase-based computation.
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Added recursive mode (<code>bw_osc_sin_state</code>,
+ *              <code>bw_osc_sin_reset_state*()</code>,
+ *              <code>bw_osc_sin_process*_rec*()</code>, and
+ *              <code>bw_osc_sin_state_is_valid()</code>) and corresponding
+ *              C++ API.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.3</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -155,6 +170,119 @@ static inline void bw_osc_sin_process_multi(
  *    of the `n_channels` output buffers `y`.
  *
  *    All samples in `x` must be in [`0.f`, `1.f`).
+ *
+ *    #### bw_osc_sin_state
+ *  ```>>> */
+typedef struct bw_osc_sin_state bw_osc_sin_state;
+/*! <<<```
+ *    Internal state and related, only used in recursive mode.
+ *
+ *    #### bw_osc_sin_reset_state()
+ *  ```>>> */
+static inline float bw_osc_sin_reset_state(
+	bw_osc_sin_state * BW_RESTRICT state,
+	float                          x_0,
+	float                          x_inc_0);
+/*! <<<```
+ *    Resets the given `state` to its initial values assuming the given initial
+ *    normalized phase `x_0` and phase increment `x_inc_0`.
+ *
+ *    Returns the corresponding initial output value.
+ *
+ *    `x_0` must be in [`0.f`, `1.f`).
+ *
+ *    `x_inc_0` must be in [`-0.5f`, `0.5f`].
+ *
+ *    #### bw_osc_sin_reset_state_multi()
+ *  ```>>> */
+static inline void bw_osc_sin_reset_state_multi(
+	bw_osc_sin_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float *                                      x_0,
+	const float *                                      x_inc_0,
+	float *                                            y_0,
+	size_t                                             n_channels);
+/*! <<<```
+ *    Resets each of the `n_channels` `state`s to its initial values assuming
+ *    the corresponding initial normalized phase in `x_0` and phase increment
+ *    in `x_inc_0`.
+ *
+ *    The corresponding initial output values are written into the `y_0` array,
+ *    if not `BW_NULL`.
+ *
+ *    All values in `x_0` must be in [`0.f`, `1.f`).
+ *
+ *    All values in `x_inc_0` must be in [`-0.5f`, `0.5f`].
+ *
+ *    #### bw_osc_sin_process1_rec()
+ *  ```>>> */
+static inline float bw_osc_sin_process1_rec(
+	bw_osc_sin_state * BW_RESTRICT state,
+	float                          x,
+	float                          x_inc);
+/*! <<<```
+ *    Processes one input sample `x`, representing the normalized phase, with
+ *    the corresponding phase increment value `x_inc`, while using and updating
+ *    `state`. Returns the corresponding output sample.
+ *
+ *    If `x_inc` is equal to the value it had at the previous call (or at
+ *    reset), the output is computed by rotation, otherwise it is computed from
+ *    `x` like `bw_osc_sin_process1()` does. This means that audio-rate
+ *    frequency modulation is supported, yet it makes this function slightly
+ *    more expensive than `bw_osc_sin_process1()`.
+ *
+ *    `x` must be in [`0.f`, `1.f`).
+ *
+ *    `x_inc` must be in [`-0.5f`, `0.5f`].
+ *
+ *    #### bw_osc_sin_process_rec()
+ *  ```>>> */
+static inline void bw_osc_sin_process_rec(
+	bw_osc_sin_state * BW_RESTRICT state,
+	const float *                  x,
+	const float *                  x_inc,
+	float *                        y,
+	size_t                         n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the input buffer `x`, containing the
+ *    normalized phase signal, and of the input buffer `x_inc`, containing the
+ *    phase increment values, and fills the first `n_samples` of the output
+ *    buffer `y`, while using and updating `state`.
+ *
+ *    All samples in `x` must be in [`0.f`, `1.f`).
+ *
+ *    All samples in `x_inc` must be in [`-0.5f`, `0.5f`].
+ *
+ *    #### bw_osc_sin_process_rec_multi()
+ *  ```>>> */
+static inline void bw_osc_sin_process_rec_multi(
+	bw_osc_sin_state * BW_RESTRICT const * BW_RESTRICT state,
+	const float * const *                              x,
+	const float * const *                              x_inc,
+	float * const *                                    y,
+	size_t                                             n_channels,
+	size_t                                             n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the `n_channels` input buffers `x`,
+ *    containing the normalized phase signals, and of the `n_channels` input
+ *    buffers `x_inc`, containing the phase increment values, and fills the
+ *    first `n_samples` of the `n_channels` output buffers `y`, while using and
+ *    updating each of the `n_channels` `state`s.
+ *
+ *    All samples in `x` must be in [`0.f`, `1.f`).
+ *
+ *    All samples in `x_inc` must be in [`-0.5f`, `0.5f`].
+ *
+ *    #### bw_osc_sin_state_is_valid()
+ *  ```>>> */
+static inline char bw_osc_sin_state_is_valid(
+	const bw_osc_sin_state * BW_RESTRICT state);
+/*! <<<```
+ *    Tries to determine whether `state` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    `state` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_osc_sin_state`.
  *  }}} */
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
@@ -222,6 +350,199 @@ static inline void bw_osc_sin_process_multi(
 		bw_osc_sin_process(x[i], y[i], n_samples);
 }
 
+#define BW_OSC_SIN_SYNC_PERIOD	256
+
+struct bw_osc_sin_state {
+#ifdef BW_DEBUG_DEEP
+	uint32_t	hash;
+#endif
+
+	// Coefficients
+	float		e;
+
+	// States
+	float		s;
+	float		c;
+	float		x_inc_z1;
+	size_t		sync_count;
+};
+
+// Magic circle recurrence: if s = sin(t) and c = cos(t + w / 2), then
+//   s += e * c, c -= e * s
+// with e = 2 * sin(w / 2) gives s = sin(t + w) and c = cos(t + w + w / 2).
+//
+// Rounding errors slowly change both amplitude and phase, and phase_gen
+// accumulates phase in a slightly different way, hence state is periodically
+// recomputed from the input phase with high accuracy.
+
+// sin(x) with |x| <= pi / 2, error < 1e-8
+static inline float bw_osc_sin_sin_small(
+		float x) {
+	const float x2 = x * x;
+	return x * (1.f - 0.16666666666666666f * x2 * (1.f - 0.05f * x2 * (1.f - 0.023809523809523808f * x2 * (1.f - 0.013888888888888888f * x2 * (1.f - 0.00909090909090909f * x2)))));
+}
+
+// sin(2 * pi * x), error < 1e-6
+static inline float bw_osc_sin_sin2pi_acc(
+		float x) {
+	float u = x - bw_floorf(x + 0.5f); // [-0.5f, 0.5f)
+	if (u > 0.25f)
+		u = 0.5f - u;
+	else if (u < -0.25f)
+		u = -0.5f - u;
+	return bw_osc_sin_sin_small(6.283185307179586f * u);
+}
+
+static inline float bw_osc_sin_sync(
+		bw_osc_sin_state * BW_RESTRICT state,
+		float                          x,
+		float                          x_inc) {
+	state->e = 2.f * bw_osc_sin_sin_small(3.141592653589793f * x_inc);
+	state->s = bw_osc_sin_sin2pi_acc(x);
+	state->c = bw_osc_sin_sin2pi_acc(x + 0.5f * x_inc + 0.25f);
+	state->sync_count = BW_OSC_SIN_SYNC_PERIOD;
+	return bw_clipf(state->s, -1.f, 1.f);
+}
+
+static inline float bw_osc_sin_reset_state(
+		bw_osc_sin_state * BW_RESTRICT state,
+		float                          x_0,
+		float                          x_inc_0) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT(bw_is_finite(x_0));
+	BW_ASSERT(x_0 >= 0.f && x_0 < 1.f);
+	BW_ASSERT(bw_is_finite(x_inc_0));
+	BW_ASSERT(x_inc_0 >= -0.5f && x_inc_0 <= 0.5f);
+
+	state->x_inc_z1 = x_inc_0;
+	const float y = bw_osc_sin_sync(state, x_0, x_inc_0);
+
+#ifdef BW_DEBUG_DEEP
+	state->hash = bw_hash_sdbm("bw_osc_sin_state");
+#endif
+	BW_ASSERT_DEEP(bw_osc_sin_state_is_valid(state));
+	BW_ASSERT(bw_is_finite(y));
+
+	return y;
+}
+
+static inline void bw_osc_sin_reset_state_multi(
+		bw_osc_sin_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float *                                      x_0,
+		const float *                                      x_inc_0,
+		float *                                            y_0,
+		size_t                                             n_channels) {
+	BW_ASSERT(state != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j]);
+#endif
+	BW_ASSERT(x_0 != BW_NULL);
+	BW_ASSERT(x_inc_0 != BW_NULL);
+
+	if (y_0 != BW_NULL)
+		for (size_t i = 0; i < n_channels; i++)
+			y_0[i] = bw_osc_sin_reset_state(state[i], x_0[i], x_inc_0[i]);
+	else
+		for (size_t i = 0; i < n_channels; i++)
+			bw_osc_sin_reset_state(state[i], x_0[i], x_inc_0[i]);
+
+	BW_ASSERT_DEEP(y_0 != BW_NULL ? bw_has_only_finite(y_0, n_channels) : 1);
+}
+
+static inline float bw_osc_sin_process1_rec(
+		bw_osc_sin_state * BW_RESTRICT state,
+		float                          x,
+		float                          x_inc) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_sin_state_is_valid(state));
+	BW_ASSERT(bw_is_finite(x));
+	BW_ASSERT(x >= 0.f && x < 1.f);
+	BW_ASSERT(bw_is_finite(x_inc));
+	BW_ASSERT(x_inc >= -0.5f && x_inc <= 0.5f);
+
+	float y;
+	if (x_inc != state->x_inc_z1) {
+		state->x_inc_z1 = x_inc;
+		state->sync_count = 0;
+		y = bw_sin2pif(x);
+	} else if (state->sync_count == 0)
+		y = bw_osc_sin_sync(state, x, x_inc);
+	else {
+		state->s += state->e * state->c;
+		state->c -= state->e * state->s;
+		state->sync_count--;
+		y = bw_clipf(state->s, -1.f, 1.f); // rounding errors could make it slightly exceed
+	}
+
+	BW_ASSERT_DEEP(bw_osc_sin_state_is_valid(state));
+	BW_ASSERT(bw_is_finite(y));
+
+	return y;
+}
+
+static inline void bw_osc_sin_process_rec(
+		bw_osc_sin_state * BW_RESTRICT state,
+		const float *                  x,
+		const float *                  x_inc,
+		float *                        y,
+		size_t                         n_samples) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_sin_state_is_valid(state));
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
+	BW_ASSERT(x_inc != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x_inc, n_samples));
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_samples; i++)
+		y[i] = bw_osc_sin_process1_rec(state, x[i], x_inc[i]);
+
+	BW_ASSERT_DEEP(bw_osc_sin_state_is_valid(state));
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_samples));
+}
+
+static inline void bw_osc_sin_process_rec_multi(
+		bw_osc_sin_state * BW_RESTRICT const * BW_RESTRICT state,
+		const float * const *                              x,
+		const float * const *                              x_inc,
+		float * const *                                    y,
+		size_t                                             n_channels,
+		size_t                                             n_samples) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(x_inc != BW_NULL);
+	BW_ASSERT(y != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(state[i] != state[j] && y[i] != y[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels; j++)
+			BW_ASSERT(i == j || (x[i] != y[j] && x_inc[i] != y[j]));
+#endif
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_osc_sin_process_rec(state[i], x[i], x_inc[i], y[i], n_samples);
+}
+
+static inline char bw_osc_sin_state_is_valid(
+		const bw_osc_sin_state * BW_RESTRICT state) {
+	BW_ASSERT(state != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (state->hash != bw_hash_sdbm("bw_osc_sin_state"))
+		return 0;
+#endif
+
+	return bw_is_finite(state->e) && bw_is_finite(state->s) && bw_is_finite(state->c)
+		&& bw_is_finite(state->x_inc_z1) && state->x_inc_z1 >= -0.5f && state->x_inc_z1 <= 0.5f
+		&& state->sync_count <= BW_OSC_SIN_SYNC_PERIOD;
+}
+
+#undef BW_OSC_SIN_SYNC_PERIOD
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 }
 #endif
@@ -253,6 +574,54 @@ void oscSinProcess(
 	size_t                                nSamples);
 # endif
 /*! <<<```
+ *
+ *    ##### Brickworks::OscSin
+ *  ```>>> */
+template<size_t N_CHANNELS = 1>
+class OscSin {
+public:
+	OscSin();
+
+	void reset(
+		float               x0 = 0.f,
+		float               xInc0 = 0.f,
+		float * BW_RESTRICT y0 = BW_NULL);
+
+# ifndef BW_CXX_NO_ARRAY
+	void reset(
+		float                                       x0,
+		float                                       xInc0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT y0);
+# endif
+
+	void reset(
+		const float * x0,
+		const float * xInc0,
+		float *       y0 = BW_NULL);
+
+# ifndef BW_CXX_NO_ARRAY
+	void reset(
+		std::array<float, N_CHANNELS>               x0,
+		std::array<float, N_CHANNELS>               xInc0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT y0 = BW_NULL);
+# endif
+
+	void process(
+		const float * const * x,
+		const float * const * xInc,
+		float * const *       y,
+		size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+	void process(
+		std::array<const float *, N_CHANNELS> x,
+		std::array<const float *, N_CHANNELS> xInc,
+		std::array<float *, N_CHANNELS>       y,
+		size_t                                nSamples);
+# endif
+/*! <<<...
+ *  }
+ *  ```
  *  }}} */
 
 /*** Implementation ***/
@@ -260,6 +629,11 @@ void oscSinProcess(
 /* WARNING: This part of the file is not part of the public API. Its content may
  * change at any time in future versions. Please, do not use it directly. */
 
+private:
+	bw_osc_sin_state		states[N_CHANNELS];
+	bw_osc_sin_state * BW_RESTRICT	statesP[N_CHANNELS];
+};
+
 template<size_t N_CHANNELS>
 inline void oscSinProcess(
 		const float * const * x,
@@ -278,6 +652,73 @@ inline void oscSinProcess(
 }
 # endif
 
+template<size_t N_CHANNELS>
+inline OscSin<N_CHANNELS>::OscSin() {
+	for (size_t i = 0; i < N_CHANNELS; i++)
+		statesP[i] = states + i;
+}
+
+template<size_t N_CHANNELS>
+inline void OscSin<N_CHANNELS>::reset(
+		float               x0,
+		float               xInc0,
+		float * BW_RESTRICT y0) {
+	if (y0 != BW_NULL)
+		for (size_t i = 0; i < N_CHANNELS; i++)
+			y0[i] = bw_osc_sin_reset_state(states + i, x0, xInc0);
+	else
+		for (size_t i = 0; i < N_CHANNELS; i++)
+			bw_osc_sin_reset_state(states + i, x0, xInc0);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void OscSin<N_CHANNELS>::reset(
+		float                                       x0,
+		float                                       xInc0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT y0) {
+	reset(x0, xInc0, y0 != BW_NULL ? y0->data() : BW_NULL);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void OscSin<N_CHANNELS>::reset(
+		const float * x0,
+		const float * xInc0,
+		float *       y0) {
+	bw_osc_sin_reset_state_multi(statesP, x0, xInc0, y0, N_CHANNELS);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void OscSin<N_CHANNELS>::reset(
+		std::array<float, N_CHANNELS>               x0,
+		std::array<float, N_CHANNELS>               xInc0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT y0) {
+	reset(x0.data(), xInc0.data(), y0 != BW_NULL ? y0->data() : BW_NULL);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void OscSin<N_CHANNELS>::process(
+		const float * const * x,
+		const float * const * xInc,
+		float * const *       y,
+		size_t                nSamples) {
+	bw_osc_sin_process_rec_multi(statesP, x, xInc, y, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void OscSin<N_CHANNELS>::process(
+		std::array<const float *, N_CHANNELS> x,
+		std::array<const float *, N_CHANNELS> xInc,
+		std::array<float *, N_CHANNELS>       y,
+		size_t                                nSamples) {
+	process(x.data(), xInc.data(), y.data(), nSamples);
+}
+# endif
+
 }
 #endif
 
@@ -0,0 +1,763 @@
+/*
+ * Brickworks
+ *
+ * Copyright (C) 2026 Orastron Srl unipersonale
+ *
+ * Brickworks is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * Brickworks is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Brickworks.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File author: Stefano D'Angelo
+ */
+
+/*!
+ *  module_type {{{ dsp }}}
+ *  version {{{ 1.0.0 }}}
+ *  requires {{{ bw_common bw_math }}}
+ *  description {{{
+ *    Wavetable oscillator waveshaper with mipmapped band-limited tables.
+ *
+ *    It turns a normalized phase signal, such as that generated by
+ *    [bw\_phase\_gen](bw_phase_gen), into an arbitrary periodic waveform,
+ *    given as one cycle of samples.
+ *
+ *    The waveform is decomposed into harmonics and resynthesized into a
+ *    series of tables (mip levels), each containing half the harmonics of the
+ *    previous one and, when possible, half as many samples. Level `0`
+ *    contains up to `table_length / 4` harmonics (see `bw_osc_wt_init()`).
+ *
+ *    While processing, the mip level is chosen once every 32 samples based on
+ *    the maximum absolute phase increment, so that no harmonic exceeds the
+ *    Nyquist frequency, and the two adjacent levels are crossfaded to avoid
+ *    abrupt spectral changes. Samples are read from tables using linear
+ *    interpolation.
+ *  }}}
+ *  changelog {{{
+ *    <ul>
+ *      <li>Version <strong>1.0.0</strong>:
+ *        <ul>
+ *          <li>First release.</li>
+ *        </ul>
+ *      </li>
+ *    </ul>
+ *  }}}
+ */
+
+#ifndef BW_OSC_WT_H
+#define BW_OSC_WT_H
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_common.h"
+#else
+# include <bw_common.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+/*** Public API ***/
+
+/*! api {{{
+ *    #### bw_osc_wt_coeffs
+ *  ```>>> */
+typedef struct bw_osc_wt_coeffs bw_osc_wt_coeffs;
+/*! <<<```
+ *    Coefficients and related.
+ *
+ *    #### bw_osc_wt_init()
+ *  ```>>> */
+static inline void bw_osc_wt_init(
+	bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+	size_t                         table_length);
+/*! <<<```
+ *    Initializes input parameter values in `coeffs` so that the table of mip
+ *    level `0` contains `table_length` samples.
+ *
+ *    `table_length` must be a power of `2` in [`64`, `65536`].
+ *
+ *    #### bw_osc_wt_coeffs_mem_req()
+ *  ```>>> */
+static inline size_t bw_osc_wt_coeffs_mem_req(
+	const bw_osc_wt_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the size, in bytes, of contiguous memory to be supplied to
+ *    `bw_osc_wt_coeffs_mem_set()` using `coeffs`.
+ *
+ *    #### bw_osc_wt_coeffs_mem_set()
+ *  ```>>> */
+static inline void bw_osc_wt_coeffs_mem_set(
+	bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+	void * BW_RESTRICT             mem);
+/*! <<<```
+ *    Associates the contiguous memory block `mem` to the given `coeffs`.
+ *
+ *    Such memory holds all tables, which are initially set to silence.
+ *
+ *    `mem` must be aligned for `float` values.
+ *
+ *    #### bw_osc_wt_set_wave()
+ *  ```>>> */
+static inline void bw_osc_wt_set_wave(
+	bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+	const float * BW_RESTRICT      x,
+	size_t                         length);
+/*! <<<```
+ *    Sets the waveform in `coeffs` to the first `length` samples of the buffer
+ *    `x`, which represent exactly one cycle, and builds all tables
+ *    accordingly.
+ *
+ *    `length` must be positive. Harmonics at or above `length / 2` are
+ *    ignored.
+ *
+ *    This function does not allocate memory and can be called while
+ *    processing (the change is abrupt), yet it is computationally expensive
+ *    (its cost is roughly proportional to `length * table_length`) and should
+ *    not be called from the audio thread.
+ *
+ *    #### bw_osc_wt_set_sample_rate()
+ *  ```>>> */
+static inline void bw_osc_wt_set_sample_rate(
+	bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+	float                          sample_rate);
+/*! <<<```
+ *    Sets the `sample_rate` (Hz) value in `coeffs`.
+ *
+ *    #### bw_osc_wt_reset_coeffs()
+ *  ```>>> */
+static inline void bw_osc_wt_reset_coeffs(
+	bw_osc_wt_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Resets coefficients in `coeffs` to assume their target values.
+ *
+ *    #### bw_osc_wt_update_coeffs_ctrl()
+ *  ```>>> */
+static inline void bw_osc_wt_update_coeffs_ctrl(
+	bw_osc_wt_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Triggers control-rate update of coefficients in `coeffs`.
+ *
+ *    #### bw_osc_wt_update_coeffs_audio()
+ *  ```>>> */
+static inline void bw_osc_wt_update_coeffs_audio(
+	bw_osc_wt_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Triggers audio-rate update of coefficients in `coeffs`.
+ *
+ *    #### bw_osc_wt_process1()
+ *  ```>>> */
+static inline float bw_osc_wt_process1(
+	const bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+	float                                x,
+	float                                x_inc);
+/*! <<<```
+ *    Processes one input sample `x`, representing the normalized phase, using
+ *    `coeffs` and choosing the mip levels based on the phase increment value
+ *    `x_inc`. It returns the corresponding output sample.
+ *
+ *    Since mip levels are chosen at each call, this is more expensive than
+ *    using `bw_osc_wt_process()`.
+ *
+ *    `x` must be in [`0.f`, `1.f`).
+ *
+ *    `x_inc` must be in [`-0.5f`, `0.5f`].
+ *
+ *    #### bw_osc_wt_process()
+ *  ```>>> */
+static inline void bw_osc_wt_process(
+	bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+	const float *                  x,
+	const float *                  x_inc,
+	float *                        y,
+	size_t                         n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the input buffer `x`, containing the
+ *    normalized phase signal, and of the input buffer `x_inc`, containing the
+ *    phase increment values, and fills the first `n_samples` of the output
+ *    buffer `y`, while using `coeffs`.
+ *
+ *    All samples in `x` must be in [`0.f`, `1.f`).
+ *
+ *    All samples is `x_inc` must be in [`-0.5f`, `0.5f`].
+ *
+ *    #### bw_osc_wt_process_multi()
+ *  ```>>> */
+static inline void bw_osc_wt_process_multi(
+	bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+	const float * const *          x,
+	const float * const *          x_inc,
+	float * const *                y,
+	size_t                         n_channels,
+	size_t                         n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the `n_channels` input buffers `x`,
+ *    containing the normalized phase signals, and of the `n_channels` input
+ *    buffers `x_inc`, containing the phase increment values, and fills the
+ *    first `n_samples` of the `n_channels` output buffers `y`, while using
+ *    `coeffs`.
+ *
+ *    All samples in `x` must be in [`0.f`, `1.f`).
+ *
+ *    All samples is `x_inc` must be in [`-0.5f`, `0.5f`].
+ *
+ *    #### bw_osc_wt_coeffs_is_valid()
+ *  ```>>> */
+static inline char bw_osc_wt_coeffs_is_valid(
+	const bw_osc_wt_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Tries to determine whether `coeffs` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    `coeffs` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_osc_wt_coeffs`.
+ *  }}} */
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_math.h"
+#else
+# include <bw_math.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+#define BW_OSC_WT_N_LEVELS_MAX	15	// table_length = 65536 -> 16384, 8192, ..., 1 harmonics
+#define BW_OSC_WT_TABLE_LEN_MIN	64
+#define BW_OSC_WT_BLOCK		32
+
+#ifdef BW_DEBUG_DEEP
+enum bw_osc_wt_coeffs_state {
+	bw_osc_wt_coeffs_state_invalid,
+	bw_osc_wt_coeffs_state_init,
+	bw_osc_wt_coeffs_state_mem_set,
+	bw_osc_wt_coeffs_state_set_sample_rate,
+	bw_osc_wt_coeffs_state_reset_coeffs
+};
+#endif
+
+struct bw_osc_wt_coeffs {
+#ifdef BW_DEBUG_DEEP
+	uint32_t			hash;
+	enum bw_osc_wt_coeffs_state	state;
+#endif
+
+	// Coefficients
+	size_t				table_len;
+	size_t				n_levels;
+	float				log2_table_len;
+	// each table is followed by 1 guard sample equal to the first one
+	size_t				len[BW_OSC_WT_N_LEVELS_MAX];
+	float *				tables[BW_OSC_WT_N_LEVELS_MAX];
+	float *				harm_re;
+	float *				harm_im;
+};
+
+// cos(2 * pi * k / n) and sin(2 * pi * k / n), computed in double precision
+static inline void bw_osc_wt_cos_sin(
+		size_t               k,
+		size_t               n,
+		double * BW_RESTRICT c,
+		double * BW_RESTRICT s) {
+	const size_t q = (4 * k + (n >> 1)) / n;
+	const double a = 6.283185307179586 * ((double)k - 0.25 * (double)q * (double)n) / (double)n; // in [-pi/4, pi/4]
+	const double a2 = a * a;
+	double ca = 1.0, sa = a, tc = 1.0, ts = a;
+	for (int i = 1; i <= 10; i++) {
+		tc *= -a2 / ((2 * i - 1) * (2 * i));
+		ts *= -a2 / ((2 * i) * (2 * i + 1));
+		ca += tc;
+		sa += ts;
+	}
+	switch (q & 3) {
+	case 0:
+		*c = ca;
+		*s = sa;
+		break;
+	case 1:
+		*c = -sa;
+		*s = ca;
+		break;
+	case 2:
+		*c = -ca;
+		*s = -sa;
+		break;
+	default:
+		*c = sa;
+		*s = -ca;
+		break;
+	}
+}
+
+static inline void bw_osc_wt_init(
+		bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+		size_t                         table_length) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT(table_length >= BW_OSC_WT_TABLE_LEN_MIN && table_length <= 65536);
+	BW_ASSERT((table_length & (table_length - 1)) == 0);
+
+	coeffs->table_len = table_length;
+	size_t bits = 0;
+	while (((size_t)1 << bits) < table_length)
+		bits++;
+	coeffs->log2_table_len = (float)bits;
+	coeffs->n_levels = bits - 1;
+	for (size_t i = 0; i < BW_OSC_WT_N_LEVELS_MAX; i++) {
+		const size_t n = table_length >> i;
+		coeffs->len[i] = n > BW_OSC_WT_TABLE_LEN_MIN ? n : BW_OSC_WT_TABLE_LEN_MIN;
+		coeffs->tables[i] = BW_NULL;
+	}
+	coeffs->harm_re = BW_NULL;
+	coeffs->harm_im = BW_NULL;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->hash = bw_hash_sdbm("bw_osc_wt_coeffs");
+	coeffs->state = bw_osc_wt_coeffs_state_init;
+#endif
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_osc_wt_coeffs_state_init);
+}
+
+static inline size_t bw_osc_wt_coeffs_mem_req(
+		const bw_osc_wt_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_init);
+
+	size_t n = 2 * ((coeffs->table_len >> 2) + 1);
+	for (size_t i = 0; i < coeffs->n_levels; i++)
+		n += coeffs->len[i] + 1;
+	return n * sizeof(float);
+}
+
+static inline void bw_osc_wt_coeffs_mem_set(
+		bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+		void * BW_RESTRICT             mem) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_init);
+	BW_ASSERT(mem != BW_NULL);
+
+	float *m = (float *)mem;
+	for (size_t i = 0; i < coeffs->n_levels; i++) {
+		coeffs->tables[i] = m;
+		for (size_t j = 0; j <= coeffs->len[i]; j++)
+			m[j] = 0.f;
+		m += coeffs->len[i] + 1;
+	}
+	coeffs->harm_re = m;
+	coeffs->harm_im = m + (coeffs->table_len >> 2) + 1;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_osc_wt_coeffs_state_mem_set;
+#endif
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_osc_wt_coeffs_state_mem_set);
+}
+
+static inline void bw_osc_wt_set_wave(
+		bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+		const float * BW_RESTRICT      x,
+		size_t                         length) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_mem_set);
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(length > 0);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, length));
+
+	// harmonics analysis, harm_re[0] being twice the DC component
+	const size_t k0 = coeffs->table_len >> 2;
+	const size_t k_max = (length - 1) >> 1 < k0 ? (length - 1) >> 1 : k0;
+	const double norm = 2.0 / (double)length;
+	for (size_t k = 0; k <= k_max; k++) {
+		double c_inc, s_inc;
+		bw_osc_wt_cos_sin(k, length, &c_inc, &s_inc);
+		double c = 1.0, s = 0.0, re = 0.0, im = 0.0;
+		for (size_t i = 0; i < length; i++) {
+			re += (double)x[i] * c;
+			im += (double)x[i] * s;
+			const double t = c * c_inc - s * s_inc;
+			s = c * s_inc + s * c_inc;
+			c = t;
+		}
+		coeffs->harm_re[k] = (float)(norm * re);
+		coeffs->harm_im[k] = (float)(norm * im);
+	}
+
+	// resynthesis
+	for (size_t l = 0; l < coeffs->n_levels; l++) {
+		float *t = coeffs->tables[l];
+		const size_t n = coeffs->len[l];
+		const size_t k_l = k0 >> l < k_max ? k0 >> l : k_max;
+		const float dc = 0.5f * coeffs->harm_re[0];
+		for (size_t i = 0; i < n; i++)
+			t[i] = dc;
+		for (size_t k = 1; k <= k_l; k++) {
+			double c_inc, s_inc;
+			bw_osc_wt_cos_sin(k, n, &c_inc, &s_inc);
+			const double a = coeffs->harm_re[k];
+			const double b = coeffs->harm_im[k];
+			double c = 1.0, s = 0.0;
+			for (size_t i = 0; i < n; i++) {
+				t[i] += (float)(a * c + b * s);
+				const double u = c * c_inc - s * s_inc;
+				s = c * s_inc + s * c_inc;
+				c = u;
+			}
+		}
+		t[n] = t[0];
+	}
+
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_mem_set);
+}
+
+static inline void bw_osc_wt_set_sample_rate(
+		bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+		float                          sample_rate) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_mem_set);
+	BW_ASSERT(bw_is_finite(sample_rate) && sample_rate > 0.f);
+
+	(void)coeffs;
+	(void)sample_rate;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_osc_wt_coeffs_state_set_sample_rate;
+#endif
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_osc_wt_coeffs_state_set_sample_rate);
+}
+
+static inline void bw_osc_wt_reset_coeffs(
+		bw_osc_wt_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_set_sample_rate);
+
+	(void)coeffs;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_osc_wt_coeffs_state_reset_coeffs;
+#endif
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_osc_wt_coeffs_state_reset_coeffs);
+}
+
+static inline void bw_osc_wt_update_coeffs_ctrl(
+		bw_osc_wt_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_reset_coeffs);
+
+	(void)coeffs;
+}
+
+static inline void bw_osc_wt_update_coeffs_audio(
+		bw_osc_wt_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_reset_coeffs);
+
+	(void)coeffs;
+}
+
+// Picks mip levels l and l + 1 and crossfade weight w for the absolute phase
+// increment a_inc. Level l has up to table_len / 2^(l + 2) harmonics, hence
+// the highest is below Nyquist if 2^l >= table_len * a_inc.
+static inline void bw_osc_wt_get_levels(
+		const bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+		float                                a_inc,
+		size_t * BW_RESTRICT                 l,
+		float * BW_RESTRICT                  w) {
+	const float top = (float)(coeffs->n_levels - 1);
+	const float v = a_inc * (float)coeffs->table_len;
+	const float lf = v <= 1.f ? 0.f : bw_minf(coeffs->log2_table_len + bw_log2f(a_inc), top);
+	const float li = bw_floorf(lf);
+	*l = (size_t)li;
+	*w = lf - li;
+}
+
+static inline float bw_osc_wt_read(
+		const float * BW_RESTRICT t,
+		float                     n,
+		float                     x) {
+	const float p = x * n;
+	const size_t i = (size_t)p;
+	const float f = p - (float)i;
+	return t[i] + f * (t[i + 1] - t[i]);
+}
+
+static inline float bw_osc_wt_process1(
+		const bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+		float                                x,
+		float                                x_inc) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_reset_coeffs);
+	BW_ASSERT(bw_is_finite(x));
+	BW_ASSERT(x >= 0.f && x < 1.f);
+	BW_ASSERT(bw_is_finite(x_inc));
+	BW_ASSERT(x_inc >= -0.5f && x_inc <= 0.5f);
+
+	size_t l;
+	float w;
+	bw_osc_wt_get_levels(coeffs, bw_absf(x_inc), &l, &w);
+	const size_t l1 = l + 1 < coeffs->n_levels ? l + 1 : l;
+	const float y0 = bw_osc_wt_read(coeffs->tables[l], (float)coeffs->len[l], x);
+	const float y1 = bw_osc_wt_read(coeffs->tables[l1], (float)coeffs->len[l1], x);
+	const float y = y0 + w * (y1 - y0);
+
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_reset_coeffs);
+	BW_ASSERT(bw_is_finite(y));
+
+	return y;
+}
+
+static inline void bw_osc_wt_process(
+		bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+		const float *                  x,
+		const float *                  x_inc,
+		float *                        y,
+		size_t                         n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_reset_coeffs);
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
+	BW_ASSERT(x_inc != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x_inc, n_samples));
+	BW_ASSERT(y != BW_NULL);
+
+	for (size_t i = 0; i < n_samples; i += BW_OSC_WT_BLOCK) {
+		const size_t n = n_samples - i < BW_OSC_WT_BLOCK ? n_samples - i : BW_OSC_WT_BLOCK;
+		float a_inc = 0.f;
+		for (size_t j = 0; j < n; j++)
+			a_inc = bw_maxf(a_inc, bw_absf(x_inc[i + j]));
+		size_t l;
+		float w;
+		bw_osc_wt_get_levels(coeffs, a_inc, &l, &w);
+		const size_t l1 = l + 1 < coeffs->n_levels ? l + 1 : l;
+		const float * BW_RESTRICT t0 = coeffs->tables[l];
+		const float * BW_RESTRICT t1 = coeffs->tables[l1];
+		const float n0 = (float)coeffs->len[l];
+		const float n1 = (float)coeffs->len[l1];
+		// no branches in here, only gathers
+		for (size_t j = 0; j < n; j++) {
+			BW_ASSERT(x[i + j] >= 0.f && x[i + j] < 1.f);
+			const float y0 = bw_osc_wt_read(t0, n0, x[i + j]);
+			const float y1 = bw_osc_wt_read(t1, n1, x[i + j]);
+			y[i + j] = y0 + w * (y1 - y0);
+		}
+	}
+
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_samples));
+}
+
+static inline void bw_osc_wt_process_multi(
+		bw_osc_wt_coeffs * BW_RESTRICT coeffs,
+		const float * const *          x,
+		const float * const *          x_inc,
+		float * const *                y,
+		size_t                         n_channels,
+		size_t                         n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_reset_coeffs);
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(x_inc != BW_NULL);
+	BW_ASSERT(y != BW_NULL);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(y[i] != y[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels; j++)
+			BW_ASSERT(i == j || (x[i] != y[j] && x_inc[i] != y[j]));
+#endif
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_osc_wt_process(coeffs, x[i], x_inc[i], y[i], n_samples);
+
+	BW_ASSERT_DEEP(bw_osc_wt_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_osc_wt_coeffs_state_reset_coeffs);
+}
+
+static inline char bw_osc_wt_coeffs_is_valid(
+		const bw_osc_wt_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->hash != bw_hash_sdbm("bw_osc_wt_coeffs"))
+		return 0;
+	if (coeffs->state < bw_osc_wt_coeffs_state_init || coeffs->state > bw_osc_wt_coeffs_state_reset_coeffs)
+		return 0;
+#endif
+
+	if (coeffs->table_len < BW_OSC_WT_TABLE_LEN_MIN || coeffs->table_len > 65536 || (coeffs->table_len & (coeffs->table_len - 1)) != 0)
+		return 0;
+	if (coeffs->n_levels < 1 || coeffs->n_levels > BW_OSC_WT_N_LEVELS_MAX || (size_t)4 << (coeffs->n_levels - 1) != coeffs->table_len)
+		return 0;
+	if (coeffs->log2_table_len != (float)(coeffs->n_levels + 1))
+		return 0;
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->state >= bw_osc_wt_coeffs_state_mem_set) {
+		for (size_t i = 0; i < coeffs->n_levels; i++) {
+			if (coeffs->tables[i] == BW_NULL)
+				return 0;
+			if (coeffs->tables[i][coeffs->len[i]] != coeffs->tables[i][0])
+				return 0;
+		}
+		if (coeffs->harm_re == BW_NULL || coeffs->harm_im == BW_NULL)
+			return 0;
+	}
+#endif
+
+	return 1;
+}
+
+#undef BW_OSC_WT_N_LEVELS_MAX
+#undef BW_OSC_WT_TABLE_LEN_MIN
+#undef BW_OSC_WT_BLOCK
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+#if !defined(BW_NO_CXX) && defined(__cplusplus)
+
+# ifndef BW_CXX_NO_ARRAY
+#  include <array>
+# endif
+
+namespace Brickworks {
+
+/*** Public C++ API ***/
+
+/*! api_cpp {{{
+ *    ##### Brickworks::OscWT
+ *  ```>>> */
+template<size_t N_CHANNELS = 1>
+class OscWT {
+public:
+	OscWT(
+		size_t tableLength = 2048);
+
+	~OscWT();
+
+	void setWave(
+		const float * BW_RESTRICT x,
+		size_t                    length);
+
+	void setSampleRate(
+		float sampleRate);
+
+	void reset();
+
+	void process(
+		const float * const * x,
+		const float * const * xInc,
+		float * const *       y,
+		size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+	void process(
+		std::array<const float *, N_CHANNELS> x,
+		std::array<const float *, N_CHANNELS> xInc,
+		std::array<float *, N_CHANNELS>       y,
+		size_t                                nSamples);
+# endif
+/*! <<<...
+ *  }
+ *  ```
+ *  }}} */
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+private:
+	bw_osc_wt_coeffs	coeffs;
+	void * BW_RESTRICT	mem;
+};
+
+template<size_t N_CHANNELS>
+inline OscWT<N_CHANNELS>::OscWT(
+		size_t tableLength) {
+	bw_osc_wt_init(&coeffs, tableLength);
+	mem = operator new(bw_osc_wt_coeffs_mem_req(&coeffs));
+	bw_osc_wt_coeffs_mem_set(&coeffs, mem);
+}
+
+template<size_t N_CHANNELS>
+inline OscWT<N_CHANNELS>::~OscWT() {
+	operator delete(mem);
+}
+
+template<size_t N_CHANNELS>
+inline void OscWT<N_CHANNELS>::setWave(
+		const float * BW_RESTRICT x,
+		size_t                    length) {
+	bw_osc_wt_set_wave(&coeffs, x, length);
+}
+
+template<size_t N_CHANNELS>
+inline void OscWT<N_CHANNELS>::setSampleRate(
+		float sampleRate) {
+	bw_osc_wt_set_sample_rate(&coeffs, sampleRate);
+}
+
+template<size_t N_CHANNELS>
+inline void OscWT<N_CHANNELS>::reset() {
+	bw_osc_wt_reset_coeffs(&coeffs);
+}
+
+template<size_t N_CHANNELS>
+inline void OscWT<N_CHANNELS>::process(
+		const float * const * x,
+		const float * const * xInc,
+		float * const *       y,
+		size_t                nSamples) {
+	bw_osc_wt_process_multi(&coeffs, x, xInc, y, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void OscWT<N_CHANNELS>::process(
+		std::array<const float *, N_CHANNELS> x,
+		std::array<const float *, N_CHANNELS> xInc,
+		std::array<float *, N_CHANNELS>       y,
+		size_t                                nSamples) {
+	process(x.data(), xInc.data(), y.data(), nSamples);
+}
+# endif
+
+}
+#endif
+
+#endif
@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.5 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_gain bw_math bw_mm2 bw_one_pole bw_svf }}}
  *  description {{{
  *    Second-order peak filter with unitary gain at DC and asymptotically
@@ -35,6 +35,14 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *          <li>Added <code>bw_peak_set_update_interval()</code> and
+ *              <code>setUpdateInterval()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.5</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -319,6 +327,21 @@ static inline void bw_peak_set_prewarp_freq(
  *
  *    Default value: `1e3f`.
  *
+ *    #### bw_peak_set_update_interval()
+ *  ```>>> */
+static inline void bw_peak_set_update_interval(
+	bw_peak_coeffs * BW_RESTRICT coeffs,
+	size_t                       value);
+/*! <<<```
+ *    Sets the coefficient update interval to the given `value` (samples) in
+ *    `coeffs`.
+ *
+ *    See `bw_svf_set_update_interval()`.
+ *
+ *    `value` must be positive.
+ *
+ *    Default value: `1`.
+ *
  *    #### bw_peak_set_peak_gain_lin()
  *  ```>>> */
 static inline void bw_peak_set_peak_gain_lin(
@@ -529,8 +552,8 @@ static inline void bw_peak_update_mm2_params(
 		if (coeffs->use_bandwidth) {
 			if (coeffs->param_changed & (BW_PEAK_PARAM_PEAK_GAIN | BW_PEAK_PARAM_BANDWIDTH)) {
 				if (coeffs->param_changed & BW_PEAK_PARAM_BANDWIDTH)
-					coeffs->bw_k = bw_pow2f(coeffs->bandwidth);
-				const float Q = bw_sqrtf(coeffs->bw_k * coeffs->peak_gain) * bw_rcpf(coeffs->bw_k - 1.f);
+					coeffs->bw_k = bw_pow2f_ctrl(coeffs->bandwidth);
+				const float Q = bw_sqrtf_ctrl(coeffs->bw_k * coeffs->peak_gain) * bw_rcpf_ctrl(coeffs->bw_k - 1.f);
 				bw_mm2_set_Q(&coeffs->mm2_coeffs, Q);
 			}
 		} else {
@@ -832,6 +855,20 @@ static inline void bw_peak_set_prewarp_freq(
 	BW_ASSERT_DEEP(coeffs->state >= bw_peak_coeffs_state_init);
 }
 
+static inline void bw_peak_set_update_interval(
+		bw_peak_coeffs * BW_RESTRICT coeffs,
+		size_t                       value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_peak_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_peak_coeffs_state_init);
+	BW_ASSERT(value > 0);
+
+	bw_mm2_set_update_interval(&coeffs->mm2_coeffs, value);
+
+	BW_ASSERT_DEEP(bw_peak_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_peak_coeffs_state_init);
+}
+
 static inline void bw_peak_set_peak_gain_lin(
 		bw_peak_coeffs * BW_RESTRICT coeffs,
 		float                        value) {
@@ -1016,6 +1053,9 @@ public:
 	void setPrewarpFreq(
 		float value);
 
+	void setUpdateInterval(
+		size_t value);
+
 	void setPeakGainLin(
 		float value);
 
@@ -1137,6 +1177,12 @@ inline void Peak<N_CHANNELS>::setPrewarpFreq(
 	bw_peak_set_prewarp_freq(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline void Peak<N_CHANNELS>::setUpdateInterval(
+		size_t value) {
+	bw_peak_set_update_interval(&coeffs, value);
+}
+
 template<size_t N_CHANNELS>
 inline void Peak<N_CHANNELS>::setPeakGainLin(
 		float value) {
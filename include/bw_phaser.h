@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{
  *    bw_ap1 bw_common bw_lp1 bw_math bw_one_pole bw_osc_sin bw_phase_gen
  *  }}}
@@ -30,6 +30,14 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *          <li>The sinusoidal LFO now uses the recursive mode of
+ *              bw_osc_sin.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -366,6 +374,7 @@ struct bw_phaser_coeffs {
 	// Sub-components
 	bw_phase_gen_coeffs		phase_gen_coeffs;
 	bw_phase_gen_state		phase_gen_state;
+	bw_osc_sin_state		osc_sin_state;
 	bw_ap1_coeffs			ap1_coeffs;
 
 	// Parameters
@@ -429,6 +438,7 @@ static inline void bw_phaser_reset_coeffs(
 	bw_phase_gen_reset_coeffs(&coeffs->phase_gen_coeffs);
 	float p, inc;
 	bw_phase_gen_reset_state(&coeffs->phase_gen_coeffs, &coeffs->phase_gen_state, 0.f, &p, &inc);
+	bw_osc_sin_reset_state(&coeffs->osc_sin_state, p, inc);
 	bw_ap1_set_cutoff(&coeffs->ap1_coeffs, coeffs->center);
 	bw_ap1_reset_coeffs(&coeffs->ap1_coeffs);
 
@@ -521,8 +531,8 @@ static inline void bw_phaser_update_coeffs_audio(
 	bw_phase_gen_update_coeffs_audio(&coeffs->phase_gen_coeffs);
 	float p, pi;
 	bw_phase_gen_process1(&coeffs->phase_gen_coeffs, &coeffs->phase_gen_state, &p, &pi);
-	const float m = coeffs->amount * bw_osc_sin_process1(p);
-	bw_ap1_set_cutoff(&coeffs->ap1_coeffs, coeffs->center * bw_pow2f(m));
+	const float m = coeffs->amount * bw_osc_sin_process1_rec(&coeffs->osc_sin_state, p, pi);
+	bw_ap1_set_cutoff(&coeffs->ap1_coeffs, coeffs->center * bw_pow2f_ctrl(m));
 	bw_ap1_update_coeffs_ctrl(&coeffs->ap1_coeffs);
 	bw_ap1_update_coeffs_audio(&coeffs->ap1_coeffs);
 
@@ -703,6 +713,8 @@ static inline char bw_phaser_coeffs_is_valid(
 #ifdef BW_DEBUG_DEEP
 	if (coeffs->state >= bw_phaser_coeffs_state_reset_coeffs && !bw_phase_gen_state_is_valid(&coeffs->phase_gen_coeffs, &coeffs->phase_gen_state))
 		return 0;
+	if (coeffs->state >= bw_phaser_coeffs_state_reset_coeffs && !bw_osc_sin_state_is_valid(&coeffs->osc_sin_state))
+		return 0;
 #endif
 
 	return bw_ap1_coeffs_is_valid(&coeffs->ap1_coeffs);
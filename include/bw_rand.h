@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ utility }}}
- *  version {{{ 1.1.1 }}}
+ *  version {{{ 1.2.0 }}}
  *  requires {{{ bw_common }}}
  *  description {{{
  *    Pseudo-random number generators.
@@ -42,6 +42,11 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.2.0</strong>:
+ *        <ul>
+ *          <li>Added <code>bw_rand_fill()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.1.1</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -93,6 +98,9 @@
 #else
 # include <bw_common.h>
 #endif
+#ifdef __AVX2__
+# include <immintrin.h>
+#endif
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 extern "C" {
@@ -122,6 +130,25 @@ static inline float bw_randf(
  *
  *    `state` is a pointer to a 64-bit unsigned integer storing the state
  *    between calls and which gets updated by this function.
+ *
+ *    #### bw_rand_fill()
+ *  ```>>> */
+static inline void bw_rand_fill(
+	uint64_t * BW_RESTRICT state,
+	float * BW_RESTRICT    y,
+	size_t                 n_elems);
+/*! <<<```
+ *    Fills the first `n_elems` of the output buffer `y` with pseudo-random
+ *    unsigned 32-bit floating point numbers in the range [`-1.f`, `1.f`].
+ *
+ *    The output values and the final value of `state` are the same as those
+ *    obtained by calling `bw_randf()` `n_elems` times. When compiling for
+ *    targets supporting AVX2, this function internally advances 8 interleaved
+ *    generator states using AVX2 intrinsics, each one skipping ahead by 8
+ *    steps at a time.
+ *
+ *    `state` is a pointer to a 64-bit unsigned integer storing the state
+ *    between calls and which gets updated by this function.
  *  }}} */
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
@@ -154,6 +181,75 @@ static inline float bw_randf(
 	return y;
 }
 
+// Multiplier and increment of 8 steps at once
+#define BW_RAND_MUL_8	0x66b84ae7ee7df5a1
+#define BW_RAND_INC_8	0x14071535def13bb8
+
+#ifdef __AVX2__
+// s * BW_RAND_MUL_8 + BW_RAND_INC_8 on 4 states - AVX2 has no 64 x 64 bit
+// multiplication, hence it is done in 32-bit halves
+static inline __m256i bw_rand_step_8(
+		__m256i s) {
+	const __m256i m_lo = _mm256_set1_epi64x((int64_t)(BW_RAND_MUL_8 & 0xffffffff));
+	const __m256i m_hi = _mm256_set1_epi64x((int64_t)(BW_RAND_MUL_8 >> 32));
+	const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(s, 32), m_lo), _mm256_mul_epu32(s, m_hi));
+	const __m256i p = _mm256_add_epi64(_mm256_mul_epu32(s, m_lo), _mm256_slli_epi64(cross, 32));
+	return _mm256_add_epi64(p, _mm256_set1_epi64x((int64_t)BW_RAND_INC_8));
+}
+
+// Same as (uint32_t)(s >> (29 - (s >> 61))) on 4 states, results in the lower
+// 128 bits
+static inline __m256i bw_rand_out_4(
+		__m256i s) {
+	const __m256i u = _mm256_srlv_epi64(s, _mm256_sub_epi64(_mm256_set1_epi64x(29), _mm256_srli_epi64(s, 61)));
+	return _mm256_permutevar8x32_epi32(u, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+}
+#endif
+
+static inline void bw_rand_fill(
+		uint64_t * BW_RESTRICT state,
+		float * BW_RESTRICT    y,
+		size_t                 n_elems) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT(y != BW_NULL);
+
+	size_t n_vec = 0;
+#ifdef __AVX2__
+	// s_a and s_b are the states after outputting elements i to i + 3 and
+	// i + 4 to i + 7, respectively, and each advances by 8 steps at a time
+	if (n_elems >= 16) {
+		n_vec = n_elems & ~(size_t)7;
+		uint64_t s[8];
+		s[0] = *state * 0x9b60933458e17d7d + 0xd737232eeccdf7ed;
+		for (size_t j = 1; j < 8; j++)
+			s[j] = s[j - 1] * 0x9b60933458e17d7d + 0xd737232eeccdf7ed;
+		__m256i s_a = _mm256_loadu_si256((const __m256i *)s);
+		__m256i s_b = _mm256_loadu_si256((const __m256i *)(s + 4));
+		__m256i s_last = s_b;
+		for (size_t i = 0; i < n_vec; i += 8) {
+			const __m256i u = _mm256_permute2x128_si256(bw_rand_out_4(s_a), bw_rand_out_4(s_b), 0x20);
+			// same as (float)u, but AVX2 only has signed conversions
+			const __m256 v = _mm256_add_ps(
+				_mm256_mul_ps(_mm256_set1_ps(65536.f), _mm256_cvtepi32_ps(_mm256_srli_epi32(u, 16))),
+				_mm256_cvtepi32_ps(_mm256_and_si256(u, _mm256_set1_epi32(0xffff))));
+			_mm256_storeu_ps(y + i, _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.f / (float)UINT32_MAX), v), _mm256_set1_ps(1.f)));
+			s_last = s_b;
+			s_a = bw_rand_step_8(s_a);
+			s_b = bw_rand_step_8(s_b);
+		}
+		_mm256_storeu_si256((__m256i *)(s + 4), s_last);
+		*state = s[7];
+	}
+#endif
+	for (size_t i = n_vec; i < n_elems; i++)
+		y[i] = bw_randf(state);
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_elems));
+}
+
+#undef BW_RAND_MUL_8
+#undef BW_RAND_INC_8
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 }
 #endif
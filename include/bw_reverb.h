@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{
  *    bw_buf bw_common bw_delay bw_dry_wet bw_gain bw_lp1 bw_math bw_one_pole
  *    bw_osc_sin bw_phase_gen
@@ -35,6 +35,24 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li><code>bw_reverb_process()</code> and
+ *              <code>bw_reverb_process_multi()</code> now process audio in
+ *              blocks, stage by stage, whenever possible.</li>
+ *          <li>Fixed output of second tank diffuser being written to the
+ *              wrong delay line.</li>
+ *          <li>The sinusoidal LFO now uses the recursive mode of
+ *              bw_osc_sin.</li>
+ *          <li>Added <code>bw_reverb_is_silent()</code> and corresponding
+ *              C++ API.</li>
+ *          <li>The internal state is now cleared once the input is zero and
+ *              the tail decays below -120 dBFS for long enough, after which
+ *              <code>bw_reverb_process()</code> and
+ *              <code>bw_reverb_process_multi()</code> are bypassed for as
+ *              long as the input stays at zero.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -345,6 +363,26 @@ static inline void bw_reverb_set_wet(
  *
  *    Default value: `0.5f`.
  *
+ *    #### bw_reverb_is_silent()
+ *  ```>>> */
+static inline char bw_reverb_is_silent(
+	const bw_reverb_coeffs * BW_RESTRICT coeffs,
+	const bw_reverb_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Returns non-`0` if the reverb whose `coeffs` and `state` are given is
+ *    silent, `0` otherwise.
+ *
+ *    This happens after a reset with zero input or when, while processing
+ *    zero input, the wet output signal has stayed below -120 dBFS for at
+ *    least as long as the total length of the internal delay lines, in which
+ *    case the internal state is also cleared. Both `bw_reverb_process1()` and
+ *    `bw_reverb_process()` check this condition sample by sample, but the
+ *    latter clears the internal state at the end of the internal processing
+ *    block (up to 32 samples) in which it is first met, provided that it still
+ *    holds there. While it is met,
+ *    `bw_reverb_process()` and `bw_reverb_process_multi()` only update
+ *    `coeffs` and output zeros as long as the input buffers are all zeros.
+ *
  *    #### bw_reverb_coeffs_is_valid()
  *  ```>>> */
 static inline char bw_reverb_coeffs_is_valid(
@@ -384,6 +422,7 @@ static inline char bw_reverb_state_is_valid(
  * change at any time in future versions. Please, do not use it directly. */
 
 #ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_buf.h"
 # include "bw_delay.h"
 # include "bw_lp1.h"
 # include "bw_phase_gen.h"
@@ -393,6 +432,7 @@ static inline char bw_reverb_state_is_valid(
 # include "bw_one_pole.h"
 # include "bw_math.h"
 #else
+# include <bw_buf.h>
 # include <bw_delay.h>
 # include <bw_lp1.h>
 # include <bw_phase_gen.h>
@@ -449,6 +489,7 @@ struct bw_reverb_coeffs {
 	bw_gain_coeffs			decay_coeffs;
 	bw_phase_gen_coeffs		phase_gen_coeffs;
 	bw_phase_gen_state		phase_gen_state;
+	bw_osc_sin_state		osc_sin_state;
 	bw_lp1_coeffs			damping_coeffs;
 	bw_dry_wet_coeffs		dry_wet_coeffs;
 	bw_one_pole_coeffs		smooth_coeffs;
@@ -457,6 +498,7 @@ struct bw_reverb_coeffs {
 	// Coefficients
 	float				fs;
 	float				T;
+	size_t				tail_len;
 	size_t				id1;
 	size_t				id2;
 	size_t				id3;
@@ -513,6 +555,9 @@ struct bw_reverb_state {
 	bw_delay_state			delay_d4_state;
 	bw_lp1_state			damping_1_state;
 	bw_lp1_state			damping_2_state;
+
+	// States
+	size_t				n_silent;
 };
 
 static inline void bw_reverb_init(
@@ -611,6 +656,19 @@ static inline void bw_reverb_set_sample_rate(
 	coeffs->dr5 = (size_t)bw_roundf(coeffs->fs * (2111.f / 29761.f));
 	coeffs->dr6 = (size_t)bw_roundf(coeffs->fs * (335.f / 29761.f));
 	coeffs->dr7 = (size_t)bw_roundf(coeffs->fs * (121.f / 29761.f));
+	coeffs->tail_len = bw_delay_get_length(&coeffs->predelay_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_id1_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_id2_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_id3_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_id4_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_dd1_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_dd2_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_dd3_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_dd4_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_d1_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_d2_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_d3_coeffs)
+		+ bw_delay_get_length(&coeffs->delay_d4_coeffs);
 
 #ifdef BW_DEBUG_DEEP
 	coeffs->state = bw_reverb_coeffs_state_set_sample_rate;
@@ -711,7 +769,7 @@ static inline void bw_reverb_reset_coeffs(
 	bw_phase_gen_reset_coeffs(&coeffs->phase_gen_coeffs);
 	float p, pi;
 	bw_phase_gen_reset_state(&coeffs->phase_gen_coeffs, &coeffs->phase_gen_state, 0.f, &p, &pi);
-	coeffs->s = (8.f / 29761.f) * bw_osc_sin_process1(p);
+	coeffs->s = (8.f / 29761.f) * bw_osc_sin_reset_state(&coeffs->osc_sin_state, p, pi);
 	bw_lp1_reset_coeffs(&coeffs->damping_coeffs);
 	coeffs->diff2 = bw_clipf(bw_gain_get_gain_lin(&coeffs->decay_coeffs) + 0.15f, 0.25f, 0.5f);
 	bw_dry_wet_reset_coeffs(&coeffs->dry_wet_coeffs);
@@ -781,6 +839,8 @@ static inline void bw_reverb_reset_state(
 	*y_l_0 = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, x_l_0, y);
 	*y_r_0 = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, x_r_0, y);
 
+	state->n_silent = i == 0.f ? coeffs->tail_len : 0;
+
 #ifdef BW_DEBUG_DEEP
 	state->state = bw_reverb_state_state_reset_state;
 	state->coeffs_reset_id = coeffs->reset_id;
@@ -873,7 +933,7 @@ static inline void bw_reverb_update_coeffs_audio(
 	bw_phase_gen_update_coeffs_audio(&coeffs->phase_gen_coeffs);
 	float p, pi;
 	bw_phase_gen_process1(&coeffs->phase_gen_coeffs, &coeffs->phase_gen_state, &p, &pi);
-	coeffs->s = (8.f / 29761.f) * bw_osc_sin_process1(p);
+	coeffs->s = (8.f / 29761.f) * bw_osc_sin_process1_rec(&coeffs->osc_sin_state, p, pi);
 	bw_lp1_update_coeffs_audio(&coeffs->damping_coeffs);
 	coeffs->diff2 = bw_clipf(bw_gain_get_gain_cur(&coeffs->decay_coeffs) + 0.15f, 0.25f, 0.5f);
 	bw_dry_wet_update_coeffs_audio(&coeffs->dry_wet_coeffs);
@@ -882,6 +942,16 @@ static inline void bw_reverb_update_coeffs_audio(
 	BW_ASSERT_DEEP(coeffs->state >= bw_reverb_coeffs_state_reset_coeffs);
 }
 
+// Silence predicate shared by bw_reverb_process1() and bw_reverb_process(),
+// evaluated on inputs and wet outputs (before dry/wet mixing) of each sample.
+static inline char bw_reverb_is_silent_sample(
+		float x_l,
+		float x_r,
+		float wet_l,
+		float wet_r) {
+	return x_l == 0.f && x_r == 0.f && bw_absf(wet_l) <= 1e-6f && bw_absf(wet_r) <= 1e-6f;
+}
+
 static inline void bw_reverb_process1(
 		const bw_reverb_coeffs * BW_RESTRICT coeffs,
 		bw_reverb_state * BW_RESTRICT        state,
@@ -957,7 +1027,7 @@ static inline void bw_reverb_process1(
 	const float n59 = bw_delay_read(&coeffs->delay_dd4_coeffs, &state->delay_dd4_state, coeffs->dd4, 0.f);
 	const float n55 = decay2 - coeffs->diff2 * n59;
 	const float dd4 = n59 + coeffs->diff2 * n55;
-	bw_delay_write(&coeffs->delay_dd2_coeffs, &state->delay_dd2_state, n55);
+	bw_delay_write(&coeffs->delay_dd4_coeffs, &state->delay_dd4_state, n55);
 	bw_delay_write(&coeffs->delay_d2_coeffs, &state->delay_d2_state, dd2);
 	bw_delay_write(&coeffs->delay_d4_coeffs, &state->delay_d4_state, dd4);
 
@@ -979,9 +1049,21 @@ static inline void bw_reverb_process1(
 			- bw_delay_read(&coeffs->delay_dd4_coeffs, &state->delay_dd4_state, coeffs->dr6, 0.f)
 			- bw_delay_read(&coeffs->delay_d4_coeffs, &state->delay_d4_state, coeffs->dr7, 0.f)
 		);
+	const char silent = bw_reverb_is_silent_sample(x_l, x_r, *y_l, *y_r);
 	*y_l = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, x_l, *y_l);
 	*y_r = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, x_r, *y_r);
 
+	if (!silent)
+		state->n_silent = 0;
+	else if (state->n_silent < coeffs->tail_len) {
+		state->n_silent++;
+		if (state->n_silent == coeffs->tail_len) {
+			// the residual tail is cleared, as in bw_reverb_process()
+			float v_l, v_r;
+			bw_reverb_reset_state(coeffs, state, 0.f, 0.f, &v_l, &v_r);
+		}
+	}
+
 	BW_ASSERT_DEEP(bw_reverb_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_reverb_coeffs_state_reset_coeffs);
 	BW_ASSERT_DEEP(bw_reverb_state_is_valid(coeffs, state));
@@ -990,6 +1072,194 @@ static inline void bw_reverb_process1(
 	BW_ASSERT(bw_is_finite(*y_r));
 }
 
+#define BW_REVERB_BLOCK		32
+// below this the ~40 block read/write calls per block cost more than they save
+#define BW_REVERB_BLOCK_MIN	16
+
+// Processes n_samples <= min(coeffs->id2 + 1, BW_REVERB_BLOCK) samples. Since
+// id2 is the shortest delay in the structure, each delay line can be read for
+// the whole block before being written, and hence the structure can be computed
+// stage by stage using block reads and writes. Only audio-rate coefficient
+// updates and recursive filters are computed sample by sample.
+static inline void bw_reverb_process_block(
+		bw_reverb_coeffs * BW_RESTRICT coeffs,
+		bw_reverb_state * BW_RESTRICT  state,
+		const float *                  x_l,
+		const float *                  x_r,
+		float *                        y_l,
+		float *                        y_r,
+		size_t                         n_samples) {
+	const size_t o = n_samples - 1;
+	float a[BW_REVERB_BLOCK], b[BW_REVERB_BLOCK], c[BW_REVERB_BLOCK];
+	float s1[BW_REVERB_BLOCK], s2[BW_REVERB_BLOCK];
+	float n30[BW_REVERB_BLOCK], n54[BW_REVERB_BLOCK];
+	float n39[BW_REVERB_BLOCK], n63[BW_REVERB_BLOCK];
+	float diff2[BW_REVERB_BLOCK], wet[BW_REVERB_BLOCK];
+	size_t dd1i[BW_REVERB_BLOCK], dd3i[BW_REVERB_BLOCK];
+	float dd1f[BW_REVERB_BLOCK], dd3f[BW_REVERB_BLOCK];
+
+	// serial part: coefficients, input filtering, and damping
+	bw_delay_read_block(&coeffs->delay_d1_coeffs, &state->delay_d1_state, coeffs->d1 - o, 0.f, n30, n_samples);
+	bw_delay_read_block(&coeffs->delay_d2_coeffs, &state->delay_d2_state, coeffs->d2 - o, 0.f, n39, n_samples);
+	bw_delay_read_block(&coeffs->delay_d3_coeffs, &state->delay_d3_state, coeffs->d3 - o, 0.f, n54, n_samples);
+	bw_delay_read_block(&coeffs->delay_d4_coeffs, &state->delay_d4_state, coeffs->d4 - o, 0.f, n63, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		bw_reverb_update_coeffs_audio(coeffs);
+		const float pd = bw_delay_process1(&coeffs->predelay_coeffs, &state->predelay_state, 0.5f * (x_l[i] + x_r[i]));
+		a[i] = bw_lp1_process1(&coeffs->bandwidth_coeffs, &state->bandwidth_state, pd);
+		n63[i] = bw_gain_process1(&coeffs->decay_coeffs, n63[i]);
+		n39[i] = bw_gain_process1(&coeffs->decay_coeffs, n39[i]);
+		float dd1if, dd3if;
+		bw_intfracf(coeffs->fs * ((672.f / 29761.f) + coeffs->s), &dd1if, dd1f + i);
+		dd1i[i] = (size_t)dd1if;
+		bw_intfracf(coeffs->fs * ((908.f / 29761.f) + coeffs->s), &dd3if, dd3f + i);
+		dd3i[i] = (size_t)dd3if;
+		const float damp1 = bw_lp1_process1(&coeffs->damping_coeffs, &state->damping_1_state, n30[i]);
+		const float damp2 = bw_lp1_process1(&coeffs->damping_coeffs, &state->damping_2_state, n54[i]);
+		n30[i] = bw_gain_process1(&coeffs->decay_coeffs, damp1);
+		n54[i] = bw_gain_process1(&coeffs->decay_coeffs, damp2);
+		diff2[i] = coeffs->diff2;
+		wet[i] = bw_dry_wet_process1(&coeffs->dry_wet_coeffs, 0.f, 1.f);
+	}
+
+	// input diffusers
+	bw_delay_read_block(&coeffs->delay_id1_coeffs, &state->delay_id1_state, coeffs->id1 - o, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		c[i] = a[i] - 0.75f * b[i];
+		a[i] = b[i] + 0.75f * c[i];
+	}
+	bw_delay_write_block(&coeffs->delay_id1_coeffs, &state->delay_id1_state, c, n_samples);
+	bw_delay_read_block(&coeffs->delay_id2_coeffs, &state->delay_id2_state, coeffs->id2 - o, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		c[i] = a[i] - 0.75f * b[i];
+		a[i] = b[i] + 0.75f * c[i];
+	}
+	bw_delay_write_block(&coeffs->delay_id2_coeffs, &state->delay_id2_state, c, n_samples);
+	bw_delay_read_block(&coeffs->delay_id3_coeffs, &state->delay_id3_state, coeffs->id3 - o, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		c[i] = a[i] - 0.625f * b[i];
+		a[i] = b[i] + 0.625f * c[i];
+	}
+	bw_delay_write_block(&coeffs->delay_id3_coeffs, &state->delay_id3_state, c, n_samples);
+	bw_delay_read_block(&coeffs->delay_id4_coeffs, &state->delay_id4_state, coeffs->id4 - o, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		c[i] = a[i] - 0.625f * b[i];
+		a[i] = b[i] + 0.625f * c[i];
+		s1[i] = a[i] + n63[i];
+		s2[i] = a[i] + n39[i];
+	}
+	bw_delay_write_block(&coeffs->delay_id4_coeffs, &state->delay_id4_state, c, n_samples);
+
+	// tank, both halves at once - modulated delays are also longer than id2
+	for (size_t i = 0; i < n_samples; i++) {
+		a[i] = bw_delay_read(&coeffs->delay_dd1_coeffs, &state->delay_dd1_state, dd1i[i] - i, dd1f[i]);
+		b[i] = bw_delay_read(&coeffs->delay_dd3_coeffs, &state->delay_dd3_state, dd3i[i] - i, dd3f[i]);
+	}
+	for (size_t i = 0; i < n_samples; i++) {
+		const float n23 = s1[i] + 0.7f * a[i];
+		const float n46 = s2[i] + 0.7f * b[i];
+		s1[i] = a[i] - 0.7f * n23;
+		s2[i] = b[i] - 0.7f * n46;
+		a[i] = n23;
+		b[i] = n46;
+	}
+	bw_delay_write_block(&coeffs->delay_dd1_coeffs, &state->delay_dd1_state, a, n_samples);
+	bw_delay_write_block(&coeffs->delay_dd3_coeffs, &state->delay_dd3_state, b, n_samples);
+	bw_delay_write_block(&coeffs->delay_d1_coeffs, &state->delay_d1_state, s1, n_samples);
+	bw_delay_write_block(&coeffs->delay_d3_coeffs, &state->delay_d3_state, s2, n_samples);
+	bw_delay_read_block(&coeffs->delay_dd2_coeffs, &state->delay_dd2_state, coeffs->dd2 - o, 0.f, a, n_samples);
+	bw_delay_read_block(&coeffs->delay_dd4_coeffs, &state->delay_dd4_state, coeffs->dd4 - o, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		const float n31 = n30[i] - diff2[i] * a[i];
+		const float n55 = n54[i] - diff2[i] * b[i];
+		s1[i] = a[i] + diff2[i] * n31;
+		s2[i] = b[i] + diff2[i] * n55;
+		n30[i] = n31;
+		n54[i] = n55;
+	}
+	bw_delay_write_block(&coeffs->delay_dd2_coeffs, &state->delay_dd2_state, n30, n_samples);
+	bw_delay_write_block(&coeffs->delay_dd4_coeffs, &state->delay_dd4_state, n54, n_samples);
+	bw_delay_write_block(&coeffs->delay_d2_coeffs, &state->delay_d2_state, s1, n_samples);
+	bw_delay_write_block(&coeffs->delay_d4_coeffs, &state->delay_d4_state, s2, n_samples);
+
+	// output taps, left in s1 and right in s2
+	bw_delay_read_block(&coeffs->delay_d3_coeffs, &state->delay_d3_state, coeffs->dl1, 0.f, s1, n_samples);
+	bw_delay_read_block(&coeffs->delay_d1_coeffs, &state->delay_d1_state, coeffs->dr1, 0.f, s2, n_samples);
+	bw_delay_read_block(&coeffs->delay_d3_coeffs, &state->delay_d3_state, coeffs->dl2, 0.f, a, n_samples);
+	bw_delay_read_block(&coeffs->delay_d1_coeffs, &state->delay_d1_state, coeffs->dr2, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		s1[i] += a[i];
+		s2[i] += b[i];
+	}
+	bw_delay_read_block(&coeffs->delay_dd4_coeffs, &state->delay_dd4_state, coeffs->dl3, 0.f, a, n_samples);
+	bw_delay_read_block(&coeffs->delay_dd2_coeffs, &state->delay_dd2_state, coeffs->dr3, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		s1[i] -= a[i];
+		s2[i] -= b[i];
+	}
+	bw_delay_read_block(&coeffs->delay_d4_coeffs, &state->delay_d4_state, coeffs->dl4, 0.f, a, n_samples);
+	bw_delay_read_block(&coeffs->delay_d2_coeffs, &state->delay_d2_state, coeffs->dr4, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		s1[i] += a[i];
+		s2[i] += b[i];
+	}
+	bw_delay_read_block(&coeffs->delay_d1_coeffs, &state->delay_d1_state, coeffs->dl5, 0.f, a, n_samples);
+	bw_delay_read_block(&coeffs->delay_d3_coeffs, &state->delay_d3_state, coeffs->dr5, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		s1[i] -= a[i];
+		s2[i] -= b[i];
+	}
+	bw_delay_read_block(&coeffs->delay_dd2_coeffs, &state->delay_dd2_state, coeffs->dl6, 0.f, a, n_samples);
+	bw_delay_read_block(&coeffs->delay_dd4_coeffs, &state->delay_dd4_state, coeffs->dr6, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		s1[i] -= a[i];
+		s2[i] -= b[i];
+	}
+	bw_delay_read_block(&coeffs->delay_d2_coeffs, &state->delay_d2_state, coeffs->dl7, 0.f, a, n_samples);
+	bw_delay_read_block(&coeffs->delay_d4_coeffs, &state->delay_d4_state, coeffs->dr7, 0.f, b, n_samples);
+	for (size_t i = 0; i < n_samples; i++) {
+		s1[i] -= a[i];
+		s2[i] -= b[i];
+	}
+
+	// silence detection, counted sample by sample as in bw_reverb_process1(),
+	// to be done before outputs are written as well
+	const size_t n_silent_prev = state->n_silent;
+	for (size_t i = 0; i < n_samples; i++) {
+		s1[i] = 0.6f * s1[i];
+		s2[i] = 0.6f * s2[i];
+		if (!bw_reverb_is_silent_sample(x_l[i], x_r[i], s1[i], s2[i]))
+			state->n_silent = 0;
+		else if (state->n_silent < coeffs->tail_len)
+			state->n_silent++;
+	}
+
+	// dry/wet, inputs are read before writing outputs as buffers may be shared
+	for (size_t i = 0; i < n_samples; i++) {
+		const float xl = x_l[i];
+		const float xr = x_r[i];
+		y_l[i] = wet[i] * (s1[i] - xl) + xl;
+		y_r[i] = wet[i] * (s2[i] - xr) + xr;
+	}
+
+	// the residual tail is cleared so that processing can be bypassed - unlike
+	// bw_reverb_process1() this happens at the end of the block
+	if (state->n_silent == coeffs->tail_len && n_silent_prev < coeffs->tail_len) {
+		float v_l, v_r;
+		bw_reverb_reset_state(coeffs, state, 0.f, 0.f, &v_l, &v_r);
+	}
+}
+
+static inline char bw_reverb_is_silent_block(
+		const bw_reverb_coeffs * BW_RESTRICT coeffs,
+		const bw_reverb_state * BW_RESTRICT  state,
+		const float *                        x_l,
+		const float *                        x_r,
+		size_t                               n_samples) {
+	return bw_reverb_is_silent(coeffs, state) && bw_has_only_zeros(x_l, n_samples)
+		&& bw_has_only_zeros(x_r, n_samples);
+}
+
 static inline void bw_reverb_process(
 		bw_reverb_coeffs * BW_RESTRICT coeffs,
 		bw_reverb_state * BW_RESTRICT  state,
@@ -1013,9 +1283,21 @@ static inline void bw_reverb_process(
 	BW_ASSERT(y_l != y_r);
 
 	bw_reverb_update_coeffs_ctrl(coeffs);
-	for (size_t i = 0; i < n_samples; i++) {
-		bw_reverb_update_coeffs_audio(coeffs);
-		bw_reverb_process1(coeffs, state, x_l[i], x_r[i], y_l + i, y_r + i);
+	const size_t b = coeffs->id2 < BW_REVERB_BLOCK ? coeffs->id2 + 1 : BW_REVERB_BLOCK;
+	for (size_t i = 0; i < n_samples; i += b) {
+		const size_t m = n_samples - i < b ? n_samples - i : b;
+		if (bw_reverb_is_silent_block(coeffs, state, x_l + i, x_r + i, m)) {
+			for (size_t k = 0; k < m; k++)
+				bw_reverb_update_coeffs_audio(coeffs);
+			bw_buf_fill(0.f, y_l + i, m);
+			bw_buf_fill(0.f, y_r + i, m);
+		} else if (m < BW_REVERB_BLOCK_MIN)
+			for (size_t j = i; j < i + m; j++) {
+				bw_reverb_update_coeffs_audio(coeffs);
+				bw_reverb_process1(coeffs, state, x_l[j], x_r[j], y_l + j, y_r + j);
+			}
+		else
+			bw_reverb_process_block(coeffs, state, x_l + i, x_r + i, y_l + i, y_r + i, m);
 	}
 
 	BW_ASSERT_DEEP(bw_reverb_coeffs_is_valid(coeffs));
@@ -1082,10 +1364,29 @@ static inline void bw_reverb_process_multi(
 #endif
 
 	bw_reverb_update_coeffs_ctrl(coeffs);
-	for (size_t i = 0; i < n_samples; i++) {
-		bw_reverb_update_coeffs_audio(coeffs);
-		for (size_t j = 0; j < n_channels; j++)
-			bw_reverb_process1(coeffs, state[j], x_l[j][i], x_r[j][i], y_l[j] + i, y_r[j] + i);
+	const size_t b = coeffs->id2 < BW_REVERB_BLOCK ? coeffs->id2 + 1 : BW_REVERB_BLOCK;
+	for (size_t i = 0; i < n_samples; i += b) {
+		const size_t m = n_samples - i < b ? n_samples - i : b;
+		// all channels but the last work on a copy of coeffs, so that they
+		// all get the same audio-rate coefficient updates
+		for (size_t j = 0; j + 1 < n_channels; j++)
+			if (bw_reverb_is_silent_block(coeffs, state[j], x_l[j] + i, x_r[j] + i, m)) {
+				bw_buf_fill(0.f, y_l[j] + i, m);
+				bw_buf_fill(0.f, y_r[j] + i, m);
+			} else {
+				bw_reverb_coeffs c = *coeffs;
+				bw_reverb_process_block(&c, state[j], x_l[j] + i, x_r[j] + i, y_l[j] + i, y_r[j] + i, m);
+			}
+		if (n_channels > 0) {
+			const size_t j = n_channels - 1;
+			if (bw_reverb_is_silent_block(coeffs, state[j], x_l[j] + i, x_r[j] + i, m)) {
+				for (size_t k = 0; k < m; k++)
+					bw_reverb_update_coeffs_audio(coeffs);
+				bw_buf_fill(0.f, y_l[j] + i, m);
+				bw_buf_fill(0.f, y_r[j] + i, m);
+			} else
+				bw_reverb_process_block(coeffs, state[j], x_l[j] + i, x_r[j] + i, y_l[j] + i, y_r[j] + i, m);
+		}
 	}
 
 	BW_ASSERT_DEEP(bw_reverb_coeffs_is_valid(coeffs));
@@ -1174,6 +1475,19 @@ static inline void bw_reverb_set_wet(
 	BW_ASSERT_DEEP(coeffs->state >= bw_reverb_coeffs_state_init);
 }
 
+static inline char bw_reverb_is_silent(
+		const bw_reverb_coeffs * BW_RESTRICT coeffs,
+		const bw_reverb_state * BW_RESTRICT  state) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_reverb_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_reverb_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_reverb_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_reverb_state_state_reset_state);
+
+	return state->n_silent >= coeffs->tail_len;
+}
+
 static inline char bw_reverb_coeffs_is_valid(
 		const bw_reverb_coeffs * BW_RESTRICT coeffs) {
 	BW_ASSERT(coeffs != BW_NULL);
@@ -1211,6 +1525,8 @@ static inline char bw_reverb_coeffs_is_valid(
 			return 0;
 		if (!bw_phase_gen_state_is_valid(&coeffs->phase_gen_coeffs, &coeffs->phase_gen_state))
 			return 0;
+		if (!bw_osc_sin_state_is_valid(&coeffs->osc_sin_state))
+			return 0;
 	}
 #endif
 
@@ -1269,6 +1585,8 @@ static inline char bw_reverb_state_is_valid(
 		&& bw_delay_state_is_valid(coeffs ? &coeffs->delay_d4_coeffs : BW_NULL, &state->delay_d4_state);
 }
 
+#undef BW_REVERB_BLOCK
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 }
 #endif
@@ -1358,6 +1676,9 @@ public:
 
 	void setWet(
 		float value);
+
+	char isSilent(
+		size_t channel);
 /*! <<<...
  *  }
  *  ```
@@ -1535,6 +1856,12 @@ inline void Reverb<N_CHANNELS>::setWet(
 	bw_reverb_set_wet(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline char Reverb<N_CHANNELS>::isSilent(
+		size_t channel) {
+	return bw_reverb_is_silent(&coeffs, states + channel);
+}
+
 }
 #endif
 
@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_math bw_one_pole }}}
  *  description {{{
  *    Antialiased tanh-based saturation with parametric bias and gain
@@ -42,9 +42,29 @@
  *    Nonlinear Waveshaping Using Continuous-Time Convolution", Proc. 19th Intl.
  *    Conf. Digital Audio Effects (DAFx-16), pp. 137-144, Brno, Czech Republic,
  *    September 2016.
+ *
+ *    Optionally, second-order antialiasing can be used, which further reduces
+ *    aliasing at the expense of more attenuation at higher frequencies (about
+ *    9.5 dB at 0.5 × Nyquist frequency) and a latency of 1 sample (as opposed
+ *    to half a sample). This is described in
+ *
+ *    S. Bilbao, F. Esqueda, J. D. Parker, and V. Välimäki, "Antiderivative
+ *    Antialiasing for Memoryless Nonlinearities", IEEE Signal Processing
+ *    Letters, vol. 24, no. 7, pp. 1049-1053, July 2017.
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *          <li>Added optional second-order antialiasing,
+ *              <code>bw_satur_set_antialiasing_order()</code>,
+ *              <code>bw_satur_process1_aa2()</code>, and
+ *              <code>bw_satur_process1_aa2_comp()</code>, and updated C++ API
+ *              in this regard.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -248,7 +268,28 @@ static inline float bw_satur_process1_comp(
  *     * `bw_satur_process1()` assumes that gain compensation is disabled;
  *     * `bw_satur_process1_comp()` assumes that gain compensation is enabled.
  *
- *    The actual gain compensation parameter value is ignored.
+ *    They perform first-order antialiasing.
+ *
+ *    The actual gain compensation and antialiasing order parameter values are
+ *    ignored.
+ *
+ *    #### bw_satur_process1_aa2()
+ *  ```>>> */
+static inline float bw_satur_process1_aa2(
+	const bw_satur_coeffs * BW_RESTRICT coeffs,
+	bw_satur_state * BW_RESTRICT        state,
+	float                               x);
+
+static inline float bw_satur_process1_aa2_comp(
+	const bw_satur_coeffs * BW_RESTRICT coeffs,
+	bw_satur_state * BW_RESTRICT        state,
+	float                               x);
+/*! <<<```
+ *    Like `bw_satur_process1()` and `bw_satur_process1_comp()`, respectively,
+ *    but performing second-order antialiasing.
+ *
+ *    It is possible to switch between first- and second-order antialiasing
+ *    functions at any time without resetting `state`.
  *
  *    #### bw_satur_process()
  *  ```>>> */
@@ -313,6 +354,16 @@ static inline void bw_satur_set_gain_compensation(
  *
  *    Default value: `0` (off).
  *
+ *    #### bw_satur_set_antialiasing_order()
+ *  ```>>> */
+static inline void bw_satur_set_antialiasing_order(
+	bw_satur_coeffs * BW_RESTRICT coeffs,
+	char                          value);
+/*! <<<```
+ *    Sets the antialiasing order `value` (either `1` or `2`) in `coeffs`.
+ *
+ *    Default value: `1`.
+ *
  *    #### bw_satur_coeffs_is_valid()
  *  ```>>> */
 static inline char bw_satur_coeffs_is_valid(
@@ -392,6 +443,7 @@ struct bw_satur_coeffs {
 	float				bias;
 	float				gain;
 	char				gain_compensation;
+	char				antialiasing_order;
 };
 
 struct bw_satur_state {
@@ -403,6 +455,9 @@ struct bw_satur_state {
 	// States
 	float		x_z1;
 	float		F_z1;
+	// second-order antialiasing only
+	float		x_z2;
+	float		D_z1;
 };
 
 static inline float bw_satur_tanhf(
@@ -412,6 +467,52 @@ static inline float bw_satur_tanhf(
 	return xm * axm * (0.01218073260037716f * axm - 0.2750231331124371f) + xm;
 }
 
+// First antiderivative of bw_satur_tanhf()
+static inline float bw_satur_F1(
+		float x) {
+	const float ax = bw_absf(x);
+	return ax >= 2.115287308554551f ? ax - 0.6847736211329452f : ax * ax * ((0.00304518315009429f * ax - 0.09167437770414569f) * ax + 0.5f);
+}
+
+// (F2(x_a) - F2(x_b)) / (x_a - x_b), F2 being the second antiderivative of
+// bw_satur_tanhf(), i.e., the mean of F1 over the interval. It is evaluated as
+// a weighted sum of the means over each piece of F1, which are computed in
+// closed form without subtractions of nearly equal quantities.
+static inline float bw_satur_F1_mean(
+		float x_a,
+		float x_b) {
+	const float d = x_a - x_b;
+	if (d * d < 1e-12f)
+		return bw_satur_F1(0.5f * (x_a + x_b));
+	// x <= -k: F1(x) = -x - 0.6847...
+	const float al = bw_minf(x_a, -2.115287308554551f);
+	const float bl = bw_minf(x_b, -2.115287308554551f);
+	const float ml = -0.5f * (al + bl) - 0.6847736211329452f;
+	// -k <= x <= 0: F1(x) = x^2 / 2 + c1 * x^3 + c2 * x^4
+	const float an = bw_clipf(x_a, -2.115287308554551f, 0.f);
+	const float bn = bw_clipf(x_b, -2.115287308554551f, 0.f);
+	const float an2 = an * an;
+	const float bn2 = bn * bn;
+	const float pn = an * bn;
+	const float s2n = an2 + pn + bn2;
+	const float mn = 0.1666666666666667f * s2n + 0.02291859442603642f * (an + bn) * (an2 + bn2) + 0.000609036630018858f * (an2 * an2 + bn2 * bn2 + pn * s2n);
+	// 0 <= x <= k: F1(x) = x^2 / 2 - c1 * x^3 + c2 * x^4
+	const float ap = bw_clipf(x_a, 0.f, 2.115287308554551f);
+	const float bp = bw_clipf(x_b, 0.f, 2.115287308554551f);
+	const float ap2 = ap * ap;
+	const float bp2 = bp * bp;
+	const float pp = ap * bp;
+	const float s2p = ap2 + pp + bp2;
+	const float mp = 0.1666666666666667f * s2p - 0.02291859442603642f * (ap + bp) * (ap2 + bp2) + 0.000609036630018858f * (ap2 * ap2 + bp2 * bp2 + pp * s2p);
+	// x >= k: F1(x) = x - 0.6847...
+	const float ar = bw_maxf(x_a, 2.115287308554551f);
+	const float br = bw_maxf(x_b, 2.115287308554551f);
+	const float mr = 0.5f * (ar + br) - 0.6847736211329452f;
+	// not using bw_rcpf() here since the error would get amplified when
+	// taking differences of the results
+	return ((al - bl) * ml + (an - bn) * mn + (ap - bp) * mp + (ar - br) * mr) / d;
+}
+
 static inline void bw_satur_init(
 		bw_satur_coeffs * BW_RESTRICT coeffs) {
 	BW_ASSERT(coeffs != BW_NULL);
@@ -422,6 +523,7 @@ static inline void bw_satur_init(
 	coeffs->bias = 0.f;
 	coeffs->gain = 1.f;
 	coeffs->gain_compensation = 0;
+	coeffs->antialiasing_order = 1;
 
 #ifdef BW_DEBUG_DEEP
 	coeffs->hash = bw_hash_sdbm("bw_satur_coeffs");
@@ -461,7 +563,7 @@ static inline void bw_satur_do_update_coeffs(
 	float gain_cur = bw_one_pole_get_y_z1(&coeffs->smooth_gain_state);
 	if (force || coeffs->gain != gain_cur) {
 		gain_cur = bw_one_pole_process1_sticky_rel(&coeffs->smooth_coeffs, &coeffs->smooth_gain_state, coeffs->gain);
-		coeffs->inv_gain = bw_rcpf(gain_cur);
+		coeffs->inv_gain = bw_rcpf_ctrl(gain_cur);
 	}
 }
 
@@ -500,6 +602,8 @@ static inline float bw_satur_reset_state(
 	const float y = (coeffs->gain_compensation ? coeffs->inv_gain : 1.f) * (yb - coeffs->bias_dc);
 	state->x_z1 = x;
 	state->F_z1 = F;
+	state->x_z2 = x;
+	state->D_z1 = F;
 
 #ifdef BW_DEBUG_DEEP
 	state->hash = bw_hash_sdbm("bw_satur_state");
@@ -582,6 +686,10 @@ static inline float bw_satur_process1(
 	const float y = yb - coeffs->bias_dc;
 	state->x_z1 = x;
 	state->F_z1 = F;
+	// as if the last two inputs were equal, to allow switching to
+	// second-order antialiasing
+	state->x_z2 = x;
+	state->D_z1 = F;
 
 	BW_ASSERT_DEEP(bw_satur_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_reset_coeffs);
@@ -612,6 +720,69 @@ static inline float bw_satur_process1_comp(
 	return y;
 }
 
+static inline float bw_satur_process1_aa2(
+		const bw_satur_coeffs * BW_RESTRICT coeffs,
+		bw_satur_state * BW_RESTRICT        state,
+		float                               x) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_satur_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_satur_state_is_valid(coeffs, state));
+	BW_ASSERT(bw_is_finite(x));
+
+	x = bw_one_pole_get_y_z1(&coeffs->smooth_gain_state) * x + bw_one_pole_get_y_z1(&coeffs->smooth_bias_state);
+	const float D = bw_satur_F1_mean(x, state->x_z1);
+	const float d = x - state->x_z2;
+	// F1 grows linearly past the knee, hence the error on D - D_z1 scales with input magnitude
+	const float m = bw_maxf(1.f, bw_maxf(bw_maxf(bw_absf(x), bw_absf(state->x_z1)), bw_absf(state->x_z2)));
+	const float t = 1e-4f * m * m;
+	float yb;
+	if (d * d >= t)
+		yb = 2.f * (D - state->D_z1) * bw_rcpf(d);
+	else {
+		// x ~= x_z2
+		const float xm = 0.5f * (x + state->x_z2);
+		const float dm = xm - state->x_z1;
+		yb = dm * dm < t ? bw_satur_tanhf(0.5f * (xm + state->x_z1)) : 2.f * (bw_satur_F1(xm) - bw_satur_F1_mean(xm, state->x_z1)) * bw_rcpf(dm);
+	}
+	// residual rounding error must not push the output past the curve's range
+	yb = bw_clipf(yb, -1.f, 1.f);
+	const float y = yb - coeffs->bias_dc;
+	state->x_z2 = state->x_z1;
+	state->x_z1 = x;
+	state->D_z1 = D;
+	state->F_z1 = bw_satur_F1(x);
+
+	BW_ASSERT_DEEP(bw_satur_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_satur_state_is_valid(coeffs, state));
+	BW_ASSERT(bw_is_finite(y));
+
+	return y;
+}
+
+static inline float bw_satur_process1_aa2_comp(
+		const bw_satur_coeffs * BW_RESTRICT coeffs,
+		bw_satur_state * BW_RESTRICT        state,
+		float                               x) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_satur_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_satur_state_is_valid(coeffs, state));
+	BW_ASSERT(bw_is_finite(x));
+
+	const float y = coeffs->inv_gain * bw_satur_process1_aa2(coeffs, state, x);
+
+	BW_ASSERT_DEEP(bw_satur_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_satur_state_is_valid(coeffs, state));
+	BW_ASSERT(bw_is_finite(y));
+
+	return y;
+}
+
 static inline void bw_satur_process(
 		bw_satur_coeffs * BW_RESTRICT coeffs,
 		bw_satur_state * BW_RESTRICT  state,
@@ -627,16 +798,29 @@ static inline void bw_satur_process(
 	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
 	BW_ASSERT(y != BW_NULL);
 
-	if (coeffs->gain_compensation)
-		for (size_t i = 0; i < n_samples; i++) {
-			bw_satur_update_coeffs_audio(coeffs);
-			y[i] = bw_satur_process1_comp(coeffs, state, x[i]);
-		}
-	else
-		for (size_t i = 0; i < n_samples; i++) {
-			bw_satur_update_coeffs_audio(coeffs);
-			y[i] = bw_satur_process1(coeffs, state, x[i]);
-		}
+	if (coeffs->antialiasing_order == 2) {
+		if (coeffs->gain_compensation)
+			for (size_t i = 0; i < n_samples; i++) {
+				bw_satur_update_coeffs_audio(coeffs);
+				y[i] = bw_satur_process1_aa2_comp(coeffs, state, x[i]);
+			}
+		else
+			for (size_t i = 0; i < n_samples; i++) {
+				bw_satur_update_coeffs_audio(coeffs);
+				y[i] = bw_satur_process1_aa2(coeffs, state, x[i]);
+			}
+	} else {
+		if (coeffs->gain_compensation)
+			for (size_t i = 0; i < n_samples; i++) {
+				bw_satur_update_coeffs_audio(coeffs);
+				y[i] = bw_satur_process1_comp(coeffs, state, x[i]);
+			}
+		else
+			for (size_t i = 0; i < n_samples; i++) {
+				bw_satur_update_coeffs_audio(coeffs);
+				y[i] = bw_satur_process1(coeffs, state, x[i]);
+			}
+	}
 
 	BW_ASSERT_DEEP(bw_satur_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_reset_coeffs);
@@ -681,18 +865,33 @@ static inline void bw_satur_process_multi(
 #endif
 
 	bw_satur_update_coeffs_ctrl(coeffs);
-	if (coeffs->gain_compensation)
-		for (size_t i = 0; i < n_samples; i++) {
-			bw_satur_update_coeffs_audio(coeffs);
-			for (size_t j = 0; j < n_channels; j++)
-				y[j][i] = bw_satur_process1_comp(coeffs, state[j], x[j][i]);
-		}
-	else
-		for (size_t i = 0; i < n_samples; i++) {
-			bw_satur_update_coeffs_audio(coeffs);
-			for (size_t j = 0; j < n_channels; j++)
-				y[j][i] = bw_satur_process1(coeffs, state[j], x[j][i]);
-		}
+	if (coeffs->antialiasing_order == 2) {
+		if (coeffs->gain_compensation)
+			for (size_t i = 0; i < n_samples; i++) {
+				bw_satur_update_coeffs_audio(coeffs);
+				for (size_t j = 0; j < n_channels; j++)
+					y[j][i] = bw_satur_process1_aa2_comp(coeffs, state[j], x[j][i]);
+			}
+		else
+			for (size_t i = 0; i < n_samples; i++) {
+				bw_satur_update_coeffs_audio(coeffs);
+				for (size_t j = 0; j < n_channels; j++)
+					y[j][i] = bw_satur_process1_aa2(coeffs, state[j], x[j][i]);
+			}
+	} else {
+		if (coeffs->gain_compensation)
+			for (size_t i = 0; i < n_samples; i++) {
+				bw_satur_update_coeffs_audio(coeffs);
+				for (size_t j = 0; j < n_channels; j++)
+					y[j][i] = bw_satur_process1_comp(coeffs, state[j], x[j][i]);
+			}
+		else
+			for (size_t i = 0; i < n_samples; i++) {
+				bw_satur_update_coeffs_audio(coeffs);
+				for (size_t j = 0; j < n_channels; j++)
+					y[j][i] = bw_satur_process1(coeffs, state[j], x[j][i]);
+			}
+	}
 
 	BW_ASSERT_DEEP(bw_satur_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_reset_coeffs);
@@ -747,6 +946,20 @@ static inline void bw_satur_set_gain_compensation(
 	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_init);
 }
 
+static inline void bw_satur_set_antialiasing_order(
+		bw_satur_coeffs * BW_RESTRICT coeffs,
+		char                          value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_satur_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_init);
+	BW_ASSERT(value == 1 || value == 2);
+
+	coeffs->antialiasing_order = value;
+
+	BW_ASSERT_DEEP(bw_satur_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_satur_coeffs_state_init);
+}
+
 static inline char bw_satur_coeffs_is_valid(
 		const bw_satur_coeffs * BW_RESTRICT coeffs) {
 	BW_ASSERT(coeffs != BW_NULL);
@@ -762,6 +975,8 @@ static inline char bw_satur_coeffs_is_valid(
 		return 0;
 	if (!bw_is_finite(coeffs->gain) || coeffs->gain < 1e-12f || coeffs->gain > 1e12f)
 		return 0;
+	if (coeffs->antialiasing_order != 1 && coeffs->antialiasing_order != 2)
+		return 0;
 
 	if (!bw_one_pole_coeffs_is_valid(&coeffs->smooth_coeffs))
 		return 0;
@@ -798,7 +1013,7 @@ static inline char bw_satur_state_is_valid(
 
 	(void)coeffs;
 
-	return bw_is_finite(state->x_z1) && bw_is_finite(state->F_z1);
+	return bw_is_finite(state->x_z1) && bw_is_finite(state->F_z1) && bw_is_finite(state->x_z2) && bw_is_finite(state->D_z1);
 }
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
@@ -866,6 +1081,9 @@ public:
 
 	void setGainCompensation(
 		bool value);
+
+	void setAntialiasingOrder(
+		char value);
 /*! <<<...
  *  }
  *  ```
@@ -970,6 +1188,12 @@ inline void Satur<N_CHANNELS>::setGainCompensation(
 	bw_satur_set_gain_compensation(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline void Satur<N_CHANNELS>::setAntialiasingOrder(
+		char value) {
+	bw_satur_set_antialiasing_order(&coeffs, value);
+}
+
 }
 #endif
 
@@ -0,0 +1,707 @@
+/*
+ * Brickworks
+ *
+ * Copyright (C) 2026 Orastron Srl unipersonale
+ *
+ * Brickworks is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * Brickworks is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Brickworks.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File author: Stefano D'Angelo
+ */
+
+/*!
+ *  module_type {{{ utility }}}
+ *  version {{{ 1.0.0 }}}
+ *  requires {{{ bw_common bw_iir2 bw_math }}}
+ *  description {{{
+ *    Cascade of second-order IIR filters (biquads, second-order sections) in
+ *    TDF-II form.
+ *
+ *    Each section behaves exactly like [bw_iir2](bw_iir2), whose
+ *    `bw_iir2_coeffs_*()` functions can be used to compute the coefficients
+ *    of individual sections, e.g.:
+ *
+ *    ```
+ *    for (size_t i = 0; i < n_sections; i++)
+ *        bw_iir2_coeffs_lp2(sample_rate, cutoff, Q[i], 1, 0.f,
+ *            b0 + i, b1 + i, b2 + i, a1 + i, a2 + i);
+ *    ```
+ *
+ *    Coefficients are stored in five arrays (`b0`, `b1`, `b2`, `a1`, and
+ *    `a2`) of `n_sections` elements each, where the `i`-th element refers to
+ *    the `i`-th section, and the same goes for states (`s1` and `s2`). Block
+ *    processing is pipelined across sections, so that section `i + 1`
+ *    processes a few samples while section `i` processes the following ones,
+ *    and compilers can vectorize computations over groups of sections. Output
+ *    is identical to that of the equivalent chain of `bw_iir2_process()`
+ *    calls.
+ *
+ *    This is not a regular DSP module, as it exposes state and coefficients,
+ *    and it's not appropriate for time-varying operation.
+ *  }}}
+ *  changelog {{{
+ *    <ul>
+ *      <li>Version <strong>1.0.0</strong>:
+ *        <ul>
+ *          <li>First release.</li>
+ *        </ul>
+ *      </li>
+ *    </ul>
+ *  }}}
+ */
+
+#ifndef BW_SOS_H
+#define BW_SOS_H
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_common.h"
+#else
+# include <bw_common.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+/*** Public API ***/
+
+/*! api {{{
+ *    #### bw_sos_reset()
+ *  ```>>> */
+static inline void bw_sos_reset(
+	float               x_0,
+	float *             y_0,
+	float * BW_RESTRICT s1_0,
+	float * BW_RESTRICT s2_0,
+	const float *       b0,
+	const float *       b1,
+	const float *       b2,
+	const float *       a1,
+	const float *       a2,
+	size_t              n_sections);
+/*! <<<```
+ *    Computes and puts the initial output in `y_0` and the initial states of
+ *    each of the `n_sections` sections in `s1_0` and `s2_0`, given the initial
+ *    input `x_0` and coefficient arrays `b0`, `b1`, `b2`, `a1`, and `a2`.
+ *
+ *    `y_0` may be `BW_NULL`, in which case the initial output is not written
+ *    anywhere.
+ *
+ *    `n_sections` must be positive and the given coefficients must describe
+ *    stable filters.
+ *
+ *    #### bw_sos_reset_multi()
+ *  ```>>> */
+static inline void bw_sos_reset_multi(
+	const float *       x_0,
+	float *             y_0,
+	float * BW_RESTRICT s1_0,
+	float * BW_RESTRICT s2_0,
+	const float *       b0,
+	const float *       b1,
+	const float *       b2,
+	const float *       a1,
+	const float *       a2,
+	size_t              n_sections,
+	size_t              n_channels);
+/*! <<<```
+ *    Computes and puts each of the `n_channels` initial outputs in `y_0` and
+ *    initial states in `s1_0` and `s2_0`, given the corresponding initial
+ *    inputs `x_0` and coefficient arrays `b0`, `b1`, `b2`, `a1`, and `a2`.
+ *
+ *    `s1_0` and `s2_0` must each contain `n_sections * n_channels` values,
+ *    where states of channel `j` start at index `j * n_sections`.
+ *
+ *    `y_0` may be `BW_NULL`, in which case the initial outputs are not written
+ *    anywhere.
+ *
+ *    `n_sections` must be positive and the given coefficients must describe
+ *    stable filters.
+ *
+ *    #### bw_sos_process1()
+ *  ```>>> */
+static inline void bw_sos_process1(
+	float               x,
+	float * BW_RESTRICT y,
+	float * BW_RESTRICT s1,
+	float * BW_RESTRICT s2,
+	const float *       b0,
+	const float *       b1,
+	const float *       b2,
+	const float *       a1,
+	const float *       a2,
+	size_t              n_sections);
+/*! <<<```
+ *    Processes one input sample `x` through the `n_sections` sections using
+ *    coefficient arrays `b0`, `b1`, `b2`, `a1`, and `a2`. The output sample
+ *    and next states values are put in `y` and `s1`/`s2` respectively.
+ *
+ *    `n_sections` must be positive and the given coefficients must describe
+ *    stable filters.
+ *
+ *    #### bw_sos_process()
+ *  ```>>> */
+static inline void bw_sos_process(
+	const float *       x,
+	float *             y,
+	float * BW_RESTRICT s1,
+	float * BW_RESTRICT s2,
+	const float *       b0,
+	const float *       b1,
+	const float *       b2,
+	const float *       a1,
+	const float *       a2,
+	size_t              n_sections,
+	size_t              n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the input buffer `x` through the
+ *    `n_sections` sections and fills the first `n_samples` of the output
+ *    buffer `y`, while using coefficient arrays `b0`, `b1`, `b2`, `a1`, and
+ *    `a2`. The next state values are put in `s1` and `s2`.
+ *
+ *    `n_sections` must be positive and the given coefficients must describe
+ *    stable filters.
+ *
+ *    #### bw_sos_process_multi()
+ *  ```>>> */
+static inline void bw_sos_process_multi(
+	const float * const * x,
+	float * const *       y,
+	float * BW_RESTRICT   s1,
+	float * BW_RESTRICT   s2,
+	const float *         b0,
+	const float *         b1,
+	const float *         b2,
+	const float *         a1,
+	const float *         a2,
+	size_t                n_sections,
+	size_t                n_channels,
+	size_t                n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the `n_channels` input buffers `x`
+ *    through the `n_sections` sections and fills the first `n_samples` of the
+ *    `n_channels` output buffers `y`, while using coefficient arrays `b0`,
+ *    `b1`, `b2`, `a1`, and `a2`. The next state values are put in `s1` and
+ *    `s2`.
+ *
+ *    `s1` and `s2` must each contain `n_sections * n_channels` values, where
+ *    states of channel `j` start at index `j * n_sections`.
+ *
+ *    `n_sections` must be positive and the given coefficients must describe
+ *    stable filters.
+ *
+ *    #### bw_sos_coeffs_is_valid()
+ *  ```>>> */
+static inline char bw_sos_coeffs_is_valid(
+	const float * b0,
+	const float * b1,
+	const float * b2,
+	const float * a1,
+	const float * a2,
+	size_t        n_sections);
+/*! <<<```
+ *    Determines whether all of the first `n_sections` values in `b0`, `b1`,
+ *    `b2`, `a1`, and `a2` are valid and describe stable or marginally stable
+ *    filters.
+ *
+ *    It returns non-`0` if it is the case and `0` otherwise.
+ *  }}} */
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_iir2.h"
+#else
+# include <bw_iir2.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+#define BW_SOS_LANES	8
+#define BW_SOS_BLOCK	4
+
+static inline void bw_sos_reset(
+		float               x_0,
+		float *             y_0,
+		float * BW_RESTRICT s1_0,
+		float * BW_RESTRICT s2_0,
+		const float *       b0,
+		const float *       b1,
+		const float *       b2,
+		const float *       a1,
+		const float *       a2,
+		size_t              n_sections) {
+	BW_ASSERT(bw_is_finite(x_0));
+	BW_ASSERT(s1_0 != BW_NULL);
+	BW_ASSERT(s2_0 != BW_NULL);
+	BW_ASSERT(s1_0 != s2_0);
+	BW_ASSERT(y_0 == BW_NULL || (y_0 != s1_0 && y_0 != s2_0));
+	BW_ASSERT(n_sections > 0);
+	BW_ASSERT(bw_sos_coeffs_is_valid(b0, b1, b2, a1, a2, n_sections));
+
+	float v = x_0;
+	for (size_t i = 0; i < n_sections; i++)
+		bw_iir2_reset(v, &v, s1_0 + i, s2_0 + i, b0[i], b1[i], b2[i], a1[i], a2[i]);
+	if (y_0 != BW_NULL)
+		*y_0 = v;
+
+	BW_ASSERT(y_0 != BW_NULL ? bw_is_finite(*y_0) : 1);
+	BW_ASSERT_DEEP(bw_has_only_finite(s1_0, n_sections));
+	BW_ASSERT_DEEP(bw_has_only_finite(s2_0, n_sections));
+}
+
+static inline void bw_sos_reset_multi(
+		const float *       x_0,
+		float *             y_0,
+		float * BW_RESTRICT s1_0,
+		float * BW_RESTRICT s2_0,
+		const float *       b0,
+		const float *       b1,
+		const float *       b2,
+		const float *       a1,
+		const float *       a2,
+		size_t              n_sections,
+		size_t              n_channels) {
+	BW_ASSERT(x_0 != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x_0, n_channels));
+	BW_ASSERT(s1_0 != BW_NULL);
+	BW_ASSERT(s2_0 != BW_NULL);
+	BW_ASSERT(s1_0 != s2_0);
+	BW_ASSERT(x_0 != s1_0 && x_0 != s2_0);
+	BW_ASSERT(y_0 == BW_NULL || (y_0 != s1_0 && y_0 != s2_0));
+	BW_ASSERT(n_sections > 0);
+	BW_ASSERT(bw_sos_coeffs_is_valid(b0, b1, b2, a1, a2, n_sections));
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_sos_reset(x_0[i], y_0 != BW_NULL ? y_0 + i : BW_NULL, s1_0 + i * n_sections, s2_0 + i * n_sections, b0, b1, b2, a1, a2, n_sections);
+
+	BW_ASSERT_DEEP(y_0 != BW_NULL ? bw_has_only_finite(y_0, n_channels) : 1);
+	BW_ASSERT_DEEP(bw_has_only_finite(s1_0, n_sections * n_channels));
+	BW_ASSERT_DEEP(bw_has_only_finite(s2_0, n_sections * n_channels));
+}
+
+static inline void bw_sos_process1(
+		float               x,
+		float * BW_RESTRICT y,
+		float * BW_RESTRICT s1,
+		float * BW_RESTRICT s2,
+		const float *       b0,
+		const float *       b1,
+		const float *       b2,
+		const float *       a1,
+		const float *       a2,
+		size_t              n_sections) {
+	BW_ASSERT(bw_is_finite(x));
+	BW_ASSERT(y != BW_NULL);
+	BW_ASSERT(s1 != BW_NULL);
+	BW_ASSERT(s2 != BW_NULL);
+	BW_ASSERT(s1 != s2);
+	BW_ASSERT(n_sections > 0);
+	BW_ASSERT_DEEP(bw_has_only_finite(s1, n_sections));
+	BW_ASSERT_DEEP(bw_has_only_finite(s2, n_sections));
+	BW_ASSERT(bw_sos_coeffs_is_valid(b0, b1, b2, a1, a2, n_sections));
+
+	float v = x;
+	for (size_t i = 0; i < n_sections; i++)
+		bw_iir2_process1(v, &v, s1 + i, s2 + i, b0[i], b1[i], b2[i], a1[i], a2[i]);
+	*y = v;
+
+	BW_ASSERT(bw_is_finite(*y));
+	BW_ASSERT_DEEP(bw_has_only_finite(s1, n_sections));
+	BW_ASSERT_DEEP(bw_has_only_finite(s2, n_sections));
+}
+
+static inline void bw_sos_process_lanes(
+		const float * BW_RESTRICT b0,
+		const float * BW_RESTRICT b1,
+		const float * BW_RESTRICT b2,
+		const float * BW_RESTRICT a1,
+		const float * BW_RESTRICT a2,
+		float (* BW_RESTRICT x)[BW_SOS_LANES],
+		float (* BW_RESTRICT y)[BW_SOS_LANES],
+		float * BW_RESTRICT       s1,
+		float * BW_RESTRICT       s2,
+		size_t                    lane_first,
+		size_t                    lane_last) {
+	for (size_t i = 0; i < BW_SOS_BLOCK; i++)
+		for (size_t j = lane_first; j <= lane_last; j++) {
+			y[i][j] = b0[j] * x[i][j] + s1[j];
+			s1[j] = b1[j] * x[i][j] - a1[j] * y[i][j] + s2[j];
+			s2[j] = b2[j] * x[i][j] - a2[j] * y[i][j];
+		}
+}
+
+static inline void bw_sos_process_lanes_all(
+		const float * BW_RESTRICT b0,
+		const float * BW_RESTRICT b1,
+		const float * BW_RESTRICT b2,
+		const float * BW_RESTRICT a1,
+		const float * BW_RESTRICT a2,
+		float (* BW_RESTRICT x)[BW_SOS_LANES],
+		float (* BW_RESTRICT y)[BW_SOS_LANES],
+		float * BW_RESTRICT       s1,
+		float * BW_RESTRICT       s2) {
+	// Local copies with a fixed number of lanes can be kept in registers.
+	float v_b0[BW_SOS_LANES], v_b1[BW_SOS_LANES], v_b2[BW_SOS_LANES], v_a1[BW_SOS_LANES], v_a2[BW_SOS_LANES], v_s1[BW_SOS_LANES], v_s2[BW_SOS_LANES];
+	for (size_t j = 0; j < BW_SOS_LANES; j++) {
+		v_b0[j] = b0[j];
+		v_b1[j] = b1[j];
+		v_b2[j] = b2[j];
+		v_a1[j] = a1[j];
+		v_a2[j] = a2[j];
+		v_s1[j] = s1[j];
+		v_s2[j] = s2[j];
+	}
+	for (size_t i = 0; i < BW_SOS_BLOCK; i++)
+		for (size_t j = 0; j < BW_SOS_LANES; j++) {
+			const float v = v_b0[j] * x[i][j] + v_s1[j];
+			v_s1[j] = v_b1[j] * x[i][j] - v_a1[j] * v + v_s2[j];
+			v_s2[j] = v_b2[j] * x[i][j] - v_a2[j] * v;
+			y[i][j] = v;
+		}
+	for (size_t j = 0; j < BW_SOS_LANES; j++) {
+		s1[j] = v_s1[j];
+		s2[j] = v_s2[j];
+	}
+}
+
+static inline void bw_sos_process_group(
+		float * BW_RESTRICT       y,
+		float * BW_RESTRICT       s1,
+		float * BW_RESTRICT       s2,
+		const float * BW_RESTRICT b0,
+		const float * BW_RESTRICT b1,
+		const float * BW_RESTRICT b2,
+		const float * BW_RESTRICT a1,
+		const float * BW_RESTRICT a2,
+		size_t                    n_sections,
+		size_t                    n_samples) {
+	// Sections are mapped to lanes and pipelined over blocks of BW_SOS_BLOCK
+	// samples: at step k, lane j processes block k - j, whose input is the
+	// output of lane j - 1 at step k - 1. Lanes beyond n_sections have null
+	// coefficients and states, so that all lanes can be processed at once
+	// when all sections are busy. Remaining samples are processed section by
+	// section.
+	float v_b0[BW_SOS_LANES], v_b1[BW_SOS_LANES], v_b2[BW_SOS_LANES], v_a1[BW_SOS_LANES], v_a2[BW_SOS_LANES], v_s1[BW_SOS_LANES], v_s2[BW_SOS_LANES];
+	float v_x[BW_SOS_BLOCK][BW_SOS_LANES], v_y[BW_SOS_BLOCK][BW_SOS_LANES];
+	for (size_t j = 0; j < BW_SOS_LANES; j++) {
+		const char used = j < n_sections;
+		v_b0[j] = used ? b0[j] : 0.f;
+		v_b1[j] = used ? b1[j] : 0.f;
+		v_b2[j] = used ? b2[j] : 0.f;
+		v_a1[j] = used ? a1[j] : 0.f;
+		v_a2[j] = used ? a2[j] : 0.f;
+		v_s1[j] = used ? s1[j] : 0.f;
+		v_s2[j] = used ? s2[j] : 0.f;
+		for (size_t i = 0; i < BW_SOS_BLOCK; i++)
+			v_y[i][j] = 0.f;
+	}
+
+	const size_t n_blocks = n_samples / BW_SOS_BLOCK;
+	const size_t last = n_sections - 1;
+	if (n_blocks > 0)
+		for (size_t k = 0; k < n_blocks + last; k++) {
+			for (size_t i = 0; i < BW_SOS_BLOCK; i++) {
+				v_x[i][0] = k < n_blocks ? y[BW_SOS_BLOCK * k + i] : 0.f;
+				for (size_t j = 1; j < BW_SOS_LANES; j++)
+					v_x[i][j] = v_y[i][j - 1];
+			}
+			const size_t first = k < n_blocks ? 0 : k - n_blocks + 1;
+			const size_t busy = k < last ? k : last;
+			if (first == 0 && busy == last)
+				bw_sos_process_lanes_all(v_b0, v_b1, v_b2, v_a1, v_a2, v_x, v_y, v_s1, v_s2);
+			else
+				bw_sos_process_lanes(v_b0, v_b1, v_b2, v_a1, v_a2, v_x, v_y, v_s1, v_s2, first, busy);
+			if (k >= last)
+				for (size_t i = 0; i < BW_SOS_BLOCK; i++)
+					y[BW_SOS_BLOCK * (k - last) + i] = v_y[i][last];
+		}
+
+	for (size_t j = 0; j < n_sections; j++) {
+		s1[j] = v_s1[j];
+		s2[j] = v_s2[j];
+	}
+
+	const size_t m = BW_SOS_BLOCK * n_blocks;
+	for (size_t j = 0; j < n_sections; j++)
+		bw_iir2_process(y + m, y + m, s1 + j, s2 + j, b0[j], b1[j], b2[j], a1[j], a2[j], n_samples - m);
+}
+
+static inline void bw_sos_process(
+		const float *       x,
+		float *             y,
+		float * BW_RESTRICT s1,
+		float * BW_RESTRICT s2,
+		const float *       b0,
+		const float *       b1,
+		const float *       b2,
+		const float *       a1,
+		const float *       a2,
+		size_t              n_sections,
+		size_t              n_samples) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, n_samples));
+	BW_ASSERT(y != BW_NULL);
+	BW_ASSERT(s1 != BW_NULL);
+	BW_ASSERT(s2 != BW_NULL);
+	BW_ASSERT(x != s1);
+	BW_ASSERT(y != s1);
+	BW_ASSERT(x != s2);
+	BW_ASSERT(y != s2);
+	BW_ASSERT(s1 != s2);
+	BW_ASSERT(n_sections > 0);
+	BW_ASSERT_DEEP(bw_has_only_finite(s1, n_sections));
+	BW_ASSERT_DEEP(bw_has_only_finite(s2, n_sections));
+	BW_ASSERT(bw_sos_coeffs_is_valid(b0, b1, b2, a1, a2, n_sections));
+
+	if (y != x)
+		for (size_t i = 0; i < n_samples; i++)
+			y[i] = x[i];
+	for (size_t i = 0; i < n_sections; i += BW_SOS_LANES) {
+		const size_t n = n_sections - i < BW_SOS_LANES ? n_sections - i : BW_SOS_LANES;
+		// pipelining doesn't pay off with less than 3 sections
+		if (n < 3)
+			for (size_t j = i; j < i + n; j++)
+				bw_iir2_process(y, y, s1 + j, s2 + j, b0[j], b1[j], b2[j], a1[j], a2[j], n_samples);
+		else
+			bw_sos_process_group(y, s1 + i, s2 + i, b0 + i, b1 + i, b2 + i, a1 + i, a2 + i, n, n_samples);
+	}
+
+	BW_ASSERT_DEEP(bw_has_only_finite(y, n_samples));
+	BW_ASSERT_DEEP(bw_has_only_finite(s1, n_sections));
+	BW_ASSERT_DEEP(bw_has_only_finite(s2, n_sections));
+}
+
+static inline void bw_sos_process_multi(
+		const float * const * x,
+		float * const *       y,
+		float * BW_RESTRICT   s1,
+		float * BW_RESTRICT   s2,
+		const float *         b0,
+		const float *         b1,
+		const float *         b2,
+		const float *         a1,
+		const float *         a2,
+		size_t                n_sections,
+		size_t                n_channels,
+		size_t                n_samples) {
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(y != BW_NULL);
+	BW_ASSERT(s1 != BW_NULL);
+	BW_ASSERT(s2 != BW_NULL);
+	BW_ASSERT(s1 != s2);
+	BW_ASSERT(n_sections > 0);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++) {
+		BW_ASSERT(x[i] != BW_NULL);
+		BW_ASSERT_DEEP(bw_has_only_finite(x[i], n_samples));
+		BW_ASSERT(y[i] != BW_NULL);
+	}
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = i + 1; j < n_channels; j++)
+			BW_ASSERT(y[i] != y[j]);
+	for (size_t i = 0; i < n_channels; i++)
+		for (size_t j = 0; j < n_channels; j++)
+			BW_ASSERT(i == j || x[i] != y[j]);
+#endif
+	BW_ASSERT_DEEP(bw_has_only_finite(s1, n_sections * n_channels));
+	BW_ASSERT_DEEP(bw_has_only_finite(s2, n_sections * n_channels));
+	BW_ASSERT(bw_sos_coeffs_is_valid(b0, b1, b2, a1, a2, n_sections));
+
+	for (size_t i = 0; i < n_channels; i++)
+		bw_sos_process(x[i], y[i], s1 + i * n_sections, s2 + i * n_sections, b0, b1, b2, a1, a2, n_sections, n_samples);
+
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < n_channels; i++)
+		BW_ASSERT_DEEP(bw_has_only_finite(y[i], n_samples));
+#endif
+	BW_ASSERT_DEEP(bw_has_only_finite(s1, n_sections * n_channels));
+	BW_ASSERT_DEEP(bw_has_only_finite(s2, n_sections * n_channels));
+}
+
+static inline char bw_sos_coeffs_is_valid(
+		const float * b0,
+		const float * b1,
+		const float * b2,
+		const float * a1,
+		const float * a2,
+		size_t        n_sections) {
+	char ret = b0 != BW_NULL && b1 != BW_NULL && b2 != BW_NULL && a1 != BW_NULL && a2 != BW_NULL;
+	for (size_t i = 0; i < n_sections && ret; i++)
+		ret = bw_iir2_coeffs_is_valid(b0[i], b1[i], b2[i], a1[i], a2[i]);
+	return ret;
+}
+
+#undef BW_SOS_LANES
+#undef BW_SOS_BLOCK
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+#if !defined(BW_NO_CXX) && defined(__cplusplus)
+
+# ifndef BW_CXX_NO_ARRAY
+#  include <array>
+# endif
+
+namespace Brickworks {
+
+/*** Public C++ API ***/
+
+/*! api_cpp {{{
+ *    ##### Brickworks::sosReset
+ *  ```>>> */
+template<size_t N_CHANNELS = 1>
+void sosReset(
+	const float *       x0,
+	float *             y0,
+	float * BW_RESTRICT s10,
+	float * BW_RESTRICT s20,
+	const float *       b0,
+	const float *       b1,
+	const float *       b2,
+	const float *       a1,
+	const float *       a2,
+	size_t              nSections);
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS = 1>
+void sosReset(
+	std::array<float, N_CHANNELS>               x0,
+	std::array<float, N_CHANNELS> * BW_RESTRICT y0,
+	float * BW_RESTRICT                         s10,
+	float * BW_RESTRICT                         s20,
+	const float *                               b0,
+	const float *                               b1,
+	const float *                               b2,
+	const float *                               a1,
+	const float *                               a2,
+	size_t                                      nSections);
+# endif
+
+template<size_t N_CHANNELS = 1>
+void sosProcess(
+	const float * const * x,
+	float * const *       y,
+	float * BW_RESTRICT   s1,
+	float * BW_RESTRICT   s2,
+	const float *         b0,
+	const float *         b1,
+	const float *         b2,
+	const float *         a1,
+	const float *         a2,
+	size_t                nSections,
+	size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS = 1>
+void sosProcess(
+	std::array<const float *, N_CHANNELS> x,
+	std::array<float *, N_CHANNELS>       y,
+	float * BW_RESTRICT                   s1,
+	float * BW_RESTRICT                   s2,
+	const float *                         b0,
+	const float *                         b1,
+	const float *                         b2,
+	const float *                         a1,
+	const float *                         a2,
+	size_t                                nSections,
+	size_t                                nSamples);
+# endif
+/*! <<<```
+ *  }}} */
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+template<size_t N_CHANNELS>
+inline void sosReset(
+		const float *       x0,
+		float *             y0,
+		float * BW_RESTRICT s10,
+		float * BW_RESTRICT s20,
+		const float *       b0,
+		const float *       b1,
+		const float *       b2,
+		const float *       a1,
+		const float *       a2,
+		size_t              nSections) {
+	bw_sos_reset_multi(x0, y0, s10, s20, b0, b1, b2, a1, a2, nSections, N_CHANNELS);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void sosReset(
+		std::array<float, N_CHANNELS>               x0,
+		std::array<float, N_CHANNELS> * BW_RESTRICT y0,
+		float * BW_RESTRICT                         s10,
+		float * BW_RESTRICT                         s20,
+		const float *                               b0,
+		const float *                               b1,
+		const float *                               b2,
+		const float *                               a1,
+		const float *                               a2,
+		size_t                                      nSections) {
+	sosReset<N_CHANNELS>(x0.data(), y0 != BW_NULL ? y0->data() : BW_NULL, s10, s20, b0, b1, b2, a1, a2, nSections);
+}
+# endif
+
+template<size_t N_CHANNELS>
+inline void sosProcess(
+		const float * const * x,
+		float * const *       y,
+		float * BW_RESTRICT   s1,
+		float * BW_RESTRICT   s2,
+		const float *         b0,
+		const float *         b1,
+		const float *         b2,
+		const float *         a1,
+		const float *         a2,
+		size_t                nSections,
+		size_t                nSamples) {
+	bw_sos_process_multi(x, y, s1, s2, b0, b1, b2, a1, a2, nSections, N_CHANNELS, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_CHANNELS>
+inline void sosProcess(
+		std::array<const float *, N_CHANNELS> x,
+		std::array<float *, N_CHANNELS>       y,
+		float * BW_RESTRICT                   s1,
+		float * BW_RESTRICT                   s2,
+		const float *                         b0,
+		const float *                         b1,
+		const float *                         b2,
+		const float *                         a1,
+		const float *                         a2,
+		size_t                                nSections,
+		size_t                                nSamples) {
+	sosProcess<N_CHANNELS>(x.data(), y.data(), s1, s2, b0, b1, b2, a1, a2, nSections, nSamples);
+}
+# endif
+
+}
+#endif
+
+#endif
@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.5 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{ bw_common bw_math bw_one_pole }}}
  *  description {{{
  *    State variable filter (2nd order, 12 dB/oct) model with separated lowpass,
@@ -28,6 +28,27 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>Control-rate computations now use
+ *              <code>BW_MATH_PRECISION_CTRL</code> precision.</li>
+ *          <li>Added optional denormal killing via
+ *              <code>BW_DENORMAL_KILL</code>.</li>
+ *          <li><code>bw_svf_process_multi()</code> now computes coefficients
+ *              once per sample and processes channels in packed groups that
+ *              can be vectorized.</li>
+ *          <li>Added <code>bw_svf_set_update_interval()</code> and
+ *              <code>setUpdateInterval()</code> to optionally recompute
+ *              coefficients less frequently and interpolate them in
+ *              between.</li>
+ *          <li>Added <code>bw_svf_is_silent()</code> and corresponding C++
+ *              API.</li>
+ *          <li><code>bw_svf_process()</code> and
+ *              <code>bw_svf_process_multi()</code> now skip state updates and
+ *              output zeros when the filter is silent and the input is all
+ *              zeros.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.5</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -343,6 +364,41 @@ static inline void bw_svf_set_prewarp_freq(
  *
  *    Default value: `1e3f`.
  *
+ *    #### bw_svf_set_update_interval()
+ *  ```>>> */
+static inline void bw_svf_set_update_interval(
+	bw_svf_coeffs * BW_RESTRICT coeffs,
+	size_t                      value);
+/*! <<<```
+ *    Sets the coefficient update interval to the given `value` (samples) in
+ *    `coeffs`.
+ *
+ *    If `value` is greater than `1`, while parameters are being smoothed,
+ *    `bw_svf_update_coeffs_audio()` (and hence also `bw_svf_process()` and
+ *    `bw_svf_process_multi()`) only fully recomputes coefficients once every
+ *    `value` samples, targeting the values they will have at the end of the
+ *    interval, and linearly interpolates them in between. This reduces CPU
+ *    usage during parameter changes, but changes happening in the middle of an
+ *    interval only take effect at the beginning of the next one.
+ *
+ *    `value` must be positive.
+ *
+ *    Default value: `1`.
+ *
+ *    #### bw_svf_is_silent()
+ *  ```>>> */
+static inline char bw_svf_is_silent(
+	const bw_svf_coeffs * BW_RESTRICT coeffs,
+	const bw_svf_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Returns non-`0` if the internal state of the filter in `state` is all
+ *    zeros, that is, if it would output zeros for as long as the input is
+ *    zero, `0` otherwise.
+ *
+ *    `bw_svf_process()` and `bw_svf_process_multi()` only update `coeffs` and
+ *    output zeros when this condition is met and the input buffers (or, for
+ *    `bw_svf_process_multi()`, blocks thereof) are all zeros.
+ *
  *    #### bw_svf_coeffs_is_valid()
  *  ```>>> */
 static inline char bw_svf_coeffs_is_valid(
@@ -402,6 +458,9 @@ enum bw_svf_coeffs_state {
 };
 #endif
 
+#define BW_SVF_MULTI_BLOCK	32
+#define BW_SVF_MULTI_LANES	8
+
 struct bw_svf_coeffs {
 #ifdef BW_DEBUG_DEEP
 	uint32_t			hash;
@@ -424,12 +483,26 @@ struct bw_svf_coeffs {
 	float				k;
 	float				hp_hb;
 	float				hp_x;
+	float				cutoff_cur;
+
+	// Coefficient interpolation
+	size_t				update_count;
+	float				kf_d;
+	float				kbl_d;
+	float				hp_hb_d;
+	float				cutoff_d;
+	float				kf_t;
+	float				kbl_t;
+	float				hp_hb_t;
+	float				hp_x_t;
+	float				cutoff_t;
 
 	// Parameters
 	float				cutoff;
 	float				Q;
 	float				prewarp_k;
 	float				prewarp_freq;
+	size_t				update_interval;
 };
 
 struct bw_svf_state {
@@ -456,6 +529,7 @@ static inline void bw_svf_init(
 	coeffs->Q = 0.5f;
 	coeffs->prewarp_freq = 1e3f;
 	coeffs->prewarp_k = 1.f;
+	coeffs->update_interval = 1;
 
 #ifdef BW_DEBUG_DEEP
 	coeffs->hash = bw_hash_sdbm("bw_svf_coeffs");
@@ -486,9 +560,12 @@ static inline void bw_svf_set_sample_rate(
 	BW_ASSERT_DEEP(coeffs->state == bw_svf_coeffs_state_set_sample_rate);
 }
 
+// Smoothers are advanced by n_steps samples and coefficients are computed at
+// the last one.
 static inline void bw_svf_do_update_coeffs(
 		bw_svf_coeffs * BW_RESTRICT coeffs,
-		char                        force) {
+		char                        force,
+		size_t                      n_steps) {
 	const float prewarp_freq = coeffs->prewarp_freq + coeffs->prewarp_k * (coeffs->cutoff - coeffs->prewarp_freq);
 	float cutoff_cur = bw_one_pole_get_y_z1(&coeffs->smooth_cutoff_state);
 	float prewarp_freq_cur = bw_one_pole_get_y_z1(&coeffs->smooth_prewarp_freq_state);
@@ -499,21 +576,25 @@ static inline void bw_svf_do_update_coeffs(
 	if (cutoff_changed || prewarp_freq_changed || Q_changed) {
 		if (cutoff_changed || prewarp_freq_changed) {
 			if (cutoff_changed)
-				cutoff_cur = bw_one_pole_process1_sticky_rel(&coeffs->smooth_coeffs, &coeffs->smooth_cutoff_state, coeffs->cutoff);
+				for (size_t i = 0; i < n_steps; i++)
+					cutoff_cur = bw_one_pole_process1_sticky_rel(&coeffs->smooth_coeffs, &coeffs->smooth_cutoff_state, coeffs->cutoff);
 			if (prewarp_freq_changed) {
-				prewarp_freq_cur = bw_one_pole_process1_sticky_rel(&coeffs->smooth_coeffs, &coeffs->smooth_prewarp_freq_state, prewarp_freq);
+				for (size_t i = 0; i < n_steps; i++)
+					prewarp_freq_cur = bw_one_pole_process1_sticky_rel(&coeffs->smooth_coeffs, &coeffs->smooth_prewarp_freq_state, prewarp_freq);
 				const float f = bw_minf(prewarp_freq_cur, coeffs->prewarp_freq_max);
-				coeffs->kf = bw_tanf(coeffs->t_k * f) * bw_rcpf(f);
+				coeffs->kf = bw_tanf_ctrl(coeffs->t_k * f) * bw_rcpf_ctrl(f);
 			}
 			coeffs->kbl = coeffs->kf * cutoff_cur;
 		}
 		if (Q_changed) {
-			Q_cur = bw_one_pole_process1_sticky_abs(&coeffs->smooth_coeffs, &coeffs->smooth_Q_state, coeffs->Q);
-			coeffs->k = bw_rcpf(Q_cur);
+			for (size_t i = 0; i < n_steps; i++)
+				Q_cur = bw_one_pole_process1_sticky_abs(&coeffs->smooth_coeffs, &coeffs->smooth_Q_state, coeffs->Q);
+			coeffs->k = bw_rcpf_ctrl(Q_cur);
 		}
 		coeffs->hp_hb = coeffs->k + coeffs->kbl;
-		coeffs->hp_x = bw_rcpf(1.f + coeffs->kbl * coeffs->hp_hb);
+		coeffs->hp_x = bw_rcpf_ctrl(1.f + coeffs->kbl * coeffs->hp_hb);
 	}
+	coeffs->cutoff_cur = cutoff_cur;
 }
 
 static inline void bw_svf_reset_coeffs(
@@ -525,7 +606,8 @@ static inline void bw_svf_reset_coeffs(
 	bw_one_pole_reset_state(&coeffs->smooth_coeffs, &coeffs->smooth_cutoff_state, coeffs->cutoff);
 	bw_one_pole_reset_state(&coeffs->smooth_coeffs, &coeffs->smooth_Q_state, coeffs->Q);
 	bw_one_pole_reset_state(&coeffs->smooth_coeffs, &coeffs->smooth_prewarp_freq_state, coeffs->prewarp_freq + coeffs->prewarp_k * (coeffs->cutoff - coeffs->prewarp_freq));
-	bw_svf_do_update_coeffs(coeffs, 1);
+	bw_svf_do_update_coeffs(coeffs, 1, 1);
+	coeffs->update_count = 0;
 
 #ifdef BW_DEBUG_DEEP
 	coeffs->state = bw_svf_coeffs_state_reset_coeffs;
@@ -667,7 +749,49 @@ static inline void bw_svf_update_coeffs_audio(
 	BW_ASSERT_DEEP(bw_svf_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_svf_coeffs_state_reset_coeffs);
 
-	bw_svf_do_update_coeffs(coeffs, 0);
+	if (coeffs->update_count != 0) {
+		// interpolating, last step lands exactly on target values
+		coeffs->update_count--;
+		if (coeffs->update_count == 0) {
+			coeffs->kf = coeffs->kf_t;
+			coeffs->kbl = coeffs->kbl_t;
+			coeffs->hp_hb = coeffs->hp_hb_t;
+			coeffs->hp_x = coeffs->hp_x_t;
+			coeffs->cutoff_cur = coeffs->cutoff_t;
+		} else {
+			coeffs->kf += coeffs->kf_d;
+			coeffs->kbl += coeffs->kbl_d;
+			coeffs->hp_hb += coeffs->hp_hb_d;
+			coeffs->hp_x = bw_rcpf(1.f + coeffs->kbl * coeffs->hp_hb);
+			coeffs->cutoff_cur += coeffs->cutoff_d;
+		}
+	} else if (coeffs->update_interval == 1)
+		bw_svf_do_update_coeffs(coeffs, 0, 1);
+	else {
+		const float kf = coeffs->kf;
+		const float kbl = coeffs->kbl;
+		const float hp_hb = coeffs->hp_hb;
+		const float cutoff_cur = coeffs->cutoff_cur;
+		bw_svf_do_update_coeffs(coeffs, 0, coeffs->update_interval);
+		if (coeffs->kf != kf || coeffs->kbl != kbl || coeffs->hp_hb != hp_hb || coeffs->cutoff_cur != cutoff_cur) {
+			const float k = bw_rcpf((float)coeffs->update_interval);
+			coeffs->kf_t = coeffs->kf;
+			coeffs->kbl_t = coeffs->kbl;
+			coeffs->hp_hb_t = coeffs->hp_hb;
+			coeffs->hp_x_t = coeffs->hp_x;
+			coeffs->cutoff_t = coeffs->cutoff_cur;
+			coeffs->kf_d = k * (coeffs->kf_t - kf);
+			coeffs->kbl_d = k * (coeffs->kbl_t - kbl);
+			coeffs->hp_hb_d = k * (coeffs->hp_hb_t - hp_hb);
+			coeffs->cutoff_d = k * (coeffs->cutoff_t - cutoff_cur);
+			coeffs->kf = kf + coeffs->kf_d;
+			coeffs->kbl = kbl + coeffs->kbl_d;
+			coeffs->hp_hb = hp_hb + coeffs->hp_hb_d;
+			coeffs->hp_x = bw_rcpf(1.f + coeffs->kbl * coeffs->hp_hb);
+			coeffs->cutoff_cur = cutoff_cur + coeffs->cutoff_d;
+			coeffs->update_count = coeffs->update_interval - 1;
+		}
+	}
 
 	BW_ASSERT_DEEP(bw_svf_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_svf_coeffs_state_reset_coeffs);
@@ -699,10 +823,10 @@ static inline void bw_svf_process1(
 	*y_hp = coeffs->hp_x * (x - coeffs->hp_hb * bp_xz1 - lp_xz1);
 	*y_bp = bp_xz1 + coeffs->kbl * *y_hp;
 	*y_lp = lp_xz1 + coeffs->kbl * *y_bp;
-	state->hp_z1 = *y_hp;
-	state->lp_z1 = *y_lp;
-	state->bp_z1 = *y_bp;
-	state->cutoff_z1 = bw_one_pole_get_y_z1(&coeffs->smooth_cutoff_state);
+	state->hp_z1 = BW_KILL_DENORMAL_STATE(*y_hp);
+	state->lp_z1 = BW_KILL_DENORMAL_STATE(*y_lp);
+	state->bp_z1 = BW_KILL_DENORMAL_STATE(*y_bp);
+	state->cutoff_z1 = coeffs->cutoff_cur;
 
 	BW_ASSERT_DEEP(bw_svf_coeffs_is_valid(coeffs));
 	BW_ASSERT_DEEP(coeffs->state >= bw_svf_coeffs_state_reset_coeffs);
@@ -731,7 +855,21 @@ static inline void bw_svf_process(
 	BW_ASSERT(y_lp == BW_NULL || y_hp == BW_NULL || y_lp != y_hp);
 	BW_ASSERT(y_bp == BW_NULL || y_hp == BW_NULL || y_bp != y_hp);
 
-	if (y_lp != BW_NULL) {
+	if (bw_svf_is_silent(coeffs, state) && bw_has_only_zeros(x, n_samples)) {
+		for (size_t i = 0; i < n_samples; i++)
+			bw_svf_update_coeffs_audio(coeffs);
+		if (n_samples != 0)
+			state->cutoff_z1 = coeffs->cutoff_cur;
+		if (y_lp != BW_NULL)
+			for (size_t i = 0; i < n_samples; i++)
+				y_lp[i] = 0.f;
+		if (y_bp != BW_NULL)
+			for (size_t i = 0; i < n_samples; i++)
+				y_bp[i] = 0.f;
+		if (y_hp != BW_NULL)
+			for (size_t i = 0; i < n_samples; i++)
+				y_hp[i] = 0.f;
+	} else if (y_lp != BW_NULL) {
 		if (y_bp != BW_NULL) {
 			if (y_hp != BW_NULL) {
 				for (size_t i = 0; i < n_samples; i++) {
@@ -800,6 +938,37 @@ static inline void bw_svf_process(
 	BW_ASSERT_DEEP(y_hp != BW_NULL ? bw_has_only_finite(y_hp, n_samples) : 1);
 }
 
+static inline void bw_svf_process_lanes(
+		const float * BW_RESTRICT kf,
+		const float * BW_RESTRICT kbl,
+		const float * BW_RESTRICT hp_hb,
+		const float * BW_RESTRICT hp_x,
+		const float * BW_RESTRICT cutoff,
+		float (* BW_RESTRICT x)[BW_SVF_MULTI_LANES],
+		float (* BW_RESTRICT y_lp)[BW_SVF_MULTI_LANES],
+		float (* BW_RESTRICT y_bp)[BW_SVF_MULTI_LANES],
+		float (* BW_RESTRICT y_hp)[BW_SVF_MULTI_LANES],
+		float * BW_RESTRICT       hp_z1,
+		float * BW_RESTRICT       lp_z1,
+		float * BW_RESTRICT       bp_z1,
+		float * BW_RESTRICT       cutoff_z1,
+		size_t                    n_lanes,
+		size_t                    n_samples) {
+	for (size_t i = 0; i < n_samples; i++)
+		for (size_t j = 0; j < n_lanes; j++) {
+			const float kk = kf[i] * cutoff_z1[j];
+			const float lp_xz1 = lp_z1[j] + kk * bp_z1[j];
+			const float bp_xz1 = bp_z1[j] + kk * hp_z1[j];
+			y_hp[i][j] = hp_x[i] * (x[i][j] - hp_hb[i] * bp_xz1 - lp_xz1);
+			y_bp[i][j] = bp_xz1 + kbl[i] * y_hp[i][j];
+			y_lp[i][j] = lp_xz1 + kbl[i] * y_bp[i][j];
+			hp_z1[j] = BW_KILL_DENORMAL_STATE(y_hp[i][j]);
+			lp_z1[j] = BW_KILL_DENORMAL_STATE(y_lp[i][j]);
+			bp_z1[j] = BW_KILL_DENORMAL_STATE(y_bp[i][j]);
+			cutoff_z1[j] = cutoff[i];
+		}
+}
+
 static inline void bw_svf_process_multi(
 		bw_svf_coeffs * BW_RESTRICT                    coeffs,
 		bw_svf_state * BW_RESTRICT const * BW_RESTRICT state,
@@ -869,102 +1038,71 @@ static inline void bw_svf_process_multi(
 				BW_ASSERT(y_bp[i] == BW_NULL || y_hp[j] == BW_NULL || y_bp[i] != y_hp[j]);
 #endif
 
-	if (y_lp != BW_NULL) {
-		if (y_bp != BW_NULL) {
-			if (y_hp != BW_NULL) {
-				for (size_t i = 0; i < n_samples; i++) {
-					bw_svf_update_coeffs_audio(coeffs);
-					for (size_t j = 0; j < n_channels; j++) {
-						float v_lp, v_bp, v_hp;
-						bw_svf_process1(coeffs, state[j], x[j][i], &v_lp, &v_bp, &v_hp);
-						if (y_lp[j])
-							y_lp[j][i] = v_lp;
-						if (y_bp[j])
-							y_bp[j][i] = v_bp;
-						if (y_hp[j])
-							y_hp[j][i] = v_hp;
-					}
-				}
-			} else {
-				for (size_t i = 0; i < n_samples; i++) {
-					bw_svf_update_coeffs_audio(coeffs);
-					for (size_t j = 0; j < n_channels; j++) {
-						float v_lp, v_bp, v_hp;
-						bw_svf_process1(coeffs, state[j], x[j][i], &v_lp, &v_bp, &v_hp);
-						if (y_lp[j])
-							y_lp[j][i] = v_lp;
-						if (y_bp[j])
-							y_bp[j][i] = v_bp;
-					}
-				}
-			}
-		} else {
-			if (y_hp != BW_NULL) {
-				for (size_t i = 0; i < n_samples; i++) {
-					bw_svf_update_coeffs_audio(coeffs);
-					for (size_t j = 0; j < n_channels; j++) {
-						float v_lp, v_bp, v_hp;
-						bw_svf_process1(coeffs, state[j], x[j][i], &v_lp, &v_bp, &v_hp);
-						if (y_lp[j])
-							y_lp[j][i] = v_lp;
-						if (y_hp[j])
-							y_hp[j][i] = v_hp;
-					}
-				}
-			} else {
-				for (size_t i = 0; i < n_samples; i++) {
-					bw_svf_update_coeffs_audio(coeffs);
-					for (size_t j = 0; j < n_channels; j++) {
-						float v_lp, v_bp, v_hp;
-						bw_svf_process1(coeffs, state[j], x[j][i], &v_lp, &v_bp, &v_hp);
-						if (y_lp[j])
-							y_lp[j][i] = v_lp;
-					}
-				}
+	if (n_channels == 1)
+		bw_svf_process(coeffs, state[0], x[0], y_lp != BW_NULL ? y_lp[0] : BW_NULL, y_bp != BW_NULL ? y_bp[0] : BW_NULL, y_hp != BW_NULL ? y_hp[0] : BW_NULL, n_samples);
+	else {
+		// Shared coefficients are computed once per sample for a block of samples,
+		// then channels are processed BW_SVF_MULTI_LANES at a time with states,
+		// inputs, and outputs packed lane-contiguously so that the integrator
+		// updates of all lanes can be vectorized.
+		float kf[BW_SVF_MULTI_BLOCK], kbl[BW_SVF_MULTI_BLOCK], hp_hb[BW_SVF_MULTI_BLOCK], hp_x[BW_SVF_MULTI_BLOCK], cutoff[BW_SVF_MULTI_BLOCK];
+		float v_x[BW_SVF_MULTI_BLOCK][BW_SVF_MULTI_LANES], v_lp[BW_SVF_MULTI_BLOCK][BW_SVF_MULTI_LANES], v_bp[BW_SVF_MULTI_BLOCK][BW_SVF_MULTI_LANES], v_hp[BW_SVF_MULTI_BLOCK][BW_SVF_MULTI_LANES];
+		float hp_z1[BW_SVF_MULTI_LANES], lp_z1[BW_SVF_MULTI_LANES], bp_z1[BW_SVF_MULTI_LANES], cutoff_z1[BW_SVF_MULTI_LANES];
+		for (size_t i = 0; i < n_samples; i += BW_SVF_MULTI_BLOCK) {
+			const size_t n = n_samples - i < BW_SVF_MULTI_BLOCK ? n_samples - i : BW_SVF_MULTI_BLOCK;
+			for (size_t k = 0; k < n; k++) {
+				bw_svf_update_coeffs_audio(coeffs);
+				kf[k] = coeffs->kf;
+				kbl[k] = coeffs->kbl;
+				hp_hb[k] = coeffs->hp_hb;
+				hp_x[k] = coeffs->hp_x;
+				cutoff[k] = coeffs->cutoff_cur;
 			}
-		}
-	} else {
-		if (y_bp != BW_NULL) {
-			if (y_hp != BW_NULL) {
-				for (size_t i = 0; i < n_samples; i++) {
-					bw_svf_update_coeffs_audio(coeffs);
-					for (size_t j = 0; j < n_channels; j++) {
-						float v_lp, v_bp, v_hp;
-						bw_svf_process1(coeffs, state[j], x[j][i], &v_lp, &v_bp, &v_hp);
-						if (y_bp[j])
-							y_bp[j][i] = v_bp;
-						if (y_hp[j])
-							y_hp[j][i] = v_hp;
-					}
-				}
-			} else {
-				for (size_t i = 0; i < n_samples; i++) {
-					bw_svf_update_coeffs_audio(coeffs);
-					for (size_t j = 0; j < n_channels; j++) {
-						float v_lp, v_bp, v_hp;
-						bw_svf_process1(coeffs, state[j], x[j][i], &v_lp, &v_bp, &v_hp);
-						if (y_bp[j])
-							y_bp[j][i] = v_bp;
+
+			for (size_t j = 0; j < n_channels; j += BW_SVF_MULTI_LANES) {
+				const size_t m = n_channels - j < BW_SVF_MULTI_LANES ? n_channels - j : BW_SVF_MULTI_LANES;
+				char silent = 1;
+				for (size_t l = 0; l < m && silent; l++)
+					silent = bw_svf_is_silent(coeffs, state[j + l]) && bw_has_only_zeros(x[j + l] + i, n);
+				if (silent) {
+					for (size_t l = 0; l < m; l++) {
+						state[j + l]->cutoff_z1 = cutoff[n - 1];
+						if (y_lp != BW_NULL && y_lp[j + l] != BW_NULL)
+							for (size_t k = 0; k < n; k++)
+								y_lp[j + l][i + k] = 0.f;
+						if (y_bp != BW_NULL && y_bp[j + l] != BW_NULL)
+							for (size_t k = 0; k < n; k++)
+								y_bp[j + l][i + k] = 0.f;
+						if (y_hp != BW_NULL && y_hp[j + l] != BW_NULL)
+							for (size_t k = 0; k < n; k++)
+								y_hp[j + l][i + k] = 0.f;
 					}
-				}
-			}
-		} else {
-			if (y_hp != BW_NULL) {
-				for (size_t i = 0; i < n_samples; i++) {
-					bw_svf_update_coeffs_audio(coeffs);
-					for (size_t j = 0; j < n_channels; j++) {
-						float v_lp, v_bp, v_hp;
-						bw_svf_process1(coeffs, state[j], x[j][i], &v_lp, &v_bp, &v_hp);
-						if (y_hp[j])
-							y_hp[j][i] = v_hp;
+				} else {
+					for (size_t l = 0; l < m; l++) {
+						hp_z1[l] = state[j + l]->hp_z1;
+						lp_z1[l] = state[j + l]->lp_z1;
+						bp_z1[l] = state[j + l]->bp_z1;
+						cutoff_z1[l] = state[j + l]->cutoff_z1;
+						for (size_t k = 0; k < n; k++)
+							v_x[k][l] = x[j + l][i + k];
 					}
-				}
-			} else {
-				for (size_t i = 0; i < n_samples; i++) {
-					bw_svf_update_coeffs_audio(coeffs);
-					for (size_t j = 0; j < n_channels; j++) {
-						float v_lp, v_bp, v_hp;
-						bw_svf_process1(coeffs, state[j], x[j][i], &v_lp, &v_bp, &v_hp);
+
+					bw_svf_process_lanes(kf, kbl, hp_hb, hp_x, cutoff, v_x, v_lp, v_bp, v_hp, hp_z1, lp_z1, bp_z1, cutoff_z1, m, n);
+
+					for (size_t l = 0; l < m; l++) {
+						state[j + l]->hp_z1 = hp_z1[l];
+						state[j + l]->lp_z1 = lp_z1[l];
+						state[j + l]->bp_z1 = bp_z1[l];
+						state[j + l]->cutoff_z1 = cutoff_z1[l];
+						if (y_lp != BW_NULL && y_lp[j + l] != BW_NULL)
+							for (size_t k = 0; k < n; k++)
+								y_lp[j + l][i + k] = v_lp[k][l];
+						if (y_bp != BW_NULL && y_bp[j + l] != BW_NULL)
+							for (size_t k = 0; k < n; k++)
+								y_bp[j + l][i + k] = v_bp[k][l];
+						if (y_hp != BW_NULL && y_hp[j + l] != BW_NULL)
+							for (size_t k = 0; k < n; k++)
+								y_hp[j + l][i + k] = v_hp[k][l];
 					}
 				}
 			}
@@ -1041,6 +1179,32 @@ static inline void bw_svf_set_prewarp_freq(
 	BW_ASSERT_DEEP(coeffs->state >= bw_svf_coeffs_state_init);
 }
 
+static inline void bw_svf_set_update_interval(
+		bw_svf_coeffs * BW_RESTRICT coeffs,
+		size_t                      value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_coeffs_state_init);
+	BW_ASSERT(value > 0);
+
+	coeffs->update_interval = value;
+
+	BW_ASSERT_DEEP(bw_svf_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_coeffs_state_init);
+}
+
+static inline char bw_svf_is_silent(
+		const bw_svf_coeffs * BW_RESTRICT coeffs,
+		const bw_svf_state * BW_RESTRICT  state) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_coeffs_is_valid(coeffs));
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_state_is_valid(coeffs, state));
+
+	(void)coeffs;
+	return state->hp_z1 == 0.f && state->lp_z1 == 0.f && state->bp_z1 == 0.f;
+}
+
 static inline char bw_svf_coeffs_is_valid(
 		const bw_svf_coeffs * BW_RESTRICT coeffs) {
 	BW_ASSERT(coeffs != BW_NULL);
@@ -1060,6 +1224,8 @@ static inline char bw_svf_coeffs_is_valid(
 		return 0;
 	if (!bw_is_finite(coeffs->prewarp_freq) || coeffs->prewarp_freq < 1e-6f || coeffs->prewarp_freq > 1e12f)
 		return 0;
+	if (coeffs->update_interval < 1)
+		return 0;
 
 	if (!bw_one_pole_coeffs_is_valid(&coeffs->smooth_coeffs))
 		return 0;
@@ -1083,6 +1249,8 @@ static inline char bw_svf_coeffs_is_valid(
 			return 0;
 		if (!bw_is_finite(coeffs->hp_x) || coeffs->hp_x <= 0.f || coeffs->hp_x >= 1.f)
 			return 0;
+		if (!bw_is_finite(coeffs->cutoff_cur) || coeffs->cutoff_cur < 1e-6f || coeffs->cutoff_cur > 1e12f)
+			return 0;
 
 		if (!bw_one_pole_state_is_valid(&coeffs->smooth_coeffs, &coeffs->smooth_cutoff_state))
 			return 0;
@@ -1123,6 +1291,9 @@ static inline char bw_svf_state_is_valid(
 	return 1;
 }
 
+#undef BW_SVF_MULTI_BLOCK
+#undef BW_SVF_MULTI_LANES
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 }
 #endif
@@ -1203,6 +1374,12 @@ public:
 
 	void setPrewarpFreq(
 		float value);
+
+	void setUpdateInterval(
+		size_t value);
+
+	char isSilent(
+		size_t channel);
 /*! <<<...
  *  }
  *  ```
@@ -1370,6 +1547,18 @@ inline void SVF<N_CHANNELS>::setPrewarpFreq(
 	bw_svf_set_prewarp_freq(&coeffs, value);
 }
 
+template<size_t N_CHANNELS>
+inline void SVF<N_CHANNELS>::setUpdateInterval(
+		size_t value) {
+	bw_svf_set_update_interval(&coeffs, value);
+}
+
+template<size_t N_CHANNELS>
+inline char SVF<N_CHANNELS>::isSilent(
+		size_t channel) {
+	return bw_svf_is_silent(&coeffs, states + channel);
+}
+
 }
 #endif
 
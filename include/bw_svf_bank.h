@@ -0,0 +1,1399 @@
+/*
+ * Brickworks
+ *
+ * Copyright (C) 2026 Orastron Srl unipersonale
+ *
+ * Brickworks is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * Brickworks is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Brickworks.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File author: Stefano D'Angelo
+ */
+
+/*!
+ *  module_type {{{ dsp }}}
+ *  version {{{ 1.0.0 }}}
+ *  requires {{{ bw_common bw_math }}}
+ *  description {{{
+ *    Bank of state variable filters (2nd order, 12 dB/oct) with separated
+ *    lowpass, bandpass, and highpass outputs and independent parameters.
+ *
+ *    Each of the `n_lanes` filters (lanes) behaves like
+ *    [bw\_svf](bw_svf) and has its own cutoff, Q, and prewarping parameters,
+ *    which are smoothed independently. Parameter smoothing, coefficient
+ *    computation (including bilinear transform prewarping), and integrator
+ *    updates are performed for all lanes at once on contiguous arrays, so
+ *    that compilers can vectorize them. This makes it well suited, e.g., for
+ *    polyphonic synthesizers where each voice is filtered with a different
+ *    cutoff.
+ *
+ *    The cutoff of each lane can optionally be driven by an audio-rate
+ *    buffer.
+ *  }}}
+ *  changelog {{{
+ *    <ul>
+ *      <li>Version <strong>1.0.0</strong>:
+ *        <ul>
+ *          <li>First release.</li>
+ *        </ul>
+ *      </li>
+ *    </ul>
+ *  }}}
+ */
+
+#ifndef BW_SVF_BANK_H
+#define BW_SVF_BANK_H
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_common.h"
+#else
+# include <bw_common.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+/*** Public API ***/
+
+/*! api {{{
+ *    #### bw_svf_bank_coeffs
+ *  ```>>> */
+typedef struct bw_svf_bank_coeffs bw_svf_bank_coeffs;
+/*! <<<```
+ *    Coefficients and related.
+ *
+ *    #### bw_svf_bank_state
+ *  ```>>> */
+typedef struct bw_svf_bank_state bw_svf_bank_state;
+/*! <<<```
+ *    Internal state and related.
+ *
+ *    #### bw_svf_bank_init()
+ *  ```>>> */
+static inline void bw_svf_bank_init(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	size_t                           n_lanes);
+/*! <<<```
+ *    Initializes `coeffs` so as to handle `n_lanes` filters.
+ *
+ *    `n_lanes` must be positive.
+ *
+ *    #### bw_svf_bank_coeffs_mem_req()
+ *  ```>>> */
+static inline size_t bw_svf_bank_coeffs_mem_req(
+	const bw_svf_bank_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the size, in bytes, of contiguous memory to be supplied to
+ *    `bw_svf_bank_coeffs_mem_set()` using `coeffs`.
+ *
+ *    #### bw_svf_bank_coeffs_mem_set()
+ *  ```>>> */
+static inline void bw_svf_bank_coeffs_mem_set(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	void * BW_RESTRICT               mem);
+/*! <<<```
+ *    Associates the contiguous memory block `mem` to the given `coeffs`.
+ *
+ *    Such memory holds per-lane parameters and coefficients. Input parameter
+ *    values of all lanes are initialized to their defaults.
+ *
+ *    `mem` must be aligned for `float` values.
+ *
+ *    #### bw_svf_bank_set_sample_rate()
+ *  ```>>> */
+static inline void bw_svf_bank_set_sample_rate(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	float                            sample_rate);
+/*! <<<```
+ *    Sets the `sample_rate` (Hz) value in `coeffs`.
+ *
+ *    #### bw_svf_bank_mem_req()
+ *  ```>>> */
+static inline size_t bw_svf_bank_mem_req(
+	const bw_svf_bank_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Returns the size, in bytes, of contiguous memory to be supplied to
+ *    `bw_svf_bank_mem_set()` using `coeffs`.
+ *
+ *    #### bw_svf_bank_mem_set()
+ *  ```>>> */
+static inline void bw_svf_bank_mem_set(
+	const bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	bw_svf_bank_state * BW_RESTRICT        state,
+	void * BW_RESTRICT                     mem);
+/*! <<<```
+ *    Associates the contiguous memory block `mem` to the given `state` using
+ *    `coeffs`.
+ *
+ *    `mem` must be aligned for `float` values.
+ *
+ *    #### bw_svf_bank_reset_coeffs()
+ *  ```>>> */
+static inline void bw_svf_bank_reset_coeffs(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Resets coefficients in `coeffs` to assume their target values.
+ *
+ *    #### bw_svf_bank_reset_state()
+ *  ```>>> */
+static inline void bw_svf_bank_reset_state(
+	const bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	bw_svf_bank_state * BW_RESTRICT        state,
+	const float *                          x_0,
+	float *                                y_lp_0,
+	float *                                y_bp_0,
+	float *                                y_hp_0);
+/*! <<<```
+ *    Resets the given `state` to its initial values using the given `coeffs`
+ *    and the initial input values in the `x_0` array, containing one value
+ *    per lane.
+ *
+ *    The corresponding initial lowpass, bandpass, and highpass output values
+ *    are put into the `y_lp_0`, `y_bp_0`, and `y_hp_0` arrays, respectively, if
+ *    they are not `BW_NULL`.
+ *
+ *    #### bw_svf_bank_update_coeffs_ctrl()
+ *  ```>>> */
+static inline void bw_svf_bank_update_coeffs_ctrl(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Triggers control-rate update of coefficients in `coeffs`.
+ *
+ *    #### bw_svf_bank_update_coeffs_audio()
+ *  ```>>> */
+static inline void bw_svf_bank_update_coeffs_audio(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Triggers audio-rate update of coefficients of all lanes in `coeffs`.
+ *
+ *    #### bw_svf_bank_process1()
+ *  ```>>> */
+static inline void bw_svf_bank_process1(
+	const bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	bw_svf_bank_state * BW_RESTRICT        state,
+	const float *                          x,
+	float *                                y_lp,
+	float *                                y_bp,
+	float *                                y_hp);
+/*! <<<```
+ *    Processes one input sample per lane, contained in the `x` array, using
+ *    `coeffs`, while using and updating `state`. The lowpass, bandpass, and
+ *    highpass output samples of each lane are put into the `y_lp`, `y_bp`, and
+ *    `y_hp` arrays respectively.
+ *
+ *    #### bw_svf_bank_process()
+ *  ```>>> */
+static inline void bw_svf_bank_process(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	bw_svf_bank_state * BW_RESTRICT  state,
+	const float * const *            x,
+	const float * const *            cutoff,
+	float * const *                  y_lp,
+	float * const *                  y_bp,
+	float * const *                  y_hp,
+	size_t                           n_samples);
+/*! <<<```
+ *    Processes the first `n_samples` of the input buffers `x`, one per lane,
+ *    and fills the first `n_samples` of the output buffers `y_lp` (lowpass),
+ *    `y_bp` (bandpass), and `y_hp` (highpass), one per lane, while using and
+ *    updating both `coeffs` and `state` (control and audio rate).
+ *
+ *    If `cutoff` is not `BW_NULL`, each of its elements that is not `BW_NULL`
+ *    is a buffer of cutoff frequency values (Hz) driving the corresponding
+ *    lane at audio rate. Each value is used as if it was given to
+ *    `bw_svf_bank_set_cutoff()` before processing the corresponding sample,
+ *    and hence the last one is retained in `coeffs`. Such values must be in
+ *    the same valid range of the cutoff parameter.
+ *
+ *    `y_lp`, `y_bp`, and `y_hp`, or any of their elements may be `BW_NULL`.
+ *
+ *    #### bw_svf_bank_set_cutoff()
+ *  ```>>> */
+static inline void bw_svf_bank_set_cutoff(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	size_t                           lane,
+	float                            value);
+/*! <<<```
+ *    Sets the cutoff frequency of the given `lane` to the given `value` (Hz)
+ *    in `coeffs`.
+ *
+ *    Valid range: [`1e-6f`, `1e12f`].
+ *
+ *    Default value: `1e3f`.
+ *
+ *    #### bw_svf_bank_set_Q()
+ *  ```>>> */
+static inline void bw_svf_bank_set_Q(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	size_t                           lane,
+	float                            value);
+/*! <<<```
+ *    Sets the quality factor of the given `lane` to the given `value` in
+ *    `coeffs`.
+ *
+ *    Valid range: [`1e-6f`, `1e6f`].
+ *
+ *    Default value: `0.5f`.
+ *
+ *    #### bw_svf_bank_set_prewarp_at_cutoff()
+ *  ```>>> */
+static inline void bw_svf_bank_set_prewarp_at_cutoff(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	size_t                           lane,
+	char                             value);
+/*! <<<```
+ *    Sets whether bilinear transform prewarping frequency of the given `lane`
+ *    should match its cutoff frequency (non-`0`) or not (`0`).
+ *
+ *    Default value: non-`0` (on).
+ *
+ *    #### bw_svf_bank_set_prewarp_freq()
+ *  ```>>> */
+static inline void bw_svf_bank_set_prewarp_freq(
+	bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	size_t                           lane,
+	float                            value);
+/*! <<<```
+ *    Sets the prewarping frequency of the given `lane` to the given `value`
+ *    (Hz) in `coeffs`.
+ *
+ *    Only used when the prewarp\_at\_cutoff parameter of `lane` is off and
+ *    however internally limited to avoid instability.
+ *
+ *    Valid range: [`1e-6f`, `1e12f`].
+ *
+ *    Default value: `1e3f`.
+ *
+ *    #### bw_svf_bank_coeffs_is_valid()
+ *  ```>>> */
+static inline char bw_svf_bank_coeffs_is_valid(
+	const bw_svf_bank_coeffs * BW_RESTRICT coeffs);
+/*! <<<```
+ *    Tries to determine whether `coeffs` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    `coeffs` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_svf_bank_coeffs`.
+ *
+ *    #### bw_svf_bank_state_is_valid()
+ *  ```>>> */
+static inline char bw_svf_bank_state_is_valid(
+	const bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+	const bw_svf_bank_state * BW_RESTRICT  state);
+/*! <<<```
+ *    Tries to determine whether `state` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    If `coeffs` is not `BW_NULL` extra cross-checks might be performed
+ *    (`state` is supposed to be associated to `coeffs`).
+ *
+ *    `state` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_svf_bank_state`.
+ *  }}} */
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+#ifdef BW_INCLUDE_WITH_QUOTES
+# include "bw_math.h"
+#else
+# include <bw_math.h>
+#endif
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+extern "C" {
+#endif
+
+#define BW_SVF_BANK_LANES	8
+#define BW_SVF_BANK_BLOCK	32
+
+#ifdef BW_DEBUG_DEEP
+enum bw_svf_bank_coeffs_state {
+	bw_svf_bank_coeffs_state_invalid,
+	bw_svf_bank_coeffs_state_init,
+	bw_svf_bank_coeffs_state_mem_set,
+	bw_svf_bank_coeffs_state_set_sample_rate,
+	bw_svf_bank_coeffs_state_reset_coeffs
+};
+
+enum bw_svf_bank_state_state {
+	bw_svf_bank_state_state_invalid,
+	bw_svf_bank_state_state_mem_set,
+	bw_svf_bank_state_state_reset_state
+};
+#endif
+
+struct bw_svf_bank_coeffs {
+#ifdef BW_DEBUG_DEEP
+	uint32_t			hash;
+	enum bw_svf_bank_coeffs_state	state;
+	uint32_t			reset_id;
+#endif
+
+	// Coefficients
+	size_t				n_lanes;
+	float				smooth_mA1;
+	float				t_k;
+	float				prewarp_freq_max;
+
+	float *				kf;
+	float *				kbl;
+	float *				hp_hb;
+	float *				hp_x;
+
+	// Parameter smoothing states
+	float *				cutoff_cur;
+	float *				Q_cur;
+	float *				prewarp_freq_cur;
+
+	// Parameters
+	float *				cutoff;
+	float *				Q;
+	float *				prewarp_k;
+	float *				prewarp_freq;
+};
+
+struct bw_svf_bank_state {
+#ifdef BW_DEBUG_DEEP
+	uint32_t			hash;
+	enum bw_svf_bank_state_state	state;
+	uint32_t			coeffs_reset_id;
+#endif
+
+	// States
+	size_t				n_lanes;
+	float *				hp_z1;
+	float *				lp_z1;
+	float *				bp_z1;
+	float *				cutoff_z1;
+};
+
+// same as bw_one_pole_process1_sticky_rel() with sticky threshold 1e-3f
+static inline float bw_svf_bank_smooth_rel(
+		float mA1,
+		float x,
+		float y_z1) {
+	const float y = x + mA1 * (y_z1 - x);
+	const float d = y - x;
+	return d * d <= 1e-6f * x * x ? x : y;
+}
+
+// same as bw_one_pole_process1_sticky_abs() with sticky threshold 1e-3f
+static inline float bw_svf_bank_smooth_abs(
+		float mA1,
+		float x,
+		float y_z1) {
+	const float y = x + mA1 * (y_z1 - x);
+	const float d = y - x;
+	return d * d <= 1e-6f ? x : y;
+}
+
+static inline void bw_svf_bank_init(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		size_t                           n_lanes) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT(n_lanes > 0);
+
+	coeffs->n_lanes = n_lanes;
+	coeffs->kf = BW_NULL;
+	coeffs->kbl = BW_NULL;
+	coeffs->hp_hb = BW_NULL;
+	coeffs->hp_x = BW_NULL;
+	coeffs->cutoff_cur = BW_NULL;
+	coeffs->Q_cur = BW_NULL;
+	coeffs->prewarp_freq_cur = BW_NULL;
+	coeffs->cutoff = BW_NULL;
+	coeffs->Q = BW_NULL;
+	coeffs->prewarp_k = BW_NULL;
+	coeffs->prewarp_freq = BW_NULL;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->hash = bw_hash_sdbm("bw_svf_bank_coeffs");
+	coeffs->state = bw_svf_bank_coeffs_state_init;
+	coeffs->reset_id = coeffs->hash + 1;
+#endif
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_svf_bank_coeffs_state_init);
+}
+
+static inline size_t bw_svf_bank_coeffs_mem_req(
+		const bw_svf_bank_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_init);
+
+	return 11 * coeffs->n_lanes * sizeof(float);
+}
+
+static inline void bw_svf_bank_coeffs_mem_set(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		void * BW_RESTRICT               mem) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_init);
+	BW_ASSERT(mem != BW_NULL);
+
+	const size_t n = coeffs->n_lanes;
+	float *m = (float *)mem;
+	coeffs->kf = m;
+	coeffs->kbl = m + n;
+	coeffs->hp_hb = m + 2 * n;
+	coeffs->hp_x = m + 3 * n;
+	coeffs->cutoff_cur = m + 4 * n;
+	coeffs->Q_cur = m + 5 * n;
+	coeffs->prewarp_freq_cur = m + 6 * n;
+	coeffs->cutoff = m + 7 * n;
+	coeffs->Q = m + 8 * n;
+	coeffs->prewarp_k = m + 9 * n;
+	coeffs->prewarp_freq = m + 10 * n;
+	for (size_t i = 0; i < n; i++) {
+		coeffs->cutoff[i] = 1e3f;
+		coeffs->Q[i] = 0.5f;
+		coeffs->prewarp_k[i] = 1.f;
+		coeffs->prewarp_freq[i] = 1e3f;
+	}
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_svf_bank_coeffs_state_mem_set;
+#endif
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_svf_bank_coeffs_state_mem_set);
+}
+
+static inline void bw_svf_bank_set_sample_rate(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		float                            sample_rate) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_mem_set);
+	BW_ASSERT(bw_is_finite(sample_rate) && sample_rate > 0.f);
+
+	// one-pole smoothing filters with tau = 5 ms, as in bw_svf
+	const float fs_2pi = 0.15915494309189535f * sample_rate;
+	coeffs->smooth_mA1 = fs_2pi * bw_rcpf_ctrl(fs_2pi + 31.83098861837907f);
+	coeffs->t_k = 3.141592653589793f / sample_rate;
+	coeffs->prewarp_freq_max = 0.499f * sample_rate;
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_svf_bank_coeffs_state_set_sample_rate;
+#endif
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_svf_bank_coeffs_state_set_sample_rate);
+}
+
+static inline size_t bw_svf_bank_mem_req(
+		const bw_svf_bank_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_init);
+
+	return 4 * coeffs->n_lanes * sizeof(float);
+}
+
+static inline void bw_svf_bank_mem_set(
+		const bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		bw_svf_bank_state * BW_RESTRICT        state,
+		void * BW_RESTRICT                     mem) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_init);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT(mem != BW_NULL);
+
+	const size_t n = coeffs->n_lanes;
+	float *m = (float *)mem;
+	state->n_lanes = n;
+	state->hp_z1 = m;
+	state->lp_z1 = m + n;
+	state->bp_z1 = m + 2 * n;
+	state->cutoff_z1 = m + 3 * n;
+
+#ifdef BW_DEBUG_DEEP
+	state->hash = bw_hash_sdbm("bw_svf_bank_state");
+	state->state = bw_svf_bank_state_state_mem_set;
+#endif
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_init);
+	BW_ASSERT_DEEP(bw_svf_bank_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state == bw_svf_bank_state_state_mem_set);
+}
+
+// Computes coefficients from the smoothed cutoff, prewarping frequency, and Q
+// arrays, using kf, kbl, hp_hb, and hp_x themselves as scratch arrays.
+static inline void bw_svf_bank_compute_coeffs(
+		float                     t_k,
+		float                     prewarp_freq_max,
+		const float * BW_RESTRICT cutoff,
+		const float * BW_RESTRICT prewarp_freq,
+		const float * BW_RESTRICT Q,
+		float * BW_RESTRICT       kf,
+		float * BW_RESTRICT       kbl,
+		float * BW_RESTRICT       hp_hb,
+		float * BW_RESTRICT       hp_x,
+		size_t                    n_elems) {
+	for (size_t i = 0; i < n_elems; i++) {
+		const float f = bw_minf(prewarp_freq[i], prewarp_freq_max);
+		kf[i] = t_k * f;
+		hp_x[i] = f;
+	}
+	bw_tanf_buf(kf, kf, n_elems);
+	bw_rcpf_buf(hp_x, hp_x, n_elems);
+	bw_rcpf_buf(Q, hp_hb, n_elems);
+	for (size_t i = 0; i < n_elems; i++) {
+		kf[i] *= hp_x[i];
+		kbl[i] = kf[i] * cutoff[i];
+		hp_hb[i] += kbl[i];
+		hp_x[i] = 1.f + kbl[i] * hp_hb[i];
+	}
+	bw_rcpf_buf(hp_x, hp_x, n_elems);
+}
+
+static inline char bw_svf_bank_is_settled(
+		const bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		size_t                                 lane_0,
+		size_t                                 n_lanes) {
+	char settled = 1;
+	for (size_t i = lane_0; i < lane_0 + n_lanes; i++) {
+		const float prewarp_freq = coeffs->prewarp_freq[i] + coeffs->prewarp_k[i] * (coeffs->cutoff[i] - coeffs->prewarp_freq[i]);
+		settled &= coeffs->cutoff_cur[i] == coeffs->cutoff[i] && coeffs->Q_cur[i] == coeffs->Q[i] && coeffs->prewarp_freq_cur[i] == prewarp_freq;
+	}
+	return settled;
+}
+
+static inline void bw_svf_bank_do_update_coeffs(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		char                             force) {
+	const size_t n = coeffs->n_lanes;
+	if (force || !bw_svf_bank_is_settled(coeffs, 0, n)) {
+		const float mA1 = force ? 0.f : coeffs->smooth_mA1;
+		float * BW_RESTRICT cutoff_cur = coeffs->cutoff_cur;
+		float * BW_RESTRICT Q_cur = coeffs->Q_cur;
+		float * BW_RESTRICT prewarp_freq_cur = coeffs->prewarp_freq_cur;
+		const float * BW_RESTRICT cutoff = coeffs->cutoff;
+		const float * BW_RESTRICT Q = coeffs->Q;
+		const float * BW_RESTRICT prewarp_k = coeffs->prewarp_k;
+		const float * BW_RESTRICT prewarp_freq = coeffs->prewarp_freq;
+		for (size_t i = 0; i < n; i++) {
+			cutoff_cur[i] = bw_svf_bank_smooth_rel(mA1, cutoff[i], cutoff_cur[i]);
+			prewarp_freq_cur[i] = bw_svf_bank_smooth_rel(mA1, prewarp_freq[i] + prewarp_k[i] * (cutoff[i] - prewarp_freq[i]), prewarp_freq_cur[i]);
+			Q_cur[i] = bw_svf_bank_smooth_abs(mA1, Q[i], Q_cur[i]);
+		}
+		bw_svf_bank_compute_coeffs(coeffs->t_k, coeffs->prewarp_freq_max, cutoff_cur, prewarp_freq_cur, Q_cur,
+			coeffs->kf, coeffs->kbl, coeffs->hp_hb, coeffs->hp_x, n);
+	}
+}
+
+static inline void bw_svf_bank_reset_coeffs(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_set_sample_rate);
+
+	// smoother states might still be uninitialized memory, and even with
+	// mA1 = 0 in do_update_coeffs() a non-finite value would propagate
+	for (size_t i = 0; i < coeffs->n_lanes; i++) {
+		coeffs->cutoff_cur[i] = coeffs->cutoff[i];
+		coeffs->Q_cur[i] = coeffs->Q[i];
+		coeffs->prewarp_freq_cur[i] = coeffs->prewarp_freq[i] + coeffs->prewarp_k[i] * (coeffs->cutoff[i] - coeffs->prewarp_freq[i]);
+	}
+	bw_svf_bank_do_update_coeffs(coeffs, 1);
+
+#ifdef BW_DEBUG_DEEP
+	coeffs->state = bw_svf_bank_coeffs_state_reset_coeffs;
+	coeffs->reset_id++;
+#endif
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state == bw_svf_bank_coeffs_state_reset_coeffs);
+}
+
+static inline void bw_svf_bank_reset_state(
+		const bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		bw_svf_bank_state * BW_RESTRICT        state,
+		const float *                          x_0,
+		float *                                y_lp_0,
+		float *                                y_bp_0,
+		float *                                y_hp_0) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(state->state >= bw_svf_bank_state_state_mem_set);
+	BW_ASSERT(state->n_lanes == coeffs->n_lanes);
+	BW_ASSERT(x_0 != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x_0, coeffs->n_lanes));
+	BW_ASSERT(y_lp_0 == BW_NULL || y_bp_0 == BW_NULL || y_lp_0 != y_bp_0);
+	BW_ASSERT(y_lp_0 == BW_NULL || y_hp_0 == BW_NULL || y_lp_0 != y_hp_0);
+	BW_ASSERT(y_bp_0 == BW_NULL || y_hp_0 == BW_NULL || y_bp_0 != y_hp_0);
+
+	for (size_t i = 0; i < coeffs->n_lanes; i++) {
+		state->hp_z1[i] = 0.f;
+		state->lp_z1[i] = x_0[i];
+		state->bp_z1[i] = 0.f;
+		state->cutoff_z1[i] = coeffs->cutoff[i];
+	}
+	if (y_lp_0 != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			y_lp_0[i] = x_0[i];
+	if (y_bp_0 != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			y_bp_0[i] = 0.f;
+	if (y_hp_0 != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			y_hp_0[i] = 0.f;
+
+#ifdef BW_DEBUG_DEEP
+	state->state = bw_svf_bank_state_state_reset_state;
+	state->coeffs_reset_id = coeffs->reset_id;
+#endif
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_svf_bank_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state == bw_svf_bank_state_state_reset_state);
+	BW_ASSERT_DEEP(y_lp_0 != BW_NULL ? bw_has_only_finite(y_lp_0, coeffs->n_lanes) : 1);
+	BW_ASSERT_DEEP(y_bp_0 != BW_NULL ? bw_has_only_finite(y_bp_0, coeffs->n_lanes) : 1);
+	BW_ASSERT_DEEP(y_hp_0 != BW_NULL ? bw_has_only_finite(y_hp_0, coeffs->n_lanes) : 1);
+}
+
+static inline void bw_svf_bank_update_coeffs_ctrl(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs);
+
+	(void)coeffs;
+}
+
+static inline void bw_svf_bank_update_coeffs_audio(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs);
+
+	bw_svf_bank_do_update_coeffs(coeffs, 0);
+
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs);
+}
+
+static inline void bw_svf_bank_process1_lanes(
+		const float * BW_RESTRICT kf,
+		const float * BW_RESTRICT kbl,
+		const float * BW_RESTRICT hp_hb,
+		const float * BW_RESTRICT hp_x,
+		const float * BW_RESTRICT cutoff,
+		const float * BW_RESTRICT x,
+		float * BW_RESTRICT       y_lp,
+		float * BW_RESTRICT       y_bp,
+		float * BW_RESTRICT       y_hp,
+		float * BW_RESTRICT       hp_z1,
+		float * BW_RESTRICT       lp_z1,
+		float * BW_RESTRICT       bp_z1,
+		float * BW_RESTRICT       cutoff_z1,
+		size_t                    n_lanes) {
+	for (size_t i = 0; i < n_lanes; i++) {
+		const float kk = kf[i] * cutoff_z1[i];
+		const float lp_xz1 = lp_z1[i] + kk * bp_z1[i];
+		const float bp_xz1 = bp_z1[i] + kk * hp_z1[i];
+		y_hp[i] = hp_x[i] * (x[i] - hp_hb[i] * bp_xz1 - lp_xz1);
+		y_bp[i] = bp_xz1 + kbl[i] * y_hp[i];
+		y_lp[i] = lp_xz1 + kbl[i] * y_bp[i];
+		hp_z1[i] = BW_KILL_DENORMAL_STATE(y_hp[i]);
+		lp_z1[i] = BW_KILL_DENORMAL_STATE(y_lp[i]);
+		bp_z1[i] = BW_KILL_DENORMAL_STATE(y_bp[i]);
+		cutoff_z1[i] = cutoff[i];
+	}
+}
+
+static inline void bw_svf_bank_process1(
+		const bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		bw_svf_bank_state * BW_RESTRICT        state,
+		const float *                          x,
+		float *                                y_lp,
+		float *                                y_bp,
+		float *                                y_hp) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_svf_bank_state_state_reset_state);
+	BW_ASSERT(state->n_lanes == coeffs->n_lanes);
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT_DEEP(bw_has_only_finite(x, coeffs->n_lanes));
+	BW_ASSERT(y_lp != BW_NULL);
+	BW_ASSERT(y_bp != BW_NULL);
+	BW_ASSERT(y_hp != BW_NULL);
+	BW_ASSERT(y_lp != y_bp);
+	BW_ASSERT(y_lp != y_hp);
+	BW_ASSERT(y_bp != y_hp);
+
+	bw_svf_bank_process1_lanes(coeffs->kf, coeffs->kbl, coeffs->hp_hb, coeffs->hp_x, coeffs->cutoff_cur, x, y_lp, y_bp, y_hp,
+		state->hp_z1, state->lp_z1, state->bp_z1, state->cutoff_z1, coeffs->n_lanes);
+
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_svf_bank_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(bw_has_only_finite(y_lp, coeffs->n_lanes));
+	BW_ASSERT_DEEP(bw_has_only_finite(y_bp, coeffs->n_lanes));
+	BW_ASSERT_DEEP(bw_has_only_finite(y_hp, coeffs->n_lanes));
+}
+
+// Smooths parameters of BW_SVF_BANK_LANES lanes over n_samples samples, with
+// cutoff values given per sample, and fills per-sample coefficient arrays.
+static inline void bw_svf_bank_smooth_lanes(
+		float                     mA1,
+		float                     t_k,
+		float                     prewarp_freq_max,
+		const float * BW_RESTRICT Q,
+		const float * BW_RESTRICT prewarp_k,
+		const float * BW_RESTRICT prewarp_freq,
+		float * BW_RESTRICT       cutoff_cur,
+		float * BW_RESTRICT       Q_cur,
+		float * BW_RESTRICT       prewarp_freq_cur,
+		float (* BW_RESTRICT cutoff)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT prewarp_freq_v)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT Q_v)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT kf)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT kbl)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT hp_hb)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT hp_x)[BW_SVF_BANK_LANES],
+		size_t                    n_samples) {
+	// cutoff holds target values on input and smoothed values on output
+	for (size_t i = 0; i < n_samples; i++)
+		for (size_t j = 0; j < BW_SVF_BANK_LANES; j++) {
+			const float c = cutoff[i][j];
+			cutoff_cur[j] = bw_svf_bank_smooth_rel(mA1, c, cutoff_cur[j]);
+			prewarp_freq_cur[j] = bw_svf_bank_smooth_rel(mA1, prewarp_freq[j] + prewarp_k[j] * (c - prewarp_freq[j]), prewarp_freq_cur[j]);
+			Q_cur[j] = bw_svf_bank_smooth_abs(mA1, Q[j], Q_cur[j]);
+			cutoff[i][j] = cutoff_cur[j];
+			prewarp_freq_v[i][j] = prewarp_freq_cur[j];
+			Q_v[i][j] = Q_cur[j];
+		}
+	bw_svf_bank_compute_coeffs(t_k, prewarp_freq_max, cutoff[0], prewarp_freq_v[0], Q_v[0],
+		kf[0], kbl[0], hp_hb[0], hp_x[0], n_samples * BW_SVF_BANK_LANES);
+}
+
+static inline void bw_svf_bank_process_lanes(
+		float (* BW_RESTRICT kf)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT kbl)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT hp_hb)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT hp_x)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT cutoff)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT x)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT y_lp)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT y_bp)[BW_SVF_BANK_LANES],
+		float (* BW_RESTRICT y_hp)[BW_SVF_BANK_LANES],
+		float * BW_RESTRICT       hp_z1,
+		float * BW_RESTRICT       lp_z1,
+		float * BW_RESTRICT       bp_z1,
+		float * BW_RESTRICT       cutoff_z1,
+		size_t                    n_samples) {
+	for (size_t i = 0; i < n_samples; i++)
+		for (size_t j = 0; j < BW_SVF_BANK_LANES; j++) {
+			const float kk = kf[i][j] * cutoff_z1[j];
+			const float lp_xz1 = lp_z1[j] + kk * bp_z1[j];
+			const float bp_xz1 = bp_z1[j] + kk * hp_z1[j];
+			y_hp[i][j] = hp_x[i][j] * (x[i][j] - hp_hb[i][j] * bp_xz1 - lp_xz1);
+			y_bp[i][j] = bp_xz1 + kbl[i][j] * y_hp[i][j];
+			y_lp[i][j] = lp_xz1 + kbl[i][j] * y_bp[i][j];
+			hp_z1[j] = BW_KILL_DENORMAL_STATE(y_hp[i][j]);
+			lp_z1[j] = BW_KILL_DENORMAL_STATE(y_lp[i][j]);
+			bp_z1[j] = BW_KILL_DENORMAL_STATE(y_bp[i][j]);
+			cutoff_z1[j] = cutoff[i][j];
+		}
+}
+
+static inline void bw_svf_bank_process(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		bw_svf_bank_state * BW_RESTRICT  state,
+		const float * const *            x,
+		const float * const *            cutoff,
+		float * const *                  y_lp,
+		float * const *                  y_bp,
+		float * const *                  y_hp,
+		size_t                           n_samples) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs);
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_state_is_valid(coeffs, state));
+	BW_ASSERT_DEEP(state->state >= bw_svf_bank_state_state_reset_state);
+	BW_ASSERT(state->n_lanes == coeffs->n_lanes);
+	BW_ASSERT(x != BW_NULL);
+	BW_ASSERT(y_lp == BW_NULL || y_bp == BW_NULL || y_lp != y_bp);
+	BW_ASSERT(y_lp == BW_NULL || y_hp == BW_NULL || y_lp != y_hp);
+	BW_ASSERT(y_bp == BW_NULL || y_hp == BW_NULL || y_bp != y_hp);
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < coeffs->n_lanes; i++) {
+		BW_ASSERT(x[i] != BW_NULL);
+		BW_ASSERT_DEEP(bw_has_only_finite(x[i], n_samples));
+	}
+	if (cutoff != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			if (cutoff[i] != BW_NULL)
+				for (size_t j = 0; j < n_samples; j++)
+					BW_ASSERT(bw_is_finite(cutoff[i][j]) && cutoff[i][j] >= 1e-6f && cutoff[i][j] <= 1e12f);
+	if (y_lp != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			for (size_t j = i + 1; j < coeffs->n_lanes; j++)
+				BW_ASSERT(y_lp[i] == BW_NULL || y_lp[j] == BW_NULL || y_lp[i] != y_lp[j]);
+	if (y_bp != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			for (size_t j = i + 1; j < coeffs->n_lanes; j++)
+				BW_ASSERT(y_bp[i] == BW_NULL || y_bp[j] == BW_NULL || y_bp[i] != y_bp[j]);
+	if (y_hp != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			for (size_t j = i + 1; j < coeffs->n_lanes; j++)
+				BW_ASSERT(y_hp[i] == BW_NULL || y_hp[j] == BW_NULL || y_hp[i] != y_hp[j]);
+	if (y_lp != BW_NULL && y_bp != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			for (size_t j = 0; j < coeffs->n_lanes; j++)
+				BW_ASSERT(y_lp[i] == BW_NULL || y_bp[j] == BW_NULL || y_lp[i] != y_bp[j]);
+	if (y_lp != BW_NULL && y_hp != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			for (size_t j = 0; j < coeffs->n_lanes; j++)
+				BW_ASSERT(y_lp[i] == BW_NULL || y_hp[j] == BW_NULL || y_lp[i] != y_hp[j]);
+	if (y_bp != BW_NULL && y_hp != BW_NULL)
+		for (size_t i = 0; i < coeffs->n_lanes; i++)
+			for (size_t j = 0; j < coeffs->n_lanes; j++)
+				BW_ASSERT(y_bp[i] == BW_NULL || y_hp[j] == BW_NULL || y_bp[i] != y_hp[j]);
+#endif
+
+	// Lanes are processed in groups of BW_SVF_BANK_LANES and samples in blocks
+	// of BW_SVF_BANK_BLOCK. Per-lane data of each group is packed in
+	// lane-contiguous arrays, padded with harmless values, so that all inner
+	// loops run over the full group width and can be vectorized.
+	float Q[BW_SVF_BANK_LANES], prewarp_k[BW_SVF_BANK_LANES], prewarp_freq[BW_SVF_BANK_LANES];
+	float cutoff_cur[BW_SVF_BANK_LANES], Q_cur[BW_SVF_BANK_LANES], prewarp_freq_cur[BW_SVF_BANK_LANES];
+	float hp_z1[BW_SVF_BANK_LANES], lp_z1[BW_SVF_BANK_LANES], bp_z1[BW_SVF_BANK_LANES], cutoff_z1[BW_SVF_BANK_LANES];
+	float v_cutoff[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES], v_prewarp_freq[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES], v_Q[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES];
+	float v_kf[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES], v_kbl[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES], v_hp_hb[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES], v_hp_x[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES];
+	float v_x[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES], v_lp[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES], v_bp[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES], v_hp[BW_SVF_BANK_BLOCK][BW_SVF_BANK_LANES];
+	for (size_t j = 0; j < coeffs->n_lanes; j += BW_SVF_BANK_LANES) {
+		const size_t m = coeffs->n_lanes - j < BW_SVF_BANK_LANES ? coeffs->n_lanes - j : BW_SVF_BANK_LANES;
+		char audio_rate = 0;
+		for (size_t l = 0; l < m; l++) {
+			Q[l] = coeffs->Q[j + l];
+			prewarp_k[l] = coeffs->prewarp_k[j + l];
+			prewarp_freq[l] = coeffs->prewarp_freq[j + l];
+			cutoff_cur[l] = coeffs->cutoff_cur[j + l];
+			Q_cur[l] = coeffs->Q_cur[j + l];
+			prewarp_freq_cur[l] = coeffs->prewarp_freq_cur[j + l];
+			hp_z1[l] = state->hp_z1[j + l];
+			lp_z1[l] = state->lp_z1[j + l];
+			bp_z1[l] = state->bp_z1[j + l];
+			cutoff_z1[l] = state->cutoff_z1[j + l];
+			audio_rate |= cutoff != BW_NULL && cutoff[j + l] != BW_NULL;
+		}
+		for (size_t l = m; l < BW_SVF_BANK_LANES; l++) {
+			Q[l] = 0.5f;
+			prewarp_k[l] = 1.f;
+			prewarp_freq[l] = 1e3f;
+			cutoff_cur[l] = 1e3f;
+			Q_cur[l] = 0.5f;
+			prewarp_freq_cur[l] = 1e3f;
+			hp_z1[l] = 0.f;
+			lp_z1[l] = 0.f;
+			bp_z1[l] = 0.f;
+			cutoff_z1[l] = 1e3f;
+			for (size_t k = 0; k < BW_SVF_BANK_BLOCK; k++) {
+				v_cutoff[k][l] = 1e3f;
+				v_x[k][l] = 0.f;
+			}
+		}
+
+		for (size_t i = 0; i < n_samples; i += BW_SVF_BANK_BLOCK) {
+			const size_t n = n_samples - i < BW_SVF_BANK_BLOCK ? n_samples - i : BW_SVF_BANK_BLOCK;
+
+			for (size_t l = 0; l < m; l++)
+				for (size_t k = 0; k < n; k++)
+					v_x[k][l] = x[j + l][i + k];
+
+			if (audio_rate || !bw_svf_bank_is_settled(coeffs, j, m)) {
+				for (size_t l = 0; l < m; l++) {
+					if (cutoff != BW_NULL && cutoff[j + l] != BW_NULL) {
+						for (size_t k = 0; k < n; k++)
+							v_cutoff[k][l] = cutoff[j + l][i + k];
+						coeffs->cutoff[j + l] = v_cutoff[n - 1][l];
+					} else
+						for (size_t k = 0; k < n; k++)
+							v_cutoff[k][l] = coeffs->cutoff[j + l];
+				}
+				bw_svf_bank_smooth_lanes(coeffs->smooth_mA1, coeffs->t_k, coeffs->prewarp_freq_max, Q, prewarp_k, prewarp_freq,
+					cutoff_cur, Q_cur, prewarp_freq_cur, v_cutoff, v_prewarp_freq, v_Q, v_kf, v_kbl, v_hp_hb, v_hp_x, n);
+				for (size_t l = 0; l < m; l++) {
+					coeffs->cutoff_cur[j + l] = cutoff_cur[l];
+					coeffs->Q_cur[j + l] = Q_cur[l];
+					coeffs->prewarp_freq_cur[j + l] = prewarp_freq_cur[l];
+					coeffs->kf[j + l] = v_kf[n - 1][l];
+					coeffs->kbl[j + l] = v_kbl[n - 1][l];
+					coeffs->hp_hb[j + l] = v_hp_hb[n - 1][l];
+					coeffs->hp_x[j + l] = v_hp_x[n - 1][l];
+				}
+			} else {
+				for (size_t l = 0; l < m; l++)
+					for (size_t k = 0; k < n; k++) {
+						v_cutoff[k][l] = cutoff_cur[l];
+						v_kf[k][l] = coeffs->kf[j + l];
+						v_kbl[k][l] = coeffs->kbl[j + l];
+						v_hp_hb[k][l] = coeffs->hp_hb[j + l];
+						v_hp_x[k][l] = coeffs->hp_x[j + l];
+					}
+				for (size_t l = m; l < BW_SVF_BANK_LANES; l++)
+					for (size_t k = 0; k < n; k++) {
+						v_kf[k][l] = 0.f;
+						v_kbl[k][l] = 0.f;
+						v_hp_hb[k][l] = 0.f;
+						v_hp_x[k][l] = 0.f;
+					}
+			}
+
+			bw_svf_bank_process_lanes(v_kf, v_kbl, v_hp_hb, v_hp_x, v_cutoff, v_x, v_lp, v_bp, v_hp, hp_z1, lp_z1, bp_z1, cutoff_z1, n);
+
+			for (size_t l = 0; l < m; l++) {
+				if (y_lp != BW_NULL && y_lp[j + l] != BW_NULL)
+					for (size_t k = 0; k < n; k++)
+						y_lp[j + l][i + k] = v_lp[k][l];
+				if (y_bp != BW_NULL && y_bp[j + l] != BW_NULL)
+					for (size_t k = 0; k < n; k++)
+						y_bp[j + l][i + k] = v_bp[k][l];
+				if (y_hp != BW_NULL && y_hp[j + l] != BW_NULL)
+					for (size_t k = 0; k < n; k++)
+						y_hp[j + l][i + k] = v_hp[k][l];
+			}
+		}
+
+		for (size_t l = 0; l < m; l++) {
+			state->hp_z1[j + l] = hp_z1[l];
+			state->lp_z1[j + l] = lp_z1[l];
+			state->bp_z1[j + l] = bp_z1[l];
+			state->cutoff_z1[j + l] = cutoff_z1[l];
+		}
+	}
+
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs);
+	BW_ASSERT_DEEP(bw_svf_bank_state_is_valid(coeffs, state));
+#ifndef BW_NO_DEBUG
+	for (size_t i = 0; i < coeffs->n_lanes; i++) {
+		BW_ASSERT_DEEP(y_lp != BW_NULL && y_lp[i] != BW_NULL ? bw_has_only_finite(y_lp[i], n_samples) : 1);
+		BW_ASSERT_DEEP(y_bp != BW_NULL && y_bp[i] != BW_NULL ? bw_has_only_finite(y_bp[i], n_samples) : 1);
+		BW_ASSERT_DEEP(y_hp != BW_NULL && y_hp[i] != BW_NULL ? bw_has_only_finite(y_hp[i], n_samples) : 1);
+	}
+#endif
+}
+
+static inline void bw_svf_bank_set_cutoff(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		size_t                           lane,
+		float                            value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_mem_set);
+	BW_ASSERT(lane < coeffs->n_lanes);
+	BW_ASSERT(bw_is_finite(value));
+	BW_ASSERT(value >= 1e-6f && value <= 1e12f);
+
+	coeffs->cutoff[lane] = value;
+
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_mem_set);
+}
+
+static inline void bw_svf_bank_set_Q(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		size_t                           lane,
+		float                            value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_mem_set);
+	BW_ASSERT(lane < coeffs->n_lanes);
+	BW_ASSERT(bw_is_finite(value));
+	BW_ASSERT(value >= 1e-6f && value <= 1e6f);
+
+	coeffs->Q[lane] = value;
+
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_mem_set);
+}
+
+static inline void bw_svf_bank_set_prewarp_at_cutoff(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		size_t                           lane,
+		char                             value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_mem_set);
+	BW_ASSERT(lane < coeffs->n_lanes);
+
+	coeffs->prewarp_k[lane] = value ? 1.f : 0.f;
+
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_mem_set);
+}
+
+static inline void bw_svf_bank_set_prewarp_freq(
+		bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		size_t                           lane,
+		float                            value) {
+	BW_ASSERT(coeffs != BW_NULL);
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_mem_set);
+	BW_ASSERT(lane < coeffs->n_lanes);
+	BW_ASSERT(bw_is_finite(value));
+	BW_ASSERT(value >= 1e-6f && value <= 1e12f);
+
+	coeffs->prewarp_freq[lane] = value;
+
+	BW_ASSERT_DEEP(bw_svf_bank_coeffs_is_valid(coeffs));
+	BW_ASSERT_DEEP(coeffs->state >= bw_svf_bank_coeffs_state_mem_set);
+}
+
+static inline char bw_svf_bank_coeffs_is_valid(
+		const bw_svf_bank_coeffs * BW_RESTRICT coeffs) {
+	BW_ASSERT(coeffs != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->hash != bw_hash_sdbm("bw_svf_bank_coeffs"))
+		return 0;
+	if (coeffs->state < bw_svf_bank_coeffs_state_init || coeffs->state > bw_svf_bank_coeffs_state_reset_coeffs)
+		return 0;
+#endif
+
+	if (coeffs->n_lanes == 0)
+		return 0;
+
+#ifdef BW_DEBUG_DEEP
+	if (coeffs->state >= bw_svf_bank_coeffs_state_mem_set) {
+		if (coeffs->kf == BW_NULL || coeffs->kbl == BW_NULL || coeffs->hp_hb == BW_NULL || coeffs->hp_x == BW_NULL
+			|| coeffs->cutoff_cur == BW_NULL || coeffs->Q_cur == BW_NULL || coeffs->prewarp_freq_cur == BW_NULL
+			|| coeffs->cutoff == BW_NULL || coeffs->Q == BW_NULL || coeffs->prewarp_k == BW_NULL || coeffs->prewarp_freq == BW_NULL)
+			return 0;
+
+		for (size_t i = 0; i < coeffs->n_lanes; i++) {
+			if (!bw_is_finite(coeffs->cutoff[i]) || coeffs->cutoff[i] < 1e-6f || coeffs->cutoff[i] > 1e12f)
+				return 0;
+			if (!bw_is_finite(coeffs->Q[i]) || coeffs->Q[i] < 1e-6f || coeffs->Q[i] > 1e6f)
+				return 0;
+			if (!bw_is_finite(coeffs->prewarp_k[i]) || (coeffs->prewarp_k[i] != 0.f && coeffs->prewarp_k[i] != 1.f))
+				return 0;
+			if (!bw_is_finite(coeffs->prewarp_freq[i]) || coeffs->prewarp_freq[i] < 1e-6f || coeffs->prewarp_freq[i] > 1e12f)
+				return 0;
+		}
+	}
+
+	if (coeffs->state >= bw_svf_bank_coeffs_state_set_sample_rate) {
+		if (!bw_is_finite(coeffs->smooth_mA1) || coeffs->smooth_mA1 < 0.f || coeffs->smooth_mA1 >= 1.f)
+			return 0;
+		if (!bw_is_finite(coeffs->t_k) || coeffs->t_k <= 0.f)
+			return 0;
+		if (!bw_is_finite(coeffs->prewarp_freq_max) || coeffs->prewarp_freq_max <= 0.f)
+			return 0;
+	}
+
+	if (coeffs->state >= bw_svf_bank_coeffs_state_reset_coeffs) {
+		for (size_t i = 0; i < coeffs->n_lanes; i++) {
+			if (!bw_is_finite(coeffs->cutoff_cur[i]) || coeffs->cutoff_cur[i] < 1e-6f || coeffs->cutoff_cur[i] > 1e12f)
+				return 0;
+			if (!bw_is_finite(coeffs->Q_cur[i]) || coeffs->Q_cur[i] < 1e-6f || coeffs->Q_cur[i] > 1e6f)
+				return 0;
+			if (!bw_is_finite(coeffs->prewarp_freq_cur[i]) || coeffs->prewarp_freq_cur[i] < 1e-6f || coeffs->prewarp_freq_cur[i] > 1e12f)
+				return 0;
+			if (!bw_is_finite(coeffs->kf[i]) || coeffs->kf[i] < 0.f)
+				return 0;
+			if (!bw_is_finite(coeffs->kbl[i]) || coeffs->kbl[i] < 0.f)
+				return 0;
+			if (!bw_is_finite(coeffs->hp_hb[i]) || coeffs->hp_hb[i] <= 0.f)
+				return 0;
+			if (!bw_is_finite(coeffs->hp_x[i]) || coeffs->hp_x[i] <= 0.f || coeffs->hp_x[i] >= 1.f)
+				return 0;
+		}
+	}
+#endif
+
+	return 1;
+}
+
+static inline char bw_svf_bank_state_is_valid(
+		const bw_svf_bank_coeffs * BW_RESTRICT coeffs,
+		const bw_svf_bank_state * BW_RESTRICT  state) {
+	BW_ASSERT(state != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (state->hash != bw_hash_sdbm("bw_svf_bank_state"))
+		return 0;
+	if (state->state < bw_svf_bank_state_state_mem_set || state->state > bw_svf_bank_state_state_reset_state)
+		return 0;
+
+	if (state->state >= bw_svf_bank_state_state_reset_state && coeffs != BW_NULL && coeffs->reset_id != state->coeffs_reset_id)
+		return 0;
+#endif
+
+	if (coeffs != BW_NULL && coeffs->n_lanes != state->n_lanes)
+		return 0;
+	if (state->hp_z1 == BW_NULL || state->lp_z1 == BW_NULL || state->bp_z1 == BW_NULL || state->cutoff_z1 == BW_NULL)
+		return 0;
+
+#ifdef BW_DEBUG_DEEP
+	if (state->state >= bw_svf_bank_state_state_reset_state)
+		for (size_t i = 0; i < state->n_lanes; i++) {
+			if (!bw_is_finite(state->hp_z1[i]))
+				return 0;
+			if (!bw_is_finite(state->lp_z1[i]))
+				return 0;
+			if (!bw_is_finite(state->bp_z1[i]))
+				return 0;
+			if (!bw_is_finite(state->cutoff_z1[i]) || state->cutoff_z1[i] < 1e-6f || state->cutoff_z1[i] > 1e12f)
+				return 0;
+		}
+#endif
+
+	return 1;
+}
+
+#undef BW_SVF_BANK_LANES
+#undef BW_SVF_BANK_BLOCK
+
+#if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
+}
+#endif
+
+#if !defined(BW_NO_CXX) && defined(__cplusplus)
+
+# ifndef BW_CXX_NO_ARRAY
+#  include <array>
+# endif
+
+namespace Brickworks {
+
+/*** Public C++ API ***/
+
+/*! api_cpp {{{
+ *    ##### Brickworks::SVFBank
+ *  ```>>> */
+template<size_t N_LANES>
+class SVFBank {
+public:
+	SVFBank();
+
+	~SVFBank();
+
+	void setSampleRate(
+		float sampleRate);
+
+	void reset(
+		float   x0 = 0.f,
+		float * yLp0 = BW_NULL,
+		float * yBp0 = BW_NULL,
+		float * yHp0 = BW_NULL);
+
+# ifndef BW_CXX_NO_ARRAY
+	void reset(
+		float                                    x0,
+		std::array<float, N_LANES> * BW_RESTRICT yLp0,
+		std::array<float, N_LANES> * BW_RESTRICT yBp0,
+		std::array<float, N_LANES> * BW_RESTRICT yHp0);
+# endif
+
+	void reset(
+		const float * x0,
+		float *       yLp0 = BW_NULL,
+		float *       yBp0 = BW_NULL,
+		float *       yHp0 = BW_NULL);
+
+# ifndef BW_CXX_NO_ARRAY
+	void reset(
+		std::array<float, N_LANES>               x0,
+		std::array<float, N_LANES> * BW_RESTRICT yLp0 = BW_NULL,
+		std::array<float, N_LANES> * BW_RESTRICT yBp0 = BW_NULL,
+		std::array<float, N_LANES> * BW_RESTRICT yHp0 = BW_NULL);
+# endif
+
+	void process(
+		const float * const * x,
+		const float * const * cutoff,
+		float * const *       yLp,
+		float * const *       yBp,
+		float * const *       yHp,
+		size_t                nSamples);
+
+# ifndef BW_CXX_NO_ARRAY
+	void process(
+		std::array<const float *, N_LANES> x,
+		std::array<const float *, N_LANES> cutoff,
+		std::array<float *, N_LANES>       yLp,
+		std::array<float *, N_LANES>       yBp,
+		std::array<float *, N_LANES>       yHp,
+		size_t                             nSamples);
+# endif
+
+	void setCutoff(
+		size_t lane,
+		float  value);
+
+	void setQ(
+		size_t lane,
+		float  value);
+
+	void setPrewarpAtCutoff(
+		size_t lane,
+		bool   value);
+
+	void setPrewarpFreq(
+		size_t lane,
+		float  value);
+/*! <<<...
+ *  }
+ *  ```
+ *  }}} */
+
+/*** Implementation ***/
+
+/* WARNING: This part of the file is not part of the public API. Its content may
+ * change at any time in future versions. Please, do not use it directly. */
+
+private:
+	bw_svf_bank_coeffs	coeffs;
+	bw_svf_bank_state	state;
+	void * BW_RESTRICT	coeffsMem;
+	void * BW_RESTRICT	stateMem;
+};
+
+template<size_t N_LANES>
+inline SVFBank<N_LANES>::SVFBank() {
+	bw_svf_bank_init(&coeffs, N_LANES);
+	coeffsMem = operator new(bw_svf_bank_coeffs_mem_req(&coeffs));
+	bw_svf_bank_coeffs_mem_set(&coeffs, coeffsMem);
+	stateMem = operator new(bw_svf_bank_mem_req(&coeffs));
+	bw_svf_bank_mem_set(&coeffs, &state, stateMem);
+}
+
+template<size_t N_LANES>
+inline SVFBank<N_LANES>::~SVFBank() {
+	operator delete(stateMem);
+	operator delete(coeffsMem);
+}
+
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::setSampleRate(
+		float sampleRate) {
+	bw_svf_bank_set_sample_rate(&coeffs, sampleRate);
+}
+
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::reset(
+		float   x0,
+		float * yLp0,
+		float * yBp0,
+		float * yHp0) {
+	float x0v[N_LANES];
+	for (size_t i = 0; i < N_LANES; i++)
+		x0v[i] = x0;
+	reset(x0v, yLp0, yBp0, yHp0);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::reset(
+		float                                    x0,
+		std::array<float, N_LANES> * BW_RESTRICT yLp0,
+		std::array<float, N_LANES> * BW_RESTRICT yBp0,
+		std::array<float, N_LANES> * BW_RESTRICT yHp0) {
+	reset(x0, yLp0 != BW_NULL ? yLp0->data() : BW_NULL, yBp0 != BW_NULL ? yBp0->data() : BW_NULL, yHp0 != BW_NULL ? yHp0->data() : BW_NULL);
+}
+# endif
+
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::reset(
+		const float * x0,
+		float *       yLp0,
+		float *       yBp0,
+		float *       yHp0) {
+	bw_svf_bank_reset_coeffs(&coeffs);
+	bw_svf_bank_reset_state(&coeffs, &state, x0, yLp0, yBp0, yHp0);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::reset(
+		std::array<float, N_LANES>               x0,
+		std::array<float, N_LANES> * BW_RESTRICT yLp0,
+		std::array<float, N_LANES> * BW_RESTRICT yBp0,
+		std::array<float, N_LANES> * BW_RESTRICT yHp0) {
+	reset(x0.data(), yLp0 != BW_NULL ? yLp0->data() : BW_NULL, yBp0 != BW_NULL ? yBp0->data() : BW_NULL, yHp0 != BW_NULL ? yHp0->data() : BW_NULL);
+}
+# endif
+
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::process(
+		const float * const * x,
+		const float * const * cutoff,
+		float * const *       yLp,
+		float * const *       yBp,
+		float * const *       yHp,
+		size_t                nSamples) {
+	bw_svf_bank_process(&coeffs, &state, x, cutoff, yLp, yBp, yHp, nSamples);
+}
+
+# ifndef BW_CXX_NO_ARRAY
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::process(
+		std::array<const float *, N_LANES> x,
+		std::array<const float *, N_LANES> cutoff,
+		std::array<float *, N_LANES>       yLp,
+		std::array<float *, N_LANES>       yBp,
+		std::array<float *, N_LANES>       yHp,
+		size_t                             nSamples) {
+	process(x.data(), cutoff.data(), yLp.data(), yBp.data(), yHp.data(), nSamples);
+}
+# endif
+
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::setCutoff(
+		size_t lane,
+		float  value) {
+	bw_svf_bank_set_cutoff(&coeffs, lane, value);
+}
+
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::setQ(
+		size_t lane,
+		float  value) {
+	bw_svf_bank_set_Q(&coeffs, lane, value);
+}
+
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::setPrewarpAtCutoff(
+		size_t lane,
+		bool   value) {
+	bw_svf_bank_set_prewarp_at_cutoff(&coeffs, lane, value);
+}
+
+template<size_t N_LANES>
+inline void SVFBank<N_LANES>::setPrewarpFreq(
+		size_t lane,
+		float  value) {
+	bw_svf_bank_set_prewarp_freq(&coeffs, lane, value);
+}
+
+}
+#endif
+
+#endif
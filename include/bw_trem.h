@@ -20,7 +20,7 @@
 
 /*!
  *  module_type {{{ dsp }}}
- *  version {{{ 1.2.4 }}}
+ *  version {{{ 1.3.0 }}}
  *  requires {{{
  *    bw_common bw_math bw_one_pole bw_osc_sin bw_phase_gen bw_ring_mod
  *  }}}
@@ -29,6 +29,12 @@
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.3.0</strong>:
+ *        <ul>
+ *          <li>The sinusoidal LFO now uses the recursive mode of
+ *              bw_osc_sin.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.2.4</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -349,6 +355,7 @@ struct bw_trem_state {
 
 	// Sub-components
 	bw_phase_gen_state	phase_gen_state;
+	bw_osc_sin_state	osc_sin_state;
 };
 
 static inline void bw_trem_init(
@@ -414,7 +421,7 @@ static inline float bw_trem_reset_state(
 
 	float p, pi;
 	bw_phase_gen_reset_state(&coeffs->phase_gen_coeffs, &state->phase_gen_state, 0.f, &p, &pi);
-	const float c = bw_osc_sin_process1(p);
+	const float c = bw_osc_sin_reset_state(&state->osc_sin_state, p, pi);
 	const float y = bw_ring_mod_process1(&coeffs->ring_mod_coeffs, x_0, 1.f + c);
 
 #ifdef BW_DEBUG_DEEP
@@ -497,7 +504,7 @@ static inline float bw_trem_process1(
 
 	float p, pi;
 	bw_phase_gen_process1(&coeffs->phase_gen_coeffs, &state->phase_gen_state, &p, &pi);
-	const float c = bw_osc_sin_process1(p);
+	const float c = bw_osc_sin_process1_rec(&state->osc_sin_state, p, pi);
 	const float y = bw_ring_mod_process1(&coeffs->ring_mod_coeffs, x, 1.f + c);
 
 	BW_ASSERT_DEEP(bw_trem_coeffs_is_valid(coeffs));
@@ -644,7 +651,8 @@ static inline char bw_trem_state_is_valid(
 		return 0;
 #endif
 
-	return bw_phase_gen_state_is_valid(coeffs ? &coeffs->phase_gen_coeffs : BW_NULL, &state->phase_gen_state);
+	return bw_phase_gen_state_is_valid(coeffs ? &coeffs->phase_gen_coeffs : BW_NULL, &state->phase_gen_state)
+		&& bw_osc_sin_state_is_valid(&state->osc_sin_state);
 }
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
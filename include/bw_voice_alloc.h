@@ -20,13 +20,31 @@
 
 /*!
  *  module_type {{{ utility }}}
- *  version {{{ 1.1.1 }}}
+ *  version {{{ 1.2.0 }}}
  *  requires {{{ bw_common bw_note_queue }}}
  *  description {{{
- *    Basic voice allocator with low/high note priority.
+ *    Basic voice allocator with low/high note priority and constant-time
+ *    voice allocator with voice stealing for large polyphony.
  *  }}}
  *  changelog {{{
  *    <ul>
+ *      <li>Version <strong>1.2.0</strong>:
+ *        <ul>
+ *          <li>Added <code>BW_VOICE_ALLOC_N_VOICES_MAX</code>,
+ *              <code>bw_voice_alloc_steal</code>,
+ *              <code>bw_voice_alloc_state</code>,
+ *              <code>bw_voice_alloc_reset_state()</code>,
+ *              <code>bw_voice_alloc_process()</code>,
+ *              <code>bw_voice_alloc_set_steal()</code>,
+ *              <code>bw_voice_alloc_set_voice_free()</code>,
+ *              <code>bw_voice_alloc_set_voice_level()</code>,
+ *              <code>bw_voice_alloc_get_voice_note()</code>,
+ *              <code>bw_voice_alloc_get_voice_gate()</code>,
+ *              <code>bw_voice_alloc_get_voice_velocity()</code>,
+ *              <code>bw_voice_alloc_is_voice_free()</code>, and
+ *              <code>bw_voice_alloc_state_is_valid()</code>.</li>
+ *        </ul>
+ *      </li>
  *      <li>Version <strong>1.1.1</strong>:
  *        <ul>
  *          <li>Updated dependencies.</li>
@@ -152,6 +170,173 @@ static inline void bw_voice_alloc(
  *
  *    `voices` is the array of opaque voice pointers and `n_voices` indicates
  *    the number of elements in `voices`.
+ *
+ *    It takes O(`queue->n_events` * `n_voices`) time and calls `is_free` and
+ *    `get_note` on every voice for each event. See `bw_voice_alloc_state` for
+ *    a constant-time alternative.
+ *
+ *    #### BW_VOICE_ALLOC_N_VOICES_MAX
+ *
+ *    Maximum number of voices that a `bw_voice_alloc_state` can manage. It
+ *    must be in [`1`, `65535`] and its default value is `256`.
+ *  >>> */
+#ifndef BW_VOICE_ALLOC_N_VOICES_MAX
+# define BW_VOICE_ALLOC_N_VOICES_MAX	256
+#endif
+
+#if BW_VOICE_ALLOC_N_VOICES_MAX < 1 || BW_VOICE_ALLOC_N_VOICES_MAX > 65535
+# error BW_VOICE_ALLOC_N_VOICES_MAX must be in [1, 65535]
+#endif
+/*! ...
+ *
+ *    #### bw_voice_alloc_steal
+ *  ```>>> */
+typedef enum {
+	bw_voice_alloc_steal_oldest,
+	bw_voice_alloc_steal_quietest,
+	bw_voice_alloc_steal_lowest,
+	bw_voice_alloc_steal_highest
+} bw_voice_alloc_steal;
+/*! <<<```
+ *    Voice stealing policy, used when a new note is played and no voice is
+ *    free:
+ *     * `bw_voice_alloc_steal_oldest`: steals the voice that was assigned
+ *       least recently;
+ *     * `bw_voice_alloc_steal_quietest`: steals the voice with the lowest
+ *       level as set via `bw_voice_alloc_set_voice_level()`;
+ *     * `bw_voice_alloc_steal_lowest`: steals the voice playing the lowest
+ *       note (high note priority);
+ *     * `bw_voice_alloc_steal_highest`: steals the voice playing the highest
+ *       note (low note priority).
+ *
+ *    In any case, released voices (whose note is not pressed anymore) are
+ *    stolen before voices whose note is still pressed.
+ *
+ *    #### bw_voice_alloc_state
+ *  ```>>> */
+typedef struct bw_voice_alloc_state bw_voice_alloc_state;
+/*! <<<```
+ *    Internal state and related.
+ *
+ *    It keeps track of which note each voice is playing and whether its gate
+ *    is on, in place of the callbacks in `bw_voice_alloc_opts`. It maintains
+ *    a note-to-voice table and lists of free, released, and held voices
+ *    ordered by age, so that voice allocation, retriggering, and stealing by
+ *    age or by note take constant time per event.
+ *
+ *    Voices are identified by their index in [`0`, `n_voices - 1`]. A voice
+ *    becomes free only when explicitly told via
+ *    `bw_voice_alloc_set_voice_free()`, typically once its release phase is
+ *    over.
+ *
+ *    #### bw_voice_alloc_reset_state()
+ *  ```>>> */
+static inline void bw_voice_alloc_reset_state(
+	bw_voice_alloc_state * BW_RESTRICT state,
+	size_t                             n_voices);
+/*! <<<```
+ *    Resets the given `state` so that it manages `n_voices` voices, all free
+ *    and with note `0`, gate off, velocity `0.f`, and level `0.f`. It also
+ *    sets the voice stealing policy to `bw_voice_alloc_steal_oldest`.
+ *
+ *    `n_voices` must be in [`1`, `BW_VOICE_ALLOC_N_VOICES_MAX`].
+ *
+ *    #### bw_voice_alloc_process()
+ *  ```>>> */
+static inline void bw_voice_alloc_process(
+	bw_voice_alloc_state * BW_RESTRICT state,
+	bw_note_queue * BW_RESTRICT        queue);
+/*! <<<```
+ *    Performs voice allocation using the events in `queue` and updates
+ *    `state` accordingly.
+ *
+ *    For each event, if a voice is already assigned to its note, such voice
+ *    is released and/or retriggered, otherwise a free voice is assigned to it,
+ *    if any, or a voice is stolen according to the chosen policy.
+ *
+ *    It takes constant time per event, except when stealing with
+ *    `bw_voice_alloc_steal_quietest`, which takes O(`n_voices`) time.
+ *
+ *    #### bw_voice_alloc_set_steal()
+ *  ```>>> */
+static inline void bw_voice_alloc_set_steal(
+	bw_voice_alloc_state * BW_RESTRICT state,
+	bw_voice_alloc_steal               value);
+/*! <<<```
+ *    Sets the voice stealing policy to `value` in `state`.
+ *
+ *    Default value: `bw_voice_alloc_steal_oldest`.
+ *
+ *    #### bw_voice_alloc_set_voice_free()
+ *  ```>>> */
+static inline void bw_voice_alloc_set_voice_free(
+	bw_voice_alloc_state * BW_RESTRICT state,
+	size_t                             voice);
+/*! <<<```
+ *    Marks `voice` as free in `state`, so that it can be assigned to new
+ *    notes without stealing.
+ *
+ *    `voice` must not have its gate on. It does nothing if `voice` is already
+ *    free.
+ *
+ *    #### bw_voice_alloc_set_voice_level()
+ *  ```>>> */
+static inline void bw_voice_alloc_set_voice_level(
+	bw_voice_alloc_state * BW_RESTRICT state,
+	size_t                             voice,
+	float                              value);
+/*! <<<```
+ *    Sets the level of `voice` to `value` in `state`, as used by
+ *    `bw_voice_alloc_steal_quietest`.
+ *
+ *    `value` must be finite.
+ *
+ *    #### bw_voice_alloc_get_voice_note()
+ *  ```>>> */
+static inline unsigned char bw_voice_alloc_get_voice_note(
+	const bw_voice_alloc_state * BW_RESTRICT state,
+	size_t                                   voice);
+/*! <<<```
+ *    Returns the number of the note last assigned to `voice` in `state`.
+ *
+ *    #### bw_voice_alloc_get_voice_gate()
+ *  ```>>> */
+static inline char bw_voice_alloc_get_voice_gate(
+	const bw_voice_alloc_state * BW_RESTRICT state,
+	size_t                                   voice);
+/*! <<<```
+ *    Returns whether the gate of `voice` is on (non-`0`) or off (`0`) in
+ *    `state`.
+ *
+ *    #### bw_voice_alloc_get_voice_velocity()
+ *  ```>>> */
+static inline float bw_voice_alloc_get_voice_velocity(
+	const bw_voice_alloc_state * BW_RESTRICT state,
+	size_t                                   voice);
+/*! <<<```
+ *    Returns the velocity of the last note on or off event that affected
+ *    `voice` in `state`. Its value is in [`0.f`, `1.f`] or otherwise negative
+ *    to indicate unknown / not available.
+ *
+ *    #### bw_voice_alloc_is_voice_free()
+ *  ```>>> */
+static inline char bw_voice_alloc_is_voice_free(
+	const bw_voice_alloc_state * BW_RESTRICT state,
+	size_t                                   voice);
+/*! <<<```
+ *    Returns whether `voice` is free (non-`0`) or not (`0`) in `state`.
+ *
+ *    #### bw_voice_alloc_state_is_valid()
+ *  ```>>> */
+static inline char bw_voice_alloc_state_is_valid(
+	const bw_voice_alloc_state * BW_RESTRICT state);
+/*! <<<```
+ *    Tries to determine whether `state` is valid and returns non-`0` if it
+ *    seems to be the case and `0` if it is certainly not. False positives are
+ *    possible, false negatives are not.
+ *
+ *    `state` must at least point to a readable memory block of size greater
+ *    than or equal to that of `bw_voice_alloc_state`.
  *  }}} */
 
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
@@ -227,6 +412,332 @@ static inline void bw_voice_alloc(
 	}
 }
 
+#define BW_VOICE_ALLOC_NONE	0xffff
+
+enum {
+	bw_voice_alloc_list_free,
+	bw_voice_alloc_list_released,
+	bw_voice_alloc_list_held
+};
+
+struct bw_voice_alloc_state {
+#ifdef BW_DEBUG_DEEP
+	uint32_t		hash;
+#endif
+
+	// Parameters
+	bw_voice_alloc_steal	steal;
+	size_t			n_voices;
+
+	// States
+	uint16_t		note_voice[128];
+	uint64_t		masks[3][2];	// free list mask unused
+	uint16_t		heads[3];
+	uint16_t		tails[3];
+	uint16_t		prev[BW_VOICE_ALLOC_N_VOICES_MAX];
+	uint16_t		next[BW_VOICE_ALLOC_N_VOICES_MAX];
+	unsigned char		list[BW_VOICE_ALLOC_N_VOICES_MAX];
+	unsigned char		note[BW_VOICE_ALLOC_N_VOICES_MAX];
+	float			velocity[BW_VOICE_ALLOC_N_VOICES_MAX];
+	float			level[BW_VOICE_ALLOC_N_VOICES_MAX];
+};
+
+static inline void bw_voice_alloc_list_remove(
+		bw_voice_alloc_state * BW_RESTRICT state,
+		uint16_t                           voice) {
+	const unsigned char l = state->list[voice];
+	const uint16_t p = state->prev[voice];
+	const uint16_t n = state->next[voice];
+	if (p != BW_VOICE_ALLOC_NONE)
+		state->next[p] = n;
+	else
+		state->heads[l] = n;
+	if (n != BW_VOICE_ALLOC_NONE)
+		state->prev[n] = p;
+	else
+		state->tails[l] = p;
+	if (l != bw_voice_alloc_list_free) {
+		const unsigned char note = state->note[voice];
+		state->masks[l][note >> 6] &= ~((uint64_t)1 << (note & 63));
+	}
+}
+
+static inline void bw_voice_alloc_list_append(
+		bw_voice_alloc_state * BW_RESTRICT state,
+		uint16_t                           voice,
+		unsigned char                      list) {
+	const uint16_t t = state->tails[list];
+	state->prev[voice] = t;
+	state->next[voice] = BW_VOICE_ALLOC_NONE;
+	if (t != BW_VOICE_ALLOC_NONE)
+		state->next[t] = voice;
+	else
+		state->heads[list] = voice;
+	state->tails[list] = voice;
+	state->list[voice] = list;
+	if (list != bw_voice_alloc_list_free) {
+		const unsigned char note = state->note[voice];
+		state->masks[list][note >> 6] |= (uint64_t)1 << (note & 63);
+	}
+}
+
+static inline unsigned char bw_voice_alloc_lsb64(
+		uint64_t x) {
+	unsigned char n = 0;
+	if (!(x & 0xffffffff)) { n += 32; x >>= 32; }
+	if (!(x & 0xffff)) { n += 16; x >>= 16; }
+	if (!(x & 0xff)) { n += 8; x >>= 8; }
+	if (!(x & 0xf)) { n += 4; x >>= 4; }
+	if (!(x & 0x3)) { n += 2; x >>= 2; }
+	if (!(x & 0x1)) n += 1;
+	return n;
+}
+
+static inline unsigned char bw_voice_alloc_msb64(
+		uint64_t x) {
+	unsigned char n = 0;
+	if (x >> 32) { n += 32; x >>= 32; }
+	if (x >> 16) { n += 16; x >>= 16; }
+	if (x >> 8) { n += 8; x >>= 8; }
+	if (x >> 4) { n += 4; x >>= 4; }
+	if (x >> 2) { n += 2; x >>= 2; }
+	if (x >> 1) n += 1;
+	return n;
+}
+
+static inline uint16_t bw_voice_alloc_pick(
+		const bw_voice_alloc_state * BW_RESTRICT state,
+		unsigned char                            list) {
+	// list is not empty, hence neither is its note mask
+	const uint64_t *m = state->masks[list];
+	uint16_t v = state->heads[list];
+	switch (state->steal) {
+	case bw_voice_alloc_steal_oldest:
+		break;
+	case bw_voice_alloc_steal_quietest:
+		for (uint16_t i = state->next[v]; i != BW_VOICE_ALLOC_NONE; i = state->next[i])
+			if (state->level[i] < state->level[v])
+				v = i;
+		break;
+	case bw_voice_alloc_steal_lowest:
+		v = state->note_voice[m[0] ? bw_voice_alloc_lsb64(m[0]) : 64 + bw_voice_alloc_lsb64(m[1])];
+		break;
+	default:
+		v = state->note_voice[m[1] ? 64 + bw_voice_alloc_msb64(m[1]) : bw_voice_alloc_msb64(m[0])];
+		break;
+	}
+	return v;
+}
+
+static inline void bw_voice_alloc_reset_state(
+		bw_voice_alloc_state * BW_RESTRICT state,
+		size_t                             n_voices) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT(n_voices >= 1 && n_voices <= BW_VOICE_ALLOC_N_VOICES_MAX);
+
+	state->steal = bw_voice_alloc_steal_oldest;
+	state->n_voices = n_voices;
+	for (int i = 0; i < 128; i++)
+		state->note_voice[i] = BW_VOICE_ALLOC_NONE;
+	for (int i = 0; i < 3; i++) {
+		state->masks[i][0] = 0;
+		state->masks[i][1] = 0;
+		state->heads[i] = BW_VOICE_ALLOC_NONE;
+		state->tails[i] = BW_VOICE_ALLOC_NONE;
+	}
+	for (uint16_t i = 0; i < n_voices; i++) {
+		state->note[i] = 0;
+		state->velocity[i] = 0.f;
+		state->level[i] = 0.f;
+		bw_voice_alloc_list_append(state, i, bw_voice_alloc_list_free);
+	}
+
+#ifdef BW_DEBUG_DEEP
+	state->hash = bw_hash_sdbm("bw_voice_alloc_state");
+#endif
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+}
+
+static inline void bw_voice_alloc_process(
+		bw_voice_alloc_state * BW_RESTRICT state,
+		bw_note_queue * BW_RESTRICT        queue) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+	BW_ASSERT(queue != BW_NULL);
+	BW_ASSERT_DEEP(bw_note_queue_is_valid(queue));
+
+	for (unsigned char i = 0; i < queue->n_events; i++) {
+		const bw_note_queue_event *ev = queue->events + i;
+		const bw_note_queue_status *st = queue->status + ev->note;
+		uint16_t v = state->note_voice[ev->note];
+
+		if (v != BW_VOICE_ALLOC_NONE) {
+			if (!st->pressed || ev->went_off) {
+				if (state->list[v] == bw_voice_alloc_list_held) {
+					bw_voice_alloc_list_remove(state, v);
+					bw_voice_alloc_list_append(state, v, bw_voice_alloc_list_released);
+				}
+				state->velocity[v] = st->velocity;
+			}
+			if (st->pressed) {
+				bw_voice_alloc_list_remove(state, v);
+				bw_voice_alloc_list_append(state, v, bw_voice_alloc_list_held);
+				state->velocity[v] = st->velocity;
+			}
+			continue;
+		}
+
+		if (!st->pressed)
+			continue;
+
+		v = state->heads[bw_voice_alloc_list_free];
+		if (v == BW_VOICE_ALLOC_NONE) {
+			v = bw_voice_alloc_pick(state, state->heads[bw_voice_alloc_list_released] != BW_VOICE_ALLOC_NONE
+				? bw_voice_alloc_list_released : bw_voice_alloc_list_held);
+			state->note_voice[state->note[v]] = BW_VOICE_ALLOC_NONE;
+		}
+		bw_voice_alloc_list_remove(state, v);
+		state->note[v] = ev->note;
+		state->velocity[v] = st->velocity;
+		bw_voice_alloc_list_append(state, v, bw_voice_alloc_list_held);
+		state->note_voice[ev->note] = v;
+	}
+
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+}
+
+static inline void bw_voice_alloc_set_steal(
+		bw_voice_alloc_state * BW_RESTRICT state,
+		bw_voice_alloc_steal               value) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+	BW_ASSERT(value >= bw_voice_alloc_steal_oldest && value <= bw_voice_alloc_steal_highest);
+
+	state->steal = value;
+
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+}
+
+static inline void bw_voice_alloc_set_voice_free(
+		bw_voice_alloc_state * BW_RESTRICT state,
+		size_t                             voice) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+	BW_ASSERT(voice < state->n_voices);
+	BW_ASSERT(state->list[voice] != bw_voice_alloc_list_held);
+
+	if (state->list[voice] != bw_voice_alloc_list_released)
+		return;
+	const uint16_t v = (uint16_t)voice;
+	bw_voice_alloc_list_remove(state, v);
+	state->note_voice[state->note[v]] = BW_VOICE_ALLOC_NONE;
+	bw_voice_alloc_list_append(state, v, bw_voice_alloc_list_free);
+
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+}
+
+static inline void bw_voice_alloc_set_voice_level(
+		bw_voice_alloc_state * BW_RESTRICT state,
+		size_t                             voice,
+		float                              value) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+	BW_ASSERT(voice < state->n_voices);
+	BW_ASSERT(bw_is_finite(value));
+
+	state->level[voice] = value;
+
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+}
+
+static inline unsigned char bw_voice_alloc_get_voice_note(
+		const bw_voice_alloc_state * BW_RESTRICT state,
+		size_t                                   voice) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+	BW_ASSERT(voice < state->n_voices);
+
+	return state->note[voice];
+}
+
+static inline char bw_voice_alloc_get_voice_gate(
+		const bw_voice_alloc_state * BW_RESTRICT state,
+		size_t                                   voice) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+	BW_ASSERT(voice < state->n_voices);
+
+	return state->list[voice] == bw_voice_alloc_list_held;
+}
+
+static inline float bw_voice_alloc_get_voice_velocity(
+		const bw_voice_alloc_state * BW_RESTRICT state,
+		size_t                                   voice) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+	BW_ASSERT(voice < state->n_voices);
+
+	return state->velocity[voice];
+}
+
+static inline char bw_voice_alloc_is_voice_free(
+		const bw_voice_alloc_state * BW_RESTRICT state,
+		size_t                                   voice) {
+	BW_ASSERT(state != BW_NULL);
+	BW_ASSERT_DEEP(bw_voice_alloc_state_is_valid(state));
+	BW_ASSERT(voice < state->n_voices);
+
+	return state->list[voice] == bw_voice_alloc_list_free;
+}
+
+static inline char bw_voice_alloc_state_is_valid(
+		const bw_voice_alloc_state * BW_RESTRICT state) {
+	BW_ASSERT(state != BW_NULL);
+
+#ifdef BW_DEBUG_DEEP
+	if (state->hash != bw_hash_sdbm("bw_voice_alloc_state"))
+		return 0;
+#endif
+
+	if (state->steal < bw_voice_alloc_steal_oldest || state->steal > bw_voice_alloc_steal_highest)
+		return 0;
+	if (state->n_voices < 1 || state->n_voices > BW_VOICE_ALLOC_N_VOICES_MAX)
+		return 0;
+
+	size_t cnt = 0;
+	for (unsigned char l = bw_voice_alloc_list_free; l <= bw_voice_alloc_list_held; l++) {
+		uint16_t p = BW_VOICE_ALLOC_NONE;
+		for (uint16_t i = state->heads[l]; i != BW_VOICE_ALLOC_NONE; i = state->next[i]) {
+			if (i >= state->n_voices || state->list[i] != l || state->prev[i] != p || ++cnt > state->n_voices)
+				return 0;
+			const unsigned char note = state->note[i];
+			if (note >= 128 || !bw_is_finite(state->velocity[i]) || state->velocity[i] > 1.f || !bw_is_finite(state->level[i]))
+				return 0;
+			if (l != bw_voice_alloc_list_free
+			    && (state->note_voice[note] != i || !(state->masks[l][note >> 6] & ((uint64_t)1 << (note & 63)))))
+				return 0;
+			p = i;
+		}
+		if (state->tails[l] != p)
+			return 0;
+	}
+	if (cnt != state->n_voices)
+		return 0;
+
+	for (int i = 0; i < 128; i++) {
+		const uint16_t v = state->note_voice[i];
+		if (v != BW_VOICE_ALLOC_NONE && (v >= state->n_voices || state->note[v] != i || state->list[v] == bw_voice_alloc_list_free))
+			return 0;
+		for (unsigned char l = bw_voice_alloc_list_released; l <= bw_voice_alloc_list_held; l++)
+			if (!(state->masks[l][i >> 6] & ((uint64_t)1 << (i & 63))) != (v == BW_VOICE_ALLOC_NONE || state->list[v] != l))
+				return 0;
+	}
+
+	return 1;
+}
+
+#undef BW_VOICE_ALLOC_NONE
+
 #if !defined(BW_CXX_NO_EXTERN_C) && defined(__cplusplus)
 }
 #endif
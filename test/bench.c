@@ -0,0 +1,1076 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <bw_math.h>
+#include <bw_rand.h>
+#include <bw_ap1.h>
+#include <bw_ap2.h>
+#include <bw_balance.h>
+#include <bw_bd_reduce.h>
+#include <bw_cab.h>
+#include <bw_chorus.h>
+#include <bw_clip.h>
+#include <bw_comb.h>
+#include <bw_comp.h>
+#include <bw_conv.h>
+#include <bw_conv_nu.h>
+#include <bw_delay.h>
+#include <bw_dist.h>
+#include <bw_drive.h>
+#include <bw_dry_wet.h>
+#include <bw_env_follow.h>
+#include <bw_env_gen.h>
+#include <bw_fdn.h>
+#include <bw_fuzz.h>
+#include <bw_gain.h>
+#include <bw_hp1.h>
+#include <bw_hs1.h>
+#include <bw_hs2.h>
+#include <bw_lp1.h>
+#include <bw_ls1.h>
+#include <bw_ls2.h>
+#include <bw_mm1.h>
+#include <bw_mm2.h>
+#include <bw_noise_gate.h>
+#include <bw_noise_gen.h>
+#include <bw_notch.h>
+#include <bw_one_pole.h>
+#include <bw_os.h>
+#include <bw_osc_filt.h>
+#include <bw_osc_pulse.h>
+#include <bw_osc_saw.h>
+#include <bw_osc_sin.h>
+#include <bw_osc_tri.h>
+#include <bw_osc_wt.h>
+#include <bw_pan.h>
+#include <bw_peak.h>
+#include <bw_phase_gen.h>
+#include <bw_phaser.h>
+#include <bw_pink_filt.h>
+#include <bw_ppm.h>
+#include <bw_reverb.h>
+#include <bw_ring_mod.h>
+#include <bw_sampler.h>
+#include <bw_satur.h>
+#include <bw_slew_lim.h>
+#include <bw_sos.h>
+#include <bw_sr_reduce.h>
+#include <bw_src.h>
+#include <bw_src_int.h>
+#include <bw_svf.h>
+#include <bw_svf_bank.h>
+#include <bw_trem.h>
+#include <bw_wah.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+# define BENCH_HAS_CYCLES
+#endif
+
+/* Usage: bench [-n frames] [-r repetitions] [-b baseline] [-t threshold] [module ...]
+ *
+ * For each module, channel count, block size and modulation scenario, writes
+ * one line of tab-separated values to stdout:
+ *
+ *   module function scenario n_channels block_size ns_per_sample cycles_per_sample
+ *
+ * Times are per processed sample per channel, minimum over repetitions.
+ * Cycles are TSC cycles and are reported as nan where not available.
+ *
+ * If a baseline file (previous output) is given, each line also reports the
+ * baseline ns_per_sample, the ratio between the two and a status (ok, new,
+ * regression), and the exit status is 1 if any ratio exceeds
+ * 1 + threshold / 100 (default threshold: 10). */
+
+#define SAMPLE_RATE	48000.f
+#define N_CH_MAX	8
+#define BLOCK_MAX	1024
+#define WARMUP_FRAMES	4096
+#define IR_LENGTH	16384
+
+static const size_t block_sizes[] = { 1, 16, 64, 128, 1024 };
+static const size_t channel_counts[] = { 1, 2, 8 };
+
+static float x_buf[N_CH_MAX][BLOCK_MAX];
+static float x2_buf[N_CH_MAX][BLOCK_MAX];
+static float phase_buf[N_CH_MAX][BLOCK_MAX];
+static float phase_inc_buf[N_CH_MAX][BLOCK_MAX];
+static float y_buf[N_CH_MAX][2 * BLOCK_MAX];
+static float y2_buf[N_CH_MAX][2 * BLOCK_MAX];
+static float y3_buf[N_CH_MAX][2 * BLOCK_MAX];
+
+static const float *x[N_CH_MAX];
+static const float *x2[N_CH_MAX];
+static const float *phase[N_CH_MAX];
+static const float *phase_inc[N_CH_MAX];
+static float *y[N_CH_MAX];
+static float *y2[N_CH_MAX];
+static float *y3[N_CH_MAX];
+
+static const float zeros[N_CH_MAX];
+static const char gates[N_CH_MAX] = { 1, 1, 1, 1, 1, 1, 1, 1 };
+
+static float *sample_data;
+static size_t sample_length;
+
+static float ir_data[IR_LENGTH];
+
+typedef struct {
+	const char *	name;
+	void		(*init)(size_t n_channels);
+	void		(*set)(float p);
+	void		(*process)(size_t n_samples);
+	void		(*process_multi)(size_t n_channels, size_t n_samples);
+	void		(*fini)(void);
+} bench_module;
+
+/* Modules with coeffs and per-channel state that process x into y. SET sets
+ * parameters in coeffs c as a function of p in [0, 1]. */
+#define BENCH_XY(m, SET) \
+	static bw_##m##_coeffs m##_coeffs; \
+	static bw_##m##_state m##_state[N_CH_MAX]; \
+	static bw_##m##_state *m##_statep[N_CH_MAX]; \
+	static void m##_set(float p) { \
+		bw_##m##_coeffs *c = &m##_coeffs; \
+		(void)c; \
+		(void)p; \
+		SET; \
+	} \
+	static void m##_init(size_t n_channels) { \
+		bw_##m##_init(&m##_coeffs); \
+		bw_##m##_set_sample_rate(&m##_coeffs, SAMPLE_RATE); \
+		m##_set(0.5f); \
+		bw_##m##_reset_coeffs(&m##_coeffs); \
+		for (size_t i = 0; i < n_channels; i++) \
+			m##_statep[i] = m##_state + i; \
+		bw_##m##_reset_state_multi(&m##_coeffs, m##_statep, zeros, BW_NULL, n_channels); \
+	} \
+	static void m##_process(size_t n_samples) { \
+		bw_##m##_process(&m##_coeffs, m##_state, x[0], y[0], n_samples); \
+	} \
+	static void m##_process_multi(size_t n_channels, size_t n_samples) { \
+		bw_##m##_process_multi(&m##_coeffs, m##_statep, x, y, n_channels, n_samples); \
+	}
+
+/* Same, for modules whose state needs memory. */
+#define BENCH_XY_MEM(m, MAX_DELAY, SET) \
+	static bw_##m##_coeffs m##_coeffs; \
+	static bw_##m##_state m##_state[N_CH_MAX]; \
+	static bw_##m##_state *m##_statep[N_CH_MAX]; \
+	static char *m##_mem; \
+	static void m##_set(float p) { \
+		bw_##m##_coeffs *c = &m##_coeffs; \
+		SET; \
+	} \
+	static void m##_init(size_t n_channels) { \
+		bw_##m##_init(&m##_coeffs, MAX_DELAY); \
+		bw_##m##_set_sample_rate(&m##_coeffs, SAMPLE_RATE); \
+		const size_t req = bw_##m##_mem_req(&m##_coeffs); \
+		m##_mem = (char *)malloc(req * n_channels); \
+		for (size_t i = 0; i < n_channels; i++) { \
+			m##_statep[i] = m##_state + i; \
+			bw_##m##_mem_set(&m##_coeffs, m##_state + i, m##_mem + req * i); \
+		} \
+		m##_set(0.5f); \
+		bw_##m##_reset_coeffs(&m##_coeffs); \
+		bw_##m##_reset_state_multi(&m##_coeffs, m##_statep, zeros, BW_NULL, n_channels); \
+	} \
+	static void m##_process(size_t n_samples) { \
+		bw_##m##_process(&m##_coeffs, m##_state, x[0], y[0], n_samples); \
+	} \
+	static void m##_process_multi(size_t n_channels, size_t n_samples) { \
+		bw_##m##_process_multi(&m##_coeffs, m##_statep, x, y, n_channels, n_samples); \
+	} \
+	static void m##_fini(void) { \
+		free(m##_mem); \
+	}
+
+/* Modules with coeffs only. */
+#define BENCH_COEFFS(m, SET, PROCESS, PROCESS_MULTI) \
+	static bw_##m##_coeffs m##_coeffs; \
+	static void m##_set(float p) { \
+		bw_##m##_coeffs *c = &m##_coeffs; \
+		SET; \
+	} \
+	static void m##_init(size_t n_channels) { \
+		(void)n_channels; \
+		bw_##m##_init(&m##_coeffs); \
+		bw_##m##_set_sample_rate(&m##_coeffs, SAMPLE_RATE); \
+		m##_set(0.5f); \
+		bw_##m##_reset_coeffs(&m##_coeffs); \
+	} \
+	static void m##_process(size_t n_samples) { \
+		bw_##m##_coeffs *c = &m##_coeffs; \
+		PROCESS; \
+	} \
+	static void m##_process_multi(size_t n_channels, size_t n_samples) { \
+		bw_##m##_coeffs *c = &m##_coeffs; \
+		PROCESS_MULTI; \
+	}
+
+#define BENCH_ENTRY(m)		{ #m, m##_init, m##_set, m##_process, m##_process_multi, BW_NULL }
+#define BENCH_ENTRY_NO_SET(m)	{ #m, m##_init, BW_NULL, m##_process, m##_process_multi, BW_NULL }
+#define BENCH_ENTRY_MEM(m)	{ #m, m##_init, m##_set, m##_process, m##_process_multi, m##_fini }
+
+BENCH_XY(ap1, bw_ap1_set_cutoff(c, 100.f + 9900.f * p))
+BENCH_XY(ap2, bw_ap2_set_cutoff(c, 100.f + 9900.f * p))
+BENCH_XY(cab, bw_cab_set_cutoff_low(c, p); bw_cab_set_cutoff_high(c, p); bw_cab_set_tone(c, p))
+BENCH_XY(clip, bw_clip_set_gain(c, 1.f + 9.f * p); bw_clip_set_bias(c, 0.5f * p))
+BENCH_XY(dist, bw_dist_set_distortion(c, p); bw_dist_set_tone(c, p); bw_dist_set_volume(c, p))
+BENCH_XY(drive, bw_drive_set_drive(c, p); bw_drive_set_tone(c, p); bw_drive_set_volume(c, p))
+BENCH_XY(env_follow, bw_env_follow_set_attack_tau(c, 0.001f + 0.01f * p); bw_env_follow_set_release_tau(c, 0.01f + 0.1f * p))
+BENCH_XY(fuzz, bw_fuzz_set_fuzz(c, p); bw_fuzz_set_volume(c, p))
+BENCH_XY(hp1, bw_hp1_set_cutoff(c, 100.f + 9900.f * p))
+BENCH_XY(hs1, bw_hs1_set_cutoff(c, 100.f + 9900.f * p); bw_hs1_set_high_gain_lin(c, 0.5f + p))
+BENCH_XY(hs2, bw_hs2_set_cutoff(c, 100.f + 9900.f * p); bw_hs2_set_high_gain_lin(c, 0.5f + p))
+BENCH_XY(lp1, bw_lp1_set_cutoff(c, 100.f + 9900.f * p))
+BENCH_XY(ls1, bw_ls1_set_cutoff(c, 100.f + 9900.f * p); bw_ls1_set_dc_gain_lin(c, 0.5f + p))
+BENCH_XY(ls2, bw_ls2_set_cutoff(c, 100.f + 9900.f * p); bw_ls2_set_dc_gain_lin(c, 0.5f + p))
+BENCH_XY(mm1, bw_mm1_set_cutoff(c, 100.f + 9900.f * p); bw_mm1_set_coeff_x(c, p); bw_mm1_set_coeff_lp(c, 1.f - p))
+BENCH_XY(mm2, bw_mm2_set_cutoff(c, 100.f + 9900.f * p); bw_mm2_set_coeff_lp(c, p); bw_mm2_set_coeff_hp(c, 1.f - p))
+BENCH_XY(notch, bw_notch_set_cutoff(c, 100.f + 9900.f * p))
+BENCH_XY(one_pole, bw_one_pole_set_cutoff(c, 100.f + 9900.f * p))
+BENCH_XY(peak, bw_peak_set_cutoff(c, 100.f + 9900.f * p); bw_peak_set_peak_gain_lin(c, 0.5f + p))
+BENCH_XY(phaser, bw_phaser_set_rate(c, 0.1f + 10.f * p); bw_phaser_set_amount(c, p))
+BENCH_XY(pink_filt, )
+BENCH_XY(ppm, bw_ppm_set_integration_tau(c, 0.001f + 0.1f * p))
+BENCH_XY(satur, bw_satur_set_gain(c, 1.f + 9.f * p); bw_satur_set_bias(c, 0.5f * p))
+BENCH_XY(slew_lim, bw_slew_lim_set_max_rate(c, 100.f + 10000.f * p))
+BENCH_XY(sr_reduce, bw_sr_reduce_set_ratio(c, 0.1f + 0.9f * p))
+BENCH_XY(trem, bw_trem_set_rate(c, 0.1f + 10.f * p); bw_trem_set_amount(c, p))
+BENCH_XY(wah, bw_wah_set_wah(c, p))
+
+BENCH_XY_MEM(chorus, 0.01f, bw_chorus_set_rate(c, 0.1f + 2.f * p); bw_chorus_set_amount(c, 0.004f * p))
+BENCH_XY_MEM(comb, 0.1f, bw_comb_set_delay_ff(c, 0.01f + 0.05f * p); bw_comb_set_delay_fb(c, 0.01f + 0.08f * p); bw_comb_set_coeff_fb(c, 0.5f))
+BENCH_XY_MEM(delay, 1.f, bw_delay_set_delay(c, 0.01f + 0.9f * p))
+
+BENCH_COEFFS(bd_reduce,
+	bw_bd_reduce_set_bit_depth(c, 1 + (char)(15.f * p)),
+	bw_bd_reduce_process(c, x[0], y[0], n_samples),
+	bw_bd_reduce_process_multi(c, x, y, n_channels, n_samples))
+BENCH_COEFFS(balance,
+	bw_balance_set_balance(c, 2.f * p - 1.f),
+	bw_balance_process(c, x[0], x2[0], y[0], y2[0], n_samples),
+	bw_balance_process_multi(c, x, x2, y, y2, n_channels, n_samples))
+BENCH_COEFFS(dry_wet,
+	bw_dry_wet_set_wet(c, p),
+	bw_dry_wet_process(c, x[0], x2[0], y[0], n_samples),
+	bw_dry_wet_process_multi(c, x, x2, y, n_channels, n_samples))
+BENCH_COEFFS(gain,
+	bw_gain_set_gain_lin(c, 2.f * p),
+	bw_gain_process(c, x[0], y[0], n_samples),
+	bw_gain_process_multi(c, x, y, n_channels, n_samples))
+BENCH_COEFFS(osc_pulse,
+	bw_osc_pulse_set_antialiasing(c, 1); bw_osc_pulse_set_pulse_width(c, 0.1f + 0.8f * p),
+	bw_osc_pulse_process(c, phase[0], phase_inc[0], y[0], n_samples),
+	bw_osc_pulse_process_multi(c, phase, phase_inc, y, n_channels, n_samples))
+BENCH_COEFFS(osc_saw,
+	bw_osc_saw_set_antialiasing(c, p >= 0.25f),
+	bw_osc_saw_process(c, phase[0], phase_inc[0], y[0], n_samples),
+	bw_osc_saw_process_multi(c, phase, phase_inc, y, n_channels, n_samples))
+BENCH_COEFFS(osc_tri,
+	bw_osc_tri_set_antialiasing(c, 1); bw_osc_tri_set_slope(c, 0.1f + 0.8f * p),
+	bw_osc_tri_process(c, phase[0], phase_inc[0], y[0], n_samples),
+	bw_osc_tri_process_multi(c, phase, phase_inc, y, n_channels, n_samples))
+BENCH_COEFFS(pan,
+	bw_pan_set_pan(c, 2.f * p - 1.f),
+	bw_pan_process(c, x[0], y[0], y2[0], n_samples),
+	bw_pan_process_multi(c, x, y, y2, n_channels, n_samples))
+BENCH_COEFFS(ring_mod,
+	bw_ring_mod_set_amount(c, 2.f * p - 1.f),
+	bw_ring_mod_process(c, x[0], x2[0], y[0], n_samples),
+	bw_ring_mod_process_multi(c, x, x2, y, n_channels, n_samples))
+
+static bw_comp_coeffs comp_coeffs;
+static bw_comp_state comp_state[N_CH_MAX];
+static bw_comp_state *comp_statep[N_CH_MAX];
+
+static void comp_set(float p) {
+	bw_comp_set_thresh_lin(&comp_coeffs, 0.1f + 0.5f * p);
+	bw_comp_set_ratio(&comp_coeffs, p);
+}
+
+static void comp_init(size_t n_channels) {
+	bw_comp_init(&comp_coeffs);
+	bw_comp_set_sample_rate(&comp_coeffs, SAMPLE_RATE);
+	comp_set(0.5f);
+	bw_comp_reset_coeffs(&comp_coeffs);
+	for (size_t i = 0; i < n_channels; i++)
+		comp_statep[i] = comp_state + i;
+	bw_comp_reset_state_multi(&comp_coeffs, comp_statep, zeros, zeros, BW_NULL, n_channels);
+}
+
+static void comp_process(size_t n_samples) {
+	bw_comp_process(&comp_coeffs, comp_state, x[0], x2[0], y[0], n_samples);
+}
+
+static void comp_process_multi(size_t n_channels, size_t n_samples) {
+	bw_comp_process_multi(&comp_coeffs, comp_statep, x, x2, y, n_channels, n_samples);
+}
+
+static bw_noise_gate_coeffs noise_gate_coeffs;
+static bw_noise_gate_state noise_gate_state[N_CH_MAX];
+static bw_noise_gate_state *noise_gate_statep[N_CH_MAX];
+
+static void noise_gate_set(float p) {
+	bw_noise_gate_set_thresh_lin(&noise_gate_coeffs, 0.1f + 0.5f * p);
+	bw_noise_gate_set_ratio(&noise_gate_coeffs, 1.f + 10.f * p);
+}
+
+static void noise_gate_init(size_t n_channels) {
+	bw_noise_gate_init(&noise_gate_coeffs);
+	bw_noise_gate_set_sample_rate(&noise_gate_coeffs, SAMPLE_RATE);
+	noise_gate_set(0.5f);
+	bw_noise_gate_reset_coeffs(&noise_gate_coeffs);
+	for (size_t i = 0; i < n_channels; i++)
+		noise_gate_statep[i] = noise_gate_state + i;
+	bw_noise_gate_reset_state_multi(&noise_gate_coeffs, noise_gate_statep, zeros, zeros, BW_NULL, n_channels);
+}
+
+static void noise_gate_process(size_t n_samples) {
+	bw_noise_gate_process(&noise_gate_coeffs, noise_gate_state, x[0], x2[0], y[0], n_samples);
+}
+
+static void noise_gate_process_multi(size_t n_channels, size_t n_samples) {
+	bw_noise_gate_process_multi(&noise_gate_coeffs, noise_gate_statep, x, x2, y, n_channels, n_samples);
+}
+
+static bw_env_gen_coeffs env_gen_coeffs;
+static bw_env_gen_state env_gen_state[N_CH_MAX];
+static bw_env_gen_state *env_gen_statep[N_CH_MAX];
+
+static void env_gen_set(float p) {
+	bw_env_gen_set_attack(&env_gen_coeffs, 0.001f + 0.01f * p);
+	bw_env_gen_set_sustain(&env_gen_coeffs, p);
+}
+
+static void env_gen_init(size_t n_channels) {
+	bw_env_gen_init(&env_gen_coeffs);
+	bw_env_gen_set_sample_rate(&env_gen_coeffs, SAMPLE_RATE);
+	env_gen_set(0.5f);
+	bw_env_gen_reset_coeffs(&env_gen_coeffs);
+	for (size_t i = 0; i < n_channels; i++)
+		env_gen_statep[i] = env_gen_state + i;
+	bw_env_gen_reset_state_multi(&env_gen_coeffs, env_gen_statep, gates, BW_NULL, n_channels);
+}
+
+static void env_gen_process(size_t n_samples) {
+	bw_env_gen_process(&env_gen_coeffs, env_gen_state, 1, y[0], n_samples);
+}
+
+static void env_gen_process_multi(size_t n_channels, size_t n_samples) {
+	bw_env_gen_process_multi(&env_gen_coeffs, env_gen_statep, gates, y, n_channels, n_samples);
+}
+
+static bw_phase_gen_coeffs phase_gen_coeffs;
+static bw_phase_gen_state phase_gen_state[N_CH_MAX];
+static bw_phase_gen_state *phase_gen_statep[N_CH_MAX];
+
+static void phase_gen_set(float p) {
+	bw_phase_gen_set_frequency(&phase_gen_coeffs, 20.f + 2000.f * p);
+}
+
+static void phase_gen_init(size_t n_channels) {
+	bw_phase_gen_init(&phase_gen_coeffs);
+	bw_phase_gen_set_sample_rate(&phase_gen_coeffs, SAMPLE_RATE);
+	phase_gen_set(0.5f);
+	bw_phase_gen_reset_coeffs(&phase_gen_coeffs);
+	for (size_t i = 0; i < n_channels; i++)
+		phase_gen_statep[i] = phase_gen_state + i;
+	bw_phase_gen_reset_state_multi(&phase_gen_coeffs, phase_gen_statep, zeros, BW_NULL, BW_NULL, n_channels);
+}
+
+static void phase_gen_process(size_t n_samples) {
+	bw_phase_gen_process(&phase_gen_coeffs, phase_gen_state, BW_NULL, y[0], y2[0], n_samples);
+}
+
+static void phase_gen_process_multi(size_t n_channels, size_t n_samples) {
+	bw_phase_gen_process_multi(&phase_gen_coeffs, phase_gen_statep, BW_NULL, y, y2, n_channels, n_samples);
+}
+
+static bw_svf_coeffs svf_coeffs;
+static bw_svf_state svf_state[N_CH_MAX];
+static bw_svf_state *svf_statep[N_CH_MAX];
+
+static void svf_set(float p) {
+	bw_svf_set_cutoff(&svf_coeffs, 100.f + 9900.f * p);
+	bw_svf_set_Q(&svf_coeffs, 0.5f + 4.5f * p);
+}
+
+static void svf_init(size_t n_channels) {
+	bw_svf_init(&svf_coeffs);
+	bw_svf_set_sample_rate(&svf_coeffs, SAMPLE_RATE);
+	svf_set(0.5f);
+	bw_svf_reset_coeffs(&svf_coeffs);
+	for (size_t i = 0; i < n_channels; i++)
+		svf_statep[i] = svf_state + i;
+	bw_svf_reset_state_multi(&svf_coeffs, svf_statep, zeros, BW_NULL, BW_NULL, BW_NULL, n_channels);
+}
+
+static void svf_process(size_t n_samples) {
+	bw_svf_process(&svf_coeffs, svf_state, x[0], y[0], y2[0], y3[0], n_samples);
+}
+
+static void svf_process_multi(size_t n_channels, size_t n_samples) {
+	bw_svf_process_multi(&svf_coeffs, svf_statep, x, y, y2, y3, n_channels, n_samples);
+}
+
+static bw_conv_coeffs conv_coeffs;
+static bw_conv_state conv_state[N_CH_MAX];
+static bw_conv_state *conv_statep[N_CH_MAX];
+static char *conv_coeffs_mem;
+static char *conv_mem;
+
+static void conv_init(size_t n_channels) {
+	bw_conv_init(&conv_coeffs, 64, IR_LENGTH, 1);
+	conv_coeffs_mem = (char *)malloc(bw_conv_coeffs_mem_req(&conv_coeffs));
+	bw_conv_coeffs_mem_set(&conv_coeffs, conv_coeffs_mem);
+	bw_conv_set_ir(&conv_coeffs, 0, ir_data, IR_LENGTH);
+	bw_conv_reset_coeffs(&conv_coeffs);
+	const size_t req = bw_conv_mem_req(&conv_coeffs);
+	conv_mem = (char *)malloc(req * n_channels);
+	for (size_t i = 0; i < n_channels; i++) {
+		conv_statep[i] = conv_state + i;
+		bw_conv_mem_set(&conv_coeffs, conv_state + i, conv_mem + req * i);
+	}
+	bw_conv_reset_state_multi(&conv_coeffs, conv_statep, zeros, BW_NULL, n_channels);
+}
+
+static void conv_process(size_t n_samples) {
+	bw_conv_process(&conv_coeffs, conv_state, x[0], y, n_samples);
+}
+
+static void conv_process_multi(size_t n_channels, size_t n_samples) {
+	bw_conv_process_multi(&conv_coeffs, conv_statep, x, y, n_channels, n_samples);
+}
+
+static void conv_fini(void) {
+	free(conv_mem);
+	free(conv_coeffs_mem);
+}
+
+// no worker thread, tail partitions are computed when their deadline is met
+static bw_conv_nu_coeffs conv_nu_coeffs;
+static bw_conv_nu_state conv_nu_state[N_CH_MAX];
+static bw_conv_nu_state *conv_nu_statep[N_CH_MAX];
+static char *conv_nu_coeffs_mem;
+static char *conv_nu_mem;
+
+static void conv_nu_init(size_t n_channels) {
+	bw_conv_nu_init(&conv_nu_coeffs, 64, 1024, IR_LENGTH, 1);
+	conv_nu_coeffs_mem = (char *)malloc(bw_conv_nu_coeffs_mem_req(&conv_nu_coeffs));
+	bw_conv_nu_coeffs_mem_set(&conv_nu_coeffs, conv_nu_coeffs_mem);
+	bw_conv_nu_set_ir(&conv_nu_coeffs, 0, ir_data, IR_LENGTH);
+	bw_conv_nu_reset_coeffs(&conv_nu_coeffs);
+	const size_t req = bw_conv_nu_mem_req(&conv_nu_coeffs);
+	conv_nu_mem = (char *)malloc(req * n_channels);
+	for (size_t i = 0; i < n_channels; i++) {
+		conv_nu_statep[i] = conv_nu_state + i;
+		bw_conv_nu_mem_set(&conv_nu_coeffs, conv_nu_state + i, conv_nu_mem + req * i);
+	}
+	bw_conv_nu_reset_state_multi(&conv_nu_coeffs, conv_nu_statep, zeros, BW_NULL, n_channels);
+}
+
+static void conv_nu_process(size_t n_samples) {
+	bw_conv_nu_process(&conv_nu_coeffs, conv_nu_state, x[0], y, n_samples);
+}
+
+static void conv_nu_process_multi(size_t n_channels, size_t n_samples) {
+	bw_conv_nu_process_multi(&conv_nu_coeffs, conv_nu_statep, x, y, n_channels, n_samples);
+}
+
+static void conv_nu_fini(void) {
+	free(conv_nu_mem);
+	free(conv_nu_coeffs_mem);
+}
+
+// one lane per channel, process() and process_multi() are the same
+static bw_svf_bank_coeffs svf_bank_coeffs;
+static bw_svf_bank_state svf_bank_state;
+static size_t svf_bank_n_lanes;
+static char *svf_bank_coeffs_mem;
+static char *svf_bank_mem;
+
+static void svf_bank_set(float p) {
+	for (size_t i = 0; i < svf_bank_n_lanes; i++) {
+		bw_svf_bank_set_cutoff(&svf_bank_coeffs, i, (100.f + 9900.f * p) * (1.f + 0.1f * (float)i));
+		bw_svf_bank_set_Q(&svf_bank_coeffs, i, 0.5f + 4.5f * p);
+	}
+}
+
+static void svf_bank_init(size_t n_channels) {
+	svf_bank_n_lanes = n_channels;
+	bw_svf_bank_init(&svf_bank_coeffs, n_channels);
+	svf_bank_coeffs_mem = (char *)malloc(bw_svf_bank_coeffs_mem_req(&svf_bank_coeffs));
+	bw_svf_bank_coeffs_mem_set(&svf_bank_coeffs, svf_bank_coeffs_mem);
+	bw_svf_bank_set_sample_rate(&svf_bank_coeffs, SAMPLE_RATE);
+	svf_bank_mem = (char *)malloc(bw_svf_bank_mem_req(&svf_bank_coeffs));
+	bw_svf_bank_mem_set(&svf_bank_coeffs, &svf_bank_state, svf_bank_mem);
+	svf_bank_set(0.5f);
+	bw_svf_bank_reset_coeffs(&svf_bank_coeffs);
+	bw_svf_bank_reset_state(&svf_bank_coeffs, &svf_bank_state, zeros, BW_NULL, BW_NULL, BW_NULL);
+}
+
+static void svf_bank_process(size_t n_samples) {
+	bw_svf_bank_process(&svf_bank_coeffs, &svf_bank_state, x, BW_NULL, y, y2, y3, n_samples);
+}
+
+static void svf_bank_process_multi(size_t n_channels, size_t n_samples) {
+	(void)n_channels;
+	bw_svf_bank_process(&svf_bank_coeffs, &svf_bank_state, x, BW_NULL, y, y2, y3, n_samples);
+}
+
+static void svf_bank_fini(void) {
+	free(svf_bank_mem);
+	free(svf_bank_coeffs_mem);
+}
+
+static bw_reverb_coeffs reverb_coeffs;
+static bw_reverb_state reverb_state[N_CH_MAX];
+static bw_reverb_state *reverb_statep[N_CH_MAX];
+static char *reverb_mem;
+
+static void reverb_set(float p) {
+	bw_reverb_set_predelay(&reverb_coeffs, 0.01f * p);
+	bw_reverb_set_decay(&reverb_coeffs, 0.1f + 0.8f * p);
+	bw_reverb_set_wet(&reverb_coeffs, p);
+}
+
+static void reverb_init(size_t n_channels) {
+	bw_reverb_init(&reverb_coeffs);
+	bw_reverb_set_sample_rate(&reverb_coeffs, SAMPLE_RATE);
+	const size_t req = bw_reverb_mem_req(&reverb_coeffs);
+	reverb_mem = (char *)malloc(req * n_channels);
+	for (size_t i = 0; i < n_channels; i++) {
+		reverb_statep[i] = reverb_state + i;
+		bw_reverb_mem_set(&reverb_coeffs, reverb_state + i, reverb_mem + req * i);
+	}
+	reverb_set(0.5f);
+	bw_reverb_reset_coeffs(&reverb_coeffs);
+	bw_reverb_reset_state_multi(&reverb_coeffs, reverb_statep, zeros, zeros, BW_NULL, BW_NULL, n_channels);
+}
+
+static void reverb_process(size_t n_samples) {
+	bw_reverb_process(&reverb_coeffs, reverb_state, x[0], x2[0], y[0], y2[0], n_samples);
+}
+
+static void reverb_process_multi(size_t n_channels, size_t n_samples) {
+	bw_reverb_process_multi(&reverb_coeffs, reverb_statep, x, x2, y, y2, n_channels, n_samples);
+}
+
+static void reverb_fini(void) {
+	free(reverb_mem);
+}
+
+static bw_fdn_coeffs fdn_coeffs;
+static bw_fdn_state fdn_state[N_CH_MAX];
+static bw_fdn_state *fdn_statep[N_CH_MAX];
+static char *fdn_mem;
+
+static void fdn_set(float p) {
+	bw_fdn_set_damping(&fdn_coeffs, 1000.f + 19000.f * p);
+	bw_fdn_set_decay(&fdn_coeffs, 0.5f + 4.5f * p);
+	bw_fdn_set_wet(&fdn_coeffs, p);
+}
+
+static void fdn_init(size_t n_channels) {
+	bw_fdn_init(&fdn_coeffs, 8);
+	bw_fdn_set_sample_rate(&fdn_coeffs, SAMPLE_RATE);
+	const size_t req = bw_fdn_mem_req(&fdn_coeffs);
+	fdn_mem = (char *)malloc(req * n_channels);
+	for (size_t i = 0; i < n_channels; i++) {
+		fdn_statep[i] = fdn_state + i;
+		bw_fdn_mem_set(&fdn_coeffs, fdn_state + i, fdn_mem + req * i);
+	}
+	fdn_set(0.5f);
+	bw_fdn_reset_coeffs(&fdn_coeffs);
+	bw_fdn_reset_state_multi(&fdn_coeffs, fdn_statep, zeros, zeros, BW_NULL, BW_NULL, n_channels);
+}
+
+static void fdn_process(size_t n_samples) {
+	bw_fdn_process(&fdn_coeffs, fdn_state, x[0], x2[0], y[0], y2[0], n_samples);
+}
+
+static void fdn_process_multi(size_t n_channels, size_t n_samples) {
+	bw_fdn_process_multi(&fdn_coeffs, fdn_statep, x, x2, y, y2, n_channels, n_samples);
+}
+
+static void fdn_fini(void) {
+	free(fdn_mem);
+}
+
+static bw_sampler_coeffs sampler_coeffs;
+static bw_sampler_state sampler_state[N_CH_MAX];
+static bw_sampler_state *sampler_statep[N_CH_MAX];
+static const float *sampler_sample[N_CH_MAX];
+static size_t sampler_sample_length[N_CH_MAX];
+
+static void sampler_set(float p) {
+	bw_sampler_set_rate(&sampler_coeffs, 0.5f + p);
+}
+
+static void sampler_init(size_t n_channels) {
+	bw_sampler_init(&sampler_coeffs);
+	bw_sampler_set_sample_rate(&sampler_coeffs, SAMPLE_RATE);
+	sampler_set(0.5f);
+	bw_sampler_reset_coeffs(&sampler_coeffs);
+	for (size_t i = 0; i < n_channels; i++) {
+		sampler_statep[i] = sampler_state + i;
+		sampler_sample[i] = sample_data + sample_length * i;
+		sampler_sample_length[i] = sample_length;
+	}
+	bw_sampler_reset_state_multi(&sampler_coeffs, sampler_statep, sampler_sample, sampler_sample_length, zeros, BW_NULL, n_channels);
+}
+
+static void sampler_process(size_t n_samples) {
+	bw_sampler_process(&sampler_coeffs, sampler_state, sample_data, sample_length, y[0], n_samples);
+}
+
+static void sampler_process_multi(size_t n_channels, size_t n_samples) {
+	bw_sampler_process_multi(&sampler_coeffs, sampler_statep, sampler_sample, sampler_sample_length, y, n_channels, n_samples);
+}
+
+static bw_noise_gen_coeffs noise_gen_coeffs;
+static uint64_t noise_gen_rand_state;
+
+static void noise_gen_init(size_t n_channels) {
+	(void)n_channels;
+	noise_gen_rand_state = 0xbaddecaf600dfeed;
+	bw_noise_gen_init(&noise_gen_coeffs, &noise_gen_rand_state);
+	bw_noise_gen_set_sample_rate(&noise_gen_coeffs, SAMPLE_RATE);
+	bw_noise_gen_reset_coeffs(&noise_gen_coeffs);
+}
+
+static void noise_gen_process(size_t n_samples) {
+	bw_noise_gen_process(&noise_gen_coeffs, y[0], n_samples);
+}
+
+static void noise_gen_process_multi(size_t n_channels, size_t n_samples) {
+	bw_noise_gen_process_multi(&noise_gen_coeffs, y, n_channels, n_samples);
+}
+
+static bw_osc_filt_state osc_filt_state[N_CH_MAX];
+static bw_osc_filt_state *osc_filt_statep[N_CH_MAX];
+
+static void osc_filt_init(size_t n_channels) {
+	for (size_t i = 0; i < n_channels; i++)
+		osc_filt_statep[i] = osc_filt_state + i;
+	bw_osc_filt_reset_state_multi(osc_filt_statep, zeros, BW_NULL, n_channels);
+}
+
+static void osc_filt_process(size_t n_samples) {
+	bw_osc_filt_process(osc_filt_state, x[0], y[0], n_samples);
+}
+
+static void osc_filt_process_multi(size_t n_channels, size_t n_samples) {
+	bw_osc_filt_process_multi(osc_filt_statep, x, y, n_channels, n_samples);
+}
+
+static bw_os_coeffs os_coeffs;
+static bw_os_state os_state[N_CH_MAX];
+static bw_os_state *os_statep[N_CH_MAX];
+static void *os_data[N_CH_MAX];
+
+static float os_process1(void *data, float x) {
+	(void)data;
+	return x / (1.f + bw_absf(x));
+}
+
+static void os_init(size_t n_channels) {
+	bw_os_init(&os_coeffs, 4);
+	for (size_t i = 0; i < n_channels; i++)
+		os_statep[i] = os_state + i;
+	bw_os_reset_state_multi(&os_coeffs, os_statep, zeros, zeros, n_channels);
+}
+
+static void os_process(size_t n_samples) {
+	bw_os_process(&os_coeffs, os_state, x[0], y[0], n_samples, os_process1, BW_NULL);
+}
+
+static void os_process_multi(size_t n_channels, size_t n_samples) {
+	bw_os_process_multi(&os_coeffs, os_statep, x, y, n_channels, n_samples, os_process1, os_data);
+}
+
+static void osc_sin_init(size_t n_channels) {
+	(void)n_channels;
+}
+
+static void osc_sin_process(size_t n_samples) {
+	bw_osc_sin_process(phase[0], y[0], n_samples);
+}
+
+static void osc_sin_process_multi(size_t n_channels, size_t n_samples) {
+	bw_osc_sin_process_multi(phase, y, n_channels, n_samples);
+}
+
+static bw_osc_wt_coeffs osc_wt_coeffs;
+static char *osc_wt_mem;
+
+static void osc_wt_init(size_t n_channels) {
+	(void)n_channels;
+	float wave[256];
+	for (size_t i = 0; i < 256; i++)
+		wave[i] = (float)i * (2.f / 255.f) - 1.f;
+	bw_osc_wt_init(&osc_wt_coeffs, 2048);
+	osc_wt_mem = (char *)malloc(bw_osc_wt_coeffs_mem_req(&osc_wt_coeffs));
+	bw_osc_wt_coeffs_mem_set(&osc_wt_coeffs, osc_wt_mem);
+	bw_osc_wt_set_wave(&osc_wt_coeffs, wave, 256);
+	bw_osc_wt_set_sample_rate(&osc_wt_coeffs, SAMPLE_RATE);
+	bw_osc_wt_reset_coeffs(&osc_wt_coeffs);
+}
+
+static void osc_wt_process(size_t n_samples) {
+	bw_osc_wt_process(&osc_wt_coeffs, phase[0], phase_inc[0], y[0], n_samples);
+}
+
+static void osc_wt_process_multi(size_t n_channels, size_t n_samples) {
+	bw_osc_wt_process_multi(&osc_wt_coeffs, phase, phase_inc, y, n_channels, n_samples);
+}
+
+static void osc_wt_fini(void) {
+	free(osc_wt_mem);
+}
+
+#define SOS_N_SECTIONS	8
+
+static float sos_b0[SOS_N_SECTIONS], sos_b1[SOS_N_SECTIONS], sos_b2[SOS_N_SECTIONS], sos_a1[SOS_N_SECTIONS], sos_a2[SOS_N_SECTIONS];
+static float sos_s1[N_CH_MAX * SOS_N_SECTIONS], sos_s2[N_CH_MAX * SOS_N_SECTIONS];
+
+static void sos_set(float p) {
+	for (size_t i = 0; i < SOS_N_SECTIONS; i++)
+		bw_iir2_coeffs_lp2(SAMPLE_RATE, (100.f + 9900.f * p) * (1.f + 0.1f * (float)i), 0.5f + 0.5f * (float)i, 1, 0.f,
+			sos_b0 + i, sos_b1 + i, sos_b2 + i, sos_a1 + i, sos_a2 + i);
+}
+
+static void sos_init(size_t n_channels) {
+	sos_set(0.5f);
+	bw_sos_reset_multi(zeros, BW_NULL, sos_s1, sos_s2, sos_b0, sos_b1, sos_b2, sos_a1, sos_a2, SOS_N_SECTIONS, n_channels);
+}
+
+static void sos_process(size_t n_samples) {
+	bw_sos_process(x[0], y[0], sos_s1, sos_s2, sos_b0, sos_b1, sos_b2, sos_a1, sos_a2, SOS_N_SECTIONS, n_samples);
+}
+
+static void sos_process_multi(size_t n_channels, size_t n_samples) {
+	bw_sos_process_multi(x, y, sos_s1, sos_s2, sos_b0, sos_b1, sos_b2, sos_a1, sos_a2, SOS_N_SECTIONS, n_channels, n_samples);
+}
+
+static bw_src_coeffs src_coeffs;
+static bw_src_state src_state[N_CH_MAX];
+static bw_src_state *src_statep[N_CH_MAX];
+
+static void src_init(size_t n_channels) {
+	bw_src_init(&src_coeffs, 44100.f / 48000.f);
+	for (size_t i = 0; i < n_channels; i++)
+		src_statep[i] = src_state + i;
+	bw_src_reset_state_multi(&src_coeffs, src_statep, zeros, BW_NULL, n_channels);
+}
+
+static void src_process(size_t n_samples) {
+	size_t n_in = n_samples;
+	size_t n_out = 2 * n_samples;
+	bw_src_process(&src_coeffs, src_state, x[0], y[0], &n_in, &n_out);
+}
+
+static void src_process_multi(size_t n_channels, size_t n_samples) {
+	size_t n_in[N_CH_MAX], n_out[N_CH_MAX];
+	for (size_t i = 0; i < n_channels; i++) {
+		n_in[i] = n_samples;
+		n_out[i] = 2 * n_samples;
+	}
+	bw_src_process_multi(&src_coeffs, src_statep, x, y, n_channels, n_in, n_out);
+}
+
+static bw_src_int_coeffs src_int_coeffs;
+static bw_src_int_state src_int_state[N_CH_MAX];
+static bw_src_int_state *src_int_statep[N_CH_MAX];
+
+static void src_int_init(size_t n_channels) {
+	bw_src_int_init(&src_int_coeffs, 2);
+	for (size_t i = 0; i < n_channels; i++)
+		src_int_statep[i] = src_int_state + i;
+	bw_src_int_reset_state_multi(&src_int_coeffs, src_int_statep, zeros, BW_NULL, n_channels);
+}
+
+static void src_int_process(size_t n_samples) {
+	bw_src_int_process(&src_int_coeffs, src_int_state, x[0], y[0], n_samples);
+}
+
+static void src_int_process_multi(size_t n_channels, size_t n_samples) {
+	bw_src_int_process_multi(&src_int_coeffs, src_int_statep, x, y, n_channels, n_samples, BW_NULL);
+}
+
+static const bench_module modules[] = {
+	BENCH_ENTRY(ap1),
+	BENCH_ENTRY(ap2),
+	BENCH_ENTRY(balance),
+	BENCH_ENTRY(bd_reduce),
+	BENCH_ENTRY(cab),
+	BENCH_ENTRY_MEM(chorus),
+	BENCH_ENTRY(clip),
+	BENCH_ENTRY_MEM(comb),
+	BENCH_ENTRY(comp),
+	{ "conv", conv_init, BW_NULL, conv_process, conv_process_multi, conv_fini },
+	{ "conv_nu", conv_nu_init, BW_NULL, conv_nu_process, conv_nu_process_multi, conv_nu_fini },
+	BENCH_ENTRY_MEM(delay),
+	BENCH_ENTRY(dist),
+	BENCH_ENTRY(drive),
+	BENCH_ENTRY(dry_wet),
+	BENCH_ENTRY(env_follow),
+	BENCH_ENTRY(env_gen),
+	{ "fdn", fdn_init, fdn_set, fdn_process, fdn_process_multi, fdn_fini },
+	BENCH_ENTRY(fuzz),
+	BENCH_ENTRY(gain),
+	BENCH_ENTRY(hp1),
+	BENCH_ENTRY(hs1),
+	BENCH_ENTRY(hs2),
+	BENCH_ENTRY(lp1),
+	BENCH_ENTRY(ls1),
+	BENCH_ENTRY(ls2),
+	BENCH_ENTRY(mm1),
+	BENCH_ENTRY(mm2),
+	BENCH_ENTRY(noise_gate),
+	BENCH_ENTRY_NO_SET(noise_gen),
+	BENCH_ENTRY(notch),
+	BENCH_ENTRY(one_pole),
+	BENCH_ENTRY_NO_SET(os),
+	BENCH_ENTRY_NO_SET(osc_filt),
+	BENCH_ENTRY(osc_pulse),
+	BENCH_ENTRY(osc_saw),
+	BENCH_ENTRY_NO_SET(osc_sin),
+	BENCH_ENTRY(osc_tri),
+	{ "osc_wt", osc_wt_init, BW_NULL, osc_wt_process, osc_wt_process_multi, osc_wt_fini },
+	BENCH_ENTRY(pan),
+	BENCH_ENTRY(peak),
+	BENCH_ENTRY(phase_gen),
+	BENCH_ENTRY(phaser),
+	BENCH_ENTRY_NO_SET(pink_filt),
+	BENCH_ENTRY(ppm),
+	{ "reverb", reverb_init, reverb_set, reverb_process, reverb_process_multi, reverb_fini },
+	BENCH_ENTRY(ring_mod),
+	BENCH_ENTRY(sampler),
+	BENCH_ENTRY(satur),
+	BENCH_ENTRY(slew_lim),
+	BENCH_ENTRY(sos),
+	BENCH_ENTRY(sr_reduce),
+	BENCH_ENTRY_NO_SET(src),
+	BENCH_ENTRY_NO_SET(src_int),
+	BENCH_ENTRY(svf),
+	{ "svf_bank", svf_bank_init, svf_bank_set, svf_bank_process, svf_bank_process_multi, svf_bank_fini },
+	BENCH_ENTRY(trem),
+	BENCH_ENTRY(wah)
+};
+
+typedef struct {
+	char	key[192];
+	double	ns;
+} baseline_entry;
+
+static baseline_entry *baseline;
+static size_t baseline_n;
+
+static double now_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return 1e9 * (double)ts.tv_sec + (double)ts.tv_nsec;
+}
+
+static unsigned long long now_cycles(void) {
+#ifdef BENCH_HAS_CYCLES
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+// triangle sweep over [0, 1] with 0.5 s period
+static float mod_value(size_t frame) {
+	const float t = (float)(frame % 24000) * (1.f / 12000.f);
+	return t < 1.f ? t : 2.f - t;
+}
+
+static void run_frames(const bench_module *m, char multi, char mod, size_t n_channels, size_t block_size, size_t frame_0, size_t n_frames) {
+	for (size_t i = 0; i < n_frames; i += block_size) {
+		const size_t n = n_frames - i < block_size ? n_frames - i : block_size;
+		if (mod)
+			m->set(mod_value(frame_0 + i));
+		if (multi)
+			m->process_multi(n_channels, n);
+		else
+			m->process(n);
+	}
+}
+
+static int load_baseline(const char *path) {
+	FILE *f = fopen(path, "r");
+	if (f == BW_NULL) {
+		perror(path);
+		return -1;
+	}
+	size_t cap = 0;
+	char line[512];
+	while (fgets(line, sizeof(line), f) != BW_NULL) {
+		if (line[0] == '#')
+			continue;
+		char module[64], function[32], scenario[32];
+		unsigned int n_channels, block_size;
+		double ns;
+		if (sscanf(line, "%63s %31s %31s %u %u %lf", module, function, scenario, &n_channels, &block_size, &ns) != 6)
+			continue;
+		if (baseline_n == cap) {
+			cap = cap ? 2 * cap : 256;
+			baseline = (baseline_entry *)realloc(baseline, cap * sizeof(baseline_entry));
+		}
+		snprintf(baseline[baseline_n].key, sizeof(baseline[baseline_n].key), "%s\t%s\t%s\t%u\t%u", module, function, scenario, n_channels, block_size);
+		baseline[baseline_n].ns = ns;
+		baseline_n++;
+	}
+	fclose(f);
+	return 0;
+}
+
+static const baseline_entry *find_baseline(const char *key) {
+	for (size_t i = 0; i < baseline_n; i++)
+		if (strcmp(baseline[i].key, key) == 0)
+			return baseline + i;
+	return BW_NULL;
+}
+
+int main(int argc, char *argv[]) {
+	size_t n_frames = 32768;
+	int n_reps = 3;
+	const char *baseline_path = BW_NULL;
+	double threshold = 10.0;
+	int argi = 1;
+	for (; argi < argc && argv[argi][0] == '-'; argi++) {
+		if (argi + 1 >= argc) {
+			fprintf(stderr, "Missing value for %s\n", argv[argi]);
+			return 2;
+		}
+		if (strcmp(argv[argi], "-n") == 0)
+			n_frames = (size_t)strtoul(argv[++argi], BW_NULL, 10);
+		else if (strcmp(argv[argi], "-r") == 0)
+			n_reps = atoi(argv[++argi]);
+		else if (strcmp(argv[argi], "-b") == 0)
+			baseline_path = argv[++argi];
+		else if (strcmp(argv[argi], "-t") == 0)
+			threshold = atof(argv[++argi]);
+		else {
+			fprintf(stderr, "Usage: %s [-n frames] [-r repetitions] [-b baseline] [-t threshold] [module ...]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (n_frames == 0 || n_reps < 1) {
+		fprintf(stderr, "Invalid number of frames or repetitions\n");
+		return 2;
+	}
+	if (baseline_path != BW_NULL && load_baseline(baseline_path) != 0)
+		return 2;
+
+	uint64_t rand_state = 0xbaddecaf600dfeed;
+	for (size_t i = 0; i < N_CH_MAX; i++) {
+		for (size_t j = 0; j < BLOCK_MAX; j++) {
+			x_buf[i][j] = bw_randf(&rand_state);
+			x2_buf[i][j] = bw_randf(&rand_state);
+			phase_inc_buf[i][j] = (110.f + 10.f * (float)i) / SAMPLE_RATE;
+			float phase_int;
+			bw_intfracf((float)j * phase_inc_buf[i][j], &phase_int, phase_buf[i] + j);
+		}
+		x[i] = x_buf[i];
+		x2[i] = x2_buf[i];
+		phase[i] = phase_buf[i];
+		phase_inc[i] = phase_inc_buf[i];
+		y[i] = y_buf[i];
+		y2[i] = y2_buf[i];
+		y3[i] = y3_buf[i];
+	}
+	sample_length = 2 * (WARMUP_FRAMES + n_frames) + 16;
+	sample_data = (float *)malloc(N_CH_MAX * sample_length * sizeof(float));
+	for (size_t i = 0; i < N_CH_MAX * sample_length; i++)
+		sample_data[i] = bw_randf(&rand_state);
+	for (size_t i = 0; i < IR_LENGTH; i++)
+		ir_data[i] = bw_randf(&rand_state) * (1.f - (float)i * (1.f / IR_LENGTH));
+
+	printf("# module\tfunction\tscenario\tn_channels\tblock_size\tns_per_sample\tcycles_per_sample");
+	if (baseline_path != BW_NULL)
+		printf("\tbaseline_ns_per_sample\tratio\tstatus");
+	printf("\n");
+	fflush(stdout);
+
+	int n_regressions = 0;
+	for (size_t i = 0; i < sizeof(modules) / sizeof(modules[0]); i++) {
+		const bench_module *m = modules + i;
+		if (argi < argc) {
+			int found = 0;
+			for (int j = argi; j < argc; j++)
+				if (strcmp(argv[j], m->name) == 0)
+					found = 1;
+			if (!found)
+				continue;
+		}
+		for (char multi = 0; multi <= 1; multi++)
+			for (size_t ci = 0; ci < sizeof(channel_counts) / sizeof(channel_counts[0]); ci++) {
+				const size_t n_channels = channel_counts[ci];
+				if (!multi && n_channels != 1)
+					continue;
+				for (char mod = 0; mod <= 1; mod++) {
+					if (mod && m->set == BW_NULL)
+						continue;
+					for (size_t bi = 0; bi < sizeof(block_sizes) / sizeof(block_sizes[0]); bi++) {
+						const size_t block_size = block_sizes[bi];
+						double ns_min = 0.0;
+						unsigned long long cycles_min = 0;
+						for (int r = 0; r < n_reps; r++) {
+							m->init(n_channels);
+							run_frames(m, multi, mod, n_channels, block_size, 0, WARMUP_FRAMES);
+							const double t0 = now_ns();
+							const unsigned long long c0 = now_cycles();
+							run_frames(m, multi, mod, n_channels, block_size, WARMUP_FRAMES, n_frames);
+							const unsigned long long c1 = now_cycles();
+							const double t1 = now_ns();
+							if (m->fini != BW_NULL)
+								m->fini();
+							if (r == 0 || t1 - t0 < ns_min)
+								ns_min = t1 - t0;
+							if (r == 0 || c1 - c0 < cycles_min)
+								cycles_min = c1 - c0;
+						}
+						const double n_samples = (double)n_frames * (double)n_channels;
+						const double ns = ns_min / n_samples;
+						char key[192];
+						snprintf(key, sizeof(key), "%s\t%s\t%s\t%u\t%u", m->name, multi ? "process_multi" : "process", mod ? "mod" : "static", (unsigned int)n_channels, (unsigned int)block_size);
+#ifdef BENCH_HAS_CYCLES
+						printf("%s\t%.3f\t%.3f", key, ns, (double)cycles_min / n_samples);
+#else
+						printf("%s\t%.3f\tnan", key, ns);
+#endif
+						if (baseline_path != BW_NULL) {
+							const baseline_entry *b = find_baseline(key);
+							if (b == BW_NULL)
+								printf("\tnan\tnan\tnew");
+							else {
+								const double ratio = ns / b->ns;
+								const char regression = ratio > 1.0 + 0.01 * threshold;
+								printf("\t%.3f\t%.3f\t%s", b->ns, ratio, regression ? "regression" : "ok");
+								n_regressions += regression;
+							}
+						}
+						printf("\n");
+						fflush(stdout);
+					}
+				}
+			}
+	}
+
+	if (baseline_path != BW_NULL)
+		fprintf(stderr, "%d regression(s) over %g%% threshold\n", n_regressions, threshold);
+
+	free(sample_data);
+	free(baseline);
+
+	return n_regressions ? 1 : 0;
+}
@@ -83,6 +83,94 @@ int n_ko = 0;
 	} \
 }
 
+#define TEST_BUF(f, ...) \
+{ \
+	const float x[] = { __VA_ARGS__ }; \
+	const size_t n = sizeof(x) / sizeof(float); \
+	float y[sizeof(x) / sizeof(float)]; \
+	f##_buf(x, y, n); \
+	for (size_t i = 0; i < n; i++) { \
+		union { float f; uint32_t u; } v_expr, v_expected; \
+		v_expr.f = y[i]; \
+		v_expected.f = f(x[i]); \
+		if (v_expr.f == v_expected.f) { \
+			printf("✔ %s_buf([%g]) = %g\n", #f, x[i], v_expected.f); \
+			n_ok++; \
+		} else { \
+			printf("✘ %s_buf([%g]) = %g [0x%x] (expected %g [0x%x]) - line %d\n", #f, x[i], v_expr.f, v_expr.u, v_expected.f, v_expected.u, __LINE__); \
+			n_ko++; \
+		} \
+	} \
+}
+
+#define TEST_CTRL(f, ref, tol_abs, tol_rel, ...) \
+{ \
+	const float x[] = { __VA_ARGS__ }; \
+	for (size_t i = 0; i < sizeof(x) / sizeof(float); i++) { \
+		union { float f; uint32_t u; } v_expr, v_expected; \
+		v_expr.f = f##_ctrl(x[i]); \
+		v_expected.f = ref(x[i]); \
+		float err_abs = fabsf(v_expr.f - v_expected.f); \
+		float err_rel = fabsf((v_expr.f - v_expected.f) / v_expected.f); \
+		if (err_abs <= tol_abs || err_rel <= tol_rel) { \
+			printf("✔ %s_ctrl(%g) = %g (expected %g, err %g|%g%%, tol %g|%g%%)\n", #f, x[i], v_expr.f, v_expected.f, err_abs, err_rel * 100.f, tol_abs, tol_rel * 100.f); \
+			n_ok++; \
+		} else { \
+			printf("✘ %s_ctrl(%g) = %g [0x%x] (expected %g [0x%x], err %g|%g%%, tol %g|%g%%) - line %d\n", #f, x[i], v_expr.f, v_expr.u, v_expected.f, v_expected.u, err_abs, err_rel * 100.f, tol_abs, tol_rel * 100.f, __LINE__); \
+			n_ko++; \
+		} \
+	} \
+}
+
+// Error bounds for each precision tier, as documented in bw_math.h.
+
+#define TIER(tier, low, medium, high)	((tier) == 0 ? (low) : ((tier) == 1 ? (medium) : (high)))
+
+#define TOL_RCP(tier)		TIER(tier, 0.0035f, 0.000013f, 0.0000001f)
+#define TOL_ABS_SIN(tier)	TIER(tier, 0.054f, 0.011f, 4.5e-6f)
+#define TOL_ABS_SINX(tier, x)	(TOL_ABS_SIN(tier) + 1e-7f * fabsf(x))
+#define TOL_REL_SIN(tier)	TIER(tier, 0.f, 0.017f, 0.f)
+#define TOL_ABS_TAN(tier)	TIER(tier, 0.06f, 0.06f, 0.06f)
+#define TOL_REL_TAN(tier)	TIER(tier, 0.052f, 0.008f, 0.00014f)
+#define TOL_ABS_LOG2(tier)	TIER(tier, 0.0064f, 0.0055f, 1.4e-6f)
+#define TOL_ABS_LOG(tier)	TIER(tier, 0.0045f, 0.0038f, 1.5e-6f)
+#define TOL_ABS_LOG10(tier)	TIER(tier, 0.002f, 0.0017f, 1e-6f)
+#define TOL_ABS_LIN2DB(tier)	TIER(tier, 0.039f, 0.032f, 2.2e-5f)
+#define TOL_REL_LOG(tier)	TIER(tier, 0.f, 0.012f, 0.0000002f)
+#define TOL_POW2(tier)		TIER(tier, 0.0021f, 0.00062f, 0.00000018f)
+#define TOL_EXP(tier)		TIER(tier, 0.0021f, 0.00062f, 0.000005f)
+#define TOL_LOG2_1P2X(tier)	TIER(tier, 0.0077f, 0.006f, 0.006f)
+#define TOL_LOG_1PEXPX(tier)	TIER(tier, 0.0064f, 0.004f, 0.004f)
+#define TOL_LOG10_1P10X(tier)	TIER(tier, 0.0027f, 0.002f, 0.002f)
+#define TOL_ABS_SQRT(tier)	TIER(tier, 1.09e-19f, 1.09e-19f, 1.09e-19f)
+#define TOL_REL_SQRT(tier)	TIER(tier, 0.0014f, 0.000007f, 0.00000013f)
+#define TOL_ABS_TANH(tier)	TIER(tier, 0.035f, 0.035f, 9.7e-5f)
+#define TOL_REL_TANH(tier)	TIER(tier, 0.065f, 0.065f, 0.f)
+#define TOL_ABS_SINH(tier)	TIER(tier, 0.0021f, 1e-7f, 1e-7f)
+#define TOL_REL_COSH(tier)	TIER(tier, 0.0021f, 0.0007f, 0.0007f)
+#define TOL_ABS_SECH(tier)	TIER(tier, 1e-9f, 1e-9f, 1e-9f)
+#define TOL_REL_SECH(tier)	TIER(tier, 0.0056f, 0.0007f, 0.0007f)
+#define TOL_ABS_ASINH(tier)	TIER(tier, 0.004f, 0.004f, 0.004f)
+#define TOL_REL_ASINH(tier)	TIER(tier, 0.012f, 0.012f, 0.012f)
+#define TOL_ABS_ACOSH(tier)	TIER(tier, 0.004f, 0.004f, 0.004f)
+#define TOL_REL_ACOSH(tier)	TIER(tier, 0.008f, 0.008f, 0.008f)
+
+static float rcpf(float x) {
+	return 1.f / x;
+}
+
+static float pow2f(float x) {
+	if (x < -126.f)
+		return 0.f;
+	return exp2f(x);
+}
+
+static float dB2linf(float x) {
+	if (x < -758.5955890732315f)
+		return 0.f;
+	return (float)pow(10.0, 0.05 * x);
+}
+
 static float log2_1p2xf(float x) {
 	if (x > 30.f)
 		return x;
@@ -108,6 +196,7 @@ static float xsechf(float x) {
 int main() {
 	printf("\nbw_math unit tests\n");
 	printf("------------------\n\n");
+	printf("BW_MATH_PRECISION = %d, BW_MATH_PRECISION_CTRL = %d\n\n", BW_MATH_PRECISION, BW_MATH_PRECISION_CTRL);
 
 	TEST(bw_copysignf(INFINITY, INFINITY), INFINITY);
 	TEST(bw_copysignf(INFINITY, -INFINITY), -INFINITY);
@@ -612,968 +701,993 @@ int main() {
 	TEST_BW_INTFRAC(-1.123e3f, -1.123e3f, 0.f);
 	TEST_BW_INTFRAC(-1.999e3f, -1.999e3f, 0.f);
 	
-	TEST_REL(bw_rcpf(1.2e27f), 8.333333333e-28f, 0.000013f);
-	TEST_REL(bw_rcpf(1e20f), 1e-20f, 0.000013f);
-	TEST_REL(bw_rcpf(1e10f), 1e-10f, 0.000013f);
-	TEST_REL(bw_rcpf(1e3f), 0.001f, 0.000013f);
-	TEST_REL(bw_rcpf(500.f), 0.002f, 0.000013f);
-	TEST_REL(bw_rcpf(200.f), 0.005f, 0.000013f);
-	TEST_REL(bw_rcpf(100.f), 0.01f, 0.000013f);
-	TEST_REL(bw_rcpf(50.f), 0.02f, 0.000013f);
-	TEST_REL(bw_rcpf(20.f), 0.05f, 0.000013f);
-	TEST_REL(bw_rcpf(10.f), 0.1f, 0.000013f);
-	TEST_REL(bw_rcpf(5.f), 0.2f, 0.000013f);
-	TEST_REL(bw_rcpf(2.f), 0.5f, 0.000013f);
-	TEST_REL(bw_rcpf(1.f), 1.f, 0.000013f);
-	TEST_REL(bw_rcpf(0.5f), 2.f, 0.000013f);
-	TEST_REL(bw_rcpf(0.2f), 5.f, 0.000013f);
-	TEST_REL(bw_rcpf(0.1f), 10.f, 0.000013f);
-	TEST_REL(bw_rcpf(0.05f), 20.f, 0.000013f);
-	TEST_REL(bw_rcpf(0.02f), 50.f, 0.000013f);
-	TEST_REL(bw_rcpf(0.01f), 100.f, 0.000013f);
-	TEST_REL(bw_rcpf(0.005f), 200.f, 0.000013f);
-	TEST_REL(bw_rcpf(0.002f), 500.f, 0.000013f);
-	TEST_REL(bw_rcpf(0.001f), 1000.f, 0.000013f);
-	TEST_REL(bw_rcpf(1e-10f), 1e10f, 0.000013f);
-	TEST_REL(bw_rcpf(1e-20f), 1e20f, 0.000013f);
-	TEST_REL(bw_rcpf(8.1e-28f), 1.234567901e27f, 0.000013f);
-	TEST_REL(bw_rcpf(-1.2e27f), -8.333333333e-28f, 0.000013f);
-	TEST_REL(bw_rcpf(-1e20f), -1e-20f, 0.000013f);
-	TEST_REL(bw_rcpf(-1e10f), -1e-10f, 0.000013f);
-	TEST_REL(bw_rcpf(-1e3f), -0.001f, 0.000013f);
-	TEST_REL(bw_rcpf(-500.f), -0.002f, 0.000013f);
-	TEST_REL(bw_rcpf(-200.f), -0.005f, 0.000013f);
-	TEST_REL(bw_rcpf(-100.f), -0.01f, 0.000013f);
-	TEST_REL(bw_rcpf(-50.f), -0.02f, 0.000013f);
-	TEST_REL(bw_rcpf(-20.f), -0.05f, 0.000013f);
-	TEST_REL(bw_rcpf(-10.f), -0.1f, 0.000013f);
-	TEST_REL(bw_rcpf(-5.f), -0.2f, 0.000013f);
-	TEST_REL(bw_rcpf(-2.f), -0.5f, 0.000013f);
-	TEST_REL(bw_rcpf(-1.f), -1.f, 0.000013f);
-	TEST_REL(bw_rcpf(-0.5f), -2.f, 0.000013f);
-	TEST_REL(bw_rcpf(-0.2f), -5.f, 0.000013f);
-	TEST_REL(bw_rcpf(-0.1f), -10.f, 0.000013f);
-	TEST_REL(bw_rcpf(-0.05f), -20.f, 0.000013f);
-	TEST_REL(bw_rcpf(-0.02f), -50.f, 0.000013f);
-	TEST_REL(bw_rcpf(-0.01f), -100.f, 0.000013f);
-	TEST_REL(bw_rcpf(-0.005f), -200.f, 0.000013f);
-	TEST_REL(bw_rcpf(-0.002f), -500.f, 0.000013f);
-	TEST_REL(bw_rcpf(-0.001f), -1000.f, 0.000013f);
-	TEST_REL(bw_rcpf(-1e-10f), -1e10f, 0.000013f);
-	TEST_REL(bw_rcpf(-1e-20f), -1e20f, 0.000013f);
-	TEST_REL(bw_rcpf(-8.1e-28f), -1.234567901e27f, 0.000013f);
+	TEST_REL(bw_rcpf(1.2e27f), 8.333333333e-28f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(1e20f), 1e-20f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(1e10f), 1e-10f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(1e3f), 0.001f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(500.f), 0.002f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(200.f), 0.005f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(100.f), 0.01f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(50.f), 0.02f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(20.f), 0.05f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(10.f), 0.1f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(5.f), 0.2f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(2.f), 0.5f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(1.f), 1.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(0.5f), 2.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(0.2f), 5.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(0.1f), 10.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(0.05f), 20.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(0.02f), 50.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(0.01f), 100.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(0.005f), 200.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(0.002f), 500.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(0.001f), 1000.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(1e-10f), 1e10f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(1e-20f), 1e20f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(8.1e-28f), 1.234567901e27f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-1.2e27f), -8.333333333e-28f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-1e20f), -1e-20f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-1e10f), -1e-10f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-1e3f), -0.001f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-500.f), -0.002f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-200.f), -0.005f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-100.f), -0.01f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-50.f), -0.02f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-20.f), -0.05f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-10.f), -0.1f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-5.f), -0.2f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-2.f), -0.5f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-1.f), -1.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-0.5f), -2.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-0.2f), -5.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-0.1f), -10.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-0.05f), -20.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-0.02f), -50.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-0.01f), -100.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-0.005f), -200.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-0.002f), -500.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-0.001f), -1000.f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-1e-10f), -1e10f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-1e-20f), -1e20f, TOL_RCP(BW_MATH_PRECISION));
+	TEST_REL(bw_rcpf(-8.1e-28f), -1.234567901e27f, TOL_RCP(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_sin2pif(0.f), sinf(6.283185307f * 0.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(0.1f), sinf(6.283185307f * 0.1f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(0.2f), sinf(6.283185307f * 0.2f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(0.3f), sinf(6.283185307f * 0.3f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(0.4f), sinf(6.283185307f * 0.4f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(0.5f), sinf(6.283185307f * 0.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(0.6f), sinf(6.283185307f * 0.6f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(0.7f), sinf(6.283185307f * 0.7f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(0.8f), sinf(6.283185307f * 0.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(0.9f), sinf(6.283185307f * 0.9f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(1.f), sinf(6.283185307f * 1.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(5.678f), sinf(6.283185307f * 5.678f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(56.78f), sinf(6.283185307f * 56.78f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(567.8f), sinf(6.283185307f * 567.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(5678.f), sinf(6.283185307f * 5678.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.f), sinf(6.283185307f * -0.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.1f), sinf(6.283185307f * -0.1f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.2f), sinf(6.283185307f * -0.2f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.3f), sinf(6.283185307f * -0.3f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.4f), sinf(6.283185307f * -0.4f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.5f), sinf(6.283185307f * -0.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.6f), sinf(6.283185307f * -0.6f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.7f), sinf(6.283185307f * -0.7f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.8f), sinf(6.283185307f * -0.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-0.9f), sinf(6.283185307f * -0.9f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-1.f), sinf(6.283185307f * -1.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-5.678f), sinf(6.283185307f * -5.678f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-56.78f), sinf(6.283185307f * -56.78f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-567.8f), sinf(6.283185307f * -567.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sin2pif(-5678.f), sinf(6.283185307f * -5678.f), 0.011f, 0.017);
+	TEST_ABS_REL(bw_sin2pif(0.f), sin(6.283185307179586 * 0.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(0.1f), sin(6.283185307179586 * 0.1f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(0.2f), sin(6.283185307179586 * 0.2f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(0.3f), sin(6.283185307179586 * 0.3f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(0.4f), sin(6.283185307179586 * 0.4f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(0.5f), sin(6.283185307179586 * 0.5f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(0.6f), sin(6.283185307179586 * 0.6f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(0.7f), sin(6.283185307179586 * 0.7f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(0.8f), sin(6.283185307179586 * 0.8f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(0.9f), sin(6.283185307179586 * 0.9f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(1.f), sin(6.283185307179586 * 1.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(5.678f), sin(6.283185307179586 * 5.678f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(56.78f), sin(6.283185307179586 * 56.78f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(567.8f), sin(6.283185307179586 * 567.8f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(5678.f), sin(6.283185307179586 * 5678.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.f), sin(6.283185307179586 * -0.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.1f), sin(6.283185307179586 * -0.1f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.2f), sin(6.283185307179586 * -0.2f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.3f), sin(6.283185307179586 * -0.3f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.4f), sin(6.283185307179586 * -0.4f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.5f), sin(6.283185307179586 * -0.5f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.6f), sin(6.283185307179586 * -0.6f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.7f), sin(6.283185307179586 * -0.7f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.8f), sin(6.283185307179586 * -0.8f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-0.9f), sin(6.283185307179586 * -0.9f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-1.f), sin(6.283185307179586 * -1.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-5.678f), sin(6.283185307179586 * -5.678f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-56.78f), sin(6.283185307179586 * -56.78f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-567.8f), sin(6.283185307179586 * -567.8f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sin2pif(-5678.f), sin(6.283185307179586 * -5678.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_sinf(0.f), sinf(0.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(0.5f), sinf(0.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(1.0f), sinf(1.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(1.5f), sinf(1.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(2.0f), sinf(2.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(2.5f), sinf(2.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(3.0f), sinf(3.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(3.5f), sinf(3.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(4.0f), sinf(4.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(4.5f), sinf(4.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(5.0f), sinf(5.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(5.5f), sinf(5.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(6.0f), sinf(6.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(5.678f), sinf(5.678f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(56.78f), sinf(56.78f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(567.8f), sinf(567.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(5678.f), sinf(5678.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-0.f), sinf(-0.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-0.5f), sinf(-0.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-1.0f), sinf(-1.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-1.5f), sinf(-1.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-2.0f), sinf(-2.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-2.5f), sinf(-2.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-3.0f), sinf(-3.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-3.5f), sinf(-3.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-4.0f), sinf(-4.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-4.5f), sinf(-4.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-5.0f), sinf(-5.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-5.5f), sinf(-5.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-6.0f), sinf(-6.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-5.678f), sinf(-5.678f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-56.78f), sinf(-56.78f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-567.8f), sinf(-567.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_sinf(-5678.f), sinf(-5678.f), 0.011f, 0.017);
+	TEST_ABS_REL(bw_sinf(0.f), sinf(0.f), TOL_ABS_SINX(BW_MATH_PRECISION, 0.f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(0.5f), sinf(0.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 0.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(1.0f), sinf(1.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 1.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(1.5f), sinf(1.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 1.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(2.0f), sinf(2.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 2.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(2.5f), sinf(2.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 2.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(3.0f), sinf(3.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 3.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(3.5f), sinf(3.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 3.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(4.0f), sinf(4.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 4.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(4.5f), sinf(4.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 4.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(5.0f), sinf(5.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 5.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(5.5f), sinf(5.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 5.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(6.0f), sinf(6.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 6.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(5.678f), sinf(5.678f), TOL_ABS_SINX(BW_MATH_PRECISION, 5.678f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(56.78f), sinf(56.78f), TOL_ABS_SINX(BW_MATH_PRECISION, 56.78f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(567.8f), sinf(567.8f), TOL_ABS_SINX(BW_MATH_PRECISION, 567.8f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(5678.f), sinf(5678.f), TOL_ABS_SINX(BW_MATH_PRECISION, 5678.f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-0.f), sinf(-0.f), TOL_ABS_SINX(BW_MATH_PRECISION, -0.f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-0.5f), sinf(-0.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -0.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-1.0f), sinf(-1.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -1.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-1.5f), sinf(-1.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -1.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-2.0f), sinf(-2.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -2.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-2.5f), sinf(-2.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -2.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-3.0f), sinf(-3.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -3.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-3.5f), sinf(-3.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -3.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-4.0f), sinf(-4.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -4.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-4.5f), sinf(-4.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -4.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-5.0f), sinf(-5.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -5.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-5.5f), sinf(-5.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -5.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-6.0f), sinf(-6.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -6.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-5.678f), sinf(-5.678f), TOL_ABS_SINX(BW_MATH_PRECISION, -5.678f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-56.78f), sinf(-56.78f), TOL_ABS_SINX(BW_MATH_PRECISION, -56.78f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-567.8f), sinf(-567.8f), TOL_ABS_SINX(BW_MATH_PRECISION, -567.8f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinf(-5678.f), sinf(-5678.f), TOL_ABS_SINX(BW_MATH_PRECISION, -5678.f), TOL_REL_SIN(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_cos2pif(0.f), cosf(6.283185307f * 0.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(0.1f), cosf(6.283185307f * 0.1f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(0.2f), cosf(6.283185307f * 0.2f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(0.3f), cosf(6.283185307f * 0.3f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(0.4f), cosf(6.283185307f * 0.4f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(0.5f), cosf(6.283185307f * 0.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(0.6f), cosf(6.283185307f * 0.6f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(0.7f), cosf(6.283185307f * 0.7f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(0.8f), cosf(6.283185307f * 0.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(0.9f), cosf(6.283185307f * 0.9f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(1.f), cosf(6.283185307f * 1.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(5.678f), cosf(6.283185307f * 5.678f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(56.78f), cosf(6.283185307f * 56.78f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(567.8f), cosf(6.283185307f * 567.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(5678.f), cosf(6.283185307f * 5678.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.f), cosf(6.283185307f * -0.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.1f), cosf(6.283185307f * -0.1f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.2f), cosf(6.283185307f * -0.2f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.3f), cosf(6.283185307f * -0.3f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.4f), cosf(6.283185307f * -0.4f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.5f), cosf(6.283185307f * -0.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.6f), cosf(6.283185307f * -0.6f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.7f), cosf(6.283185307f * -0.7f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.8f), cosf(6.283185307f * -0.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-0.9f), cosf(6.283185307f * -0.9f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-1.f), cosf(6.283185307f * -1.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-5.678f), cosf(6.283185307f * -5.678f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-56.78f), cosf(6.283185307f * -56.78f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-567.8f), cosf(6.283185307f * -567.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cos2pif(-5678.f), cosf(6.283185307f * -5678.f), 0.011f, 0.017);
+	TEST_ABS_REL(bw_cos2pif(0.f), cos(6.283185307179586 * 0.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(0.1f), cos(6.283185307179586 * 0.1f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(0.2f), cos(6.283185307179586 * 0.2f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(0.3f), cos(6.283185307179586 * 0.3f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(0.4f), cos(6.283185307179586 * 0.4f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(0.5f), cos(6.283185307179586 * 0.5f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(0.6f), cos(6.283185307179586 * 0.6f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(0.7f), cos(6.283185307179586 * 0.7f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(0.8f), cos(6.283185307179586 * 0.8f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(0.9f), cos(6.283185307179586 * 0.9f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(1.f), cos(6.283185307179586 * 1.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(5.678f), cos(6.283185307179586 * 5.678f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(56.78f), cos(6.283185307179586 * 56.78f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(567.8f), cos(6.283185307179586 * 567.8f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(5678.f), cos(6.283185307179586 * 5678.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.f), cos(6.283185307179586 * -0.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.1f), cos(6.283185307179586 * -0.1f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.2f), cos(6.283185307179586 * -0.2f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.3f), cos(6.283185307179586 * -0.3f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.4f), cos(6.283185307179586 * -0.4f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.5f), cos(6.283185307179586 * -0.5f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.6f), cos(6.283185307179586 * -0.6f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.7f), cos(6.283185307179586 * -0.7f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.8f), cos(6.283185307179586 * -0.8f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-0.9f), cos(6.283185307179586 * -0.9f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-1.f), cos(6.283185307179586 * -1.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-5.678f), cos(6.283185307179586 * -5.678f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-56.78f), cos(6.283185307179586 * -56.78f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-567.8f), cos(6.283185307179586 * -567.8f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cos2pif(-5678.f), cos(6.283185307179586 * -5678.f), TOL_ABS_SIN(BW_MATH_PRECISION), TOL_REL_SIN(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_cosf(0.f), cosf(0.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(0.5f), cosf(0.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(1.0f), cosf(1.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(1.5f), cosf(1.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(2.0f), cosf(2.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(2.5f), cosf(2.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(3.0f), cosf(3.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(3.5f), cosf(3.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(4.0f), cosf(4.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(4.5f), cosf(4.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(5.0f), cosf(5.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(5.5f), cosf(5.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(6.0f), cosf(6.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(5.678f), cosf(5.678f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(56.78f), cosf(56.78f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(567.8f), cosf(567.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(5678.f), cosf(5678.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-0.f), cosf(-0.f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-0.5f), cosf(-0.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-1.0f), cosf(-1.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-1.5f), cosf(-1.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-2.0f), cosf(-2.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-2.5f), cosf(-2.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-3.0f), cosf(-3.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-3.5f), cosf(-3.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-4.0f), cosf(-4.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-4.5f), cosf(-4.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-5.0f), cosf(-5.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-5.5f), cosf(-5.5f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-6.0f), cosf(-6.0f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-5.678f), cosf(-5.678f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-56.78f), cosf(-56.78f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-567.8f), cosf(-567.8f), 0.011f, 0.017);
-	TEST_ABS_REL(bw_cosf(-5678.f), cosf(-5678.f), 0.011f, 0.017);
+	TEST_ABS_REL(bw_cosf(0.f), cosf(0.f), TOL_ABS_SINX(BW_MATH_PRECISION, 0.f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(0.5f), cosf(0.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 0.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(1.0f), cosf(1.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 1.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(1.5f), cosf(1.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 1.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(2.0f), cosf(2.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 2.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(2.5f), cosf(2.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 2.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(3.0f), cosf(3.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 3.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(3.5f), cosf(3.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 3.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(4.0f), cosf(4.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 4.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(4.5f), cosf(4.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 4.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(5.0f), cosf(5.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 5.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(5.5f), cosf(5.5f), TOL_ABS_SINX(BW_MATH_PRECISION, 5.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(6.0f), cosf(6.0f), TOL_ABS_SINX(BW_MATH_PRECISION, 6.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(5.678f), cosf(5.678f), TOL_ABS_SINX(BW_MATH_PRECISION, 5.678f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(56.78f), cosf(56.78f), TOL_ABS_SINX(BW_MATH_PRECISION, 56.78f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(567.8f), cosf(567.8f), TOL_ABS_SINX(BW_MATH_PRECISION, 567.8f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(5678.f), cosf(5678.f), TOL_ABS_SINX(BW_MATH_PRECISION, 5678.f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-0.f), cosf(-0.f), TOL_ABS_SINX(BW_MATH_PRECISION, -0.f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-0.5f), cosf(-0.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -0.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-1.0f), cosf(-1.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -1.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-1.5f), cosf(-1.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -1.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-2.0f), cosf(-2.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -2.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-2.5f), cosf(-2.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -2.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-3.0f), cosf(-3.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -3.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-3.5f), cosf(-3.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -3.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-4.0f), cosf(-4.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -4.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-4.5f), cosf(-4.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -4.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-5.0f), cosf(-5.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -5.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-5.5f), cosf(-5.5f), TOL_ABS_SINX(BW_MATH_PRECISION, -5.5f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-6.0f), cosf(-6.0f), TOL_ABS_SINX(BW_MATH_PRECISION, -6.0f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-5.678f), cosf(-5.678f), TOL_ABS_SINX(BW_MATH_PRECISION, -5.678f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-56.78f), cosf(-56.78f), TOL_ABS_SINX(BW_MATH_PRECISION, -56.78f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-567.8f), cosf(-567.8f), TOL_ABS_SINX(BW_MATH_PRECISION, -567.8f), TOL_REL_SIN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_cosf(-5678.f), cosf(-5678.f), TOL_ABS_SINX(BW_MATH_PRECISION, -5678.f), TOL_REL_SIN(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_tan2pif(0.f), tanf(6.283185307f * 0.f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.02f), tanf(6.283185307f * 0.02f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.04f), tanf(6.283185307f * 0.04f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.06f), tanf(6.283185307f * 0.06f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.08f), tanf(6.283185307f * 0.08f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.10f), tanf(6.283185307f * 0.10f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.12f), tanf(6.283185307f * 0.12f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.14f), tanf(6.283185307f * 0.14f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.16f), tanf(6.283185307f * 0.16f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.18f), tanf(6.283185307f * 0.18f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.20f), tanf(6.283185307f * 0.20f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.22f), tanf(6.283185307f * 0.22f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.24f), tanf(6.283185307f * 0.24f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(0.249f), tanf(6.283185307f * 0.249f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(5.678f), tanf(6.283185307f * 5.678f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(56.78f), tanf(6.283185307f * 56.78f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(567.8f), tanf(6.283185307f * 567.8f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(5678.f), tanf(6.283185307f * 5678.f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.f), tanf(6.283185307f * -0.f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.02f), tanf(6.283185307f * -0.02f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.04f), tanf(6.283185307f * -0.04f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.06f), tanf(6.283185307f * -0.06f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.08f), tanf(6.283185307f * -0.08f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.10f), tanf(6.283185307f * -0.10f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.12f), tanf(6.283185307f * -0.12f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.14f), tanf(6.283185307f * -0.14f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.16f), tanf(6.283185307f * -0.16f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.18f), tanf(6.283185307f * -0.18f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.20f), tanf(6.283185307f * -0.20f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.22f), tanf(6.283185307f * -0.22f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.24f), tanf(6.283185307f * -0.24f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-0.249f), tanf(6.283185307f * -0.249f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-5.678f), tanf(6.283185307f * -5.678f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-56.78f), tanf(6.283185307f * -56.78f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-567.8f), tanf(6.283185307f * -567.8f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tan2pif(-5678.f), tanf(6.283185307f * -5678.f), 0.06f, 0.008);
+	TEST_ABS_REL(bw_tan2pif(0.f), tan(6.283185307179586 * 0.f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.02f), tan(6.283185307179586 * 0.02f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.04f), tan(6.283185307179586 * 0.04f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.06f), tan(6.283185307179586 * 0.06f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.08f), tan(6.283185307179586 * 0.08f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.10f), tan(6.283185307179586 * 0.10f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.12f), tan(6.283185307179586 * 0.12f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.14f), tan(6.283185307179586 * 0.14f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.16f), tan(6.283185307179586 * 0.16f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.18f), tan(6.283185307179586 * 0.18f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.20f), tan(6.283185307179586 * 0.20f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.22f), tan(6.283185307179586 * 0.22f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.24f), tan(6.283185307179586 * 0.24f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(0.249f), tan(6.283185307179586 * 0.249f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(5.678f), tan(6.283185307179586 * 5.678f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(56.78f), tan(6.283185307179586 * 56.78f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(567.8f), tan(6.283185307179586 * 567.8f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(5678.f), tan(6.283185307179586 * 5678.f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.f), tan(6.283185307179586 * -0.f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.02f), tan(6.283185307179586 * -0.02f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.04f), tan(6.283185307179586 * -0.04f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.06f), tan(6.283185307179586 * -0.06f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.08f), tan(6.283185307179586 * -0.08f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.10f), tan(6.283185307179586 * -0.10f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.12f), tan(6.283185307179586 * -0.12f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.14f), tan(6.283185307179586 * -0.14f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.16f), tan(6.283185307179586 * -0.16f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.18f), tan(6.283185307179586 * -0.18f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.20f), tan(6.283185307179586 * -0.20f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.22f), tan(6.283185307179586 * -0.22f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.24f), tan(6.283185307179586 * -0.24f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-0.249f), tan(6.283185307179586 * -0.249f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-5.678f), tan(6.283185307179586 * -5.678f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-56.78f), tan(6.283185307179586 * -56.78f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-567.8f), tan(6.283185307179586 * -567.8f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tan2pif(-5678.f), tan(6.283185307179586 * -5678.f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_tanf(0.f), tanf(0.f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(0.1f), tanf(0.1f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(0.2f), tanf(0.2f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(0.3f), tanf(0.3f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(0.4f), tanf(0.4f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(0.5f), tanf(0.5f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(0.6f), tanf(0.6f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(0.7f), tanf(0.7f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(0.8f), tanf(0.8f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(0.9f), tanf(0.9f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(1.0f), tanf(1.0f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(1.1f), tanf(1.1f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(1.2f), tanf(1.2f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(1.3f), tanf(1.3f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(1.4f), tanf(1.4f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(1.5f), tanf(1.5f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(1.56f), tanf(1.56f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(5.678f), tanf(5.678f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(56.78f), tanf(56.78f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(567.8f), tanf(567.8f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(5678.f), tanf(5678.f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.f), tanf(-0.f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.1f), tanf(-0.1f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.2f), tanf(-0.2f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.3f), tanf(-0.3f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.4f), tanf(-0.4f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.5f), tanf(-0.5f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.6f), tanf(-0.6f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.7f), tanf(-0.7f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.8f), tanf(-0.8f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-0.9f), tanf(-0.9f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-1.0f), tanf(-1.0f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-1.1f), tanf(-1.1f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-1.2f), tanf(-1.2f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-1.3f), tanf(-1.3f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-1.4f), tanf(-1.4f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-1.5f), tanf(-1.5f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-1.56f), tanf(-1.56f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-5.678f), tanf(-5.678f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-56.78f), tanf(-56.78f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-567.8f), tanf(-567.8f), 0.06f, 0.008);
-	TEST_ABS_REL(bw_tanf(-5678.f), tanf(-5678.f), 0.06f, 0.008);
+	TEST_ABS_REL(bw_tanf(0.f), tanf(0.f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(0.1f), tanf(0.1f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(0.2f), tanf(0.2f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(0.3f), tanf(0.3f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(0.4f), tanf(0.4f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(0.5f), tanf(0.5f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(0.6f), tanf(0.6f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(0.7f), tanf(0.7f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(0.8f), tanf(0.8f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(0.9f), tanf(0.9f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(1.0f), tanf(1.0f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(1.1f), tanf(1.1f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(1.2f), tanf(1.2f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(1.3f), tanf(1.3f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(1.4f), tanf(1.4f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(1.5f), tanf(1.5f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(1.56f), tanf(1.56f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(5.678f), tanf(5.678f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(56.78f), tanf(56.78f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(567.8f), tanf(567.8f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(5678.f), tanf(5678.f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.f), tanf(-0.f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.1f), tanf(-0.1f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.2f), tanf(-0.2f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.3f), tanf(-0.3f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.4f), tanf(-0.4f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.5f), tanf(-0.5f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.6f), tanf(-0.6f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.7f), tanf(-0.7f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.8f), tanf(-0.8f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-0.9f), tanf(-0.9f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-1.0f), tanf(-1.0f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-1.1f), tanf(-1.1f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-1.2f), tanf(-1.2f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-1.3f), tanf(-1.3f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-1.4f), tanf(-1.4f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-1.5f), tanf(-1.5f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-1.56f), tanf(-1.56f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-5.678f), tanf(-5.678f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-56.78f), tanf(-56.78f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-567.8f), tanf(-567.8f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanf(-5678.f), tanf(-5678.f), TOL_ABS_TAN(BW_MATH_PRECISION), TOL_REL_TAN(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_log2f(1.175494350822287e-38f), -126.f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(1.e-30f), -9.965784284662087e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(1.438449888287666e-27f), -8.916754359960814e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(2.069138081114798e-24f), -7.867724435259542e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(2.976351441631313e-21f), -6.818694510558271e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(4.281332398719396e-18f), -5.769664585856998e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(6.158482110660280e-15f), -4.720634661155725e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(8.858667904100795e-12f), -3.671604736454454e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(1.274274985703132e-08f), -2.622574811753181e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(1.832980710832437e-05f), -1.573544887051908e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(2.636650898730366e-02f), -5.245149623506357e+00f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(1.f), 0.f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(1.3f), 0.378511623253730f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(3.792690190732238e+01f), 5.245149623506357e+00f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(5.455594781168515e+04f), 1.573544887051908e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(7.847599703514622e+07f), 2.622574811753181e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(1.128837891684693e+11f), 3.671604736454454e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(1.623776739188718e+14f), 4.720634661155725e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(2.335721469090121e+17f), 5.769664585856998e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(3.359818286283788e+20f), 6.818694510558271e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(4.832930238571732e+23f), 7.867724435259542e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(6.951927961775592e+26f), 8.916754359960814e+01f, 0.0055f, 0.012f);
-	TEST_ABS_REL(bw_log2f(1e+30f), 9.965784284662087e+01f, 0.0055f, 0.012f);
+	TEST_ABS_REL(bw_log2f(1.175494350822287e-38f), -126.f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(1.e-30f), -9.965784284662087e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(1.438449888287666e-27f), -8.916754359960814e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(2.069138081114798e-24f), -7.867724435259542e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(2.976351441631313e-21f), -6.818694510558271e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(4.281332398719396e-18f), -5.769664585856998e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(6.158482110660280e-15f), -4.720634661155725e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(8.858667904100795e-12f), -3.671604736454454e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(1.274274985703132e-08f), -2.622574811753181e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(1.832980710832437e-05f), -1.573544887051908e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(2.636650898730366e-02f), -5.245149623506357e+00f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(1.f), 0.f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(1.3f), 0.378511623253730f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(3.792690190732238e+01f), 5.245149623506357e+00f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(5.455594781168515e+04f), 1.573544887051908e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(7.847599703514622e+07f), 2.622574811753181e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(1.128837891684693e+11f), 3.671604736454454e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(1.623776739188718e+14f), 4.720634661155725e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(2.335721469090121e+17f), 5.769664585856998e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(3.359818286283788e+20f), 6.818694510558271e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(4.832930238571732e+23f), 7.867724435259542e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(6.951927961775592e+26f), 8.916754359960814e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log2f(1e+30f), 9.965784284662087e+01f, TOL_ABS_LOG2(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_logf(1.175494350822287e-38f), -87.33654475055312f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(1.e-30f), -6.907755278982137e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(1.438449888287666e-27f), -6.180623144352438e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(2.069138081114798e-24f), -5.453491009722740e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(2.976351441631313e-21f), -4.726358875093041e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(4.281332398719396e-18f), -3.999226740463342e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(6.158482110660280e-15f), -3.272094605833644e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(8.858667904100795e-12f), -2.544962471203945e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(1.274274985703132e-08f), -1.817830336574247e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(1.832980710832437e-05f), -1.090698201944548e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(2.636650898730366e-02f), -3.635660673148490e+00f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(1.f), 0.f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(1.3f), 0.262364264467491f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(3.792690190732238e+01f), 3.635660673148490e+00f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(5.455594781168515e+04f), 1.090698201944548e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(7.847599703514622e+07f), 1.817830336574247e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(1.128837891684693e+11f), 2.544962471203945e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(1.623776739188718e+14f), 3.272094605833644e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(2.335721469090121e+17f), 3.999226740463342e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(3.359818286283788e+20f), 4.726358875093041e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(4.832930238571732e+23f), 5.453491009722740e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(6.951927961775592e+26f), 6.180623144352438e+01f, 0.0038f, 0.012f);
-	TEST_ABS_REL(bw_logf(1e+30f), 6.907755278982137e+01f, 0.0038f, 0.012f);
+	TEST_ABS_REL(bw_logf(1.175494350822287e-38f), -87.33654475055312f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(1.e-30f), -6.907755278982137e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(1.438449888287666e-27f), -6.180623144352438e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(2.069138081114798e-24f), -5.453491009722740e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(2.976351441631313e-21f), -4.726358875093041e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(4.281332398719396e-18f), -3.999226740463342e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(6.158482110660280e-15f), -3.272094605833644e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(8.858667904100795e-12f), -2.544962471203945e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(1.274274985703132e-08f), -1.817830336574247e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(1.832980710832437e-05f), -1.090698201944548e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(2.636650898730366e-02f), -3.635660673148490e+00f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(1.f), 0.f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(1.3f), 0.262364264467491f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(3.792690190732238e+01f), 3.635660673148490e+00f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(5.455594781168515e+04f), 1.090698201944548e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(7.847599703514622e+07f), 1.817830336574247e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(1.128837891684693e+11f), 2.544962471203945e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(1.623776739188718e+14f), 3.272094605833644e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(2.335721469090121e+17f), 3.999226740463342e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(3.359818286283788e+20f), 4.726358875093041e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(4.832930238571732e+23f), 5.453491009722740e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(6.951927961775592e+26f), 6.180623144352438e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_logf(1e+30f), 6.907755278982137e+01f, TOL_ABS_LOG(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_log10f(1.175494350822287e-38f), -37.92977945366163f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(1.e-30f), -3.000000000000000e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(1.438449888287666e-27f), -2.684210526315789e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(2.069138081114798e-24f), -2.368421052631579e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(2.976351441631313e-21f), -2.052631578947368e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(4.281332398719396e-18f), -1.736842105263158e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(6.158482110660280e-15f), -1.421052631578947e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(8.858667904100795e-12f), -1.105263157894737e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(1.274274985703132e-08f), -7.894736842105264e+00f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(1.832980710832437e-05f), -4.736842105263158e+00f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(2.636650898730366e-02f), -1.578947368421051e+00f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(1.f), 0.f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(1.3f), 0.113943352306837f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(3.792690190732238e+01f), 1.578947368421051e+00f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(5.455594781168515e+04f), 4.736842105263158e+00f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(7.847599703514622e+07f), 7.894736842105264e+00f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(1.128837891684693e+11f), 1.105263157894737e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(1.623776739188718e+14f), 1.421052631578947e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(2.335721469090121e+17f), 1.736842105263158e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(3.359818286283788e+20f), 2.052631578947368e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(4.832930238571732e+23f), 2.368421052631579e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(6.951927961775592e+26f), 2.684210526315789e+01f, 0.0017f, 0.012f);
-	TEST_ABS_REL(bw_log10f(1e+30f), 3.000000000000000e+01f, 0.0017f, 0.012f);
+	TEST_ABS_REL(bw_log10f(1.175494350822287e-38f), -37.92977945366163f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(1.e-30f), -3.000000000000000e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(1.438449888287666e-27f), -2.684210526315789e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(2.069138081114798e-24f), -2.368421052631579e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(2.976351441631313e-21f), -2.052631578947368e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(4.281332398719396e-18f), -1.736842105263158e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(6.158482110660280e-15f), -1.421052631578947e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(8.858667904100795e-12f), -1.105263157894737e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(1.274274985703132e-08f), -7.894736842105264e+00f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(1.832980710832437e-05f), -4.736842105263158e+00f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(2.636650898730366e-02f), -1.578947368421051e+00f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(1.f), 0.f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(1.3f), 0.113943352306837f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(3.792690190732238e+01f), 1.578947368421051e+00f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(5.455594781168515e+04f), 4.736842105263158e+00f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(7.847599703514622e+07f), 7.894736842105264e+00f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(1.128837891684693e+11f), 1.105263157894737e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(1.623776739188718e+14f), 1.421052631578947e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(2.335721469090121e+17f), 1.736842105263158e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(3.359818286283788e+20f), 2.052631578947368e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(4.832930238571732e+23f), 2.368421052631579e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(6.951927961775592e+26f), 2.684210526315789e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_log10f(1e+30f), 3.000000000000000e+01f, TOL_ABS_LOG10(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
 	
 	TEST(bw_pow2f(-INFINITY), 0.f);
 	TEST(bw_pow2f(-127.f), 0.f);
-	TEST_REL(bw_pow2f(-120.5f), 5.319680170962675e-37f, 0.00062f);
-	TEST_REL(bw_pow2f(-100.5f), 5.578088954947358e-31f, 0.00062f);
-	TEST_REL(bw_pow2f(-80.5f), 5.849050204022881e-25f, 0.00062f);
-	TEST_REL(bw_pow2f(-60.5f), 6.133173666733497e-19f, 0.00062f);
-	TEST_REL(bw_pow2f(-40.5f), 6.431098710768743e-13f, 0.00062f);
-	TEST_REL(bw_pow2f(-20.5f), 6.743495761743046e-07f, 0.00062f);
-	TEST_REL(bw_pow2f(0.f), 1.f, 0.00062f);
-	TEST_REL(bw_pow2f(0.1f), 1.071773462536293f, 0.00062f);
-	TEST_REL(bw_pow2f(0.2f), 1.148698354997035f, 0.00062f);
-	TEST_REL(bw_pow2f(0.3f), 1.231144413344916f, 0.00062f);
-	TEST_REL(bw_pow2f(0.4f), 1.319507910772894f, 0.00062f);
-	TEST_REL(bw_pow2f(0.5f), 1.414213562373095f, 0.00062f);
-	TEST_REL(bw_pow2f(0.6f), 1.515716566510398f, 0.00062f);
-	TEST_REL(bw_pow2f(0.7f), 1.624504792712471f, 0.00062f);
-	TEST_REL(bw_pow2f(0.8f), 1.741101126592248f, 0.00062f);
-	TEST_REL(bw_pow2f(0.9f), 1.866065983073615f, 0.00062f);
-	TEST_REL(bw_pow2f(1.f), 2.f, 0.00062f);
-	TEST_REL(bw_pow2f(20.5f), 1482910.400378931f, 0.00062f);
-	TEST_REL(bw_pow2f(40.5f), 1554944255987.738f, 0.00062f);
-	TEST_REL(bw_pow2f(60.5f), 1.630477228166598e+18f, 0.00062f);
-	TEST_REL(bw_pow2f(80.5f), 1.709679290002019e+24f, 0.00062f);
-	TEST_REL(bw_pow2f(100.5f), 1.792728671193157e+30f, 0.00062f);
-	TEST_REL(bw_pow2f(120.5f), 1.879812259125035e+36f, 0.00062f);
+	TEST_REL(bw_pow2f(-120.5f), 5.319680170962675e-37f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(-100.5f), 5.578088954947358e-31f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(-80.5f), 5.849050204022881e-25f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(-60.5f), 6.133173666733497e-19f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(-40.5f), 6.431098710768743e-13f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(-20.5f), 6.743495761743046e-07f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.f), 1.f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.1f), 1.071773462536293f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.2f), 1.148698354997035f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.3f), 1.231144413344916f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.4f), 1.319507910772894f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.5f), 1.414213562373095f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.6f), 1.515716566510398f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.7f), 1.624504792712471f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.8f), 1.741101126592248f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(0.9f), 1.866065983073615f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(1.f), 2.f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(20.5f), 1482910.400378931f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(40.5f), 1554944255987.738f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(60.5f), 1.630477228166598e+18f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(80.5f), 1.709679290002019e+24f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(100.5f), 1.792728671193157e+30f, TOL_POW2(BW_MATH_PRECISION));
+	TEST_REL(bw_pow2f(120.5f), 1.879812259125035e+36f, TOL_POW2(BW_MATH_PRECISION));
 	
 	TEST(bw_expf(-INFINITY), 0.f);
 	TEST(bw_expf(-88.f), 0.f);
-	TEST_REL(bw_expf(-80.5f), 1.094697702953142e-35f, 0.00062f);
-	TEST_REL(bw_expf(-60.5f), 5.311092249679095e-27f, 0.00062f);
-	TEST_REL(bw_expf(-40.5f), 2.576757109154981e-18f, 0.00062f);
-	TEST_REL(bw_expf(-20.5f), 1.250152866386743e-09f, 0.00062f);
-	TEST_REL(bw_expf(0.f), 1.f, 0.00062f);
-	TEST_REL(bw_expf(0.1f), 1.105170918075648f, 0.00062f);
-	TEST_REL(bw_expf(0.2f), 1.221402758160170f, 0.00062f);
-	TEST_REL(bw_expf(0.3f), 1.349858807576003f, 0.00062f);
-	TEST_REL(bw_expf(0.4f), 1.491824697641270f, 0.00062f);
-	TEST_REL(bw_expf(0.5f), 1.648721270700128f, 0.00062f);
-	TEST_REL(bw_expf(0.6f), 1.822118800390509f, 0.00062f);
-	TEST_REL(bw_expf(0.7f), 2.013752707470477f, 0.00062f);
-	TEST_REL(bw_expf(0.8f), 2.225540928492468f, 0.00062f);
-	TEST_REL(bw_expf(0.9f), 2.459603111156950f, 0.00062f);
-	TEST_REL(bw_expf(1.f), 2.718281828459045f, 0.00062f);
-	TEST_REL(bw_expf(20.5f), 799902177.4755054f, 0.00062f);
-	TEST_REL(bw_expf(40.5f), 3.880846962436204e+17f, 0.00062f);
-	TEST_REL(bw_expf(60.5f), 1.882851874885851e+26f, 0.00062f);
-	TEST_REL(bw_expf(80.5f), 9.134941978066843e+34f, 0.00062f);
+	TEST_REL(bw_expf(-80.5f), 1.094697702953142e-35f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(-60.5f), 5.311092249679095e-27f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(-40.5f), 2.576757109154981e-18f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(-20.5f), 1.250152866386743e-09f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.f), 1.f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.1f), 1.105170918075648f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.2f), 1.221402758160170f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.3f), 1.349858807576003f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.4f), 1.491824697641270f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.5f), 1.648721270700128f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.6f), 1.822118800390509f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.7f), 2.013752707470477f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.8f), 2.225540928492468f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(0.9f), 2.459603111156950f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(1.f), 2.718281828459045f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(20.5f), 799902177.4755054f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(40.5f), 3.880846962436204e+17f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(60.5f), 1.882851874885851e+26f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_expf(80.5f), 9.134941978066843e+34f, TOL_EXP(BW_MATH_PRECISION));
 	
 	TEST(bw_pow10f(-INFINITY), 0.f);
 	TEST(bw_pow10f(-38.f), 0.f);
-	TEST_REL(bw_pow10f(-30.5f), 3.162277660168379e-31f, 0.00062f);
-	TEST_REL(bw_pow10f(-20.5f), 3.162277660168379e-21f, 0.00062f);
-	TEST_REL(bw_pow10f(-10.5f), 3.162277660168379e-11f, 0.00062f);
-	TEST_REL(bw_pow10f(0.f), 1.f, 0.00062f);
-	TEST_REL(bw_pow10f(0.1f), 1.258925411794167e+00f, 0.00062f);
-	TEST_REL(bw_pow10f(0.2f), 1.584893192461114e+00f, 0.00062f);
-	TEST_REL(bw_pow10f(0.3f), 1.995262314968880e+00f, 0.00062f);
-	TEST_REL(bw_pow10f(0.4f), 2.511886431509580e+00f, 0.00062f);
-	TEST_REL(bw_pow10f(0.5f), 3.162277660168380e+00f, 0.00062f);
-	TEST_REL(bw_pow10f(0.6f), 3.981071705534972e+00f, 0.00062f);
-	TEST_REL(bw_pow10f(0.7f), 5.011872336272722e+00f, 0.00062f);
-	TEST_REL(bw_pow10f(0.8f), 6.309573444801933e+00f, 0.00062f);
-	TEST_REL(bw_pow10f(0.9f), 7.943282347242816e+00f, 0.00062f);
-	TEST_REL(bw_pow10f(1.f), 10.f, 0.00062f);
-	TEST_REL(bw_pow10f(10.5f), 31622776601.68379f, 0.00062f);
-	TEST_REL(bw_pow10f(20.5f), 3.162277660168379e+20f, 0.00062f);
-	TEST_REL(bw_pow10f(30.5f), 3.162277660168380e+30f, 0.00062f);
+	TEST_REL(bw_pow10f(-30.5f), 3.162277660168379e-31f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(-20.5f), 3.162277660168379e-21f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(-10.5f), 3.162277660168379e-11f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.f), 1.f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.1f), 1.258925411794167e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.2f), 1.584893192461114e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.3f), 1.995262314968880e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.4f), 2.511886431509580e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.5f), 3.162277660168380e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.6f), 3.981071705534972e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.7f), 5.011872336272722e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.8f), 6.309573444801933e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(0.9f), 7.943282347242816e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(1.f), 10.f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(10.5f), 31622776601.68379f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(20.5f), 3.162277660168379e+20f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_pow10f(30.5f), 3.162277660168380e+30f, TOL_EXP(BW_MATH_PRECISION));
 	
 	TEST(bw_dB2linf(-INFINITY), 0.f);
 	TEST(bw_dB2linf(-800.f), 0.f);
-	TEST_REL(bw_dB2linf(-600.5f), 9.440608762859265e-31f, 0.00062f);
-	TEST_REL(bw_dB2linf(-400.5f), 9.440608762859264e-21f, 0.00062f);
-	TEST_REL(bw_dB2linf(-200.5f), 9.440608762859226e-11f, 0.00062f);
-	TEST_REL(bw_dB2linf(0.f), 1.f, 0.00062f);
-	TEST_REL(bw_dB2linf(2.f), 1.258925411794167e+00f, 0.00062f);
-	TEST_REL(bw_dB2linf(4.f), 1.584893192461114e+00f, 0.00062f);
-	TEST_REL(bw_dB2linf(6.f), 1.995262314968880e+00f, 0.00062f);
-	TEST_REL(bw_dB2linf(8.f), 2.511886431509580e+00f, 0.00062f);
-	TEST_REL(bw_dB2linf(10.f), 3.162277660168380e+00f, 0.00062f);
-	TEST_REL(bw_dB2linf(12.f), 3.981071705534972e+00f, 0.00062f);
-	TEST_REL(bw_dB2linf(14.f), 5.011872336272722e+00f, 0.00062f);
-	TEST_REL(bw_dB2linf(16.f), 6.309573444801933e+00f, 0.00062f);
-	TEST_REL(bw_dB2linf(18.f), 7.943282347242816e+00f, 0.00062f);
-	TEST_REL(bw_dB2linf(20.f), 10.f, 0.00062f);
-	TEST_REL(bw_dB2linf(200.5f), 10592537251.77290f, 0.00062f);
-	TEST_REL(bw_dB2linf(400.5f), 1.059253725177285e+20f, 0.00062f);
-	TEST_REL(bw_dB2linf(600.5f), 1.059253725177285e+30f, 0.00062f);
+	TEST_REL(bw_dB2linf(-600.5f), 9.440608762859265e-31f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(-400.5f), 9.440608762859264e-21f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(-200.5f), 9.440608762859226e-11f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(0.f), 1.f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(2.f), 1.258925411794167e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(4.f), 1.584893192461114e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(6.f), 1.995262314968880e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(8.f), 2.511886431509580e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(10.f), 3.162277660168380e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(12.f), 3.981071705534972e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(14.f), 5.011872336272722e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(16.f), 6.309573444801933e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(18.f), 7.943282347242816e+00f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(20.f), 10.f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(200.5f), 10592537251.77290f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(400.5f), 1.059253725177285e+20f, TOL_EXP(BW_MATH_PRECISION));
+	TEST_REL(bw_dB2linf(600.5f), 1.059253725177285e+30f, TOL_EXP(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_lin2dBf(1.175494350822287e-38f), -758.5955890732326f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(1.e-30f), -600.f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(1.438449888287666e-27f), -536.8421052631579f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(2.069138081114798e-24f), -473.6842105263157f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(2.976351441631313e-21f), -410.5263157894737f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(4.281332398719396e-18f), -3.473684210526316e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(6.158482110660280e-15f), -2.842105263157895e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(8.858667904100795e-12f), -2.210526315789474e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(1.274274985703132e-08f), -1.578947368421053e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(1.832980710832437e-05f), -9.473684210526315e+01f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(2.636650898730366e-02f), -3.157894736842103e+01f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(1.f), 0.f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(1.3f), 2.278867046136735f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(3.792690190732238e+01f), 3.157894736842103e+01f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(5.455594781168515e+04f), 9.473684210526315e+01f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(7.847599703514622e+07f), 1.578947368421053e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(1.128837891684693e+11f), 2.210526315789474e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(1.623776739188718e+14f), 2.842105263157895e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(2.335721469090121e+17f), 3.473684210526316e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(3.359818286283788e+20f), 4.105263157894737e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(4.832930238571732e+23f), 4.736842105263157e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(6.951927961775592e+26f), 5.368421052631579e+02f, 0.032f, 0.012f);
-	TEST_ABS_REL(bw_lin2dBf(1e+30f), 6.000000000000000e+02f, 0.032f, 0.012f);
+	TEST_ABS_REL(bw_lin2dBf(1.175494350822287e-38f), -758.5955890732326f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(1.e-30f), -600.f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(1.438449888287666e-27f), -536.8421052631579f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(2.069138081114798e-24f), -473.6842105263157f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(2.976351441631313e-21f), -410.5263157894737f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(4.281332398719396e-18f), -3.473684210526316e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(6.158482110660280e-15f), -2.842105263157895e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(8.858667904100795e-12f), -2.210526315789474e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(1.274274985703132e-08f), -1.578947368421053e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(1.832980710832437e-05f), -9.473684210526315e+01f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(2.636650898730366e-02f), -3.157894736842103e+01f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(1.f), 0.f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(1.3f), 2.278867046136735f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(3.792690190732238e+01f), 3.157894736842103e+01f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(5.455594781168515e+04f), 9.473684210526315e+01f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(7.847599703514622e+07f), 1.578947368421053e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(1.128837891684693e+11f), 2.210526315789474e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(1.623776739188718e+14f), 2.842105263157895e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(2.335721469090121e+17f), 3.473684210526316e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(3.359818286283788e+20f), 4.105263157894737e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(4.832930238571732e+23f), 4.736842105263157e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(6.951927961775592e+26f), 5.368421052631579e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_lin2dBf(1e+30f), 6.000000000000000e+02f, TOL_ABS_LIN2DB(BW_MATH_PRECISION), TOL_REL_LOG(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_sqrtf(0.f), 0.f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(1e-28f), 1e-14f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e-20f), 2.236067977499790e-10f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e-15f), 7.071067811865476e-08f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e-10f), 2.236067977499790e-05f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e-5f), 7.071067811865475e-03f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(1.f), 1.f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5.f), 2.236067977499790f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e5f), 707.1067811865476f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e10f), 223606.7977499790f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e15f), 70710678.11865476f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e20f), 22360679774.99790f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e25f), 7071067811865.476f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e30f), 2.236067977499790e+15f, 1.09e-19f, 0.000007f);
-	TEST_ABS_REL(bw_sqrtf(5e35f), 7.071067811865476e+17f, 1.09e-19f, 0.000007f);
+	TEST_ABS_REL(bw_sqrtf(0.f), 0.f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(1e-28f), 1e-14f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e-20f), 2.236067977499790e-10f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e-15f), 7.071067811865476e-08f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e-10f), 2.236067977499790e-05f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e-5f), 7.071067811865475e-03f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(1.f), 1.f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5.f), 2.236067977499790f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e5f), 707.1067811865476f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e10f), 223606.7977499790f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e15f), 70710678.11865476f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e20f), 22360679774.99790f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e25f), 7071067811865.476f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e30f), 2.236067977499790e+15f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sqrtf(5e35f), 7.071067811865476e+17f, TOL_ABS_SQRT(BW_MATH_PRECISION), TOL_REL_SQRT(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_tanhf(-INFINITY), -1.f, 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-2.5f), tanhf(-2.5f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-2.0f), tanhf(-2.0f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-1.5f), tanhf(-1.5f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-1.0f), tanhf(-1.0f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.9f), tanhf(-0.9f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.8f), tanhf(-0.8f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.7f), tanhf(-0.7f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.6f), tanhf(-0.6f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.5f), tanhf(-0.5f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.4f), tanhf(-0.4f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.3f), tanhf(-0.3f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.2f), tanhf(-0.2f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.1f), tanhf(-0.1f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(-0.0f), tanhf(-0.0f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.0f), tanhf(0.0f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.1f), tanhf(0.1f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.2f), tanhf(0.2f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.3f), tanhf(0.3f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.4f), tanhf(0.4f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.5f), tanhf(0.5f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.6f), tanhf(0.6f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.7f), tanhf(0.7f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.8f), tanhf(0.8f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(0.9f), tanhf(0.9f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(1.0f), tanhf(1.0f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(1.5f), tanhf(1.5f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(2.0f), tanhf(2.0f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(2.5f), tanhf(2.5f), 0.035f, 0.065f);
-	TEST_ABS_REL(bw_tanhf(INFINITY), 1.f, 0.035f, 0.065f);
+	TEST_ABS_REL(bw_tanhf(-INFINITY), -1.f, TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-2.5f), tanhf(-2.5f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-2.0f), tanhf(-2.0f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-1.5f), tanhf(-1.5f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-1.0f), tanhf(-1.0f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.9f), tanhf(-0.9f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.8f), tanhf(-0.8f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.7f), tanhf(-0.7f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.6f), tanhf(-0.6f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.5f), tanhf(-0.5f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.4f), tanhf(-0.4f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.3f), tanhf(-0.3f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.2f), tanhf(-0.2f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.1f), tanhf(-0.1f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(-0.0f), tanhf(-0.0f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.0f), tanhf(0.0f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.1f), tanhf(0.1f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.2f), tanhf(0.2f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.3f), tanhf(0.3f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.4f), tanhf(0.4f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.5f), tanhf(0.5f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.6f), tanhf(0.6f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.7f), tanhf(0.7f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.8f), tanhf(0.8f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(0.9f), tanhf(0.9f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(1.0f), tanhf(1.0f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(1.5f), tanhf(1.5f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(2.0f), tanhf(2.0f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(2.5f), tanhf(2.5f), TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_tanhf(INFINITY), 1.f, TOL_ABS_TANH(BW_MATH_PRECISION), TOL_REL_TANH(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_sinhf(-80.f), sinhf(-80.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-70.f), sinhf(-70.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-60.f), sinhf(-60.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-50.f), sinhf(-50.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-40.f), sinhf(-40.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-30.f), sinhf(-30.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-20.f), sinhf(-20.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-10.f), sinhf(-10.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-9.f), sinhf(-9.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-8.f), sinhf(-8.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-7.f), sinhf(-7.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-6.f), sinhf(-6.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-5.f), sinhf(-5.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-4.f), sinhf(-4.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-3.f), sinhf(-3.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-2.f), sinhf(-2.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1.f), sinhf(-1.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1e-1f), sinhf(-1e-1f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1e-2f), sinhf(-1e-2f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1e-3f), sinhf(-1e-3f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1e-4f), sinhf(-1e-4f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1e-5f), sinhf(-1e-5f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1e-6f), sinhf(-1e-6f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1e-7f), sinhf(-1e-7f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1e-8f), sinhf(-1e-8f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-1e-9f), sinhf(-1e-9f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(-0.f), 0.f, 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(0.f), 0.f, 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1e-9f), sinhf(1e-9f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1e-8f), sinhf(1e-8f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1e-7f), sinhf(1e-7f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1e-6f), sinhf(1e-6f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1e-5f), sinhf(1e-5f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1e-4f), sinhf(1e-4f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1e-3f), sinhf(1e-3f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1e-2f), sinhf(1e-2f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1e-1f), sinhf(1e-1f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(1.f), sinhf(1.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(2.f), sinhf(2.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(3.f), sinhf(3.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(4.f), sinhf(4.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(5.f), sinhf(5.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(6.f), sinhf(6.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(7.f), sinhf(7.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(8.f), sinhf(8.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(9.f), sinhf(9.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(10.f), sinhf(10.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(20.f), sinhf(20.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(30.f), sinhf(30.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(40.f), sinhf(40.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(50.f), sinhf(50.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(60.f), sinhf(60.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(70.f), sinhf(70.f), 1e-7f, 0.0007f);
-	TEST_ABS_REL(bw_sinhf(80.f), sinhf(80.f), 1e-7f, 0.0007f);
+	TEST_ABS_REL(bw_sinhf(-80.f), sinhf(-80.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-70.f), sinhf(-70.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-60.f), sinhf(-60.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-50.f), sinhf(-50.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-40.f), sinhf(-40.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-30.f), sinhf(-30.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-20.f), sinhf(-20.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-10.f), sinhf(-10.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-9.f), sinhf(-9.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-8.f), sinhf(-8.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-7.f), sinhf(-7.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-6.f), sinhf(-6.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-5.f), sinhf(-5.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-4.f), sinhf(-4.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-3.f), sinhf(-3.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-2.f), sinhf(-2.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1.f), sinhf(-1.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1e-1f), sinhf(-1e-1f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1e-2f), sinhf(-1e-2f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1e-3f), sinhf(-1e-3f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1e-4f), sinhf(-1e-4f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1e-5f), sinhf(-1e-5f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1e-6f), sinhf(-1e-6f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1e-7f), sinhf(-1e-7f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1e-8f), sinhf(-1e-8f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-1e-9f), sinhf(-1e-9f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(-0.f), 0.f, TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(0.f), 0.f, TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1e-9f), sinhf(1e-9f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1e-8f), sinhf(1e-8f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1e-7f), sinhf(1e-7f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1e-6f), sinhf(1e-6f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1e-5f), sinhf(1e-5f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1e-4f), sinhf(1e-4f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1e-3f), sinhf(1e-3f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1e-2f), sinhf(1e-2f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1e-1f), sinhf(1e-1f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(1.f), sinhf(1.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(2.f), sinhf(2.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(3.f), sinhf(3.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(4.f), sinhf(4.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(5.f), sinhf(5.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(6.f), sinhf(6.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(7.f), sinhf(7.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(8.f), sinhf(8.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(9.f), sinhf(9.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(10.f), sinhf(10.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(20.f), sinhf(20.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(30.f), sinhf(30.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(40.f), sinhf(40.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(50.f), sinhf(50.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(60.f), sinhf(60.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(70.f), sinhf(70.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sinhf(80.f), sinhf(80.f), TOL_ABS_SINH(BW_MATH_PRECISION), TOL_REL_COSH(BW_MATH_PRECISION));
 	
-	TEST_REL(bw_coshf(-80.f), coshf(-80.f), 0.0007f);
-	TEST_REL(bw_coshf(-70.f), coshf(-70.f), 0.0007f);
-	TEST_REL(bw_coshf(-60.f), coshf(-60.f), 0.0007f);
-	TEST_REL(bw_coshf(-50.f), coshf(-50.f), 0.0007f);
-	TEST_REL(bw_coshf(-40.f), coshf(-40.f), 0.0007f);
-	TEST_REL(bw_coshf(-30.f), coshf(-30.f), 0.0007f);
-	TEST_REL(bw_coshf(-20.f), coshf(-20.f), 0.0007f);
-	TEST_REL(bw_coshf(-10.f), coshf(-10.f), 0.0007f);
-	TEST_REL(bw_coshf(-9.f), coshf(-9.f), 0.0007f);
-	TEST_REL(bw_coshf(-8.f), coshf(-8.f), 0.0007f);
-	TEST_REL(bw_coshf(-7.f), coshf(-7.f), 0.0007f);
-	TEST_REL(bw_coshf(-6.f), coshf(-6.f), 0.0007f);
-	TEST_REL(bw_coshf(-5.f), coshf(-5.f), 0.0007f);
-	TEST_REL(bw_coshf(-4.f), coshf(-4.f), 0.0007f);
-	TEST_REL(bw_coshf(-3.f), coshf(-3.f), 0.0007f);
-	TEST_REL(bw_coshf(-2.f), coshf(-2.f), 0.0007f);
-	TEST_REL(bw_coshf(-1.f), coshf(-1.f), 0.0007f);
-	TEST_REL(bw_coshf(-1e-1f), coshf(-1e-1f), 0.0007f);
-	TEST_REL(bw_coshf(-1e-2f), coshf(-1e-2f), 0.0007f);
-	TEST_REL(bw_coshf(-1e-3f), coshf(-1e-3f), 0.0007f);
-	TEST_REL(bw_coshf(-1e-4f), coshf(-1e-4f), 0.0007f);
-	TEST_REL(bw_coshf(-1e-5f), coshf(-1e-5f), 0.0007f);
-	TEST_REL(bw_coshf(-1e-6f), coshf(-1e-6f), 0.0007f);
-	TEST_REL(bw_coshf(-1e-7f), coshf(-1e-7f), 0.0007f);
-	TEST_REL(bw_coshf(-1e-8f), coshf(-1e-8f), 0.0007f);
-	TEST_REL(bw_coshf(-1e-9f), coshf(-1e-9f), 0.0007f);
-	TEST_REL(bw_coshf(-0.f), 1.f, 0.0007f);
-	TEST_REL(bw_coshf(0.f), 1.f, 0.0007f);
-	TEST_REL(bw_coshf(1e-9f), coshf(1e-9f), 0.0007f);
-	TEST_REL(bw_coshf(1e-8f), coshf(1e-8f), 0.0007f);
-	TEST_REL(bw_coshf(1e-7f), coshf(1e-7f), 0.0007f);
-	TEST_REL(bw_coshf(1e-6f), coshf(1e-6f), 0.0007f);
-	TEST_REL(bw_coshf(1e-5f), coshf(1e-5f), 0.0007f);
-	TEST_REL(bw_coshf(1e-4f), coshf(1e-4f), 0.0007f);
-	TEST_REL(bw_coshf(1e-3f), coshf(1e-3f), 0.0007f);
-	TEST_REL(bw_coshf(1e-2f), coshf(1e-2f), 0.0007f);
-	TEST_REL(bw_coshf(1e-1f), coshf(1e-1f), 0.0007f);
-	TEST_REL(bw_coshf(1.f), coshf(1.f), 0.0007f);
-	TEST_REL(bw_coshf(2.f), coshf(2.f), 0.0007f);
-	TEST_REL(bw_coshf(3.f), coshf(3.f), 0.0007f);
-	TEST_REL(bw_coshf(4.f), coshf(4.f), 0.0007f);
-	TEST_REL(bw_coshf(5.f), coshf(5.f), 0.0007f);
-	TEST_REL(bw_coshf(6.f), coshf(6.f), 0.0007f);
-	TEST_REL(bw_coshf(7.f), coshf(7.f), 0.0007f);
-	TEST_REL(bw_coshf(8.f), coshf(8.f), 0.0007f);
-	TEST_REL(bw_coshf(9.f), coshf(9.f), 0.0007f);
-	TEST_REL(bw_coshf(10.f), coshf(10.f), 0.0007f);
-	TEST_REL(bw_coshf(20.f), coshf(20.f), 0.0007f);
-	TEST_REL(bw_coshf(30.f), coshf(30.f), 0.0007f);
-	TEST_REL(bw_coshf(40.f), coshf(40.f), 0.0007f);
-	TEST_REL(bw_coshf(50.f), coshf(50.f), 0.0007f);
-	TEST_REL(bw_coshf(60.f), coshf(60.f), 0.0007f);
-	TEST_REL(bw_coshf(70.f), coshf(70.f), 0.0007f);
-	TEST_REL(bw_coshf(80.f), coshf(80.f), 0.0007f);
+	TEST_REL(bw_coshf(-80.f), coshf(-80.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-70.f), coshf(-70.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-60.f), coshf(-60.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-50.f), coshf(-50.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-40.f), coshf(-40.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-30.f), coshf(-30.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-20.f), coshf(-20.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-10.f), coshf(-10.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-9.f), coshf(-9.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-8.f), coshf(-8.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-7.f), coshf(-7.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-6.f), coshf(-6.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-5.f), coshf(-5.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-4.f), coshf(-4.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-3.f), coshf(-3.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-2.f), coshf(-2.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1.f), coshf(-1.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1e-1f), coshf(-1e-1f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1e-2f), coshf(-1e-2f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1e-3f), coshf(-1e-3f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1e-4f), coshf(-1e-4f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1e-5f), coshf(-1e-5f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1e-6f), coshf(-1e-6f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1e-7f), coshf(-1e-7f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1e-8f), coshf(-1e-8f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-1e-9f), coshf(-1e-9f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(-0.f), 1.f, TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(0.f), 1.f, TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1e-9f), coshf(1e-9f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1e-8f), coshf(1e-8f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1e-7f), coshf(1e-7f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1e-6f), coshf(1e-6f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1e-5f), coshf(1e-5f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1e-4f), coshf(1e-4f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1e-3f), coshf(1e-3f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1e-2f), coshf(1e-2f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1e-1f), coshf(1e-1f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(1.f), coshf(1.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(2.f), coshf(2.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(3.f), coshf(3.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(4.f), coshf(4.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(5.f), coshf(5.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(6.f), coshf(6.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(7.f), coshf(7.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(8.f), coshf(8.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(9.f), coshf(9.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(10.f), coshf(10.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(20.f), coshf(20.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(30.f), coshf(30.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(40.f), coshf(40.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(50.f), coshf(50.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(60.f), coshf(60.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(70.f), coshf(70.f), TOL_REL_COSH(BW_MATH_PRECISION));
+	TEST_REL(bw_coshf(80.f), coshf(80.f), TOL_REL_COSH(BW_MATH_PRECISION));
 
-	TEST_ABS_REL(bw_sechf(-1e37f), xsechf(-1e37f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e30f), xsechf(-1e30f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e20f), xsechf(-1e20f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e10f), xsechf(-1e10f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e5f), xsechf(-1e5f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-100.f), xsechf(-100.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-80.f), xsechf(-80.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-70.f), xsechf(-70.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-60.f), xsechf(-60.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-50.f), xsechf(-50.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-40.f), xsechf(-40.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-30.f), xsechf(-30.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-20.f), xsechf(-20.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-10.f), xsechf(-10.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-9.f), xsechf(-9.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-8.f), xsechf(-8.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-7.f), xsechf(-7.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-6.f), xsechf(-6.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-5.f), xsechf(-5.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-4.f), xsechf(-4.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-3.f), xsechf(-3.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-2.f), xsechf(-2.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1.f), xsechf(-1.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e-1f), xsechf(-1e-1f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e-2f), xsechf(-1e-2f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e-3f), xsechf(-1e-3f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e-4f), xsechf(-1e-4f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e-5f), xsechf(-1e-5f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e-6f), xsechf(-1e-6f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e-7f), xsechf(-1e-7f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e-8f), xsechf(-1e-8f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-1e-9f), xsechf(-1e-9f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(-0.f), xsechf(0.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(0.f), xsechf(0.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e-9f), xsechf(1e-9f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e-8f), xsechf(1e-8f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e-7f), xsechf(1e-7f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e-6f), xsechf(1e-6f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e-5f), xsechf(1e-5f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e-4f), xsechf(1e-4f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e-3f), xsechf(1e-3f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e-2f), xsechf(1e-2f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e-1f), xsechf(1e-1f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1.f), xsechf(1.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(2.f), xsechf(2.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(3.f), xsechf(3.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(4.f), xsechf(4.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(5.f), xsechf(5.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(6.f), xsechf(6.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(7.f), xsechf(7.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(8.f), xsechf(8.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(9.f), xsechf(9.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(10.f), xsechf(10.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(20.f), xsechf(20.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(30.f), xsechf(30.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(40.f), xsechf(40.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(50.f), xsechf(50.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(60.f), xsechf(60.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(70.f), xsechf(70.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(80.f), xsechf(80.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(100.f), xsechf(100.f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e5f), xsechf(1e5f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e10f), xsechf(1e10f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e20f), xsechf(1e20f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e30f), xsechf(1e30f), 1e-9f, 0.0007f);
-	TEST_ABS_REL(bw_sechf(1e37f), xsechf(1e37f), 1e-9f, 0.0007f);
+	TEST_ABS_REL(bw_sechf(-1e37f), xsechf(-1e37f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e30f), xsechf(-1e30f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e20f), xsechf(-1e20f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e10f), xsechf(-1e10f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e5f), xsechf(-1e5f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-100.f), xsechf(-100.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-80.f), xsechf(-80.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-70.f), xsechf(-70.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-60.f), xsechf(-60.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-50.f), xsechf(-50.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-40.f), xsechf(-40.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-30.f), xsechf(-30.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-20.f), xsechf(-20.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-10.f), xsechf(-10.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-9.f), xsechf(-9.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-8.f), xsechf(-8.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-7.f), xsechf(-7.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-6.f), xsechf(-6.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-5.f), xsechf(-5.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-4.f), xsechf(-4.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-3.f), xsechf(-3.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-2.f), xsechf(-2.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1.f), xsechf(-1.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e-1f), xsechf(-1e-1f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e-2f), xsechf(-1e-2f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e-3f), xsechf(-1e-3f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e-4f), xsechf(-1e-4f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e-5f), xsechf(-1e-5f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e-6f), xsechf(-1e-6f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e-7f), xsechf(-1e-7f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e-8f), xsechf(-1e-8f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-1e-9f), xsechf(-1e-9f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(-0.f), xsechf(0.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(0.f), xsechf(0.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e-9f), xsechf(1e-9f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e-8f), xsechf(1e-8f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e-7f), xsechf(1e-7f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e-6f), xsechf(1e-6f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e-5f), xsechf(1e-5f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e-4f), xsechf(1e-4f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e-3f), xsechf(1e-3f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e-2f), xsechf(1e-2f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e-1f), xsechf(1e-1f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1.f), xsechf(1.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(2.f), xsechf(2.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(3.f), xsechf(3.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(4.f), xsechf(4.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(5.f), xsechf(5.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(6.f), xsechf(6.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(7.f), xsechf(7.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(8.f), xsechf(8.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(9.f), xsechf(9.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(10.f), xsechf(10.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(20.f), xsechf(20.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(30.f), xsechf(30.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(40.f), xsechf(40.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(50.f), xsechf(50.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(60.f), xsechf(60.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(70.f), xsechf(70.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(80.f), xsechf(80.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(100.f), xsechf(100.f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e5f), xsechf(1e5f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e10f), xsechf(1e10f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e20f), xsechf(1e20f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e30f), xsechf(1e30f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_sechf(1e37f), xsechf(1e37f), TOL_ABS_SECH(BW_MATH_PRECISION), TOL_REL_SECH(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_asinhf(-1e37f), asinhf(-1e37f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e30f), asinhf(-1e30f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e20f), asinhf(-1e20f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e10f), asinhf(-1e10f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e5f), asinhf(-1e5f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-100.f), asinhf(-100.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-80.f), asinhf(-80.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-70.f), asinhf(-70.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-60.f), asinhf(-60.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-50.f), asinhf(-50.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-40.f), asinhf(-40.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-30.f), asinhf(-30.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-20.f), asinhf(-20.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-10.f), asinhf(-10.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-9.f), asinhf(-9.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-8.f), asinhf(-8.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-7.f), asinhf(-7.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-6.f), asinhf(-6.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-5.f), asinhf(-5.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-4.f), asinhf(-4.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-3.f), asinhf(-3.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-2.f), asinhf(-2.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1.f), asinhf(-1.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e-1f), asinhf(-1e-1f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e-2f), asinhf(-1e-2f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e-3f), asinhf(-1e-3f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e-4f), asinhf(-1e-4f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e-5f), asinhf(-1e-5f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e-6f), asinhf(-1e-6f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e-7f), asinhf(-1e-7f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e-8f), asinhf(-1e-8f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-1e-9f), asinhf(-1e-9f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(-0.f), 0.f, 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(0.f), 0.f, 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e-9f), asinhf(1e-9f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e-8f), asinhf(1e-8f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e-7f), asinhf(1e-7f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e-6f), asinhf(1e-6f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e-5f), asinhf(1e-5f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e-4f), asinhf(1e-4f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e-3f), asinhf(1e-3f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e-2f), asinhf(1e-2f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e-1f), asinhf(1e-1f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1.f), asinhf(1.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(2.f), asinhf(2.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(3.f), asinhf(3.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(4.f), asinhf(4.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(5.f), asinhf(5.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(6.f), asinhf(6.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(7.f), asinhf(7.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(8.f), asinhf(8.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(9.f), asinhf(9.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(10.f), asinhf(10.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(20.f), asinhf(20.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(30.f), asinhf(30.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(40.f), asinhf(40.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(50.f), asinhf(50.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(60.f), asinhf(60.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(70.f), asinhf(70.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(80.f), asinhf(80.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(100.f), asinhf(100.f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e5f), asinhf(1e5f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e10f), asinhf(1e10f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e20f), asinhf(1e20f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e30f), asinhf(1e30f), 0.004f, 0.012f);
-	TEST_ABS_REL(bw_asinhf(1e37f), asinhf(1e37f), 0.004f, 0.012f);
+	TEST_ABS_REL(bw_asinhf(-1e37f), asinhf(-1e37f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e30f), asinhf(-1e30f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e20f), asinhf(-1e20f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e10f), asinhf(-1e10f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e5f), asinhf(-1e5f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-100.f), asinhf(-100.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-80.f), asinhf(-80.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-70.f), asinhf(-70.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-60.f), asinhf(-60.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-50.f), asinhf(-50.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-40.f), asinhf(-40.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-30.f), asinhf(-30.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-20.f), asinhf(-20.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-10.f), asinhf(-10.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-9.f), asinhf(-9.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-8.f), asinhf(-8.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-7.f), asinhf(-7.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-6.f), asinhf(-6.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-5.f), asinhf(-5.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-4.f), asinhf(-4.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-3.f), asinhf(-3.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-2.f), asinhf(-2.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1.f), asinhf(-1.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e-1f), asinhf(-1e-1f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e-2f), asinhf(-1e-2f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e-3f), asinhf(-1e-3f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e-4f), asinhf(-1e-4f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e-5f), asinhf(-1e-5f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e-6f), asinhf(-1e-6f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e-7f), asinhf(-1e-7f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e-8f), asinhf(-1e-8f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-1e-9f), asinhf(-1e-9f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(-0.f), 0.f, TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(0.f), 0.f, TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e-9f), asinhf(1e-9f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e-8f), asinhf(1e-8f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e-7f), asinhf(1e-7f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e-6f), asinhf(1e-6f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e-5f), asinhf(1e-5f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e-4f), asinhf(1e-4f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e-3f), asinhf(1e-3f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e-2f), asinhf(1e-2f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e-1f), asinhf(1e-1f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1.f), asinhf(1.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(2.f), asinhf(2.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(3.f), asinhf(3.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(4.f), asinhf(4.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(5.f), asinhf(5.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(6.f), asinhf(6.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(7.f), asinhf(7.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(8.f), asinhf(8.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(9.f), asinhf(9.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(10.f), asinhf(10.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(20.f), asinhf(20.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(30.f), asinhf(30.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(40.f), asinhf(40.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(50.f), asinhf(50.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(60.f), asinhf(60.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(70.f), asinhf(70.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(80.f), asinhf(80.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(100.f), asinhf(100.f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e5f), asinhf(1e5f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e10f), asinhf(1e10f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e20f), asinhf(1e20f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e30f), asinhf(1e30f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_asinhf(1e37f), asinhf(1e37f), TOL_ABS_ASINH(BW_MATH_PRECISION), TOL_REL_ASINH(BW_MATH_PRECISION));
 	
-	TEST_ABS_REL(bw_acoshf(1.f), acoshf(1.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(2.f), acoshf(2.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(3.f), acoshf(3.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(4.f), acoshf(4.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(5.f), acoshf(5.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(6.f), acoshf(6.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(7.f), acoshf(7.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(8.f), acoshf(8.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(9.f), acoshf(9.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(10.f), acoshf(10.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(20.f), acoshf(20.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(30.f), acoshf(30.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(40.f), acoshf(40.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(50.f), acoshf(50.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(60.f), acoshf(60.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(70.f), acoshf(70.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(80.f), acoshf(80.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(100.f), acoshf(100.f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(1e5f), acoshf(1e5f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(1e10f), acoshf(1e10f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(1e20f), acoshf(1e20f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(1e30f), acoshf(1e30f), 0.004f, 0.008f);
-	TEST_ABS_REL(bw_acoshf(1e37f), acoshf(1e37f), 0.004f, 0.008f);
+	TEST_ABS_REL(bw_acoshf(1.f), acoshf(1.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(2.f), acoshf(2.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(3.f), acoshf(3.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(4.f), acoshf(4.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(5.f), acoshf(5.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(6.f), acoshf(6.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(7.f), acoshf(7.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(8.f), acoshf(8.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(9.f), acoshf(9.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(10.f), acoshf(10.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(20.f), acoshf(20.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(30.f), acoshf(30.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(40.f), acoshf(40.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(50.f), acoshf(50.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(60.f), acoshf(60.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(70.f), acoshf(70.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(80.f), acoshf(80.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(100.f), acoshf(100.f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(1e5f), acoshf(1e5f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(1e10f), acoshf(1e10f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(1e20f), acoshf(1e20f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(1e30f), acoshf(1e30f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+	TEST_ABS_REL(bw_acoshf(1e37f), acoshf(1e37f), TOL_ABS_ACOSH(BW_MATH_PRECISION), TOL_REL_ACOSH(BW_MATH_PRECISION));
+
+	TEST_ABS(bw_log2_1p2xf(-1e37f), log2_1p2xf(-1e37f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e30f), log2_1p2xf(-1e30f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e20f), log2_1p2xf(-1e20f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e10f), log2_1p2xf(-1e10f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e5f), log2_1p2xf(-1e5f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-100.f), log2_1p2xf(-100.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-80.f), log2_1p2xf(-80.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-70.f), log2_1p2xf(-70.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-60.f), log2_1p2xf(-60.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-50.f), log2_1p2xf(-50.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-40.f), log2_1p2xf(-40.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-30.f), log2_1p2xf(-30.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-20.f), log2_1p2xf(-20.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-10.f), log2_1p2xf(-10.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-9.f), log2_1p2xf(-9.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-8.f), log2_1p2xf(-8.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-7.f), log2_1p2xf(-7.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-6.f), log2_1p2xf(-6.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-5.f), log2_1p2xf(-5.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-4.f), log2_1p2xf(-4.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-3.f), log2_1p2xf(-3.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-2.f), log2_1p2xf(-2.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1.f), log2_1p2xf(-1.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e-1f), log2_1p2xf(-1e-1f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e-2f), log2_1p2xf(-1e-2f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e-3f), log2_1p2xf(-1e-3f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e-4f), log2_1p2xf(-1e-4f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e-5f), log2_1p2xf(-1e-5f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e-6f), log2_1p2xf(-1e-6f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e-7f), log2_1p2xf(-1e-7f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e-8f), log2_1p2xf(-1e-8f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-1e-9f), log2_1p2xf(-1e-9f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(-0.f), log2_1p2xf(-0.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(0.f), log2_1p2xf(0.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e-9f), log2_1p2xf(1e-9f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e-8f), log2_1p2xf(1e-8f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e-7f), log2_1p2xf(1e-7f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e-6f), log2_1p2xf(1e-6f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e-5f), log2_1p2xf(1e-5f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e-4f), log2_1p2xf(1e-4f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e-3f), log2_1p2xf(1e-3f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e-2f), log2_1p2xf(1e-2f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e-1f), log2_1p2xf(1e-1f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1.f), log2_1p2xf(1.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(2.f), log2_1p2xf(2.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(3.f), log2_1p2xf(3.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(4.f), log2_1p2xf(4.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(5.f), log2_1p2xf(5.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(6.f), log2_1p2xf(6.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(7.f), log2_1p2xf(7.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(8.f), log2_1p2xf(8.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(9.f), log2_1p2xf(9.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(10.f), log2_1p2xf(10.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(20.f), log2_1p2xf(20.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(30.f), log2_1p2xf(30.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(40.f), log2_1p2xf(40.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(50.f), log2_1p2xf(50.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(60.f), log2_1p2xf(60.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(70.f), log2_1p2xf(70.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(80.f), log2_1p2xf(80.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(100.f), log2_1p2xf(100.f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e5f), log2_1p2xf(1e5f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e10f), log2_1p2xf(1e10f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e20f), log2_1p2xf(1e20f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e30f), log2_1p2xf(1e30f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log2_1p2xf(1e37f), log2_1p2xf(1e37f), TOL_LOG2_1P2X(BW_MATH_PRECISION));
+
+	TEST_ABS(bw_log_1pexpxf(-1e37f), log_1pexpxf(-1e37f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e30f), log_1pexpxf(-1e30f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e20f), log_1pexpxf(-1e20f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e10f), log_1pexpxf(-1e10f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e5f), log_1pexpxf(-1e5f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-100.f), log_1pexpxf(-100.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-80.f), log_1pexpxf(-80.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-70.f), log_1pexpxf(-70.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-60.f), log_1pexpxf(-60.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-50.f), log_1pexpxf(-50.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-40.f), log_1pexpxf(-40.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-30.f), log_1pexpxf(-30.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-20.f), log_1pexpxf(-20.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-10.f), log_1pexpxf(-10.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-9.f), log_1pexpxf(-9.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-8.f), log_1pexpxf(-8.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-7.f), log_1pexpxf(-7.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-6.f), log_1pexpxf(-6.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-5.f), log_1pexpxf(-5.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-4.f), log_1pexpxf(-4.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-3.f), log_1pexpxf(-3.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-2.f), log_1pexpxf(-2.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1.f), log_1pexpxf(-1.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e-1f), log_1pexpxf(-1e-1f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e-2f), log_1pexpxf(-1e-2f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e-3f), log_1pexpxf(-1e-3f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e-4f), log_1pexpxf(-1e-4f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e-5f), log_1pexpxf(-1e-5f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e-6f), log_1pexpxf(-1e-6f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e-7f), log_1pexpxf(-1e-7f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e-8f), log_1pexpxf(-1e-8f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-1e-9f), log_1pexpxf(-1e-9f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(-0.f), log_1pexpxf(-0.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(0.f), log_1pexpxf(0.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e-9f), log_1pexpxf(1e-9f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e-8f), log_1pexpxf(1e-8f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e-7f), log_1pexpxf(1e-7f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e-6f), log_1pexpxf(1e-6f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e-5f), log_1pexpxf(1e-5f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e-4f), log_1pexpxf(1e-4f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e-3f), log_1pexpxf(1e-3f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e-2f), log_1pexpxf(1e-2f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e-1f), log_1pexpxf(1e-1f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1.f), log_1pexpxf(1.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(2.f), log_1pexpxf(2.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(3.f), log_1pexpxf(3.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(4.f), log_1pexpxf(4.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(5.f), log_1pexpxf(5.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(6.f), log_1pexpxf(6.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(7.f), log_1pexpxf(7.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(8.f), log_1pexpxf(8.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(9.f), log_1pexpxf(9.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(10.f), log_1pexpxf(10.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(20.f), log_1pexpxf(20.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(30.f), log_1pexpxf(30.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(40.f), log_1pexpxf(40.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(50.f), log_1pexpxf(50.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(60.f), log_1pexpxf(60.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(70.f), log_1pexpxf(70.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(80.f), log_1pexpxf(80.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(100.f), log_1pexpxf(100.f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e5f), log_1pexpxf(1e5f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e10f), log_1pexpxf(1e10f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e20f), log_1pexpxf(1e20f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e30f), log_1pexpxf(1e30f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
+	TEST_ABS(bw_log_1pexpxf(1e37f), log_1pexpxf(1e37f), TOL_LOG_1PEXPX(BW_MATH_PRECISION));
 
-	TEST_ABS(bw_log2_1p2xf(-1e37f), log2_1p2xf(-1e37f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e30f), log2_1p2xf(-1e30f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e20f), log2_1p2xf(-1e20f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e10f), log2_1p2xf(-1e10f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e5f), log2_1p2xf(-1e5f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-100.f), log2_1p2xf(-100.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-80.f), log2_1p2xf(-80.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-70.f), log2_1p2xf(-70.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-60.f), log2_1p2xf(-60.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-50.f), log2_1p2xf(-50.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-40.f), log2_1p2xf(-40.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-30.f), log2_1p2xf(-30.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-20.f), log2_1p2xf(-20.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-10.f), log2_1p2xf(-10.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-9.f), log2_1p2xf(-9.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-8.f), log2_1p2xf(-8.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-7.f), log2_1p2xf(-7.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-6.f), log2_1p2xf(-6.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-5.f), log2_1p2xf(-5.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-4.f), log2_1p2xf(-4.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-3.f), log2_1p2xf(-3.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-2.f), log2_1p2xf(-2.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1.f), log2_1p2xf(-1.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e-1f), log2_1p2xf(-1e-1f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e-2f), log2_1p2xf(-1e-2f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e-3f), log2_1p2xf(-1e-3f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e-4f), log2_1p2xf(-1e-4f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e-5f), log2_1p2xf(-1e-5f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e-6f), log2_1p2xf(-1e-6f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e-7f), log2_1p2xf(-1e-7f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e-8f), log2_1p2xf(-1e-8f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-1e-9f), log2_1p2xf(-1e-9f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(-0.f), log2_1p2xf(-0.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(0.f), log2_1p2xf(0.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e-9f), log2_1p2xf(1e-9f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e-8f), log2_1p2xf(1e-8f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e-7f), log2_1p2xf(1e-7f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e-6f), log2_1p2xf(1e-6f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e-5f), log2_1p2xf(1e-5f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e-4f), log2_1p2xf(1e-4f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e-3f), log2_1p2xf(1e-3f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e-2f), log2_1p2xf(1e-2f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e-1f), log2_1p2xf(1e-1f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1.f), log2_1p2xf(1.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(2.f), log2_1p2xf(2.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(3.f), log2_1p2xf(3.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(4.f), log2_1p2xf(4.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(5.f), log2_1p2xf(5.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(6.f), log2_1p2xf(6.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(7.f), log2_1p2xf(7.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(8.f), log2_1p2xf(8.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(9.f), log2_1p2xf(9.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(10.f), log2_1p2xf(10.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(20.f), log2_1p2xf(20.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(30.f), log2_1p2xf(30.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(40.f), log2_1p2xf(40.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(50.f), log2_1p2xf(50.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(60.f), log2_1p2xf(60.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(70.f), log2_1p2xf(70.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(80.f), log2_1p2xf(80.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(100.f), log2_1p2xf(100.f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e5f), log2_1p2xf(1e5f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e10f), log2_1p2xf(1e10f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e20f), log2_1p2xf(1e20f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e30f), log2_1p2xf(1e30f), 0.006f);
-	TEST_ABS(bw_log2_1p2xf(1e37f), log2_1p2xf(1e37f), 0.006f);
+	TEST_ABS(bw_log10_1p10xf(-1e37f), log10_1p10xf(-1e37f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e30f), log10_1p10xf(-1e30f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e20f), log10_1p10xf(-1e20f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e10f), log10_1p10xf(-1e10f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e5f), log10_1p10xf(-1e5f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-100.f), log10_1p10xf(-100.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-80.f), log10_1p10xf(-80.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-70.f), log10_1p10xf(-70.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-60.f), log10_1p10xf(-60.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-50.f), log10_1p10xf(-50.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-40.f), log10_1p10xf(-40.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-30.f), log10_1p10xf(-30.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-20.f), log10_1p10xf(-20.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-10.f), log10_1p10xf(-10.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-9.f), log10_1p10xf(-9.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-8.f), log10_1p10xf(-8.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-7.f), log10_1p10xf(-7.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-6.f), log10_1p10xf(-6.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-5.f), log10_1p10xf(-5.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-4.f), log10_1p10xf(-4.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-3.f), log10_1p10xf(-3.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-2.f), log10_1p10xf(-2.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1.f), log10_1p10xf(-1.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e-1f), log10_1p10xf(-1e-1f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e-2f), log10_1p10xf(-1e-2f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e-3f), log10_1p10xf(-1e-3f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e-4f), log10_1p10xf(-1e-4f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e-5f), log10_1p10xf(-1e-5f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e-6f), log10_1p10xf(-1e-6f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e-7f), log10_1p10xf(-1e-7f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e-8f), log10_1p10xf(-1e-8f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-1e-9f), log10_1p10xf(-1e-9f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(-0.f), log10_1p10xf(-0.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(0.f), log10_1p10xf(0.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e-9f), log10_1p10xf(1e-9f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e-8f), log10_1p10xf(1e-8f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e-7f), log10_1p10xf(1e-7f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e-6f), log10_1p10xf(1e-6f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e-5f), log10_1p10xf(1e-5f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e-4f), log10_1p10xf(1e-4f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e-3f), log10_1p10xf(1e-3f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e-2f), log10_1p10xf(1e-2f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e-1f), log10_1p10xf(1e-1f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1.f), log10_1p10xf(1.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(2.f), log10_1p10xf(2.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(3.f), log10_1p10xf(3.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(4.f), log10_1p10xf(4.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(5.f), log10_1p10xf(5.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(6.f), log10_1p10xf(6.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(7.f), log10_1p10xf(7.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(8.f), log10_1p10xf(8.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(9.f), log10_1p10xf(9.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(10.f), log10_1p10xf(10.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(20.f), log10_1p10xf(20.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(30.f), log10_1p10xf(30.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(40.f), log10_1p10xf(40.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(50.f), log10_1p10xf(50.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(60.f), log10_1p10xf(60.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(70.f), log10_1p10xf(70.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(80.f), log10_1p10xf(80.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(100.f), log10_1p10xf(100.f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e5f), log10_1p10xf(1e5f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e10f), log10_1p10xf(1e10f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e20f), log10_1p10xf(1e20f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e30f), log10_1p10xf(1e30f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
+	TEST_ABS(bw_log10_1p10xf(1e37f), log10_1p10xf(1e37f), TOL_LOG10_1P10X(BW_MATH_PRECISION));
 
-	TEST_ABS(bw_log_1pexpxf(-1e37f), log_1pexpxf(-1e37f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e30f), log_1pexpxf(-1e30f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e20f), log_1pexpxf(-1e20f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e10f), log_1pexpxf(-1e10f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e5f), log_1pexpxf(-1e5f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-100.f), log_1pexpxf(-100.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-80.f), log_1pexpxf(-80.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-70.f), log_1pexpxf(-70.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-60.f), log_1pexpxf(-60.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-50.f), log_1pexpxf(-50.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-40.f), log_1pexpxf(-40.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-30.f), log_1pexpxf(-30.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-20.f), log_1pexpxf(-20.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-10.f), log_1pexpxf(-10.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-9.f), log_1pexpxf(-9.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-8.f), log_1pexpxf(-8.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-7.f), log_1pexpxf(-7.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-6.f), log_1pexpxf(-6.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-5.f), log_1pexpxf(-5.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-4.f), log_1pexpxf(-4.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-3.f), log_1pexpxf(-3.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-2.f), log_1pexpxf(-2.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1.f), log_1pexpxf(-1.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e-1f), log_1pexpxf(-1e-1f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e-2f), log_1pexpxf(-1e-2f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e-3f), log_1pexpxf(-1e-3f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e-4f), log_1pexpxf(-1e-4f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e-5f), log_1pexpxf(-1e-5f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e-6f), log_1pexpxf(-1e-6f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e-7f), log_1pexpxf(-1e-7f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e-8f), log_1pexpxf(-1e-8f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-1e-9f), log_1pexpxf(-1e-9f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(-0.f), log_1pexpxf(-0.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(0.f), log_1pexpxf(0.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e-9f), log_1pexpxf(1e-9f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e-8f), log_1pexpxf(1e-8f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e-7f), log_1pexpxf(1e-7f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e-6f), log_1pexpxf(1e-6f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e-5f), log_1pexpxf(1e-5f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e-4f), log_1pexpxf(1e-4f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e-3f), log_1pexpxf(1e-3f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e-2f), log_1pexpxf(1e-2f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e-1f), log_1pexpxf(1e-1f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1.f), log_1pexpxf(1.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(2.f), log_1pexpxf(2.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(3.f), log_1pexpxf(3.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(4.f), log_1pexpxf(4.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(5.f), log_1pexpxf(5.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(6.f), log_1pexpxf(6.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(7.f), log_1pexpxf(7.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(8.f), log_1pexpxf(8.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(9.f), log_1pexpxf(9.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(10.f), log_1pexpxf(10.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(20.f), log_1pexpxf(20.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(30.f), log_1pexpxf(30.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(40.f), log_1pexpxf(40.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(50.f), log_1pexpxf(50.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(60.f), log_1pexpxf(60.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(70.f), log_1pexpxf(70.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(80.f), log_1pexpxf(80.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(100.f), log_1pexpxf(100.f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e5f), log_1pexpxf(1e5f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e10f), log_1pexpxf(1e10f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e20f), log_1pexpxf(1e20f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e30f), log_1pexpxf(1e30f), 0.004f);
-	TEST_ABS(bw_log_1pexpxf(1e37f), log_1pexpxf(1e37f), 0.004f);
+	TEST_BUF(bw_rcpf, -1.237940039e27f, -1e3f, -1.f, -1e-3f, -8.077935669e-28f, 8.077935669e-28f, 1e-3f, 0.5f, 1.f, 3.f, 1e3f, 1.237940039e27f);
+	TEST_BUF(bw_sin2pif, -1e30f, -8388609.f, -1000.3f, -1.f, -0.75f, -0.5f, -0.25f, -0.1f, -1e-30f, -0.f, 0.f, 1e-30f, 0.1f, 0.25f, 0.5f, 0.75f, 1.f, 1.3f, 1000.3f, 8388609.f, 1e30f);
+	TEST_BUF(bw_sinf, -1000.f, -3.14f, -1.f, -0.f, 0.f, 0.5f, 1.f, 1.5707963f, 3.14f, 1000.f);
+	TEST_BUF(bw_cos2pif, -1e30f, -1000.3f, -1.f, -0.75f, -0.5f, -0.25f, -0.1f, 0.f, 0.1f, 0.25f, 0.5f, 0.75f, 1.f, 1000.3f, 1e30f);
+	TEST_BUF(bw_cosf, -1000.f, -3.14f, -1.f, 0.f, 0.5f, 1.f, 1.5707963f, 3.14f, 1000.f);
+	TEST_BUF(bw_tan2pif, -100.1f, -0.2f, -0.1f, -0.f, 0.f, 0.1f, 0.2f, 0.3f, 0.6f, 100.1f);
+	TEST_BUF(bw_tanf, -100.f, -1.5f, -1.f, -0.f, 0.f, 0.5f, 1.f, 1.5f, 2.f, 100.f);
+	TEST_BUF(bw_log2f, 1.175494350822287e-38f, 1e-30f, 1e-3f, 0.5f, 1.f, 2.f, 3.f, 1e3f, 1e30f, 3e38f);
+	TEST_BUF(bw_logf, 1.175494350822287e-38f, 1e-30f, 1e-3f, 0.5f, 1.f, 2.718281828459045f, 1e3f, 3e38f);
+	TEST_BUF(bw_log10f, 1.175494350822287e-38f, 1e-30f, 1e-3f, 0.5f, 1.f, 10.f, 1e3f, 3e38f);
+	TEST_BUF(bw_pow2f, -INFINITY, -1e30f, -127.f, -126.5f, -126.f, -125.5f, -10.3f, -1.f, -0.5f, -0.f, 0.f, 0.5f, 1.f, 10.3f, 127.f, 127.999f);
+	TEST_BUF(bw_expf, -INFINITY, -1e30f, -100.f, -87.3365447505531f, -10.3f, -1.f, 0.f, 1.f, 10.3f, 88.722f);
+	TEST_BUF(bw_pow10f, -INFINITY, -1e30f, -40.f, -37.92977945366162f, -10.3f, -1.f, 0.f, 1.f, 10.3f, 38.531f);
+	TEST_BUF(bw_dB2linf, -INFINITY, -1e30f, -800.f, -758.5955890732315f, -60.f, -6.f, 0.f, 6.f, 60.f, 770.630f);
+	TEST_BUF(bw_lin2dBf, 1.175494350822287e-38f, 1e-30f, 1e-3f, 0.5f, 1.f, 2.f, 1e3f, 3e38f);
+	TEST_BUF(bw_sqrtf, 0.f, 1e-40f, 1.175494350822287e-38f, 1e-28f, 5e-20f, 1e-3f, 0.5f, 1.f, 2.f, 1e3f, 1e20f, 1e30f, 3.4e38f);
+	TEST_BUF(bw_tanhf, -INFINITY, -1e30f, -10.f, -2.115287308554551f, -1.f, -0.1f, -0.f, 0.f, 0.1f, 1.f, 2.115287308554551f, 10.f, 1e30f, INFINITY);
 
-	TEST_ABS(bw_log10_1p10xf(-1e37f), log10_1p10xf(-1e37f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e30f), log10_1p10xf(-1e30f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e20f), log10_1p10xf(-1e20f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e10f), log10_1p10xf(-1e10f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e5f), log10_1p10xf(-1e5f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-100.f), log10_1p10xf(-100.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-80.f), log10_1p10xf(-80.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-70.f), log10_1p10xf(-70.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-60.f), log10_1p10xf(-60.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-50.f), log10_1p10xf(-50.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-40.f), log10_1p10xf(-40.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-30.f), log10_1p10xf(-30.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-20.f), log10_1p10xf(-20.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-10.f), log10_1p10xf(-10.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-9.f), log10_1p10xf(-9.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-8.f), log10_1p10xf(-8.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-7.f), log10_1p10xf(-7.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-6.f), log10_1p10xf(-6.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-5.f), log10_1p10xf(-5.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-4.f), log10_1p10xf(-4.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-3.f), log10_1p10xf(-3.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-2.f), log10_1p10xf(-2.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1.f), log10_1p10xf(-1.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e-1f), log10_1p10xf(-1e-1f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e-2f), log10_1p10xf(-1e-2f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e-3f), log10_1p10xf(-1e-3f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e-4f), log10_1p10xf(-1e-4f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e-5f), log10_1p10xf(-1e-5f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e-6f), log10_1p10xf(-1e-6f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e-7f), log10_1p10xf(-1e-7f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e-8f), log10_1p10xf(-1e-8f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-1e-9f), log10_1p10xf(-1e-9f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(-0.f), log10_1p10xf(-0.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(0.f), log10_1p10xf(0.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e-9f), log10_1p10xf(1e-9f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e-8f), log10_1p10xf(1e-8f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e-7f), log10_1p10xf(1e-7f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e-6f), log10_1p10xf(1e-6f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e-5f), log10_1p10xf(1e-5f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e-4f), log10_1p10xf(1e-4f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e-3f), log10_1p10xf(1e-3f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e-2f), log10_1p10xf(1e-2f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e-1f), log10_1p10xf(1e-1f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1.f), log10_1p10xf(1.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(2.f), log10_1p10xf(2.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(3.f), log10_1p10xf(3.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(4.f), log10_1p10xf(4.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(5.f), log10_1p10xf(5.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(6.f), log10_1p10xf(6.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(7.f), log10_1p10xf(7.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(8.f), log10_1p10xf(8.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(9.f), log10_1p10xf(9.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(10.f), log10_1p10xf(10.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(20.f), log10_1p10xf(20.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(30.f), log10_1p10xf(30.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(40.f), log10_1p10xf(40.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(50.f), log10_1p10xf(50.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(60.f), log10_1p10xf(60.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(70.f), log10_1p10xf(70.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(80.f), log10_1p10xf(80.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(100.f), log10_1p10xf(100.f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e5f), log10_1p10xf(1e5f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e10f), log10_1p10xf(1e10f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e20f), log10_1p10xf(1e20f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e30f), log10_1p10xf(1e30f), 0.002f);
-	TEST_ABS(bw_log10_1p10xf(1e37f), log10_1p10xf(1e37f), 0.002f);
+	TEST_CTRL(bw_rcpf, rcpf, 0.f, TOL_RCP(BW_MATH_PRECISION_CTRL), -1.237940039e27f, -1.f, -8.077935669e-28f, 8.077935669e-28f, 1e-3f, 1.f, 3.f, 1.237940039e27f);
+	TEST_CTRL(bw_tanf, tanf, TOL_ABS_TAN(BW_MATH_PRECISION_CTRL), TOL_REL_TAN(BW_MATH_PRECISION_CTRL), -1.5f, -1.f, 0.f, 0.5f, 1.f, 1.5f, 100.f);
+	TEST_CTRL(bw_log2f, log2f, TOL_ABS_LOG2(BW_MATH_PRECISION_CTRL), TOL_REL_LOG(BW_MATH_PRECISION_CTRL), 1.175494350822287e-38f, 1e-3f, 0.5f, 1.f, 3.f, 1e30f);
+	TEST_CTRL(bw_pow2f, pow2f, 0.f, TOL_POW2(BW_MATH_PRECISION_CTRL), -INFINITY, -126.5f, -10.3f, -0.5f, 0.f, 0.5f, 10.3f, 127.999f);
+	TEST_CTRL(bw_dB2linf, dB2linf, 0.f, TOL_EXP(BW_MATH_PRECISION_CTRL), -INFINITY, -800.f, -60.f, -6.f, 0.f, 6.f, 60.f, 770.630f);
+	TEST_CTRL(bw_sqrtf, sqrtf, TOL_ABS_SQRT(BW_MATH_PRECISION_CTRL), TOL_REL_SQRT(BW_MATH_PRECISION_CTRL), 0.f, 1e-40f, 1.175494350822287e-38f, 1e-3f, 0.5f, 2.f, 1e20f, 3.4e38f);
 
 	printf("\nsuceeded: %d, failed: %d\n\n", n_ok, n_ko);
 	
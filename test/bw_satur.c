@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include <bw_satur.h>
+
+#include <math.h>
+
+int n_ok = 0;
+int n_ko = 0;
+
+// peak output of a 0.37 rad/sample sine driven into the given process1 variant must stay within the curve's [-1, 1] range
+#define TEST_PEAK(process1, amp) \
+{ \
+	bw_satur_coeffs coeffs; \
+	bw_satur_state state; \
+	bw_satur_init(&coeffs); \
+	bw_satur_set_sample_rate(&coeffs, 48000.f); \
+	bw_satur_reset_coeffs(&coeffs); \
+	bw_satur_reset_state(&coeffs, &state, 0.f); \
+	const float a = amp; \
+	float peak = 0.f; \
+	bw_satur_update_coeffs_ctrl(&coeffs); \
+	for (int n = 0; n < 100000; n++) { \
+		bw_satur_update_coeffs_audio(&coeffs); \
+		const float y = fabsf(process1(&coeffs, &state, a * sinf(0.37f * n))); \
+		peak = y > peak ? y : peak; \
+	} \
+	if (peak <= 1.f) { \
+		printf("✔ peak %s(%g * sin(0.37 n)) = %.7f\n", #process1, a, peak); \
+		n_ok++; \
+	} else { \
+		printf("✘ peak %s(%g * sin(0.37 n)) = %.7f (expected <= 1) - line %d\n", #process1, a, peak, __LINE__); \
+		n_ko++; \
+	} \
+}
+
+int main() {
+	printf("\nbw_satur unit tests\n");
+	printf("-------------------\n\n");
+
+	const float amps[] = { 1.f, 10.f, 100.f, 1e3f, 1e4f, 1e5f };
+	for (size_t i = 0; i < sizeof(amps) / sizeof(amps[0]); i++)
+		TEST_PEAK(bw_satur_process1_aa2, amps[i]);
+
+	printf("\nsuceeded: %d, failed: %d\n\n", n_ok, n_ko);
+	
+	return n_ko ? EXIT_FAILURE : EXIT_SUCCESS;
+}